@@ -23,6 +23,7 @@
 #include <vsip/signal.hpp>
 
 #include <vsip/opt/diag/eval.hpp>
+#include <vsip/opt/signal/conv_fft.hpp>
 
 #include <vsip_csl/test.hpp>
 #include "loop.hpp"
@@ -35,8 +36,81 @@ using namespace vsip;
   Definitions
 ***********************************************************************/
 
+// ImplTag selects the implementation:
+//   Impl_auto   - Convolution, choosing the direct or FFT algorithm,
+//   Impl_direct - Convolution with the alg_noise hint, always direct,
+//   Impl_fft    - the FFT overlap-save implementation.
+
+struct Impl_auto;
+struct Impl_direct;
+struct Impl_fft;
+
+template <typename            ImplTag,
+	  support_region_type Supp,
+	  typename            T>
+struct Conv1_runner
+{
+  template <typename Block>
+  static float
+  run(const_Vector<T, Block> coeff, Vector<T> in, Vector<T> out,
+      length_type dec, length_type loop)
+  {
+    alg_hint_type const hint =
+      impl::Type_equal<ImplTag, Impl_direct>::value ? alg_noise : alg_time;
+    typedef Convolution<const_Vector, nonsym, Supp, T, 0, hint> conv_type;
+
+    conv_type conv(coeff, Domain<1>(in.size()), dec);
+
+    vsip::impl::profile::Timer t1;
+    
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      conv(in, out);
+    t1.stop();
+    
+    return t1.delta();
+  }
+};
+
 template <support_region_type Supp,
 	  typename            T>
+struct Conv1_runner<Impl_fft, Supp, T>
+{
+  template <typename Block>
+  static float
+  run(const_Vector<T, Block> coeff, Vector<T> in, Vector<T> out,
+      length_type dec, length_type loop)
+  {
+    typedef impl::Layout<1, row1_type, impl::Stride_unit,
+                         impl::Cmplx_inter_fmt> layout_type;
+
+    Domain<1> kernel_size(coeff.size());
+    impl::Conv_fft<1, T> conv(kernel_size, Domain<1>(in.size()),
+			      Domain<1>(out.size()),
+			      impl::conv_fft_offset(Supp, kernel_size), dec);
+    conv.set_kernel(coeff);
+
+    impl::Ext_data<typename Vector<T>::block_type, layout_type>
+      in_ext(in.block(), impl::SYNC_IN);
+    impl::Ext_data<typename Vector<T>::block_type, layout_type>
+      out_ext(out.block(), impl::SYNC_OUT);
+
+    vsip::impl::profile::Timer t1;
+    
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      conv(in_ext.data(), 1, out_ext.data(), 1);
+    t1.stop();
+    
+    return t1.delta();
+  }
+};
+
+
+
+template <support_region_type Supp,
+	  typename            T,
+	  typename            ImplTag = Impl_auto>
 struct t_conv1 : Benchmark_base
 {
   static length_type const Dec = 1;
@@ -81,20 +155,7 @@ struct t_conv1 : Benchmark_base
     coeff(0) = T(1);
     coeff(1) = T(2);
 
-    symmetry_type const       symmetry = nonsym;
-
-    typedef Convolution<const_Vector, symmetry, Supp, T> conv_type;
-
-    conv_type conv(coeff, Domain<1>(size), Dec);
-
-    vsip::impl::profile::Timer t1;
-    
-    t1.start();
-    for (index_type l=0; l<loop; ++l)
-      conv(in, out);
-    t1.stop();
-    
-    time = t1.delta();
+    time = Conv1_runner<ImplTag, Supp, T>::run(coeff, in, out, Dec, loop);
   }
 
   t_conv1(length_type coeff_size) : coeff_size_(coeff_size) {}
@@ -137,6 +198,32 @@ test(Loop1P& loop, int what)
   case  5: loop(t_conv1<support_same, cf_type>(loop.user_param_)); break;
   case  6: loop(t_conv1<support_min,  cf_type>(loop.user_param_)); break;
 
+  case 11: loop(t_conv1<support_full, float, Impl_direct>(loop.user_param_)); break;
+  case 12: loop(t_conv1<support_same, float, Impl_direct>(loop.user_param_)); break;
+  case 13: loop(t_conv1<support_min,  float, Impl_direct>(loop.user_param_)); break;
+
+  case 14: loop(t_conv1<support_full, cf_type, Impl_direct>(loop.user_param_)); break;
+  case 15: loop(t_conv1<support_same, cf_type, Impl_direct>(loop.user_param_)); break;
+  case 16: loop(t_conv1<support_min,  cf_type, Impl_direct>(loop.user_param_)); break;
+
+  case 21: loop(t_conv1<support_full, float, Impl_fft>(loop.user_param_)); break;
+  case 22: loop(t_conv1<support_same, float, Impl_fft>(loop.user_param_)); break;
+  case 23: loop(t_conv1<support_min,  float, Impl_fft>(loop.user_param_)); break;
+
+  case 24: loop(t_conv1<support_full, cf_type, Impl_fft>(loop.user_param_)); break;
+  case 25: loop(t_conv1<support_same, cf_type, Impl_fft>(loop.user_param_)); break;
+  case 26: loop(t_conv1<support_min,  cf_type, Impl_fft>(loop.user_param_)); break;
+
+  case 0:
+    std::cout
+      << "conv -- 1D convolution\n"
+      << " Sweep input size, kernel size given by -param (default 16)\n"
+      << "   -1 ..  -3 -- float,          full/same/min support\n"
+      << "   -4 ..  -6 -- complex<float>, full/same/min support\n"
+      << "  -11 .. -16 -- same, direct algorithm\n"
+      << "  -21 .. -26 -- same, FFT overlap-save algorithm\n"
+      ;
+
   default: return 0;
   }
   return 1;
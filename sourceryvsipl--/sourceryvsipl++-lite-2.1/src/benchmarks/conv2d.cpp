@@ -23,6 +23,7 @@
 #include <vsip/signal.hpp>
 
 #include <vsip/opt/diag/eval.hpp>
+#include <vsip/opt/signal/conv_fft.hpp>
 
 #include <vsip_csl/test.hpp>
 #include "loop.hpp"
@@ -35,8 +36,80 @@ using namespace vsip;
   Definitions
 ***********************************************************************/
 
+// ImplTag selects the implementation:
+//   Impl_auto   - Convolution, choosing the direct or FFT algorithm,
+//   Impl_direct - Convolution with the alg_noise hint, always direct,
+//   Impl_fft    - the FFT overlap-save implementation.
+
+struct Impl_auto;
+struct Impl_direct;
+struct Impl_fft;
+
+template <typename            ImplTag,
+	  support_region_type Supp,
+	  typename            T>
+struct Conv2d_runner
+{
+  static float
+  run(Matrix<T> coeff, Matrix<T> in, Matrix<T> out,
+      length_type dec, length_type loop)
+  {
+    alg_hint_type const hint =
+      impl::Type_equal<ImplTag, Impl_direct>::value ? alg_noise : alg_time;
+    typedef Convolution<const_Matrix, nonsym, Supp, T, 0, hint> conv_type;
+
+    conv_type conv(coeff, Domain<2>(in.size(0), in.size(1)), dec);
+
+    vsip::impl::profile::Timer t1;
+    
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      conv(in, out);
+    t1.stop();
+    
+    return t1.delta();
+  }
+};
+
 template <support_region_type Supp,
 	  typename            T>
+struct Conv2d_runner<Impl_fft, Supp, T>
+{
+  static float
+  run(Matrix<T> coeff, Matrix<T> in, Matrix<T> out,
+      length_type dec, length_type loop)
+  {
+    typedef impl::Layout<2, row2_type, impl::Stride_unit_dense,
+                         impl::Cmplx_inter_fmt> layout_type;
+
+    Domain<2> kernel_size(coeff.size(0), coeff.size(1));
+    impl::Conv_fft<2, T> conv(kernel_size, Domain<2>(in.size(0), in.size(1)),
+			      Domain<2>(out.size(0), out.size(1)),
+			      impl::conv_fft_offset(Supp, kernel_size), dec);
+    conv.set_kernel(coeff);
+
+    impl::Ext_data<typename Matrix<T>::block_type, layout_type>
+      in_ext(in.block(), impl::SYNC_IN);
+    impl::Ext_data<typename Matrix<T>::block_type, layout_type>
+      out_ext(out.block(), impl::SYNC_OUT);
+
+    vsip::impl::profile::Timer t1;
+    
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      conv(in_ext.data(),  in.size(1),  1,
+	   out_ext.data(), out.size(1), 1);
+    t1.stop();
+    
+    return t1.delta();
+  }
+};
+
+
+
+template <support_region_type Supp,
+	  typename            T,
+	  typename            ImplTag = Impl_auto>
 struct t_conv2d : Benchmark_base
 {
   static length_type const rdec = 1;
@@ -93,20 +166,7 @@ struct t_conv2d : Benchmark_base
 
     coeff = T(1);
 
-    symmetry_type const       symmetry = nonsym;
-
-    typedef Convolution<const_Matrix, symmetry, Supp, T> conv_type;
-
-    conv_type conv(coeff, Domain<2>(rows_, cols), rdec);
-
-    vsip::impl::profile::Timer t1;
-    
-    t1.start();
-    for (index_type l=0; l<loop; ++l)
-      conv(in, out);
-    t1.stop();
-    
-    time = t1.delta();
+    time = Conv2d_runner<ImplTag, Supp, T>::run(coeff, in, out, rdec, loop);
   }
 
   t_conv2d(length_type rows, length_type m, length_type n)
@@ -161,9 +221,41 @@ test(Loop1P& loop, int what)
   case  2: loop(t_conv2d<support_same, float>(rows, M, N)); break;
   case  3: loop(t_conv2d<support_min, float> (rows, M, N)); break;
 
-  // case  4: loop(t_conv1<support_full, cf_type>(loop.user_param_)); break;
-  // case  5: loop(t_conv1<support_same, cf_type>(loop.user_param_)); break;
-  // case  6: loop(t_conv1<support_min,  cf_type>(loop.user_param_)); break;
+  case  4: loop(t_conv2d<support_full, cf_type>(rows, M, N)); break;
+  case  5: loop(t_conv2d<support_same, cf_type>(rows, M, N)); break;
+  case  6: loop(t_conv2d<support_min,  cf_type>(rows, M, N)); break;
+
+  case 11: loop(t_conv2d<support_full, float, Impl_direct>(rows, M, N)); break;
+  case 12: loop(t_conv2d<support_same, float, Impl_direct>(rows, M, N)); break;
+  case 13: loop(t_conv2d<support_min,  float, Impl_direct>(rows, M, N)); break;
+
+  case 14: loop(t_conv2d<support_full, cf_type, Impl_direct>(rows, M, N)); break;
+  case 15: loop(t_conv2d<support_same, cf_type, Impl_direct>(rows, M, N)); break;
+  case 16: loop(t_conv2d<support_min,  cf_type, Impl_direct>(rows, M, N)); break;
+
+  case 21: loop(t_conv2d<support_full, float, Impl_fft>(rows, M, N)); break;
+  case 22: loop(t_conv2d<support_same, float, Impl_fft>(rows, M, N)); break;
+  case 23: loop(t_conv2d<support_min,  float, Impl_fft>(rows, M, N)); break;
+
+  case 24: loop(t_conv2d<support_full, cf_type, Impl_fft>(rows, M, N)); break;
+  case 25: loop(t_conv2d<support_same, cf_type, Impl_fft>(rows, M, N)); break;
+  case 26: loop(t_conv2d<support_min,  cf_type, Impl_fft>(rows, M, N)); break;
+
+  case 0:
+    std::cout
+      << "conv2d -- 2D convolution\n"
+      << " Sweep number of columns\n"
+      << "   -1 ..  -3 -- float,          full/same/min support\n"
+      << "   -4 ..  -6 -- complex<float>, full/same/min support\n"
+      << "  -11 .. -16 -- same, direct algorithm\n"
+      << "  -21 .. -26 -- same, FFT overlap-save algorithm\n"
+      << "\n"
+      << "Parameters\n"
+      << "  -p:rows <n>  Number of rows (default 16)\n"
+      << "  -p:m <m>     Kernel rows (default 3)\n"
+      << "  -p:n <n>     Kernel columns (default 3)\n"
+      << "  -p:mn <n>    Kernel rows and columns\n"
+      ;
 
   default: return 0;
   }
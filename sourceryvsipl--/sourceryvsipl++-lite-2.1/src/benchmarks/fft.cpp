@@ -22,6 +22,9 @@
 #include <vsip/math.hpp>
 #include <vsip/signal.hpp>
 #include <vsip/opt/diag/fft.hpp>
+#if defined(VSIP_IMPL_FFTW3)
+#  include <vsip/opt/fftw3/wisdom.hpp>
+#endif
 
 #include "benchmarks.hpp"
 
@@ -194,6 +197,52 @@ struct t_fft_bv : Benchmark_base
 
 
 
+/***********************************************************************
+  Fft, setup
+***********************************************************************/
+
+// Time the construction of an Fft object.  A cold setup starts
+// without FFTW wisdom, as at the first run of a program.  A warm setup
+// finds the plan in the wisdom store, as after --svpp-fftw-wisdom has
+// loaded it.
+
+template <typename T,
+	  int      no_times,
+	  bool     cold>
+struct t_fft_setup : Benchmark_base
+{
+  char const* what() { return "t_fft_setup"; }
+  float ops_per_point(length_type len)  { return fft_ops(len); }
+  int riob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int wiob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int mem_per_point(length_type)  { return 1*sizeof(T); }
+
+  void operator()(length_type size, length_type loop, float& time)
+  {
+    typedef Fft<const_Vector, T, T, fft_fwd, by_reference, no_times, alg_time>
+      fft_type;
+
+    // Plan once, so that a warm setup has wisdom.
+    { fft_type fft(Domain<1>(size), 1.f); }
+
+    vsip::impl::profile::Acc_timer t1;
+    
+    for (index_type l=0; l<loop; ++l)
+    {
+#if defined(VSIP_IMPL_FFTW3)
+      if (cold) vsip::impl::fftw3::forget_wisdom();
+#endif
+      t1.start();
+      fft_type fft(Domain<1>(size), 1.f);
+      t1.stop();
+    }
+    
+    time = t1.total();
+  }
+};
+
+
+
 void
 defaults(Loop1P& loop)
 {
@@ -232,6 +281,11 @@ test(Loop1P& loop, int what)
   case 25: loop(t_fft_op<complex<float>, patient>(true)); break;
   case 26: loop(t_fft_ip<complex<float>, patient>(true)); break;
   case 27: loop(t_fft_bv<complex<float>, patient>(true)); break;
+
+  case 31: loop(t_fft_setup<complex<float>, measure, true>()); break;
+  case 32: loop(t_fft_setup<complex<float>, measure, false>()); break;
+  case 33: loop(t_fft_setup<complex<float>, patient, true>()); break;
+  case 34: loop(t_fft_setup<complex<float>, patient, false>()); break;
 #endif
 
   // Double precision cases.
@@ -257,6 +311,11 @@ test(Loop1P& loop, int what)
   case 125: loop(t_fft_op<complex<double>, patient>(true)); break;
   case 126: loop(t_fft_ip<complex<double>, patient>(true)); break;
   case 127: loop(t_fft_bv<complex<double>, patient>(true)); break;
+
+  case 131: loop(t_fft_setup<complex<double>, measure, true>()); break;
+  case 132: loop(t_fft_setup<complex<double>, measure, false>()); break;
+  case 133: loop(t_fft_setup<complex<double>, patient, true>()); break;
+  case 134: loop(t_fft_setup<complex<double>, patient, false>()); break;
 #endif
 
   case 0:
@@ -274,6 +333,11 @@ test(Loop1P& loop, int what)
 
       << " Planning effor: measure (number of times = 15): 11-16\n"
       << " Planning effor: pateint (number of times = 0): 21-26\n"
+      << " Setup (construction only):\n"
+      << "  -31 -- measure, cold (no wisdom)\n"
+      << "  -32 -- measure, warm (wisdom)\n"
+      << "  -33 -- patient, cold (no wisdom)\n"
+      << "  -34 -- patient, warm (wisdom)\n"
 #else
       << "Single precision FFT support not provided by library\n"
 #endif
@@ -284,6 +348,7 @@ test(Loop1P& loop, int what)
       << " Planning effor: estimate (number of times = 1): 101-106\n"
       << " Planning effor: measure (number of times = 15): 111-116\n"
       << " Planning effor: pateint (number of times = 0): 121-126\n"
+      << " Setup (construction only): 131-134\n"
 #else
       << "Double precision FFT support not provided by library\n"
 #endif
@@ -206,6 +206,130 @@ struct t_fir2 : Benchmark_base
 
 
 
+// Sweep FIR kernel size, processing a fixed input size
+//
+// ImplTag selects the implementation:
+//   Impl_auto - Fir<> as dispatched,
+//   Impl_conv - the convolution-based backend,
+//   Impl_fft  - the FFT overlap-save backend,
+//   Impl_poly - the polyphase backend (decimation > 1),
+//   Impl_dot  - the dot-product backend.
+
+struct Impl_auto;
+struct Impl_conv;
+struct Impl_fft;
+struct Impl_poly;
+struct Impl_dot;
+
+template <typename ImplTag, typename T> struct Fir_impl_of;
+
+template <typename T>
+struct Fir_impl_of<Impl_conv, T>
+{
+  typedef vsip::impl::Fir_conv_impl<T, nonsym, state_save> type;
+};
+
+template <typename T>
+struct Fir_impl_of<Impl_fft, T>
+{
+  typedef vsip::impl::Fir_fft_impl<T, nonsym, state_save> type;
+};
+
+template <typename T>
+struct Fir_impl_of<Impl_poly, T>
+{
+  typedef vsip::impl::Fir_poly_impl<T, nonsym, state_save> type;
+};
+
+template <typename T>
+struct Fir_impl_of<Impl_dot, T>
+{
+  typedef vsip::impl::Fir_impl<T, nonsym, state_save> type;
+};
+
+template <typename ImplTag,
+	  typename T>
+struct t_fir3 : Benchmark_base
+{
+  char const* what() { return "t_fir3"; }
+
+  float ops_per_point(length_type coeff_size)
+  {
+    float ops = (coeff_size * input_size_ / dec_) *
+      (vsip::impl::Ops_info<T>::mul + vsip::impl::Ops_info<T>::add);
+
+    return ops / coeff_size;
+  }
+
+  int riob_per_point(length_type) { return -1; }
+  int wiob_per_point(length_type) { return -1; }
+  int mem_per_point(length_type)  { return -1; }
+
+  void operator()(length_type coeff_size, length_type loop, float& time)
+  {
+    typedef typename Fir_impl_of<ImplTag, T>::type impl_type;
+
+    vsip::impl::aligned_array<T> coeff(coeff_size);
+    for (index_type i=0; i<coeff_size; ++i)
+      coeff[i] = T(i % 3) - T(1);
+
+    impl_type fir(coeff, coeff_size, input_size_, dec_);
+
+    Vector<T>   in (input_size_, T(1));
+    Vector<T>   out(fir.output_size());
+
+    vsip::impl::Ext_data<typename Vector<T>::block_type> ext_in(in.block());
+    vsip::impl::Ext_data<typename Vector<T>::block_type> ext_out(out.block());
+
+    vsip::impl::profile::Timer t1;
+
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      fir.apply(ext_in.data(), 1, input_size_,
+		ext_out.data(), 1, fir.output_size());
+    t1.stop();
+
+    time = t1.delta();
+  }
+
+  t_fir3(length_type input_size, length_type dec)
+    : input_size_(input_size), dec_(dec) {}
+
+  length_type input_size_;
+  length_type dec_;
+};
+
+template <typename T>
+struct t_fir3<Impl_auto, T> : t_fir3<Impl_conv, T>
+{
+  char const* what() { return "t_fir3<Impl_auto>"; }
+
+  void operator()(length_type coeff_size, length_type loop, float& time)
+  {
+    length_type const size = this->input_size_;
+    Vector<T>   coeff(coeff_size);
+    for (index_type i=0; i<coeff_size; ++i)
+      coeff.put(i, T(i % 3) - T(1));
+
+    Fir<T, nonsym, state_save> fir(coeff, size, this->dec_);
+
+    Vector<T>   in (size, T(1));
+    Vector<T>   out(fir.output_size());
+
+    vsip::impl::profile::Timer t1;
+
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      fir(in, out);
+    t1.stop();
+
+    time = t1.delta();
+  }
+
+  t_fir3(length_type input_size, length_type dec)
+    : t_fir3<Impl_conv, T>(input_size, dec) {}
+};
+
 
 
 void
@@ -254,6 +378,17 @@ test(Loop1P& loop, int what)
   case 31: loop(t_fir2<state_save,    SX>(k, size)); break;
   case 32: loop(t_fir2<state_save,    CX>(k, size)); break;
 
+  case 41: loop(t_fir3<Impl_auto, SX>(size, d)); break;
+  case 42: loop(t_fir3<Impl_conv, SX>(size, d)); break;
+  case 43: loop(t_fir3<Impl_fft,  SX>(size, d)); break;
+  case 44: loop(t_fir3<Impl_auto, CX>(size, d)); break;
+  case 45: loop(t_fir3<Impl_conv, CX>(size, d)); break;
+  case 46: loop(t_fir3<Impl_fft,  CX>(size, d)); break;
+  case 47: loop(t_fir3<Impl_poly, SX>(size, d)); break;
+  case 48: loop(t_fir3<Impl_poly, CX>(size, d)); break;
+  case 49: loop(t_fir3<Impl_dot,  SX>(size, d)); break;
+  case 50: loop(t_fir3<Impl_dot,  CX>(size, d)); break;
+
   case 0:
     std::cout
       << "fir -- FIR signal processing object benchmark\n"
@@ -276,6 +411,22 @@ test(Loop1P& loop, int what)
       << "Parameters for cases 22, 32\n"
       << "  -p:k <size>  Kernel size (default 16)\n"
       << "  -p:size <size> Problem size (default 1)\n"
+      << "\n"
+      << " Sweep kernel size, fixed problem size\n"
+      << "  -41 -- Dispatched,       float\n"
+      << "  -42 -- Convolution,      float\n"
+      << "  -43 -- FFT overlap-save, float\n"
+      << "  -44 -- Dispatched,       complex<float>\n"
+      << "  -45 -- Convolution,      complex<float>\n"
+      << "  -46 -- FFT overlap-save, complex<float>\n"
+      << "  -47 -- Polyphase,        float\n"
+      << "  -48 -- Polyphase,        complex<float>\n"
+      << "  -49 -- Dot-product,      float\n"
+      << "  -50 -- Dot-product,      complex<float>\n"
+      << "\n"
+      << "Parameters for cases 41 to 50\n"
+      << "  -p:d <size>  Decimation (default 1, > 1 for cases 47, 48)\n"
+      << "  -p:size <size> Problem size (default 2^stop)\n"
       ;
 
   default: return 0;
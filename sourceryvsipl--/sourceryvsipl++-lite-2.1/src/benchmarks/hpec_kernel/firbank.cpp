@@ -29,6 +29,7 @@
 #include <vsip/map.hpp>
 #include <vsip/math.hpp>
 #include <vsip/signal.hpp>
+#include <vsip_csl/fir_bank.hpp>
 
 #include "benchmarks.hpp"
 
@@ -53,6 +54,7 @@ struct t_firbank_base;
 struct ImplFull;	   // Time-domain convolution using Fir class
 struct ImplFast;	   // Fast convolution using FFTs
 struct ImplExpr;	   // Fast convolution using FFTMs
+struct ImplBank;	   // Time-domain convolution using Fir_bank class
 
 
 template <typename T>
@@ -191,6 +193,68 @@ public:
 };
 
 
+/***********************************************************************
+  ImplBank: built-in FIR filter bank
+***********************************************************************/
+
+template <typename T>
+struct t_firbank_base<T, ImplBank> : t_local_view<T>,  Benchmark_base
+{
+  float ops(length_type filters, length_type points, length_type coeffs)
+  {
+    float total_ops = filters * points * coeffs *
+                  (vsip::impl::Ops_info<T>::mul + vsip::impl::Ops_info<T>::add); 
+    return total_ops;
+  }
+
+  template <
+    typename Block1,
+    typename Block2,
+    typename Block3,
+    typename Block4
+    >
+  void firbank(
+    Matrix<T, Block1> inputs,
+    Matrix<T, Block2> filters,
+    Matrix<T, Block3> outputs,
+    Matrix<T, Block4> expected,
+    length_type       loop,
+    float&            time)
+  {
+    this->verify_views(inputs, filters, outputs, expected);
+
+    // Create the filter bank, one channel per local row.
+    length_type N = inputs.row(0).size();
+
+    typedef vsip_csl::Fir_bank<T, nonsym, state_no_save, 1> fir_type;
+    fir_type fir(LOCAL(filters), N, 1);
+
+
+    vsip::impl::profile::Timer t1;
+    
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+    {
+      // Perform FIR convolutions
+      fir(LOCAL(inputs), LOCAL(outputs));
+    }
+    t1.stop();
+    time = t1.delta();
+
+    // Verify data
+    assert( view_equal(LOCAL(outputs), LOCAL(expected)) );
+  }
+
+  t_firbank_base(length_type filters, length_type coeffs)
+   : m_(filters), k_(coeffs) {}
+
+public:
+  // Member data
+  length_type const m_;
+  length_type const k_;
+};
+
+
 /***********************************************************************
   ImplFast: fast convolution using FFTs
 ***********************************************************************/
@@ -608,6 +672,12 @@ test(Loop1P& loop, int what)
   case  22: loop(
     t_firbank_sweep_n<complex<float>, ImplExpr>(20,  12));
     break;
+  case  31: loop(
+    t_firbank_sweep_n<complex<float>, ImplBank>(64, 128));
+    break;
+  case  32: loop(
+    t_firbank_sweep_n<complex<float>, ImplBank>(20,  12));
+    break;
 
 #ifdef VSIP_IMPL_SOURCERY_VPP
   case  51: loop(
@@ -628,6 +698,12 @@ test(Loop1P& loop, int what)
   case  72: loop(
     t_firbank_from_file<complex<float>, ImplExpr> (20,  12, "data/set2"));
     break;
+  case  81: loop(
+    t_firbank_from_file<complex<float>, ImplBank> (64, 128, "data/set1"));
+    break;
+  case  82: loop(
+    t_firbank_from_file<complex<float>, ImplBank> (20,  12, "data/set2"));
+    break;
 #endif
 
   case 0:
@@ -640,6 +716,8 @@ test(Loop1P& loop, int what)
       << " -12   2    Freq/FFT   generated\n"
       << " -21   1    Freq/FFTM  generated\n"
       << " -22   2    Freq/FFTM  generated\n"
+      << " -31   1    Time/bank  generated\n"
+      << " -32   2    Time/bank  generated\n"
       << " ---\n"
       << " -51   1      Time     external\n"
       << " -52   2      Time     external\n"
@@ -647,6 +725,8 @@ test(Loop1P& loop, int what)
       << " -62   2    Freq/FFT   external\n"
       << " -71   1    Freq/FFTM  external\n"
       << " -72   2    Freq/FFTM  external\n"
+      << " -81   1    Time/bank  external\n"
+      << " -82   2    Time/bank  external\n"
       << std::endl;
 
   default: 
@@ -0,0 +1,203 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    benchmarks/iir.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Benchmark for IIR filters.
+
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <iostream>
+#include <vector>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/math.hpp>
+#include <vsip/signal.hpp>
+#include <vsip/core/profile.hpp>
+
+#include <vsip_csl/test.hpp>
+#include <vsip_csl/iir_bank.hpp>
+#include "loop.hpp"
+
+using namespace vsip;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+// Coefficients of a cascade of SECTIONS stable second-order sections.
+
+template <typename T>
+void
+init_sections(Matrix<T> b, Matrix<T> a)
+{
+  for (index_type m = 0; m < a.size(0); ++m)
+  {
+    b.put(m, 0, T(1));
+    b.put(m, 1, T(-1));
+    b.put(m, 2, T(0.5));
+    a.put(m, 0, T(-0.9));
+    a.put(m, 1, T(0.2));
+  }
+}
+
+
+
+// Filter CHANNELS channels, sweeping the input size.
+//
+// ImplTag selects the implementation:
+//   Impl_iir  - one Iir<> per channel,
+//   Impl_bank - one Iir_bank<> for all channels.
+
+struct Impl_iir;
+struct Impl_bank;
+
+template <typename ImplTag,
+	  typename T>
+struct t_iir1;
+
+template <typename T>
+struct t_iir1_base : Benchmark_base
+{
+  float ops_per_point(length_type size)
+  {
+    return channels_ *
+      vsip::impl::signal_detail::Op_count_iir<T>::value(size, sections_) /
+      size;
+  }
+
+  int riob_per_point(length_type) { return channels_ * sizeof(T); }
+  int wiob_per_point(length_type) { return channels_ * sizeof(T); }
+  int mem_per_point(length_type)  { return 2 * channels_ * sizeof(T); }
+
+  t_iir1_base(length_type channels, length_type sections)
+    : channels_(channels), sections_(sections)
+  {}
+
+  length_type channels_;
+  length_type sections_;
+};
+
+template <typename T>
+struct t_iir1<Impl_iir, T> : t_iir1_base<T>
+{
+  char const* what() { return "t_iir1<Impl_iir>"; }
+
+  void operator()(length_type size, length_type loop, float& time)
+  {
+    typedef Iir<T, state_save> iir_type;
+
+    Matrix<T> b(this->sections_, 3);
+    Matrix<T> a(this->sections_, 2);
+    init_sections(b, a);
+
+    std::vector<iir_type> iir(this->channels_, iir_type(b, a, size));
+
+    Matrix<T> in (this->channels_, size, T(1));
+    Matrix<T> out(this->channels_, size);
+
+    vsip::impl::profile::Timer t1;
+
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      for (index_type c=0; c<this->channels_; ++c)
+	iir[c](in.row(c), out.row(c));
+    t1.stop();
+
+    time = t1.delta();
+  }
+
+  t_iir1(length_type channels, length_type sections)
+    : t_iir1_base<T>(channels, sections)
+  {}
+};
+
+template <typename T>
+struct t_iir1<Impl_bank, T> : t_iir1_base<T>
+{
+  char const* what() { return "t_iir1<Impl_bank>"; }
+
+  void operator()(length_type size, length_type loop, float& time)
+  {
+    typedef vsip_csl::Iir_bank<T, state_save> bank_type;
+
+    Matrix<T> b(this->sections_, 3);
+    Matrix<T> a(this->sections_, 2);
+    init_sections(b, a);
+
+    bank_type bank(b, a, this->channels_, size);
+
+    Matrix<T> in (this->channels_, size, T(1));
+    Matrix<T> out(this->channels_, size);
+
+    vsip::impl::profile::Timer t1;
+
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      bank(in, out);
+    t1.stop();
+
+    time = t1.delta();
+  }
+
+  t_iir1(length_type channels, length_type sections)
+    : t_iir1_base<T>(channels, sections)
+  {}
+};
+
+
+
+void
+defaults(Loop1P& loop)
+{
+  loop.loop_start_ = 1;
+  loop.start_ = 4;
+  loop.stop_  = 12;
+
+  loop.param_["channels"] = "512";
+  loop.param_["sections"] = "2";
+}
+
+
+
+int
+test(Loop1P& loop, int what)
+{
+  length_type channels = atoi(loop.param_["channels"].c_str());
+  length_type sections = atoi(loop.param_["sections"].c_str());
+
+  typedef float               SX;
+  typedef std::complex<float> CX;
+
+  switch (what)
+  {
+  case  1: loop(t_iir1<Impl_iir,  SX>(channels, sections)); break;
+  case  2: loop(t_iir1<Impl_iir,  CX>(channels, sections)); break;
+  case 11: loop(t_iir1<Impl_bank, SX>(channels, sections)); break;
+  case 12: loop(t_iir1<Impl_bank, CX>(channels, sections)); break;
+
+  case 0:
+    std::cout
+      << "iir -- IIR filter benchmark\n"
+      << " Sweep input size, filtering several channels\n"
+      << "   -1 -- One Iir per channel, float\n"
+      << "   -2 -- One Iir per channel, complex<float>\n"
+      << "  -11 -- Iir_bank,             float\n"
+      << "  -12 -- Iir_bank,             complex<float>\n"
+      << "\n"
+      << "Parameters\n"
+      << "  -p:channels <n>  Number of channels (default 512)\n"
+      << "  -p:sections <n>  Number of second-order sections (default 2)\n"
+      ;
+
+  default: return 0;
+  }
+  return 1;
+}
@@ -16,15 +16,18 @@
 ***********************************************************************/
 
 #include <iostream>
+#include <vector>
 
 #include <vsip/initfin.hpp>
 #include <vsip/support.hpp>
 #include <vsip/math.hpp>
+#include <vsip/tensor.hpp>
 #include <vsip/solvers.hpp>
 
 #include <vsip/opt/profile.hpp>
 
 #include <vsip_csl/test.hpp>
+#include <vsip_csl/solver_bank.hpp>
 #include "loop.hpp"
 
 using namespace vsip;
@@ -157,6 +160,105 @@ struct t_qrd : Benchmark_base
 
 
 
+// Batched QR: BATCH problems of RATIO * SIZE x SIZE, factored either
+// with one qrd object per problem, or with a Qrd_bank.
+
+template <typename T>
+float
+qrd_batch_ops(length_type n, length_type ratio, length_type batch)
+{
+  length_type m = ratio * n;
+  float ops = impl::Is_complex<T>::value ? (8.f * n * n * (3*m - n) / 3)
+                                         : (2.f * n * n * (3*m - n) / 3);
+  return batch * ops / n;
+}
+
+template <typename T>
+struct t_qrd_batch : Benchmark_base
+{
+  char const* what() { return "t_qrd_batch"; }
+  float ops_per_point(length_type n)
+  { return qrd_batch_ops<T>(n, ratio_, batch_); }
+
+  int riob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int wiob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int mem_per_point(length_type size)
+  { return batch_*ratio_*size*sizeof(T); }
+
+  void operator()(length_type size, length_type loop, float& time)
+  {
+    std::vector<Matrix<T> > A;
+    for (index_type p=0; p<batch_; ++p)
+    {
+      A.push_back(Matrix<T>(ratio_*size, size));
+      randm(A.back());
+    }
+
+    qrd<T, by_reference> qr(ratio_*size, size, qrd_saveq1);
+    
+    vsip::impl::profile::Timer t1;
+    
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      for (index_type p=0; p<batch_; ++p)
+	qr.decompose(A[p]);
+    t1.stop();
+    
+    time = t1.delta();
+  }
+
+  t_qrd_batch(length_type ratio, length_type batch)
+    : ratio_(ratio), batch_(batch) {}
+
+  length_type ratio_;
+  length_type batch_;
+};
+
+template <typename T>
+struct t_qrd_bank : Benchmark_base
+{
+  char const* what() { return "t_qrd_bank"; }
+  float ops_per_point(length_type n)
+  { return qrd_batch_ops<T>(n, ratio_, batch_); }
+
+  int riob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int wiob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int mem_per_point(length_type size)
+  { return batch_*ratio_*size*sizeof(T); }
+
+  void operator()(length_type size, length_type loop, float& time)
+  {
+    Tensor<T> A(batch_, ratio_*size, size);
+    Matrix<T> m(ratio_*size, size);
+    for (index_type p=0; p<batch_; ++p)
+    {
+      randm(m);
+      for (index_type i=0; i<m.size(0); ++i)
+	for (index_type j=0; j<m.size(1); ++j)
+	  A.put(p, i, j, m.get(i, j));
+    }
+
+    vsip_csl::Qrd_bank<T> qr(batch_, ratio_*size, size);
+    
+    vsip::impl::profile::Timer t1;
+    
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      qr.decompose(A);
+    t1.stop();
+    
+    time = t1.delta();
+  }
+
+  t_qrd_bank(length_type ratio, length_type batch)
+    : ratio_(ratio), batch_(batch) {}
+
+  length_type ratio_;
+  length_type batch_;
+};
+
+
+
 void
 defaults(Loop1P& loop)
 {
@@ -179,6 +281,12 @@ test(Loop1P& loop, int what)
   case 12: loop(t_qrd<complex<float>, col2_type >(3, qrd_saveq1)); break;
   case 13: loop(t_qrd<complex<float>, col2_type >(3, qrd_saveq)); break;
 
+  case 21: loop(t_qrd_batch<complex<float> >(3, 256)); break;
+  case 22: loop(t_qrd_batch<float>(3, 256)); break;
+
+  case 31: loop(t_qrd_bank<complex<float> >(3, 256)); break;
+  case 32: loop(t_qrd_bank<float>(3, 256)); break;
+
 #if HAVE_LAPACK
   // These can be enabled if using Lapack as a backend.
   case  11: loop(t_qrd_lapack1<complex<float>, true>()); break;
@@ -0,0 +1,304 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    benchmarks/lapack/toepsol.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Benchmark for batched Toeplitz solvers.
+
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <iostream>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/math.hpp>
+#include <vsip/solvers.hpp>
+
+#include <vsip/opt/profile.hpp>
+
+#include <vsip_csl/test.hpp>
+#include <vsip_csl/solver_bank.hpp>
+#include "loop.hpp"
+
+using namespace vsip;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+/// Return a random value between -0.5 and +0.5
+
+template <typename T>
+struct Random
+{
+  static T value() { return T(1.f * rand()/(RAND_MAX+1.0)) - T(0.5); }
+};
+
+/// Specialization for random complex value.
+
+template <typename T>
+struct Random<complex<T> >
+{
+  static complex<T> value() {
+    return complex<T>(Random<T>::value(), Random<T>::value());
+  }
+};
+
+
+
+/// Fill the rows of T with the first rows of diagonally dominant,
+/// hence positive definite, Toeplitz matrices.
+
+template <typename T,
+	  typename Block>
+void
+toeplitz_rows(Matrix<T, Block> t)
+{
+  length_type n = t.size(1);
+  for (index_type p=0; p<t.size(0); ++p)
+  {
+    t.put(p, 0, T(n));
+    for (index_type k=1; k<n; ++k)
+      t.put(p, k, Random<T>::value());
+  }
+}
+
+template <typename T,
+	  typename Block>
+void
+randm(Matrix<T, Block> m)
+{
+  for (index_type r=0; r<m.size(0); ++r)
+    for (index_type c=0; c<m.size(1); ++c)
+      m.put(r, c, Random<T>::value());
+}
+
+
+
+// Toeplitz solves: BATCH systems of SIZE, solved with one call to
+// vsip::toepsol per system (Impl_call), with the batched
+// vsip_csl::toepsol (Impl_bank), or sharing one matrix between all
+// right-hand sides (Impl_shared).
+
+struct Impl_call;
+struct Impl_bank;
+struct Impl_shared;
+
+template <typename T,
+	  typename ImplTag>
+struct t_toepsol : Benchmark_base
+{
+  char const* what() { return "t_toepsol"; }
+
+  // The Levinson solve of a system of order n takes about 4 n^2
+  // multiply-adds.
+  float ops_per_point(length_type n)
+  {
+    float ops = impl::Is_complex<T>::value ? 8.f * 4 * n * n
+                                           : 2.f * 4 * n * n;
+    return batch_ * ops / n;
+  }
+
+  int riob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int wiob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int mem_per_point(length_type) { return 3*batch_*sizeof(T); }
+
+  void operator()(length_type size, length_type loop, float& time)
+  {
+    Matrix<T> t(batch_, size);
+    Matrix<T> b(batch_, size);
+    Matrix<T> x(batch_, size);
+
+    toeplitz_rows(t);
+    randm(b);
+
+    vsip::impl::profile::Timer t1;
+
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      run(t, b, x, static_cast<ImplTag*>(0));
+    t1.stop();
+
+    time = t1.delta();
+  }
+
+  void run(Matrix<T> t, Matrix<T> b, Matrix<T> x, Impl_call*)
+  {
+    Vector<T> w(t.size(1));
+    for (index_type p=0; p<batch_; ++p)
+      toepsol(t.row(p), b.row(p), w, x.row(p));
+  }
+
+  void run(Matrix<T> t, Matrix<T> b, Matrix<T> x, Impl_bank*)
+  {
+    vsip_csl::toepsol(t, b, x);
+  }
+
+  void run(Matrix<T> t, Matrix<T> b, Matrix<T> x, Impl_shared*)
+  {
+    vsip_csl::toepsol(t.row(0), b, x);
+  }
+
+  t_toepsol(length_type batch) : batch_(batch) {}
+
+  length_type batch_;
+};
+
+
+
+// Linear prediction: BATCH predictors of order SIZE - 1 from SIZE
+// autocorrelation lags, found by solving the normal equations with
+// vsip::toepsol per problem (Impl_call), with the batched Levinson
+// recursion (Impl_levinson), or with the batched split Levinson
+// recursion (Impl_split).
+
+struct Impl_levinson;
+struct Impl_split;
+
+template <typename T,
+	  typename ImplTag>
+struct t_levinson : Benchmark_base
+{
+  char const* what() { return "t_levinson"; }
+
+  // The Levinson-Durbin recursion of order n takes about 2 n^2
+  // multiply-adds.
+  float ops_per_point(length_type n)
+  {
+    float ops = impl::Is_complex<T>::value ? 8.f * 2 * n * n
+                                           : 2.f * 2 * n * n;
+    return batch_ * ops / n;
+  }
+
+  int riob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int wiob_per_point(length_type) { return -1*(int)sizeof(T); }
+  int mem_per_point(length_type) { return 2*batch_*sizeof(T); }
+
+  void operator()(length_type size, length_type loop, float& time)
+  {
+    typedef typename impl::Scalar_of<T>::type scalar_type;
+
+    Matrix<T>           r(batch_, size);
+    Matrix<T>           a(batch_, size);
+    Vector<scalar_type> e(batch_);
+
+    toeplitz_rows(r);
+
+    vsip::impl::profile::Timer t1;
+
+    t1.start();
+    for (index_type l=0; l<loop; ++l)
+      run(r, a, e, static_cast<ImplTag*>(0));
+    t1.stop();
+
+    time = t1.delta();
+  }
+
+  template <typename VectorT>
+  void run(Matrix<T> r, Matrix<T> a, VectorT, Impl_call*)
+  {
+    length_type n = r.size(1);
+    if (n < 2)
+      return;
+    Domain<1> lags(1, 1, n - 1);
+    Domain<1> order(n - 1);
+    Vector<T> b(n - 1);
+    Vector<T> w(n - 1);
+    for (index_type p=0; p<batch_; ++p)
+    {
+      for (index_type k=1; k<n; ++k)
+	b.put(k - 1, -impl::impl_conj(r.get(p, k)));
+      toepsol(r.row(p)(order), b, w, a.row(p)(lags));
+    }
+    a.col(0) = T(1);
+  }
+
+  template <typename VectorT>
+  void run(Matrix<T> r, Matrix<T> a, VectorT e, Impl_levinson*)
+  {
+    vsip_csl::levinson(r, a, e);
+  }
+
+  template <typename VectorT>
+  void run(Matrix<T> r, Matrix<T> a, VectorT e, Impl_split*)
+  {
+    vsip_csl::split_levinson(r, a, e);
+  }
+
+  t_levinson(length_type batch) : batch_(batch) {}
+
+  length_type batch_;
+};
+
+
+
+void
+defaults(Loop1P& loop)
+{
+  loop.loop_start_ = 100;
+  loop.start_ = 2;
+  loop.stop_  = 8;
+
+  loop.param_["batch"] = "256";
+}
+
+
+
+int
+test(Loop1P& loop, int what)
+{
+  length_type batch = atoi(loop.param_["batch"].c_str());
+
+  typedef float               SX;
+  typedef std::complex<float> CX;
+
+  switch (what)
+  {
+  case  1: loop(t_toepsol<SX, Impl_call>(batch)); break;
+  case  2: loop(t_toepsol<SX, Impl_bank>(batch)); break;
+  case  3: loop(t_toepsol<SX, Impl_shared>(batch)); break;
+
+  case  4: loop(t_toepsol<CX, Impl_call>(batch)); break;
+  case  5: loop(t_toepsol<CX, Impl_bank>(batch)); break;
+  case  6: loop(t_toepsol<CX, Impl_shared>(batch)); break;
+
+  case 11: loop(t_levinson<SX, Impl_call>(batch)); break;
+  case 12: loop(t_levinson<SX, Impl_levinson>(batch)); break;
+  case 13: loop(t_levinson<SX, Impl_split>(batch)); break;
+
+  case 14: loop(t_levinson<CX, Impl_call>(batch)); break;
+  case 15: loop(t_levinson<CX, Impl_levinson>(batch)); break;
+
+  case 0:
+    std::cout
+      << "toepsol -- batched Toeplitz solvers\n"
+      << "  -1 -- toepsol,  float,   one call per system\n"
+      << "  -2 -- toepsol,  float,   batched\n"
+      << "  -3 -- toepsol,  float,   one matrix, many right-hand sides\n"
+      << "  -4 -- toepsol,  complex, one call per system\n"
+      << "  -5 -- toepsol,  complex, batched\n"
+      << "  -6 -- toepsol,  complex, one matrix, many right-hand sides\n"
+      << " -11 -- levinson, float,   one toepsol call per problem\n"
+      << " -12 -- levinson, float,   batched\n"
+      << " -13 -- levinson, float,   batched split Levinson\n"
+      << " -14 -- levinson, complex, one toepsol call per problem\n"
+      << " -15 -- levinson, complex, batched\n"
+      << "\n"
+      << " Parameters:\n"
+      << "  -p:batch BATCH -- number of systems (default 256)\n"
+      ;
+
+  default: return 0;
+  }
+  return 1;
+}
@@ -24,6 +24,7 @@
 #include <vsip/initfin.hpp>
 #include <vsip/core/check_config.hpp>
 #include <vsip/core/huge_page_pool.hpp>
+#include <vsip/core/parallel/services.hpp>
 
 #include "benchmarks.hpp"
 
@@ -32,6 +33,19 @@ using namespace vsip;
 extern int test(Loop1P& loop, int what);
 extern void defaults(Loop1P& loop);
 
+// Run the benchmark on every processor.  With the threads parallel
+// service, processors are threads and must be started explicitly.
+
+struct Run_test
+{
+  Run_test(Loop1P const& loop, int what) : loop_(loop), what_(what) {}
+
+  void operator()() { test(loop_, what_); }
+
+  Loop1P loop_;
+  int    what_;
+};
+
 
 
 int
@@ -213,7 +227,7 @@ main(int argc, char** argv)
 
   loop.what_ = what;
 
-  test(loop, what);
+  vsip::impl::par_spmd(Run_test(loop, what));
 }
 
 
@@ -49,6 +49,12 @@ struct Impl_alltoallv;
 template <bool CopyLocal, bool OptSingleRow, int OptPhaseOrder>
 struct Impl_persistent_x;
 
+template <typename ParAssignImpl>
+struct Impl_pa;				// Par_assign<ParAssignImpl> object
+
+template <length_type Chunks>
+struct Impl_pa_chunks;			// Par_assign<Alltoall_assign>, chunked
+
 template <typename ImplTag>
 struct Does_copy_local
 {
@@ -1543,6 +1549,79 @@ private:
 
 
 
+/***********************************************************************
+  Send class using a Par_assign object.
+***********************************************************************/
+
+template <typename T,
+	  typename SBlock,
+	  typename DBlock,
+	  typename ParAssignImpl>
+class Send<T, SBlock, DBlock, Impl_pa<ParAssignImpl> >
+{
+  typedef impl::Par_assign<2, T, T, DBlock, SBlock, ParAssignImpl>
+		par_assign_type;
+
+  // Constructor.
+public:
+  Send(
+    Matrix<T, SBlock> src,
+    Matrix<T, DBlock> dst)
+  : src_(src),
+    dst_(dst),
+    pa_ (dst_, src_)
+  {}
+
+  void operator()() { pa_(); }
+
+  void test_fixup() {}
+
+  // Member data.
+private:
+  Matrix<T, SBlock> src_;
+  Matrix<T, DBlock> dst_;
+  par_assign_type   pa_;
+};
+
+
+
+/***********************************************************************
+  Send class using a Par_assign<Alltoall_assign> object, exchanging
+  the data in CHUNKS pipelined steps.
+***********************************************************************/
+
+template <typename    T,
+	  typename    SBlock,
+	  typename    DBlock,
+	  length_type Chunks>
+class Send<T, SBlock, DBlock, Impl_pa_chunks<Chunks> >
+{
+  typedef impl::Par_assign<2, T, T, DBlock, SBlock, impl::Alltoall_assign>
+		par_assign_type;
+
+  // Constructor.
+public:
+  Send(
+    Matrix<T, SBlock> src,
+    Matrix<T, DBlock> dst)
+  : src_(src),
+    dst_(dst),
+    pa_ (dst_, src_, Chunks)
+  {}
+
+  void operator()() { pa_(); }
+
+  void test_fixup() {}
+
+  // Member data.
+private:
+  Matrix<T, SBlock> src_;
+  Matrix<T, DBlock> dst_;
+  par_assign_type   pa_;
+};
+
+
+
 /***********************************************************************
   t_alltoall
 ***********************************************************************/
@@ -1777,6 +1856,10 @@ test(Loop1P& loop, int what)
   typedef row2_type Rt;
   typedef col2_type Ct;
 
+  typedef Impl_pa<impl::Chained_assign>  Ca;
+  typedef Impl_pa<impl::Alltoall_assign> Aa;
+  typedef Impl_pa_chunks<4>              Aa4;
+
   if (what < 100)
   {
     if (loop.user_param_ == -1)                  loop.user_param_ = 1;
@@ -1813,6 +1896,14 @@ test(Loop1P& loop, int what)
   case 41: loop(t_alltoall<float, Rt, Rt, Impl_persistent_x<true, true, true> >(ratio)); break;
   case 42: loop(t_alltoall<float, Rt, Ct, Impl_persistent_x<true, true, true> >(ratio)); break;
 
+  // Par_assign: Chained_assign, Alltoall_assign, Alltoall_assign in 4 steps.
+  case 51: loop(t_alltoall<float, Rt, Rt, Ca>(ratio)); break;
+  case 52: loop(t_alltoall<float, Rt, Ct, Ca>(ratio)); break;
+  case 61: loop(t_alltoall<float, Rt, Rt, Aa>(ratio)); break;
+  case 62: loop(t_alltoall<float, Rt, Ct, Aa>(ratio)); break;
+  case 71: loop(t_alltoall<float, Rt, Rt, Aa4>(ratio)); break;
+  case 72: loop(t_alltoall<float, Rt, Ct, Aa4>(ratio)); break;
+
 
   case 101: loop(t_alltoall_fr<float, Rt, Rt, Impl_alltoall>(rows)); break;
   case 102: loop(t_alltoall_fr<float, Rt, Ct, Impl_alltoall>(rows)); break;
@@ -1860,6 +1951,14 @@ test(Loop1P& loop, int what)
   case 183: loop(t_alltoall_fr<float, Rt, Rt, Impl_alltoallv<true> >(rows,n1,n2)); break;
   case 184: loop(t_alltoall_fr<float, Rt, Ct, Impl_alltoallv<true> >(rows,n1,n2)); break;
 
+  // Par_assign: Chained_assign, Alltoall_assign, Alltoall_assign in 4 steps.
+  case 211: loop(t_alltoall_fr<float, Rt, Rt, Ca>(rows)); break;
+  case 212: loop(t_alltoall_fr<float, Rt, Ct, Ca>(rows)); break;
+  case 221: loop(t_alltoall_fr<float, Rt, Rt, Aa>(rows)); break;
+  case 222: loop(t_alltoall_fr<float, Rt, Ct, Aa>(rows)); break;
+  case 231: loop(t_alltoall_fr<float, Rt, Rt, Aa4>(rows)); break;
+  case 232: loop(t_alltoall_fr<float, Rt, Ct, Aa4>(rows)); break;
+
   default:
     return 0;
   }
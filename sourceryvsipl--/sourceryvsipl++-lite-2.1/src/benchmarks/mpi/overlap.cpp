@@ -0,0 +1,225 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    benchmarks/mpi/overlap.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Benchmark for overlapping corner turns
+                              with computation.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <iostream>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/math.hpp>
+#include <vsip/map.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/parallel.hpp>
+#include <vsip/opt/profile.hpp>
+
+#include <vsip_csl/test.hpp>
+#include "loop.hpp"
+
+using namespace vsip;
+using namespace vsip_csl;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+// A stream of frames (CPIs) of ROWS x SIZE values is corner turned
+// from a row to a column distribution, and each turned frame is
+// processed with WORK passes of a multiply-add over the local data.
+// The corner turn is done before processing (Impl_sync), or the turn
+// of frame K+1 is started before processing frame K and waited for
+// after (Impl_async).  Impl_async_poll also tests the turn between
+// passes, which lets communication libraries without a progress
+// thread advance it.
+
+struct Impl_sync;
+struct Impl_async;
+struct Impl_async_poll;
+
+template <typename T,
+	  typename ImplTag>
+struct t_overlap : Benchmark_base
+{
+  typedef Map<Block_dist, Block_dist>      map_type;
+  typedef Dense<2, T, row2_type, map_type> block_type;
+  typedef Matrix<T, block_type>            view_type;
+
+  char const* what() { return "t_overlap"; }
+
+  float ops_per_point(length_type)
+  {
+    float ops = impl::Is_complex<T>::value ? 8.f : 2.f;
+    return rows_ * work_ * ops;
+  }
+
+  int riob_per_point(length_type) { return rows_*sizeof(T); }
+  int wiob_per_point(length_type) { return rows_*sizeof(T); }
+  int mem_per_point(length_type)  { return 5*rows_*sizeof(T); }
+
+  void operator()(length_type size, length_type loop, float& time)
+  {
+    processor_type np = num_processors();
+
+    map_type row_map(np, 1);
+    map_type col_map(1, np);
+
+    view_type A0 (rows_, size, T(1), row_map);
+    view_type A1 (rows_, size, T(2), row_map);
+    view_type B0 (rows_, size, T(0), col_map);
+    view_type B1 (rows_, size, T(0), col_map);
+    view_type acc(rows_, size, T(0), col_map);
+
+    Setup_assign turn0(B0, A0);
+    Setup_assign turn1(B1, A1);
+
+    vsip::impl::profile::Timer t1;
+
+    t1.start();
+    run(turn0, turn1, B0, B1, acc, loop, static_cast<ImplTag*>(0));
+    t1.stop();
+
+    // Frames alternate between values 1 and 2.
+    T expect = T(0);
+    for (index_type l=0; l<loop; ++l)
+      for (index_type i=0; i<work_; ++i)
+	expect = expect * T(0.5) + T(l % 2 ? 2 : 1);
+    if (acc.local().size() > 0)
+      test_assert(equal(acc.local().get(0, 0), expect));
+
+    time = t1.delta();
+  }
+
+  void run(Setup_assign& turn0, Setup_assign& turn1,
+	   view_type B0, view_type B1, view_type acc,
+	   length_type loop, Impl_sync*)
+  {
+    for (index_type l=0; l<loop; ++l)
+    {
+      if (l % 2 == 0) { turn0(); process(B0, acc, 0); }
+      else            { turn1(); process(B1, acc, 0); }
+    }
+  }
+
+  void run(Setup_assign& turn0, Setup_assign& turn1,
+	   view_type B0, view_type B1, view_type acc,
+	   length_type loop, Impl_async*)
+  {
+    run_async(turn0, turn1, B0, B1, acc, loop, false);
+  }
+
+  void run(Setup_assign& turn0, Setup_assign& turn1,
+	   view_type B0, view_type B1, view_type acc,
+	   length_type loop, Impl_async_poll*)
+  {
+    run_async(turn0, turn1, B0, B1, acc, loop, true);
+  }
+
+  void run_async(Setup_assign& turn0, Setup_assign& turn1,
+		 view_type B0, view_type B1, view_type acc,
+		 length_type loop, bool poll)
+  {
+    Setup_assign::Async_handle cur = turn0.exec_async();
+    for (index_type l=0; l<loop; ++l)
+    {
+      cur.wait();
+      if (l % 2 == 0)
+      {
+	Setup_assign::Async_handle next = turn1.exec_async();
+	process(B0, acc, poll ? &next : 0);
+	cur = next;
+      }
+      else
+      {
+	Setup_assign::Async_handle next = turn0.exec_async();
+	process(B1, acc, poll ? &next : 0);
+	cur = next;
+      }
+    }
+    cur.wait();
+  }
+
+  void process(view_type B, view_type acc, Setup_assign::Async_handle* next)
+  {
+    for (index_type i=0; i<work_; ++i)
+    {
+      acc.local() = acc.local() * T(0.5) + B.local();
+      if (next)
+	next->test();
+    }
+  }
+
+  t_overlap(length_type rows, length_type work)
+    : rows_(rows), work_(work)
+  {}
+
+  // Member data.
+  length_type rows_;
+  length_type work_;
+};
+
+
+
+void
+defaults(Loop1P& loop)
+{
+  loop.start_ = 4;
+  loop.stop_  = 12;
+
+  loop.param_["rows"] = "256";
+  loop.param_["work"] = "8";
+}
+
+
+
+int
+test(Loop1P& loop, int what)
+{
+  length_type rows = atoi(loop.param_["rows"].c_str());
+  length_type work = atoi(loop.param_["work"].c_str());
+
+  typedef float               SX;
+  typedef std::complex<float> CX;
+
+  switch (what)
+  {
+  case  1: loop(t_overlap<SX, Impl_sync>(rows, work)); break;
+  case  2: loop(t_overlap<SX, Impl_async>(rows, work)); break;
+  case  3: loop(t_overlap<SX, Impl_async_poll>(rows, work)); break;
+
+  case 11: loop(t_overlap<CX, Impl_sync>(rows, work)); break;
+  case 12: loop(t_overlap<CX, Impl_async>(rows, work)); break;
+  case 13: loop(t_overlap<CX, Impl_async_poll>(rows, work)); break;
+
+  case 0:
+    std::cout
+      << "overlap -- corner turns overlapped with computation\n"
+      << "   -1 -- float,   turn, then process\n"
+      << "   -2 -- float,   turn the next frame while processing\n"
+      << "   -3 -- float,   as -2, testing the turn during processing\n"
+      << "  -11 -- complex, turn, then process\n"
+      << "  -12 -- complex, turn the next frame while processing\n"
+      << "  -13 -- complex, as -12, testing the turn during processing\n"
+      << "\n"
+      << " Parameters:\n"
+      << "  -p:rows ROWS -- rows per frame (default 256)\n"
+      << "  -p:work WORK -- passes over each frame (default 8)\n"
+      ;
+
+  default: return 0;
+  }
+  return 1;
+}
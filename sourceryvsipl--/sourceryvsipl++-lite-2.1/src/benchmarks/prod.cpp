@@ -319,6 +319,13 @@ test(Loop1P& loop, int what)
 # endif
 #endif
 
+#if !VSIP_IMPL_REF_IMPL
+  case  7: loop(t_prod2<impl::Simd_builtin_tag, float>()); break;
+  case  8: loop(t_prod2<impl::Simd_builtin_tag, complex<float> >()); break;
+  case  9: loop(t_prod2<impl::Simd_builtin_tag, double>()); break;
+  case 10: loop(t_prod2<impl::Simd_builtin_tag, complex<double> >()); break;
+#endif
+
   case  11: loop(t_prodt1<float>()); break;
   case  12: loop(t_prodt1<complex<float> >()); break;
   case  13: loop(t_prodh1<complex<float> >()); break;
@@ -202,11 +202,21 @@ test(Loop1P& loop, int what)
   length_type pi   = atoi(loop.param_["pi"].c_str());
 
   interpolate_type const IL = interp_linear;
+  interpolate_type const IC = interp_cubic;
 
   switch (what)
   {
   case  1: loop(t_pwarp_obj<float, float, IL> (rows, pi)); break;
   case  2: loop(t_pwarp_obj<float, unsigned char, IL>(rows, pi)); break;
+  case  3: loop(t_pwarp_obj<float, unsigned short, IL>(rows, pi)); break;
+  case  4: loop(t_pwarp_obj<double, double, IL>(rows, pi)); break;
+  case  5: loop(t_pwarp_obj<float, cf_type, IL>(rows, pi)); break;
+
+  case 21: loop(t_pwarp_obj<float, float, IC> (rows, pi)); break;
+  case 22: loop(t_pwarp_obj<float, unsigned char, IC>(rows, pi)); break;
+  case 23: loop(t_pwarp_obj<float, unsigned short, IC>(rows, pi)); break;
+  case 24: loop(t_pwarp_obj<double, double, IC>(rows, pi)); break;
+  case 25: loop(t_pwarp_obj<float, cf_type, IC>(rows, pi)); break;
 
   case 11: loop(t_pwarp_fun<float, float> (rows, pi)); break;
   case 12: loop(t_pwarp_fun<float, unsigned char>(rows, pi)); break;
@@ -214,15 +224,27 @@ test(Loop1P& loop, int what)
   case  0:
     std::cout
       << "pwarp -- Perspective_warp\n"
-      << " Object:\n"
+      << " Object, bilinear:\n"
       << "   -1 -- float\n"
       << "   -2 -- char\n"
+      << "   -3 -- unsigned short\n"
+      << "   -4 -- double (double coefficients)\n"
+      << "   -5 -- complex<float>\n"
+      << " Object, bicubic:\n"
+      << "  -21 -- float\n"
+      << "  -22 -- char\n"
+      << "  -23 -- unsigned short\n"
+      << "  -24 -- double (double coefficients)\n"
+      << "  -25 -- complex<float>\n"
       << " Funcion:\n"
       << "  -11 -- float\n"
       << "  -12 -- char\n"
       << "\n"
       << "Parameters:\n"
-      << "   -p:rows ROWS -- set image rows (default 16)\n"
+      << "   -p:rows ROWS -- set image rows (default 512)\n"
+      << "   -p:pi   IDX  -- set projection (default 0)\n"
+      << "\n"
+      << "-p:rows 2160 -start 12 -stop 12 warps 2160 x 4096 images.\n"
       ;
     
 
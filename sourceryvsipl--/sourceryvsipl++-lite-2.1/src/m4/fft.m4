@@ -12,7 +12,8 @@ AC_DEFUN([SVXX_CHECK_FFT],
 AC_ARG_ENABLE(fft,
   AS_HELP_STRING([--enable-fft],
                  [Specify list of FFT engines. Available engines are:
-                  fftw3, ipp, sal, cvsip, cbe_sdk, cuda, builtin, dft, or no_fft [[builtin]].]),,
+                  fftw3, ipp, sal, cvsip, cbe_sdk, cuda, builtin, native,
+                  dft, or no_fft [[builtin]].]),,
   [enable_fft=builtin])
   
 AC_ARG_WITH(fftw3_prefix,
@@ -53,6 +54,11 @@ AC_ARG_ENABLE(fftw3_simd,
 		  SIMD ISA]),,
   [enable_fftw3_simd=yes])
 
+AC_ARG_ENABLE(fftw3_threads,
+  AS_HELP_STRING([--disable-fftw3-threads],
+                 [Do not use multi-threaded FFTW3 plans.]),,
+  [enable_fftw3_threads=yes])
+
 #
 # Find the FFT backends.
 # At present, SAL, IPP, and FFTW3 are supported.
@@ -108,6 +114,16 @@ if test "$enable_fft_float" = yes -o \
 	  AC_MSG_ERROR([The cuda FFT backend requires --with-cuda.])
         fi
         ;;
+      native)
+        AC_SUBST(VSIP_IMPL_NATIVE_FFT, 1)
+        AC_DEFINE_UNQUOTED(VSIP_IMPL_NATIVE_FFT, 1,
+          [Define to enable native FFT backend.])
+        if test "$enable_fft_float" = yes; then provide_fft_float=1; fi
+        if test "$enable_fft_double" = yes; then provide_fft_double=1; fi
+        if test "$enable_fft_long_double" = yes; then
+          provide_fft_long_double=1
+        fi
+        ;;
       dft)
         AC_SUBST(VSIP_IMPL_DFT_FFT, 1)
         AC_DEFINE_UNQUOTED(VSIP_IMPL_DFT_FFT, 1,
@@ -189,6 +205,40 @@ if test "$enable_fftw3" != "no"; then
       [AC_MSG_RESULT([no.])
        LIBS=$keep_LIBS])
   fi
+  if test "$enable_fftw3_threads" = yes; then
+    # FFTW3 provides threads either in its main libraries (if built
+    # --with-combined-threads) or in separate _threads libraries.
+    syms=
+    thread_libs=
+    if test "$fftw_has_float" = 1; then
+      syms="$syms fftwf_init_threads();"
+      thread_libs="$thread_libs -lfftw3f_threads"
+    fi
+    if test "$fftw_has_double" = 1; then
+      syms="$syms fftw_init_threads();"
+      thread_libs="$thread_libs -lfftw3_threads"
+    fi
+    if test "$fftw_has_long_double" = 1; then
+      syms="$syms fftwl_init_threads();"
+      thread_libs="$thread_libs -lfftw3l_threads"
+    fi
+
+    AC_MSG_CHECKING([if external FFTW3 library supports threads])
+    keep_LIBS="$LIBS"
+    for try_libs in " " "$thread_libs"; do
+      LIBS="$try_libs $keep_LIBS -lpthread"
+      AC_LINK_IFELSE(
+        [AC_LANG_PROGRAM([#include <fftw3.h>], [$syms])],
+        [fftw_has_threads=1
+         break])
+    done
+    if test "$fftw_has_threads" = 1; then
+      AC_MSG_RESULT([yes.])
+    else
+      AC_MSG_RESULT([no.])
+      LIBS=$keep_LIBS
+    fi
+  fi
 fi
 if test "$enable_builtin_fft" != "no"; then
 
@@ -248,6 +298,10 @@ if test "$enable_builtin_fft" != "no"; then
         powerpc*)         fftw3_f_simd="--enable-altivec" ;;
       esac
     fi
+    if test "$enable_fftw3_threads" = "yes"; then
+      fftw_has_threads=1
+      fftw3_opts="$fftw3_opts --enable-threads --with-combined-threads"
+    fi
     AC_MSG_NOTICE([fftw3 config options: $fftw3_opts $fftw3_simd.])
 
     # We don't export CFLAGS to FFTW configure because this overrides its
@@ -296,6 +350,9 @@ if test "$enable_builtin_fft" != "no"; then
       (cd vendor/fftw3l; $fftw3_configure CC="$fftw_CC" $fftw3_l_simd $fftw3_opts $with_fftw3_cfg_opts --enable-long-double)
       libs="$libs -lfftw3l"
     fi
+    if test "$fftw_has_threads" = 1; then
+      libs="$libs -lpthread"
+    fi
 
     echo "==============================================================="
 
@@ -370,6 +427,9 @@ if test "$neutral_acconfig" = 'y'; then
   if test "$fftw_has_long_double" = 1; then
     CPPFLAGS="$CPPFLAGS -DVSIP_IMPL_FFTW3_HAVE_LONG_DOUBLE"
   fi
+  if test "$fftw_has_threads" = 1; then
+    CPPFLAGS="$CPPFLAGS -DVSIP_IMPL_FFTW3_HAVE_THREADS"
+  fi
 else
   if test "$fftw_has_float" = 1; then
     AC_DEFINE_UNQUOTED(VSIP_IMPL_FFTW3_HAVE_FLOAT, $fftw_has_float,
@@ -383,6 +443,10 @@ else
     AC_DEFINE_UNQUOTED(VSIP_IMPL_FFTW3_HAVE_LONG_DOUBLE, $fftw_has_long_double,
       [Define to 1 if -lfftw3l was found.])
   fi
+  if test "$fftw_has_threads" = 1; then
+    AC_DEFINE_UNQUOTED(VSIP_IMPL_FFTW3_HAVE_THREADS, $fftw_has_threads,
+      [Define to 1 if FFTW3 supports multi-threaded plans.])
+  fi
 fi
 
 ])
@@ -26,7 +26,7 @@ AC_DEFUN([SVXX_CHECK_PARALLEL],
 AC_ARG_ENABLE([parallel],
   AS_HELP_STRING([--enable-parallel],
                  [Use Parallel service. Available backends are:
-                  lam, mpich2, intelmpi, mpipro, and pas.
+                  lam, mpich2, intelmpi, mpipro, pas, and threads.
                   In addition, the value 'probe' causes configure to try.]),,
   [enable_parallel=probe])
 
@@ -313,6 +313,12 @@ then
         MPI_LIBS="-lmpipro"
         PAR_SERVICE="mpipro"
       ;;
+      threads)
+        # Shared-memory threads within a single process.
+        MPI_CPPFLAGS=""
+        MPI_LIBS="-lpthread"
+        PAR_SERVICE=threads
+      ;;
       *)
         AC_MSG_ERROR([Unknown MPI library $enable_parallel])
       ;;
@@ -340,6 +346,9 @@ then
   then vsipl_par_service=0
   elif test "$PAR_SERVICE" = "pas"
   then vsipl_par_service=2
+  elif test "$PAR_SERVICE" = "threads"
+  then vsipl_par_service=3
+    AC_SUBST(VSIP_IMPL_HAVE_THREADS, 1)
   else
     # must be MPI
     vsipl_par_service=1
@@ -362,7 +371,8 @@ then
   then CPPFLAGS="$CPPFLAGS -DVSIP_IMPL_PAR_SERVICE=$vsipl_par_service"
   else
     AC_DEFINE_UNQUOTED(VSIP_IMPL_PAR_SERVICE, $vsipl_par_service,
-      [Define to parallel service provided (0 == no service, 1 = MPI, 2 = PAS).])
+      [Define to parallel service provided (0 == no service, 1 = MPI, 2 = PAS,
+       3 = threads).])
   fi
 
   CPPFLAGS="$CPPFLAGS $MPI_CPPFLAGS"
@@ -0,0 +1,151 @@
+#! /usr/bin/perl
+
+#########################################################################
+# trace2json.pl -- Convert a binary VSIPL++ profiler trace to JSON	#
+#									#
+# author: agent								#
+# date:   2026-10-17							#
+#									#
+# Usage:								#
+#   trace2json.pl [-o <out.json>] <trace.bin>				#
+#									#
+# Reads a trace written with --vsipl++-profile-mode=trace and		#
+# --vsipl++-profile-format=binary, and writes it in the Chrome trace	#
+# event format, which chrome://tracing and Perfetto can display.	#
+#									#
+# Options:								#
+#   -o <out.json>							#
+#		-- write output to <out.json> (instead of standard	#
+#		   output).						#
+#########################################################################
+
+use strict;
+
+
+
+# --------------------------------------------------------------------- #
+# json_string -- quote a string for JSON
+# --------------------------------------------------------------------- #
+sub json_string {
+    my ($str) = @_;
+    $str =~ s/(["\\])/\\$1/g;
+    $str =~ s/([\x00-\x1f])/sprintf("\\u%04x", ord($1))/ge;
+    return "\"$str\"";
+}
+
+
+
+# --------------------------------------------------------------------- #
+# read_bytes -- read exactly N bytes from a file handle
+# --------------------------------------------------------------------- #
+sub read_bytes {
+    my ($fh, $n) = @_;
+    my $buf = '';
+    return $buf if ($n == 0);
+    my $got = read($fh, $buf, $n);
+    die "Truncated trace file\n" if (!defined $got || $got != $n);
+    return $buf;
+}
+
+
+
+# --------------------------------------------------------------------- #
+# convert -- convert a binary trace
+# --------------------------------------------------------------------- #
+sub convert {
+    my ($file, $out) = @_;
+
+    open(my $in, '<', $file) || die "Can't read '$file': $!\n";
+    binmode($in);
+
+    die "'$file' is not a VSIPL++ binary trace\n"
+	if (read_bytes($in, 8) ne "SVPPTRC1");
+
+    # The trace is in the byte order of the host that wrote it.
+    my $order = read_bytes($in, 4);
+    my $e;
+    if    (unpack('V', $order) == 0x01020304) { $e = '<'; }
+    elsif (unpack('N', $order) == 0x01020304) { $e = '>'; }
+    else  { die "Unknown byte order in '$file'\n"; }
+
+    my ($clocks_per_sec) = unpack("Q$e", read_bytes($in, 8));
+    $clocks_per_sec = 1 if ($clocks_per_sec == 0);
+
+    my ($num_names) = unpack("L$e", read_bytes($in, 4));
+    my @name = ('');
+    foreach my $id (1 .. $num_names) {
+	my ($len) = unpack("L$e", read_bytes($in, 4));
+	push @name, json_string(read_bytes($in, $len));
+    }
+
+    my @events;
+    my $t0;
+    my ($num_threads) = unpack("L$e", read_bytes($in, 4));
+    foreach my $t (1 .. $num_threads) {
+	my ($tid, $pad, $count, $dropped) =
+	    unpack("L$e L$e Q$e Q$e", read_bytes($in, 24));
+
+	push @events, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0," .
+	    "\"tid\":$tid,\"args\":{\"name\":\"thread $tid\"}}";
+
+	# Ends of events whose start was dropped are skipped.
+	my %open;
+	foreach my $i (1 .. $count) {
+	    my ($ticks, $id, $idx, $end, $value) =
+		unpack("Q$e L$e l$e l$e l$e", read_bytes($in, 24));
+	    $t0 = $ticks if (!defined $t0 || $ticks < $t0);
+	    if ($end == 0) {
+		$open{$idx} = 1;
+		push @events, [$ticks, "{\"name\":$name[$id]," .
+			       "\"cat\":\"vsipl++\",\"ph\":\"B\",\"pid\":0," .
+			       "\"tid\":$tid,\"ts\":",
+			       ",\"args\":{\"ops\":$value}}"];
+	    }
+	    elsif (delete $open{$end}) {
+		push @events, [$ticks, "{\"name\":$name[$id]," .
+			       "\"cat\":\"vsipl++\",\"ph\":\"E\",\"pid\":0," .
+			       "\"tid\":$tid,\"ts\":", "}"];
+	    }
+	}
+    }
+    close($in);
+
+    # Time stamps are in microseconds from the first event.
+    print $out "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    my $sep = '';
+    foreach my $ev (@events) {
+	if (ref $ev) {
+	    my $us = ($ev->[0] - $t0) * 1e6 / $clocks_per_sec;
+	    print $out $sep, $ev->[1], sprintf("%.3f", $us), $ev->[2];
+	}
+	else {
+	    print $out $sep, $ev;
+	}
+	$sep = ",\n";
+    }
+    print $out "\n]}\n";
+}
+
+
+
+# --------------------------------------------------------------------- #
+my $out_file;
+my @files;
+
+while (@ARGV) {
+    my $arg = shift @ARGV;
+    if ($arg eq '-o') {
+	$out_file = shift @ARGV;
+    }
+    else {
+	push @files, $arg;
+    }
+}
+
+die "usage: trace2json.pl [-o <out.json>] <trace.bin>\n" if (@files != 1);
+
+my $out = \*STDOUT;
+if (defined $out_file) {
+    open($out, '>', $out_file) || die "Can't write '$out_file': $!\n";
+}
+convert($files[0], $out);
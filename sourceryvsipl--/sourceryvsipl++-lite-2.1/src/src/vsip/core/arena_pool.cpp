@@ -0,0 +1,282 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/arena_pool.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Arena memory pool and scratch scopes.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <algorithm>
+#include <cassert>
+
+#include <vsip/core/arena_pool.hpp>
+#include <vsip/core/aligned_pool.hpp>
+#include <vsip/core/allocation.hpp>
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+
+namespace impl
+{
+
+namespace
+{
+
+// Scratch arenas are per-thread.  Without thread-local storage
+// Scratch_scope has no effect.
+
+size_t const scratch_chunk_size = 1 << 20;
+
+#ifdef VSIP_IMPL_THREAD_LOCAL
+VSIP_IMPL_THREAD_LOCAL Arena_pool* scratch_arena = 0;
+VSIP_IMPL_THREAD_LOCAL unsigned    scratch_depth = 0;
+#endif
+
+inline size_t
+round_up(size_t size, size_t align)
+{
+  return (size + align - 1) & ~(align - 1);
+}
+
+} // namespace vsip::impl::<unnamed>
+
+
+
+Arena_pool::Arena_pool(size_t chunk_size)
+  : chunk_size_(round_up(std::max(chunk_size, align), align)),
+    current_   (0),
+    offset_    (0),
+    live_      (0)
+{}
+
+Arena_pool::~Arena_pool()
+{
+  for (index_type i=0; i<chunks_.size(); ++i)
+    free_align(chunks_[i].base);
+}
+
+
+
+void*
+Arena_pool::impl_allocate(size_t size)
+{
+  // If size == 0, allocate one unit of alignment.
+  size = size ? round_up(size, align) : align;
+
+  // Reuse a released block of the same size.
+  Free_list* list = free_list(size);
+  if (list && list->head)
+  {
+    char* ptr = list->head;
+    list->head = *reinterpret_cast<char**>(ptr);
+    ++live_;
+    return ptr;
+  }
+
+  // Move on to the first chunk with enough room left, which is
+  // reached in the same way each time the arena is replayed.
+  while (current_ < chunks_.size() &&
+	 offset_ + size > chunks_[current_].size)
+  {
+    ++current_;
+    offset_ = 0;
+  }
+
+  if (current_ == chunks_.size())
+  {
+    Chunk chunk;
+    chunk.size = std::max(size, chunk_size_);
+    chunk.base = alloc_align<char>(align, chunk.size);
+    if (chunk.base == 0)
+      VSIP_IMPL_THROW(std::bad_alloc());
+    chunks_.push_back(chunk);
+    offset_ = 0;
+  }
+
+  char* ptr = chunks_[current_].base + offset_;
+  offset_ += size;
+  ++live_;
+  return ptr;
+}
+
+
+
+void
+Arena_pool::impl_deallocate(void* ptr, size_t size)
+{
+  size = size ? round_up(size, align) : align;
+
+  assert(live_ > 0);
+  if (--live_ == 0)
+  {
+    current_ = 0;
+    offset_  = 0;
+    for (index_type i=0; i<free_.size(); ++i)
+      free_[i].head = 0;
+  }
+  else if (current_ < chunks_.size() &&
+	   static_cast<char*>(ptr) + size == chunks_[current_].base + offset_)
+    offset_ -= size;
+  else
+  {
+    // The size entry is kept once created, so that a steady state of
+    // allocations does not grow free_.
+    Free_list* list = free_list(size);
+    if (list == 0)
+    {
+      Free_list entry;
+      entry.size = size;
+      entry.head = 0;
+      free_.push_back(entry);
+      list = &free_.back();
+    }
+    *reinterpret_cast<char**>(ptr) = list->head;
+    list->head = static_cast<char*>(ptr);
+  }
+}
+
+
+
+char const*
+Arena_pool::name()
+{
+  return "Arena_pool";
+}
+
+
+
+Arena_pool::Mark
+Arena_pool::mark() const
+{
+  Mark mark;
+  mark.chunk  = current_;
+  mark.offset = offset_;
+  return mark;
+}
+
+
+
+// live_ is left alone: blocks allocated since MARK have been released,
+// and blocks from before MARK released since then have already been
+// counted.
+
+void
+Arena_pool::rewind(Mark const& mark)
+{
+  if (live_ == 0)
+  {
+    current_ = 0;
+    offset_  = 0;
+    for (index_type i=0; i<free_.size(); ++i)
+      free_[i].head = 0;
+  }
+  else if (mark.chunk < current_ ||
+	   (mark.chunk == current_ && mark.offset < offset_))
+  {
+    drop_free(mark);
+    current_ = mark.chunk;
+    offset_  = mark.offset;
+  }
+}
+
+
+
+Arena_pool::Free_list*
+Arena_pool::free_list(size_t size)
+{
+  for (index_type i=0; i<free_.size(); ++i)
+    if (free_[i].size == size)
+      return &free_[i];
+  return 0;
+}
+
+
+
+// Remove the released blocks that lie past MARK, whose memory is
+// handed out again by bumping.
+
+void
+Arena_pool::drop_free(Mark const& mark)
+{
+  for (index_type i=0; i<free_.size(); ++i)
+  {
+    char** link = &free_[i].head;
+    while (*link)
+    {
+      char* ptr = *link;
+      index_type c = 0;
+      while (ptr < chunks_[c].base || ptr >= chunks_[c].base + chunks_[c].size)
+	++c;
+      if (c > mark.chunk ||
+	  (c == mark.chunk && size_t(ptr - chunks_[c].base) >= mark.offset))
+	*link = *reinterpret_cast<char**>(ptr);
+      else
+	link = reinterpret_cast<char**>(ptr);
+    }
+  }
+}
+
+
+
+Scratch_scope::Scratch_scope()
+  : arena_(0)
+{
+#ifdef VSIP_IMPL_THREAD_LOCAL
+  // The arena is kept for the lifetime of the thread, so that each
+  // scope reuses the chunks of the previous ones.
+  if (scratch_arena == 0)
+    scratch_arena = new Arena_pool(scratch_chunk_size);
+  arena_ = scratch_arena;
+  mark_  = arena_->mark();
+  ++scratch_depth;
+#endif
+}
+
+Scratch_scope::~Scratch_scope()
+{
+#ifdef VSIP_IMPL_THREAD_LOCAL
+  --scratch_depth;
+  arena_->rewind(mark_);
+#endif
+}
+
+Arena_pool*
+Scratch_scope::arena()
+{
+#ifdef VSIP_IMPL_THREAD_LOCAL
+  return scratch_arena;
+#else
+  return 0;
+#endif
+}
+
+
+
+Memory_pool*
+temporary_pool()
+{
+#ifdef VSIP_IMPL_THREAD_LOCAL
+  if (scratch_depth)
+    return scratch_arena;
+#endif
+  if (default_pool)
+    return default_pool;
+
+  // Temporaries created outside of vsipl initialization.
+  static Aligned_pool fallback;
+  return &fallback;
+}
+
+} // namespace vsip::impl
+
+} // namespace vsip
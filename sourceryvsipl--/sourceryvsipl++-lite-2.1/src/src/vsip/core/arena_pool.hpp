@@ -0,0 +1,154 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/arena_pool.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Arena memory pool and scratch scopes.
+*/
+
+#ifndef VSIP_CORE_ARENA_POOL_HPP
+#define VSIP_CORE_ARENA_POOL_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vector>
+
+#include <vsip/core/config.hpp>
+#include <vsip/core/memory_pool.hpp>
+#include <vsip/core/noncopyable.hpp>
+#include <vsip/support.hpp>
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+
+namespace impl
+{
+
+/// Bump-pointer memory pool.
+///
+/// Memory is carved sequentially out of chunks, which are obtained
+/// from the system allocator once and kept until the pool is
+/// destroyed.  Deallocating the most recent block returns its memory
+/// at once; other blocks are kept on a free list for their size and
+/// reused by later requests of the same size.  All memory is reclaimed
+/// when no block remains live, and blocks allocated since a mark are
+/// reclaimed by rewinding the pool to it.  A program that repeats the
+/// same sequence of allocations thus calls the system allocator only
+/// during the first repetition, even when long-lived blocks stay
+/// allocated.
+///
+/// Arena_pool is not thread-safe.
+
+class Arena_pool
+  : public Memory_pool
+{
+public:
+  static size_t const align = VSIP_IMPL_ALLOC_ALIGNMENT;
+  static size_t const default_chunk_size = 4 << 20;
+
+  /// Allocation state saved by mark() and restored by rewind().
+  struct Mark
+  {
+    length_type chunk;
+    size_t      offset;
+  };
+
+  // Constructors and destructor.
+public:
+  Arena_pool(size_t chunk_size = default_chunk_size);
+  ~Arena_pool();
+
+  // Memory_pool accessors.
+public:
+  void* impl_allocate(size_t size);
+  void  impl_deallocate(void* ptr, size_t size);
+
+  char const* name();
+
+  // Impl accessors.
+public:
+  Mark mark() const;
+
+  /// Reclaim the memory of all blocks allocated since MARK was taken.
+  /// Blocks that reused released memory from before MARK are reclaimed
+  /// only when the arena next becomes empty.
+  ///
+  /// Requires:
+  ///   Blocks allocated since MARK have been deallocated.
+  void rewind(Mark const& mark);
+
+  /// Number of chunks obtained from the system allocator.
+  length_type chunks() const { return chunks_.size(); }
+
+  /// Number of blocks allocated and not yet released.
+  length_type live() const { return live_; }
+
+private:
+  struct Chunk
+  {
+    char*  base;
+    size_t size;
+  };
+
+  // Released blocks of one size, linked through their first word.
+  struct Free_list
+  {
+    size_t size;
+    char*  head;
+  };
+
+  Free_list* free_list(size_t size);
+  void       drop_free(Mark const& mark);
+
+  size_t                 chunk_size_;
+  std::vector<Chunk>     chunks_;
+  std::vector<Free_list> free_;	// one per size released so far
+  length_type            current_;	// chunk being allocated from
+  size_t                 offset_;	// next free byte in current chunk
+  length_type            live_;
+};
+
+
+
+/// Scratch scope.
+///
+/// While a Scratch_scope is active, temporary_pool() returns an arena
+/// private to the calling thread.  Temporaries created by expression
+/// evaluation (return blocks of functions such as FFTs and the
+/// buffers of Ext_data and Rt_ext_data copies) draw from it, and their
+/// memory is reclaimed together when the scope ends.  Placing a
+/// Scratch_scope in the body of a processing loop keeps the steady
+/// state of the loop free of calls to the system allocator.
+///
+/// Scopes nest.  Views that outlive a scope must not be created
+/// from temporary_pool() inside it.
+
+class Scratch_scope : Non_copyable
+{
+public:
+  Scratch_scope();
+  ~Scratch_scope();
+
+  /// The calling thread's scratch arena, or 0 if it has none yet.
+  static Arena_pool* arena();
+
+private:
+  Arena_pool*      arena_;
+  Arena_pool::Mark mark_;
+};
+
+
+
+} // namespace vsip::impl
+
+} // namespace vsip
+
+#endif // VSIP_CORE_ARENA_POOL_HPP
@@ -16,6 +16,8 @@
   cfg << "  VSIP_IMPL_PAR_SERVICE             - 1 (MPI)\n";
 #elif VSIP_IMPL_PAR_SERVICE == 2
   cfg << "  VSIP_IMPL_PAR_SERVICE             - 2 (PAS)\n";
+#elif VSIP_IMPL_PAR_SERVICE == 3
+  cfg << "  VSIP_IMPL_PAR_SERVICE             - 3 (Threads)\n";
 #else
   cfg << "  VSIP_IMPL_HAVE_SIMD_LOOP_FUSION   - Unknown\n";
 #endif
@@ -140,6 +142,12 @@
   cfg << "  VSIP_IMPL_SAL_FFT                 - 0\n";
 #endif
 
+#if VSIP_IMPL_NATIVE_FFT
+  cfg << "  VSIP_IMPL_NATIVE_FFT              - 1\n";
+#else
+  cfg << "  VSIP_IMPL_NATIVE_FFT              - 0\n";
+#endif
+
 #if VSIP_IMPL_DFT_FFT
   cfg << "  VSIP_IMPL_DFT_FFT                 - 1\n";
 #else
@@ -36,6 +36,14 @@
 # define VSIP_IMPL_IPP_CALL
 #endif
 
+// Storage class for thread-local variables, if the compiler supports
+// them.
+#if defined(_MSC_VER)
+# define VSIP_IMPL_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+# define VSIP_IMPL_THREAD_LOCAL __thread
+#endif
+
 // autoconf defines them
 #undef PACKAGE_NAME
 #undef PACKAGE_STRING
@@ -61,8 +69,8 @@
   Parallel Configuration
 ***********************************************************************/
 
-#if VSIP_IMPL_PAR_SERVICE == 1
-// MPI
+#if VSIP_IMPL_PAR_SERVICE == 1 || VSIP_IMPL_PAR_SERVICE == 3
+// MPI or shared-memory threads
 
 /// VSIP_DIST_LEVEL describes the implementations distribution support
 /// level [dpp.distlevel]:
@@ -75,8 +83,8 @@
 /// VSIP_IMPL_USE_PAS_SEGMENT_SIZE indicates whether PAS or VSIPL++
 /// algorithm for choosing segment sizes should be used.  When using
 /// PAS, this must be 1 so that VSIPL++ and PAS agree on how data
-/// is distributed.  When using MPI, this can be either 0 or 1, but
-/// the PAS algorithm results in empty blocks in some cases.
+/// is distributed.  When using MPI or threads, this can be either 0
+/// or 1, but the PAS algorithm results in empty blocks in some cases.
 #  define VSIP_IMPL_USE_PAS_SEGMENT_SIZE 0
 
 #elif VSIP_IMPL_PAR_SERVICE == 2
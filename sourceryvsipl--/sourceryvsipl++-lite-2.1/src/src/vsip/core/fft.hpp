@@ -49,6 +49,9 @@
 #if VSIP_IMPL_CVSIP_FFT
 # include <vsip/core/cvsip/fft.hpp>
 #endif
+#if VSIP_IMPL_NATIVE_FFT
+# include <vsip/core/fft/native.hpp>
+#endif
 #if VSIP_IMPL_DFT_FFT
 # include <vsip/core/fft/dft.hpp>
 #endif
@@ -79,6 +82,26 @@ struct Diagnose_fft;
 struct Diagnose_fftm;
 }
 
+/// Is_fft_avail<T>::value is true if FFTs of type T are available.
+template <typename T>
+struct Is_fft_avail { static bool const value = false;};
+
+template <typename T>
+struct Is_fft_avail<complex<T> > : Is_fft_avail<T> {};
+
+#if VSIP_IMPL_PROVIDE_FFT_FLOAT
+template <>
+struct Is_fft_avail<float> { static bool const value = true;};
+#endif
+#if VSIP_IMPL_PROVIDE_FFT_DOUBLE
+template <>
+struct Is_fft_avail<double> { static bool const value = true;};
+#endif
+#if VSIP_IMPL_PROVIDE_FFT_LONG_DOUBLE
+template <>
+struct Is_fft_avail<long double> { static bool const value = true;};
+#endif
+
 namespace fft
 {
 
@@ -111,6 +134,9 @@ typedef Make_type_list<
 #if VSIP_IMPL_CVSIP_FFT
   Cvsip_tag,
 #endif
+#if VSIP_IMPL_NATIVE_FFT
+  Native_tag,
+#endif
 #if VSIP_IMPL_DFT_FFT
   DFT_tag,
 #endif
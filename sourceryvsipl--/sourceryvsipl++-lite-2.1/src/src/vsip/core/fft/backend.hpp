@@ -498,6 +498,9 @@ public:
   virtual ~fftm() {}
   virtual char const* name() { return "fftm-backend-complex"; }
   virtual bool supports_scale() { return false;}
+  /// True if by_reference may be called concurrently from several
+  /// threads, on distinct data.
+  virtual bool reentrant() { return false;}
   virtual void query_layout(Rt_layout<2> &rtl_inout)
   {
     // By default use unit_stride,
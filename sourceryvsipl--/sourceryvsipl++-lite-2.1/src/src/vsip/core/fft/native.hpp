@@ -0,0 +1,1043 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/fft/native.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Native FFT backend.
+
+    This backend needs no external library.  It computes transforms
+    of any size in O(N log N) operations with Native_plan, and is used
+    in place of the DFT backend when no FFT library is available.
+*/
+
+#ifndef VSIP_CORE_FFT_NATIVE_HPP
+#define VSIP_CORE_FFT_NATIVE_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cassert>
+#include <memory>
+
+#include <vsip/support.hpp>
+#include <vsip/domain.hpp>
+#include <vsip/core/fft/factory.hpp>
+#include <vsip/core/fft/util.hpp>
+#include <vsip/core/fft/native_plan.hpp>
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace fft
+{
+
+template <typename T>
+inline std::complex<T>*
+native_offset(std::complex<T>* data, stride_type o)
+{
+  return data + o;
+}
+
+template <typename T>
+inline std::pair<T*, T*>
+native_offset(std::pair<T*, T*> data, stride_type o)
+{
+  return std::make_pair(data.first + o, data.second + o);
+}
+
+/// Gather N complex values with stride S into split arrays.
+template <typename T>
+inline void
+native_load(std::complex<T> const* in, stride_type s, length_type n,
+	    T* re, T* im)
+{
+  for (index_type i = 0; i < n; ++i)
+  {
+    re[i] = in[i * s].real();
+    im[i] = in[i * s].imag();
+  }
+}
+
+template <typename T>
+inline void
+native_load(std::pair<T*, T*> in, stride_type s, length_type n,
+	    T* re, T* im)
+{
+  for (index_type i = 0; i < n; ++i)
+  {
+    re[i] = in.first[i * s];
+    im[i] = in.second[i * s];
+  }
+}
+
+/// Scatter N complex values from split arrays with stride S.
+template <typename T>
+inline void
+native_store(T const* re, T const* im, length_type n,
+	     std::complex<T>* out, stride_type s)
+{
+  for (index_type i = 0; i < n; ++i)
+    out[i * s] = std::complex<T>(re[i], im[i]);
+}
+
+template <typename T>
+inline void
+native_store(T const* re, T const* im, length_type n,
+	     std::pair<T*, T*> out, stride_type s)
+{
+  for (index_type i = 0; i < n; ++i)
+  {
+    out.first[i * s]  = re[i];
+    out.second[i * s] = im[i];
+  }
+}
+
+
+
+/// Transforms of a fixed size along lines of strided data.
+///
+/// Each method transforms COUNT lines.  Line i starts at IN + i
+/// IN_STEP and OUT + i OUT_STEP, and its elements are IN_S and OUT_S
+/// apart.  Complex data may be interleaved or split; input and output
+/// may be the same.  Unless the size is odd, real transforms use a
+/// complex plan of half the size.
+
+template <typename T>
+class Native_line : Non_copyable
+{
+  typedef std::complex<T> ctype;
+  typedef std::pair<T*, T*> ztype;
+
+public:
+  Native_line(length_type size, bool real)
+    : size_(size),
+      half_(real && size % 2 == 0),
+      plan_(half_ ? size / 2 : size),
+      work_(2 * (size / 2 + 1)),
+      twiddle_(half_ ? 2 * (size / 2 + 1) : 1)
+  {
+    if (half_)
+    {
+      // W^k = exp(-2 pi i k / SIZE)
+      typedef typename Native_trig<T>::type trig_type;
+      length_type const h = size / 2;
+      for (index_type k = 0; k <= h; ++k)
+      {
+	trig_type phi = 2 * trig_type(VSIP_IMPL_PI) * trig_type(k)
+	              / trig_type(size);
+	twiddle_[k]         = T(std::cos(phi));
+	twiddle_[h + 1 + k] = T(-std::sin(phi));
+      }
+    }
+  }
+
+  length_type size() const { return size_;}
+
+  /// Complex transforms, with exponent sign EXP.
+  template <typename P, typename Q>
+  void c2c(length_type count,
+	   P in,  stride_type in_step,  stride_type in_s,
+	   Q out, stride_type out_step, stride_type out_s,
+	   int exp)
+  {
+    ztype buf = plan_.input();
+    for (index_type i = 0; i < count; ++i)
+    {
+      if (exp < 0)
+      {
+	native_load(native_offset(in, i * in_step), in_s, size_,
+		    buf.first, buf.second);
+	ztype y = plan_.execute();
+	native_store(y.first, y.second, size_,
+		     native_offset(out, i * out_step), out_s);
+      }
+      else
+      {
+	native_load(native_offset(in, i * in_step), in_s, size_,
+		    buf.second, buf.first);
+	ztype y = plan_.execute();
+	native_store(y.second, y.first, size_,
+		     native_offset(out, i * out_step), out_s);
+      }
+    }
+  }
+
+  /// Real forward transforms, producing SIZE/2 + 1 values per line.
+  template <typename Q>
+  void r2c(length_type count,
+	   T*  in,  stride_type in_step,  stride_type in_s,
+	   Q   out, stride_type out_step, stride_type out_s)
+  {
+    length_type const h = size_ / 2;
+    ztype buf = plan_.input();
+    T* xr = work_.get();
+    T* xi = xr + h + 1;
+    for (index_type i = 0; i < count; ++i)
+    {
+      T const* x = in + i * in_step;
+      if (!half_)
+      {
+	for (index_type n = 0; n < size_; ++n)
+	{
+	  buf.first[n]  = x[n * in_s];
+	  buf.second[n] = T();
+	}
+	ztype y = plan_.execute();
+	native_store(y.first, y.second, h + 1,
+		     native_offset(out, i * out_step), out_s);
+	continue;
+      }
+
+      // z_n = x_2n + i x_2n+1.  With Z = FFT(z) and W = exp(-2 pi i/N),
+      // X_k = (Z_k + conj(Z_h-k))/2 - i W^k (Z_k - conj(Z_h-k))/2.
+      for (index_type n = 0; n < h; ++n)
+      {
+	buf.first[n]  = x[2 * n * in_s];
+	buf.second[n] = x[(2 * n + 1) * in_s];
+      }
+      ztype z = plan_.execute();
+      T const* wr = twiddle_.get();
+      T const* wi = wr + h + 1;
+      for (index_type k = 0; k <= h; ++k)
+      {
+	index_type a = k == h ? 0 : k;
+	index_type b = k == 0 ? 0 : h - k;
+	T ar = z.first[a], ai = z.second[a];
+	T br = z.first[b], bi = -z.second[b];
+	T er = T(0.5) * (ar + br), ei = T(0.5) * (ai + bi);
+	T or_ = T(0.5) * (ai - bi), oi = T(0.5) * (br - ar);
+	xr[k] = er + wr[k] * or_ - wi[k] * oi;
+	xi[k] = ei + wr[k] * oi + wi[k] * or_;
+      }
+      native_store(xr, xi, h + 1, native_offset(out, i * out_step), out_s);
+    }
+  }
+
+  /// Real inverse transforms, reading SIZE/2 + 1 values per line.
+  template <typename P>
+  void c2r(length_type count,
+	   P   in,  stride_type in_step,  stride_type in_s,
+	   T*  out, stride_type out_step, stride_type out_s)
+  {
+    length_type const h = size_ / 2;
+    ztype buf = plan_.input();
+    T* xr = work_.get();
+    T* xi = xr + h + 1;
+    for (index_type i = 0; i < count; ++i)
+    {
+      T* x = out + i * out_step;
+      native_load(native_offset(in, i * in_step), in_s, h + 1, xr, xi);
+      if (!half_)
+      {
+	// Extend the spectrum by symmetry; the inverse DFT exchanges
+	// real and imaginary parts.
+	for (index_type k = 0; k < size_; ++k)
+	{
+	  bool lower = k <= h;
+	  index_type j = lower ? k : size_ - k;
+	  buf.first[k]  = lower ? xi[j] : -xi[j];
+	  buf.second[k] = xr[j];
+	}
+	ztype y = plan_.execute();
+	for (index_type n = 0; n < size_; ++n)
+	  x[n * out_s] = y.second[n];
+	continue;
+      }
+
+      // Z_k = (X_k + conj(X_h-k)) + i W^-k (X_k - conj(X_h-k)), whose
+      // inverse DFT is z_n = x_2n + i x_2n+1.
+      T const* wr = twiddle_.get();
+      T const* wi = wr + h + 1;
+      for (index_type k = 0; k < h; ++k)
+      {
+	T ar = xr[k],     ai = xi[k];
+	T br = xr[h - k], bi = -xi[h - k];
+	T er = ar + br, ei = ai + bi;
+	T dr = ar - br, di = ai - bi;
+	T or_ = dr * wr[k] + di * wi[k];
+	T oi  = di * wr[k] - dr * wi[k];
+	buf.first[k]  = ei + or_;
+	buf.second[k] = er - oi;
+      }
+      ztype z = plan_.execute();
+      for (index_type n = 0; n < h; ++n)
+      {
+	x[2 * n * out_s]       = z.second[n];
+	x[(2 * n + 1) * out_s] = z.first[n];
+      }
+    }
+  }
+
+private:
+  length_type      size_;
+  bool             half_;
+  Native_plan<T>   plan_;
+  aligned_array<T> work_;
+  aligned_array<T> twiddle_;
+};
+
+
+
+/// Multi-dimensional transforms, computed one axis at a time.
+///
+/// Arrays have up to three axes, given by their logical sizes and by
+/// the strides of the input and output.  Unused axes have size 1.
+/// REAL_AXIS is the axis of real transforms, or -1.
+
+template <typename T>
+class Native_nd : Non_copyable
+{
+  typedef std::complex<T> ctype;
+
+public:
+  template <dimension_type D>
+  Native_nd(Domain<D> const& dom, int real_axis)
+    : real_axis_(real_axis),
+      tmp_(1)
+  {
+    length_type tmp_size = 1;
+    for (dimension_type d = 0; d < 3; ++d)
+    {
+      size_[d] = d < D ? dom[d].size() : 1;
+      line_[d].reset(new Native_line<T>(size_[d], int(d) == real_axis));
+      tmp_size *= int(d) == real_axis ? size_[d] / 2 + 1 : size_[d];
+    }
+    if (real_axis >= 0)
+    {
+      aligned_array<ctype> tmp(tmp_size);
+      tmp_ = tmp;
+    }
+  }
+
+  template <typename P, typename Q>
+  void c2c(P in, stride_type const* in_s, Q out, stride_type const* out_s,
+	   int exp)
+  {
+    pass_c2c(2, size_, in, in_s, out, out_s, exp);
+    for (dimension_type d = 0; d < 2; ++d)
+      if (size_[d] > 1)
+	pass_c2c(d, size_, out, out_s, out, out_s, exp);
+  }
+
+  template <typename Q>
+  void r2c(T* in, stride_type const* in_s, Q out, stride_type const* out_s)
+  {
+    dimension_type const a = real_axis_;
+    length_type ext[3] = { size_[0], size_[1], size_[2] };
+
+    pass_r2c(a, ext, in, in_s, out, out_s);
+    ext[a] = size_[a] / 2 + 1;
+    for (dimension_type d = 0; d < 3; ++d)
+      if (d != a && size_[d] > 1)
+	pass_c2c(d, ext, out, out_s, out, out_s, -1);
+  }
+
+  /// The input is left unchanged; intermediate results are kept in a
+  /// dense temporary.
+  template <typename P>
+  void c2r(P in, stride_type const* in_s, T* out, stride_type const* out_s)
+  {
+    dimension_type const a = real_axis_;
+    length_type ext[3] = { size_[0], size_[1], size_[2] };
+    ext[a] = size_[a] / 2 + 1;
+    stride_type tmp_s[3] = { stride_type(ext[1] * ext[2]),
+			     stride_type(ext[2]), 1 };
+    ctype* tmp = tmp_.get();
+
+    bool copied = false;
+    for (dimension_type d = 0; d < 3; ++d)
+      if (d != a && (size_[d] > 1 || !copied))
+      {
+	if (copied)
+	  pass_c2c(d, ext, tmp, tmp_s, tmp, tmp_s, 1);
+	else
+	  pass_c2c(d, ext, in, in_s, tmp, tmp_s, 1);
+	copied = true;
+      }
+    ext[a] = size_[a];
+    pass_c2r(a, ext, tmp, tmp_s, out, out_s);
+  }
+
+private:
+  // Apply the transform of axis D to all lines of an array of extents
+  // EXT along D.
+  template <typename P, typename Q>
+  void pass_c2c(dimension_type d, length_type const* ext,
+		P in, stride_type const* in_s,
+		Q out, stride_type const* out_s, int exp)
+  {
+    dimension_type o1 = d == 0 ? 1 : 0;
+    dimension_type o2 = d == 2 ? 1 : 2;
+    for (index_type i = 0; i < ext[o1]; ++i)
+      line_[d]->c2c(ext[o2],
+		    native_offset(in, i * in_s[o1]), in_s[o2], in_s[d],
+		    native_offset(out, i * out_s[o1]), out_s[o2], out_s[d],
+		    exp);
+  }
+
+  template <typename Q>
+  void pass_r2c(dimension_type d, length_type const* ext,
+		T* in, stride_type const* in_s,
+		Q out, stride_type const* out_s)
+  {
+    dimension_type o1 = d == 0 ? 1 : 0;
+    dimension_type o2 = d == 2 ? 1 : 2;
+    for (index_type i = 0; i < ext[o1]; ++i)
+      line_[d]->r2c(ext[o2],
+		    in + i * in_s[o1], in_s[o2], in_s[d],
+		    native_offset(out, i * out_s[o1]), out_s[o2], out_s[d]);
+  }
+
+  template <typename P>
+  void pass_c2r(dimension_type d, length_type const* ext,
+		P in, stride_type const* in_s,
+		T* out, stride_type const* out_s)
+  {
+    dimension_type o1 = d == 0 ? 1 : 0;
+    dimension_type o2 = d == 2 ? 1 : 2;
+    for (index_type i = 0; i < ext[o1]; ++i)
+      line_[d]->c2r(ext[o2],
+		    native_offset(in, i * in_s[o1]), in_s[o2], in_s[d],
+		    out + i * out_s[o1], out_s[o2], out_s[d]);
+  }
+
+  int                               real_axis_;
+  length_type                       size_[3];
+  std::auto_ptr<Native_line<T> >    line_[3];
+  aligned_array<ctype>              tmp_;
+};
+
+
+
+template <dimension_type D, typename I, typename O, int A, int E>
+class native;
+
+// 1D complex -> complex FFT
+template <typename T, int A, int E>
+class native<1, std::complex<T>, std::complex<T>, A, E>
+  : public fft::backend<1, std::complex<T>, std::complex<T>, A, E>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  native(Domain<1> const& dom) : line_(dom.size(), false) {}
+
+  virtual char const* name() { return "fft-native-1D-complex"; }
+  virtual void query_layout(Rt_layout<1> &) {}
+  virtual void query_layout(Rt_layout<1> &rtl_in, Rt_layout<1> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void in_place(ctype *inout, stride_type s, length_type l)
+  {
+    assert(l == line_.size());
+    line_.c2c(1, inout, 0, s, inout, 0, s, E);
+  }
+  virtual void in_place(ztype inout, stride_type s, length_type l)
+  {
+    assert(l == line_.size());
+    line_.c2c(1, inout, 0, s, inout, 0, s, E);
+  }
+  virtual void by_reference(ctype *in, stride_type in_s,
+			    ctype *out, stride_type out_s,
+			    length_type l)
+  {
+    assert(l == line_.size());
+    line_.c2c(1, in, 0, in_s, out, 0, out_s, E);
+  }
+  virtual void by_reference(ztype in, stride_type in_s,
+			    ztype out, stride_type out_s,
+			    length_type l)
+  {
+    assert(l == line_.size());
+    line_.c2c(1, in, 0, in_s, out, 0, out_s, E);
+  }
+
+private:
+  Native_line<T> line_;
+};
+
+// 1D real -> complex FFT
+template <typename T, int A>
+class native<1, T, std::complex<T>, A, -1>
+  : public fft::backend<1, T, std::complex<T>, A, -1>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  native(Domain<1> const& dom) : line_(dom.size(), true) {}
+
+  virtual char const* name() { return "fft-native-1D-real-forward"; }
+  virtual void query_layout(Rt_layout<1> &rtl_in, Rt_layout<1> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void by_reference(rtype *in, stride_type in_s,
+			    ctype *out, stride_type out_s,
+			    length_type l)
+  {
+    assert(l == line_.size());
+    line_.r2c(1, in, 0, in_s, out, 0, out_s);
+  }
+  virtual void by_reference(rtype *in, stride_type in_s,
+			    ztype out, stride_type out_s,
+			    length_type l)
+  {
+    assert(l == line_.size());
+    line_.r2c(1, in, 0, in_s, out, 0, out_s);
+  }
+
+private:
+  Native_line<T> line_;
+};
+
+// 1D complex -> real FFT
+template <typename T, int A>
+class native<1, std::complex<T>, T, A, 1>
+  : public fft::backend<1, std::complex<T>, T, A, 1>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  native(Domain<1> const& dom) : line_(dom.size(), true) {}
+
+  virtual char const* name() { return "fft-native-1D-real-inverse"; }
+  virtual void query_layout(Rt_layout<1> &rtl_in, Rt_layout<1> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void by_reference(ctype *in, stride_type in_s,
+			    rtype *out, stride_type out_s,
+			    length_type l)
+  {
+    assert(l == line_.size());
+    line_.c2r(1, in, 0, in_s, out, 0, out_s);
+  }
+  virtual void by_reference(ztype in, stride_type in_s,
+			    rtype *out, stride_type out_s,
+			    length_type l)
+  {
+    assert(l == line_.size());
+    line_.c2r(1, in, 0, in_s, out, 0, out_s);
+  }
+
+private:
+  Native_line<T> line_;
+};
+
+// 2D complex -> complex FFT
+template <typename T, int A, int E>
+class native<2, std::complex<T>, std::complex<T>, A, E>
+  : public fft::backend<2, std::complex<T>, std::complex<T>, A, E>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  native(Domain<2> const& dom) : nd_(dom, -1) {}
+
+  virtual char const* name() { return "fft-native-2D-complex"; }
+  virtual void query_layout(Rt_layout<2> &) {}
+  virtual void query_layout(Rt_layout<2> &rtl_in, Rt_layout<2> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void in_place(ctype *inout,
+			stride_type r_stride, stride_type c_stride,
+			length_type, length_type)
+  {
+    stride_type s[3] = { r_stride, c_stride, 0 };
+    nd_.c2c(inout, s, inout, s, E);
+  }
+  virtual void in_place(ztype inout,
+			stride_type r_stride, stride_type c_stride,
+			length_type, length_type)
+  {
+    stride_type s[3] = { r_stride, c_stride, 0 };
+    nd_.c2c(inout, s, inout, s, E);
+  }
+  virtual void by_reference(ctype *in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    ctype *out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_r_stride, in_c_stride, 0 };
+    stride_type out_s[3] = { out_r_stride, out_c_stride, 0 };
+    nd_.c2c(in, in_s, out, out_s, E);
+  }
+  virtual void by_reference(ztype in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    ztype out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_r_stride, in_c_stride, 0 };
+    stride_type out_s[3] = { out_r_stride, out_c_stride, 0 };
+    nd_.c2c(in, in_s, out, out_s, E);
+  }
+
+private:
+  Native_nd<T> nd_;
+};
+
+// 2D real -> complex FFT
+template <typename T, int A>
+class native<2, T, std::complex<T>, A, -1>
+  : public fft::backend<2, T, std::complex<T>, A, -1>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  native(Domain<2> const& dom) : nd_(dom, A) {}
+
+  virtual char const* name() { return "fft-native-2D-real-forward"; }
+  virtual void query_layout(Rt_layout<2> &rtl_in, Rt_layout<2> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void by_reference(rtype *in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    ctype *out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_r_stride, in_c_stride, 0 };
+    stride_type out_s[3] = { out_r_stride, out_c_stride, 0 };
+    nd_.r2c(in, in_s, out, out_s);
+  }
+  virtual void by_reference(rtype *in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    ztype out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_r_stride, in_c_stride, 0 };
+    stride_type out_s[3] = { out_r_stride, out_c_stride, 0 };
+    nd_.r2c(in, in_s, out, out_s);
+  }
+
+private:
+  Native_nd<T> nd_;
+};
+
+// 2D complex -> real FFT
+template <typename T, int A>
+class native<2, std::complex<T>, T, A, 1>
+  : public fft::backend<2, std::complex<T>, T, A, 1>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  native(Domain<2> const& dom) : nd_(dom, A) {}
+
+  virtual char const* name() { return "fft-native-2D-real-inverse"; }
+  virtual void query_layout(Rt_layout<2> &rtl_in, Rt_layout<2> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void by_reference(ctype *in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    rtype *out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_r_stride, in_c_stride, 0 };
+    stride_type out_s[3] = { out_r_stride, out_c_stride, 0 };
+    nd_.c2r(in, in_s, out, out_s);
+  }
+  virtual void by_reference(ztype in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    rtype *out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_r_stride, in_c_stride, 0 };
+    stride_type out_s[3] = { out_r_stride, out_c_stride, 0 };
+    nd_.c2r(in, in_s, out, out_s);
+  }
+
+private:
+  Native_nd<T> nd_;
+};
+
+// 3D complex -> complex FFT
+template <typename T, int A, int E>
+class native<3, std::complex<T>, std::complex<T>, A, E>
+  : public fft::backend<3, std::complex<T>, std::complex<T>, A, E>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  native(Domain<3> const& dom) : nd_(dom, -1) {}
+
+  virtual char const* name() { return "fft-native-3D-complex"; }
+  virtual void query_layout(Rt_layout<3> &) {}
+  virtual void query_layout(Rt_layout<3> &rtl_in, Rt_layout<3> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void in_place(ctype *inout,
+			stride_type x_stride,
+			stride_type y_stride,
+			stride_type z_stride,
+			length_type, length_type, length_type)
+  {
+    stride_type s[3] = { x_stride, y_stride, z_stride };
+    nd_.c2c(inout, s, inout, s, E);
+  }
+  virtual void in_place(ztype inout,
+			stride_type x_stride,
+			stride_type y_stride,
+			stride_type z_stride,
+			length_type, length_type, length_type)
+  {
+    stride_type s[3] = { x_stride, y_stride, z_stride };
+    nd_.c2c(inout, s, inout, s, E);
+  }
+  virtual void by_reference(ctype *in,
+			    stride_type in_x_stride,
+			    stride_type in_y_stride,
+			    stride_type in_z_stride,
+			    ctype *out,
+			    stride_type out_x_stride,
+			    stride_type out_y_stride,
+			    stride_type out_z_stride,
+			    length_type, length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_x_stride, in_y_stride, in_z_stride };
+    stride_type out_s[3] = { out_x_stride, out_y_stride, out_z_stride };
+    nd_.c2c(in, in_s, out, out_s, E);
+  }
+  virtual void by_reference(ztype in,
+			    stride_type in_x_stride,
+			    stride_type in_y_stride,
+			    stride_type in_z_stride,
+			    ztype out,
+			    stride_type out_x_stride,
+			    stride_type out_y_stride,
+			    stride_type out_z_stride,
+			    length_type, length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_x_stride, in_y_stride, in_z_stride };
+    stride_type out_s[3] = { out_x_stride, out_y_stride, out_z_stride };
+    nd_.c2c(in, in_s, out, out_s, E);
+  }
+
+private:
+  Native_nd<T> nd_;
+};
+
+// 3D real -> complex FFT
+template <typename T, int A>
+class native<3, T, std::complex<T>, A, -1>
+  : public fft::backend<3, T, std::complex<T>, A, -1>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  native(Domain<3> const& dom) : nd_(dom, A) {}
+
+  virtual char const* name() { return "fft-native-3D-real-forward"; }
+  virtual void query_layout(Rt_layout<3> &rtl_in, Rt_layout<3> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void by_reference(rtype *in,
+			    stride_type in_x_stride,
+			    stride_type in_y_stride,
+			    stride_type in_z_stride,
+			    ctype *out,
+			    stride_type out_x_stride,
+			    stride_type out_y_stride,
+			    stride_type out_z_stride,
+			    length_type, length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_x_stride, in_y_stride, in_z_stride };
+    stride_type out_s[3] = { out_x_stride, out_y_stride, out_z_stride };
+    nd_.r2c(in, in_s, out, out_s);
+  }
+  virtual void by_reference(rtype *in,
+			    stride_type in_x_stride,
+			    stride_type in_y_stride,
+			    stride_type in_z_stride,
+			    ztype out,
+			    stride_type out_x_stride,
+			    stride_type out_y_stride,
+			    stride_type out_z_stride,
+			    length_type, length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_x_stride, in_y_stride, in_z_stride };
+    stride_type out_s[3] = { out_x_stride, out_y_stride, out_z_stride };
+    nd_.r2c(in, in_s, out, out_s);
+  }
+
+private:
+  Native_nd<T> nd_;
+};
+
+// 3D complex -> real FFT
+template <typename T, int A>
+class native<3, std::complex<T>, T, A, 1>
+  : public fft::backend<3, std::complex<T>, T, A, 1>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  native(Domain<3> const& dom) : nd_(dom, A) {}
+
+  virtual char const* name() { return "fft-native-3D-real-inverse"; }
+  virtual void query_layout(Rt_layout<3> &rtl_in, Rt_layout<3> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void by_reference(ctype *in,
+			    stride_type in_x_stride,
+			    stride_type in_y_stride,
+			    stride_type in_z_stride,
+			    rtype *out,
+			    stride_type out_x_stride,
+			    stride_type out_y_stride,
+			    stride_type out_z_stride,
+			    length_type, length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_x_stride, in_y_stride, in_z_stride };
+    stride_type out_s[3] = { out_x_stride, out_y_stride, out_z_stride };
+    nd_.c2r(in, in_s, out, out_s);
+  }
+  virtual void by_reference(ztype in,
+			    stride_type in_x_stride,
+			    stride_type in_y_stride,
+			    stride_type in_z_stride,
+			    rtype *out,
+			    stride_type out_x_stride,
+			    stride_type out_y_stride,
+			    stride_type out_z_stride,
+			    length_type, length_type, length_type)
+  {
+    stride_type in_s[3]  = { in_x_stride, in_y_stride, in_z_stride };
+    stride_type out_s[3] = { out_x_stride, out_y_stride, out_z_stride };
+    nd_.c2r(in, in_s, out, out_s);
+  }
+
+private:
+  Native_nd<T> nd_;
+};
+
+
+
+template <typename I, typename O, int A, int E> class nativem;
+
+// real -> complex FFTM
+template <typename T, int A>
+class nativem<T, std::complex<T>, A, -1>
+  : public fft::fftm<T, std::complex<T>, A, -1>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  nativem(Domain<2> const& dom) : line_(dom[A].size(), true) {}
+
+  virtual char const* name() { return "fftm-native-real-forward"; }
+  virtual void query_layout(Rt_layout<2> &rtl_in, Rt_layout<2> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void by_reference(rtype *in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    ctype *out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type rows, length_type cols)
+  {
+    if (A == 0)
+      line_.r2c(cols, in, in_c_stride, in_r_stride,
+		out, out_c_stride, out_r_stride);
+    else
+      line_.r2c(rows, in, in_r_stride, in_c_stride,
+		out, out_r_stride, out_c_stride);
+  }
+  virtual void by_reference(rtype *in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    ztype out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type rows, length_type cols)
+  {
+    if (A == 0)
+      line_.r2c(cols, in, in_c_stride, in_r_stride,
+		out, out_c_stride, out_r_stride);
+    else
+      line_.r2c(rows, in, in_r_stride, in_c_stride,
+		out, out_r_stride, out_c_stride);
+  }
+
+private:
+  Native_line<T> line_;
+};
+
+// complex -> real FFTM
+template <typename T, int A>
+class nativem<std::complex<T>, T, A, 1>
+  : public fft::fftm<std::complex<T>, T, A, 1>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  nativem(Domain<2> const& dom) : line_(dom[A].size(), true) {}
+
+  virtual char const* name() { return "fftm-native-real-inverse"; }
+  virtual void query_layout(Rt_layout<2> &rtl_in, Rt_layout<2> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void by_reference(ctype *in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    rtype *out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type rows, length_type cols)
+  {
+    if (A == 0)
+      line_.c2r(cols, in, in_c_stride, in_r_stride,
+		out, out_c_stride, out_r_stride);
+    else
+      line_.c2r(rows, in, in_r_stride, in_c_stride,
+		out, out_r_stride, out_c_stride);
+  }
+  virtual void by_reference(ztype in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    rtype *out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type rows, length_type cols)
+  {
+    if (A == 0)
+      line_.c2r(cols, in, in_c_stride, in_r_stride,
+		out, out_c_stride, out_r_stride);
+    else
+      line_.c2r(rows, in, in_r_stride, in_c_stride,
+		out, out_r_stride, out_c_stride);
+  }
+
+private:
+  Native_line<T> line_;
+};
+
+// complex -> complex FFTM
+template <typename T, int A, int E>
+class nativem<std::complex<T>, std::complex<T>, A, E>
+  : public fft::fftm<std::complex<T>, std::complex<T>, A, E>
+{
+  typedef T rtype;
+  typedef std::complex<rtype> ctype;
+  typedef std::pair<rtype*, rtype*> ztype;
+
+public:
+  nativem(Domain<2> const& dom) : line_(dom[A].size(), false) {}
+
+  virtual char const* name() { return "fftm-native-complex"; }
+  virtual void query_layout(Rt_layout<2> &) {}
+  virtual void query_layout(Rt_layout<2> &rtl_in, Rt_layout<2> &rtl_out)
+  { rtl_in.complex = rtl_out.complex; }
+  virtual void in_place(ctype *inout,
+			stride_type r_stride, stride_type c_stride,
+			length_type rows, length_type cols)
+  {
+    if (A == 0)
+      line_.c2c(cols, inout, c_stride, r_stride, inout, c_stride, r_stride, E);
+    else
+      line_.c2c(rows, inout, r_stride, c_stride, inout, r_stride, c_stride, E);
+  }
+  virtual void in_place(ztype inout,
+			stride_type r_stride, stride_type c_stride,
+			length_type rows, length_type cols)
+  {
+    if (A == 0)
+      line_.c2c(cols, inout, c_stride, r_stride, inout, c_stride, r_stride, E);
+    else
+      line_.c2c(rows, inout, r_stride, c_stride, inout, r_stride, c_stride, E);
+  }
+  virtual void by_reference(ctype *in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    ctype *out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type rows, length_type cols)
+  {
+    if (A == 0)
+      line_.c2c(cols, in, in_c_stride, in_r_stride,
+		out, out_c_stride, out_r_stride, E);
+    else
+      line_.c2c(rows, in, in_r_stride, in_c_stride,
+		out, out_r_stride, out_c_stride, E);
+  }
+  virtual void by_reference(ztype in,
+			    stride_type in_r_stride, stride_type in_c_stride,
+			    ztype out,
+			    stride_type out_r_stride, stride_type out_c_stride,
+			    length_type rows, length_type cols)
+  {
+    if (A == 0)
+      line_.c2c(cols, in, in_c_stride, in_r_stride,
+		out, out_c_stride, out_r_stride, E);
+    else
+      line_.c2c(rows, in, in_r_stride, in_c_stride,
+		out, out_r_stride, out_c_stride, E);
+  }
+
+private:
+  Native_line<T> line_;
+};
+
+struct Native_tag;
+
+template <dimension_type D,
+	  typename I,
+	  typename O,
+	  int S,
+	  vsip::return_mechanism_type R,
+	  unsigned N>
+struct evaluator<D, I, O, S, R, N, Native_tag>
+{
+  static bool const ct_valid = true;
+  static bool rt_valid(Domain<D> const &/*dom*/) { return true;}
+  static std::auto_ptr<backend<D, I, O,
+ 			       axis<I, O, S>::value,
+ 			       exponent<I, O, S>::value> >
+  create(Domain<D> const &dom, typename Scalar_of<I>::type /*scale*/)
+  {
+    static int const A = axis<I, O, S>::value;
+    static int const E = exponent<I, O, S>::value;
+    return std::auto_ptr<backend<D, I, O, A, E> >
+      (new native<D, I, O, A, E>(dom));
+  }
+};
+
+} // namespace vsip::impl::fft
+
+namespace fftm
+{
+template <typename I,
+	  typename O,
+	  int A,
+	  int E,
+	  vsip::return_mechanism_type R,
+	  unsigned N>
+struct evaluator<I, O, A, E, R, N, fft::Native_tag>
+{
+  static bool const ct_valid = true;
+  static bool rt_valid(Domain<2> const &/*dom*/) { return true;}
+  static std::auto_ptr<fft::fftm<I, O, A, E> >
+  create(Domain<2> const &dom, typename Scalar_of<I>::type /*scale*/)
+  {
+    return std::auto_ptr<fft::fftm<I, O, A, E> >
+      (new fft::nativem<I, O, A, E>(dom));
+  }
+};
+
+} // namespace vsip::impl::fftm
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif
@@ -0,0 +1,607 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/fft/native_plan.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Mixed-radix and Bluestein FFT plans used
+             by the native FFT backend.
+*/
+
+#ifndef VSIP_CORE_FFT_NATIVE_PLAN_HPP
+#define VSIP_CORE_FFT_NATIVE_PLAN_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <vsip/support.hpp>
+#include <vsip/core/config.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/core/noncopyable.hpp>
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace fft
+{
+
+/// Type in which the twiddle factors of a Native_plan<T> are computed.
+template <typename T> struct Native_trig { typedef double type;};
+template <> struct Native_trig<long double> { typedef long double type;};
+
+
+
+/// Forward complex DFT of a fixed size.
+///
+/// Sizes whose prime factors are at most max_radix are computed by a
+/// mixed-radix Stockham FFT (radix 4, 2, 3 and 5 butterflies, and
+/// generic odd butterflies up to max_radix).  Stockham stages do not
+/// need a bit-reversal pass and read and write unit-stride runs, which
+/// the compiler can vectorize.  Other sizes are computed by Bluestein's
+/// algorithm, as a convolution with a power-of-two FFT.
+///
+/// Data are in split format.  The caller fills the buffer returned by
+/// input() and calls execute(), which returns the buffer holding the
+/// result.  The inverse DFT is computed by exchanging the real and
+/// imaginary parts of both the input and the output.
+///
+/// A plan owns its buffers, so it may only be used by one thread at a
+/// time.
+
+template <typename T>
+class Native_plan : Non_copyable
+{
+public:
+  typedef std::pair<T*, T*> ztype;
+
+  static length_type const max_radix = 31;
+
+  explicit Native_plan(length_type size);
+
+  length_type size() const { return size_;}
+
+  /// Buffer receiving the input of the next execute().
+  ztype input() { return ztype(data_.get(), data_.get() + size_);}
+
+  /// Transform the input buffer.  The returned buffer is valid until
+  /// the next call.
+  ztype execute();
+
+private:
+  typedef typename Native_trig<T>::type trig_type;
+
+  static bool factor(length_type size, std::vector<length_type>& radix);
+
+  void init_stockham();
+  void init_bluestein();
+  ztype bluestein();
+
+  void stage(length_type p, length_type ns, T const* w,
+	     T const* xr, T const* xi, T* yr, T* yi) const;
+
+  // Butterflies read X[k + r*M] and write Y[k*YS + r*NS] for k < COUNT
+  // and r < P.  If W, input r is first multiplied by twiddle
+  // W[(r-1)*NS + k].
+  template <bool W>
+  static void radix2(length_type count, length_type m,
+		     T const* xr, T const* xi, T* yr, T* yi,
+		     stride_type ys, length_type ns,
+		     T const* wr, T const* wi);
+  template <bool W>
+  static void radix3(length_type count, length_type m,
+		     T const* xr, T const* xi, T* yr, T* yi,
+		     stride_type ys, length_type ns,
+		     T const* wr, T const* wi);
+  template <bool W>
+  static void radix4(length_type count, length_type m,
+		     T const* xr, T const* xi, T* yr, T* yi,
+		     stride_type ys, length_type ns,
+		     T const* wr, T const* wi);
+  template <bool W>
+  static void radix5(length_type count, length_type m,
+		     T const* xr, T const* xi, T* yr, T* yi,
+		     stride_type ys, length_type ns,
+		     T const* wr, T const* wi);
+  template <bool W>
+  static void radixg(length_type p, length_type count, length_type m,
+		     T const* xr, T const* xi, T* yr, T* yi,
+		     stride_type ys, length_type ns,
+		     T const* wr, T const* wi, T const* root);
+  template <bool W>
+  static void butterflies(length_type p, length_type count, length_type m,
+			  T const* xr, T const* xi, T* yr, T* yi,
+			  stride_type ys, length_type ns,
+			  T const* wr, T const* wi, T const* root);
+
+  length_type              size_;
+  std::vector<length_type> radix_;
+  aligned_array<T>         data_;	// two buffers of SIZE complex values
+  aligned_array<T>         twiddle_;	// per stage: twiddles, then roots
+
+  // Bluestein's algorithm.
+  std::auto_ptr<Native_plan> conv_;	// power-of-two convolution plan
+  aligned_array<T>           chirp_;	// exp(-i pi n^2 / SIZE)
+  aligned_array<T>           filter_;	// FFT of the conjugate chirp
+};
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+template <typename T>
+length_type const Native_plan<T>::max_radix;
+
+template <typename T>
+Native_plan<T>::Native_plan(length_type size)
+  : size_(size),
+    data_(1),
+    twiddle_(1),
+    chirp_(1),
+    filter_(1)
+{
+  if (factor(size, radix_))
+    init_stockham();
+  else
+    init_bluestein();
+}
+
+// Split SIZE into radices, fours first.  Return false if SIZE has a
+// prime factor larger than max_radix.
+
+template <typename T>
+bool
+Native_plan<T>::factor(length_type size, std::vector<length_type>& radix)
+{
+  radix.clear();
+  while (size > 1 && size % 4 == 0)
+  {
+    radix.push_back(4);
+    size /= 4;
+  }
+  if (size % 2 == 0)
+  {
+    radix.push_back(2);
+    size /= 2;
+  }
+  for (length_type p = 3; size > 1 && p <= max_radix; p += 2)
+    while (size % p == 0)
+    {
+      radix.push_back(p);
+      size /= p;
+    }
+  return size <= 1;
+}
+
+template <typename T>
+void
+Native_plan<T>::init_stockham()
+{
+  trig_type const two_pi = 2 * trig_type(VSIP_IMPL_PI);
+
+  aligned_array<T> data(size_ ? 2 * 2 * size_ : 1);
+  data_ = data;
+
+  // Stage s with radix P follows stages covering NS points.  Its
+  // twiddles are exp(-2 pi i r k / (NS P)) for 0 < r < P, k < NS.
+  length_type total = 0;
+  length_type ns = 1;
+  for (index_type s = 0; s < radix_.size(); ++s)
+  {
+    length_type p = radix_[s];
+    total += 2 * (p - 1) * ns + (p > 5 ? 2 * p : 0);
+    ns *= p;
+  }
+  aligned_array<T> twiddle(total ? total : 1);
+  twiddle_ = twiddle;
+
+  T* w = twiddle_.get();
+  ns = 1;
+  for (index_type s = 0; s < radix_.size(); ++s)
+  {
+    length_type p = radix_[s];
+    for (index_type r = 1; r < p; ++r)
+      for (index_type k = 0; k < ns; ++k)
+      {
+	trig_type phi = two_pi * trig_type(r * k) / trig_type(ns * p);
+	w[(r - 1) * ns + k]            = T(std::cos(phi));
+	w[(p - 1 + r - 1) * ns + k]    = T(-std::sin(phi));
+      }
+    w += 2 * (p - 1) * ns;
+    if (p > 5)
+    {
+      for (index_type j = 0; j < p; ++j)
+      {
+	trig_type phi = two_pi * trig_type(j) / trig_type(p);
+	w[j]     = T(std::cos(phi));
+	w[p + j] = T(std::sin(phi));
+      }
+      w += 2 * p;
+    }
+    ns *= p;
+  }
+}
+
+template <typename T>
+void
+Native_plan<T>::init_bluestein()
+{
+  trig_type const pi = trig_type(VSIP_IMPL_PI);
+
+  length_type m = 1;
+  while (m < 2 * size_ - 1)
+    m *= 2;
+  conv_.reset(new Native_plan(m));
+
+  aligned_array<T> data(2 * size_);
+  data_ = data;
+
+  // n^2 is reduced modulo 2 SIZE, over which the chirp is periodic.
+  aligned_array<T> chirp(2 * size_);
+  chirp_ = chirp;
+  T* cr = chirp_.get();
+  T* ci = cr + size_;
+  length_type q = 0;
+  for (index_type n = 0; n < size_; ++n)
+  {
+    trig_type phi = pi * trig_type(q) / trig_type(size_);
+    cr[n] = T(std::cos(phi));
+    ci[n] = T(-std::sin(phi));
+    q = (q + 2 * n + 1) % (2 * size_);
+  }
+
+  ztype b = conv_->input();
+  for (index_type k = 0; k < m; ++k)
+    b.first[k] = b.second[k] = T();
+  for (index_type n = 0; n < size_; ++n)
+  {
+    b.first[n]  =  cr[n];
+    b.second[n] = -ci[n];
+    if (n > 0)
+    {
+      b.first[m - n]  =  cr[n];
+      b.second[m - n] = -ci[n];
+    }
+  }
+  ztype f = conv_->execute();
+
+  // The 1/M of the inverse convolution FFT is folded into the filter.
+  aligned_array<T> filter(2 * m);
+  filter_ = filter;
+  T const scale = T(1) / T(m);
+  for (index_type k = 0; k < m; ++k)
+  {
+    filter_[k]     = f.first[k] * scale;
+    filter_[m + k] = f.second[k] * scale;
+  }
+}
+
+
+
+template <typename T>
+typename Native_plan<T>::ztype
+Native_plan<T>::execute()
+{
+  if (conv_.get())
+    return bluestein();
+
+  T* xr = data_.get();
+  T* xi = xr + size_;
+  T* yr = xi + size_;
+  T* yi = yr + size_;
+  T const* w = twiddle_.get();
+  length_type ns = 1;
+  for (index_type s = 0; s < radix_.size(); ++s)
+  {
+    length_type p = radix_[s];
+    stage(p, ns, w, xr, xi, yr, yi);
+    w += 2 * (p - 1) * ns + (p > 5 ? 2 * p : 0);
+    std::swap(xr, yr);
+    std::swap(xi, yi);
+    ns *= p;
+  }
+  return ztype(xr, xi);
+}
+
+// X_k = c_k sum_n (x_n c_n) conj(c_{k-n}), with c_n = exp(-i pi n^2/N).
+// The convolution is computed with FFTs of M >= 2N - 1 points.
+
+template <typename T>
+typename Native_plan<T>::ztype
+Native_plan<T>::bluestein()
+{
+  length_type const m = conv_->size();
+  T* xr = data_.get();
+  T* xi = xr + size_;
+  T const* cr = chirp_.get();
+  T const* ci = cr + size_;
+  T const* fr = filter_.get();
+  T const* fi = fr + m;
+
+  ztype a = conv_->input();
+  for (index_type n = 0; n < size_; ++n)
+  {
+    a.first[n]  = xr[n] * cr[n] - xi[n] * ci[n];
+    a.second[n] = xr[n] * ci[n] + xi[n] * cr[n];
+  }
+  for (index_type n = size_; n < m; ++n)
+    a.first[n] = a.second[n] = T();
+
+  // Multiply by the filter, and exchange real and imaginary parts for
+  // the inverse FFT.  The result may be in the input buffer.
+  ztype s = conv_->execute();
+  for (index_type k = 0; k < m; ++k)
+  {
+    T re = s.first[k] * fr[k] - s.second[k] * fi[k];
+    T im = s.first[k] * fi[k] + s.second[k] * fr[k];
+    a.first[k]  = im;
+    a.second[k] = re;
+  }
+
+  ztype y = conv_->execute();
+  for (index_type k = 0; k < size_; ++k)
+  {
+    T re = y.second[k];
+    T im = y.first[k];
+    xr[k] = re * cr[k] - im * ci[k];
+    xi[k] = re * ci[k] + im * cr[k];
+  }
+  return ztype(xr, xi);
+}
+
+
+
+// Stage of radix P following stages that covered NS points: butterfly
+// j = b NS + k (k < NS) reads X[j + r N/P] and writes Y[b NS P + k + r NS].
+// The first stage has no twiddles, and iterates over b instead.
+
+template <typename T>
+void
+Native_plan<T>::stage(length_type p, length_type ns, T const* w,
+		      T const* xr, T const* xi, T* yr, T* yi) const
+{
+  length_type const m      = size_ / p;
+  length_type const blocks = m / ns;
+  T const* wr   = w;
+  T const* wi   = w + (p - 1) * ns;
+  T const* root = w + 2 * (p - 1) * ns;
+
+  if (ns == 1)
+    butterflies<false>(p, blocks, m, xr, xi, yr, yi, p, 1, wr, wi, root);
+  else
+    for (index_type b = 0; b < blocks; ++b)
+      butterflies<true>(p, ns, m, xr + b * ns, xi + b * ns,
+			yr + b * ns * p, yi + b * ns * p, 1, ns,
+			wr, wi, root);
+}
+
+template <typename T>
+template <bool W>
+void
+Native_plan<T>::butterflies(length_type p, length_type count, length_type m,
+			    T const* xr, T const* xi, T* yr, T* yi,
+			    stride_type ys, length_type ns,
+			    T const* wr, T const* wi, T const* root)
+{
+  switch (p)
+  {
+  case 2: radix2<W>(count, m, xr, xi, yr, yi, ys, ns, wr, wi); break;
+  case 3: radix3<W>(count, m, xr, xi, yr, yi, ys, ns, wr, wi); break;
+  case 4: radix4<W>(count, m, xr, xi, yr, yi, ys, ns, wr, wi); break;
+  case 5: radix5<W>(count, m, xr, xi, yr, yi, ys, ns, wr, wi); break;
+  default:
+    radixg<W>(p, count, m, xr, xi, yr, yi, ys, ns, wr, wi, root);
+  }
+}
+
+template <typename T>
+template <bool W>
+void
+Native_plan<T>::radix2(length_type count, length_type m,
+		       T const* xr, T const* xi, T* yr, T* yi,
+		       stride_type ys, length_type ns,
+		       T const* wr, T const* wi)
+{
+  for (index_type k = 0; k < count; ++k)
+  {
+    T ar = xr[k],     ai = xi[k];
+    T br = xr[k + m], bi = xi[k + m];
+    if (W)
+    {
+      T t = br * wr[k] - bi * wi[k];
+      bi  = br * wi[k] + bi * wr[k];
+      br  = t;
+    }
+    yr[k * ys]      = ar + br; yi[k * ys]      = ai + bi;
+    yr[k * ys + ns] = ar - br; yi[k * ys + ns] = ai - bi;
+  }
+}
+
+template <typename T>
+template <bool W>
+void
+Native_plan<T>::radix3(length_type count, length_type m,
+		       T const* xr, T const* xi, T* yr, T* yi,
+		       stride_type ys, length_type ns,
+		       T const* wr, T const* wi)
+{
+  T const h = T(0.86602540378443864676372317075294L); // sqrt(3)/2
+  for (index_type k = 0; k < count; ++k)
+  {
+    T ar = xr[k],         ai = xi[k];
+    T br = xr[k + m],     bi = xi[k + m];
+    T cr = xr[k + 2 * m], ci = xi[k + 2 * m];
+    if (W)
+    {
+      T t = br * wr[k] - bi * wi[k];
+      bi  = br * wi[k] + bi * wr[k];
+      br  = t;
+      t   = cr * wr[ns + k] - ci * wi[ns + k];
+      ci  = cr * wi[ns + k] + ci * wr[ns + k];
+      cr  = t;
+    }
+    T sr = br + cr, si = bi + ci;
+    T dr = br - cr, di = bi - ci;
+    T er = ar - T(0.5) * sr, ei = ai - T(0.5) * si;
+    yr[k * ys]          = ar + sr;     yi[k * ys]          = ai + si;
+    yr[k * ys + ns]     = er + h * di; yi[k * ys + ns]     = ei - h * dr;
+    yr[k * ys + 2 * ns] = er - h * di; yi[k * ys + 2 * ns] = ei + h * dr;
+  }
+}
+
+template <typename T>
+template <bool W>
+void
+Native_plan<T>::radix4(length_type count, length_type m,
+		       T const* xr, T const* xi, T* yr, T* yi,
+		       stride_type ys, length_type ns,
+		       T const* wr, T const* wi)
+{
+  for (index_type k = 0; k < count; ++k)
+  {
+    T ar = xr[k],         ai = xi[k];
+    T br = xr[k + m],     bi = xi[k + m];
+    T cr = xr[k + 2 * m], ci = xi[k + 2 * m];
+    T dr = xr[k + 3 * m], di = xi[k + 3 * m];
+    if (W)
+    {
+      T t = br * wr[k] - bi * wi[k];
+      bi  = br * wi[k] + bi * wr[k];
+      br  = t;
+      t   = cr * wr[ns + k] - ci * wi[ns + k];
+      ci  = cr * wi[ns + k] + ci * wr[ns + k];
+      cr  = t;
+      t   = dr * wr[2 * ns + k] - di * wi[2 * ns + k];
+      di  = dr * wi[2 * ns + k] + di * wr[2 * ns + k];
+      dr  = t;
+    }
+    // (t3r, t3i) = -i (b - d)
+    T t0r = ar + cr, t0i = ai + ci;
+    T t1r = ar - cr, t1i = ai - ci;
+    T t2r = br + dr, t2i = bi + di;
+    T t3r = bi - di, t3i = dr - br;
+    yr[k * ys]          = t0r + t2r; yi[k * ys]          = t0i + t2i;
+    yr[k * ys + ns]     = t1r + t3r; yi[k * ys + ns]     = t1i + t3i;
+    yr[k * ys + 2 * ns] = t0r - t2r; yi[k * ys + 2 * ns] = t0i - t2i;
+    yr[k * ys + 3 * ns] = t1r - t3r; yi[k * ys + 3 * ns] = t1i - t3i;
+  }
+}
+
+template <typename T>
+template <bool W>
+void
+Native_plan<T>::radix5(length_type count, length_type m,
+		       T const* xr, T const* xi, T* yr, T* yi,
+		       stride_type ys, length_type ns,
+		       T const* wr, T const* wi)
+{
+  T const c1 = T( 0.30901699437494742410229341718281906L); // cos(2pi/5)
+  T const c2 = T(-0.80901699437494742410229341718281906L); // cos(4pi/5)
+  T const s1 = T( 0.95105651629515357211643933337938214L); // sin(2pi/5)
+  T const s2 = T( 0.58778525229247312916870595463907277L); // sin(4pi/5)
+  for (index_type k = 0; k < count; ++k)
+  {
+    T ar[5], ai[5];
+    for (index_type r = 0; r < 5; ++r)
+    {
+      ar[r] = xr[k + r * m];
+      ai[r] = xi[k + r * m];
+      if (W && r > 0)
+      {
+	index_type j = (r - 1) * ns + k;
+	T t   = ar[r] * wr[j] - ai[r] * wi[j];
+	ai[r] = ar[r] * wi[j] + ai[r] * wr[j];
+	ar[r] = t;
+      }
+    }
+    T s14r = ar[1] + ar[4], s14i = ai[1] + ai[4];
+    T d14r = ar[1] - ar[4], d14i = ai[1] - ai[4];
+    T s23r = ar[2] + ar[3], s23i = ai[2] + ai[3];
+    T d23r = ar[2] - ar[3], d23i = ai[2] - ai[3];
+    T b1r = ar[0] + c1 * s14r + c2 * s23r, b1i = ai[0] + c1 * s14i + c2 * s23i;
+    T b2r = ar[0] + c2 * s14r + c1 * s23r, b2i = ai[0] + c2 * s14i + c1 * s23i;
+    T e1r = s1 * d14r + s2 * d23r, e1i = s1 * d14i + s2 * d23i;
+    T e2r = s2 * d14r - s1 * d23r, e2i = s2 * d14i - s1 * d23i;
+    yr[k * ys]          = ar[0] + s14r + s23r;
+    yi[k * ys]          = ai[0] + s14i + s23i;
+    yr[k * ys + ns]     = b1r + e1i; yi[k * ys + ns]     = b1i - e1r;
+    yr[k * ys + 2 * ns] = b2r + e2i; yi[k * ys + 2 * ns] = b2i - e2r;
+    yr[k * ys + 3 * ns] = b2r - e2i; yi[k * ys + 3 * ns] = b2i + e2r;
+    yr[k * ys + 4 * ns] = b1r - e1i; yi[k * ys + 4 * ns] = b1i + e1r;
+  }
+}
+
+// Odd radix P: y_q = a_0 + sum_r cos(2 pi r q/P) (a_r + a_{P-r})
+//                        - i sum_r sin(2 pi r q/P) (a_r - a_{P-r}).
+// ROOT holds cos(2 pi j/P), then sin(2 pi j/P), for j < P.
+
+template <typename T>
+template <bool W>
+void
+Native_plan<T>::radixg(length_type p, length_type count, length_type m,
+		       T const* xr, T const* xi, T* yr, T* yi,
+		       stride_type ys, length_type ns,
+		       T const* wr, T const* wi, T const* root)
+{
+  length_type const h = (p - 1) / 2;
+  T ar[max_radix], ai[max_radix];
+  T sr[max_radix / 2 + 1], si[max_radix / 2 + 1];
+  T dr[max_radix / 2 + 1], di[max_radix / 2 + 1];
+
+  for (index_type k = 0; k < count; ++k)
+  {
+    for (index_type r = 0; r < p; ++r)
+    {
+      ar[r] = xr[k + r * m];
+      ai[r] = xi[k + r * m];
+      if (W && r > 0)
+      {
+	index_type j = (r - 1) * ns + k;
+	T t   = ar[r] * wr[j] - ai[r] * wi[j];
+	ai[r] = ar[r] * wi[j] + ai[r] * wr[j];
+	ar[r] = t;
+      }
+    }
+    T y0r = ar[0], y0i = ai[0];
+    for (index_type r = 1; r <= h; ++r)
+    {
+      sr[r] = ar[r] + ar[p - r]; si[r] = ai[r] + ai[p - r];
+      dr[r] = ar[r] - ar[p - r]; di[r] = ai[r] - ai[p - r];
+      y0r += sr[r];
+      y0i += si[r];
+    }
+    yr[k * ys] = y0r;
+    yi[k * ys] = y0i;
+    for (index_type q = 1; q <= h; ++q)
+    {
+      T br = ar[0], bi = ai[0], er = T(), ei = T();
+      index_type j = 0;
+      for (index_type r = 1; r <= h; ++r)
+      {
+	j += q;
+	if (j >= p) j -= p;
+	br += root[j] * sr[r];     bi += root[j] * si[r];
+	er += root[p + j] * dr[r]; ei += root[p + j] * di[r];
+      }
+      yr[k * ys + q * ns]       = br + ei; yi[k * ys + q * ns]       = bi - er;
+      yr[k * ys + (p - q) * ns] = br - ei; yi[k * ys + (p - q) * ns] = bi + er;
+    }
+  }
+}
+
+} // namespace vsip::impl::fft
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_CORE_FFT_NATIVE_PLAN_HPP
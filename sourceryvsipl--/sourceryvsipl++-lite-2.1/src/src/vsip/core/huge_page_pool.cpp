@@ -12,11 +12,13 @@
 
 #include <limits>
 #include <cstdlib>
+#include <algorithm>
 #include <iostream>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
 #include <fcntl.h>
+#include <unistd.h>
 #include <string.h>
 #include <errno.h>
 
@@ -35,7 +37,7 @@
 namespace vsip
 {
 
-namespace impl 
+namespace impl
 {
 
 // Allocate memory in huge page space (that are freed on program
@@ -51,8 +53,9 @@ namespace impl
 char*
 open_huge_pages(char const* mem_file, int pages)
 {
-  int   fmem;
-  char* mem_addr;
+  int    fmem;
+  char*  mem_addr;
+  size_t size = size_t(pages) * 0x1000000;
 
   if ((fmem = open(mem_file, O_CREAT | O_RDWR, 0755)) == -1)
   {
@@ -63,8 +66,13 @@ open_huge_pages(char const* mem_file, int pages)
 
   // Delete file so that huge pages will get freed on program termination.
   remove(mem_file);
-	
-  mem_addr = (char *)mmap(0, pages * 0x1000000,
+
+  // Size the file, in case MEM_FILE is not on a hugetlbfs file system.
+  if (ftruncate(fmem, size) == -1)
+    std::cerr << "WARNING: unable to size file " << mem_file
+	      << " (errno=" << errno << " " << strerror(errno) << ")\n";
+
+  mem_addr = (char *)mmap(0, size,
 			   PROT_READ | PROT_WRITE, MAP_SHARED, fmem, 0);
 
   if (mem_addr == MAP_FAILED)
@@ -77,162 +85,386 @@ open_huge_pages(char const* mem_file, int pages)
 
     // Touch each of the large pages.
     for (int i=0; i<pages; ++i)
-      mem_addr[i*0x1000000 + 0x0800000] = (char) 0;
+      mem_addr[i*size_t(0x1000000) + 0x0800000] = (char) 0;
 
   return mem_addr;
 }
 
 
 
-/// Aligned_pool implementation.
+/// A block in a thread cache.
+
+struct Huge_page_pool::Free_block
+{
+  Free_block* next;
+};
+
+
+
+/// Free blocks of each size class owned by one thread.  Cached blocks
+/// are allocated as far as the buddy system is concerned.
+
+struct Huge_page_pool::Thread_cache
+{
+  Huge_page_pool* pool;
+  Thread_cache*   next;
+  Thread_cache*   prev;
+  Free_block*     head[num_classes];
+  length_type     count[num_classes];
+};
+
+
+
+namespace
+{
+
+inline size_t
+round_size(size_t size)
+{
+  size_t const unit = Huge_page_pool::align;
+  // If size == 0, allocate one unit.
+  return size < unit ? unit : (size + unit - 1) & ~(unit - 1);
+}
+
+inline unsigned
+order_of(size_t size)
+{
+  unsigned order = 7;
+  while ((size_t(1) << order) < size)
+    ++order;
+  return order;
+}
+
+} // namespace vsip::impl::<unnamed>
+
+
+
+/// Huge_page_pool implementation.
 
 Huge_page_pool::Huge_page_pool(const char* file, int pages)
-  : pool_       (open_huge_pages(file, pages)),
-    size_       (pages * 0x1000000),
-    free_       (pool_),
-    total_avail_(size_)
+  : pool_         (open_huge_pages(file, pages)),
+    size_         (pool_ ? size_t(pages) * 0x1000000 : 0),
+    top_order_    (order_of(size_)),
+    tree_         (new unsigned char[size_t(2) << (top_order_ - min_order)]),
+    total_avail_  (size_),
+    thread_cached_(0),
+    cache_bytes_  (std::min(size_t(131072), size_ >> 8)),
+    caches_       (0)
 {
-  *(char**)free_ = 0; // next block
-  ((size_t*)free_)[1] = size_;
+  // Leaves beyond the end of the pool are never free.
+  size_t leaves = size_t(1) << (top_order_ - min_order);
+  for (size_t i=0; i<leaves; ++i)
+    tree_[leaves + i] = (i << min_order) < size_ ? min_order + 1 : 0;
+
+  for (size_t i=leaves-1, n=leaves/2, order=min_order+1; i>0; --i)
+  {
+    unsigned char l = tree_[2*i], r = tree_[2*i+1];
+    tree_[i] = (l == order && r == order) ? order + 1 : std::max(l, r);
+    if (i == n)
+    {
+      n /= 2;
+      ++order;
+    }
+  }
+
+  pthread_key_create(&key_, &Huge_page_pool::destroy_thread_cache);
 }
 
 Huge_page_pool::~Huge_page_pool()
-{}
+{
+  pthread_key_delete(key_);
+  while (caches_)
+  {
+    Thread_cache* next = caches_->next;
+    delete caches_;
+    caches_ = next;
+  }
+  delete[] tree_;
+}
 
-void* 
+void*
 Huge_page_pool::impl_allocate(size_t size)
 {
-  // If size == 0, allocate 1 byte.
-  if (size < 2*sizeof(char*))
-    size = 2*sizeof(char*);
+  size = round_size(size);
+  unsigned order = order_of(size);
 
-  // Maintain 128 B alignment
-  if (size % 128 != 0)
-    size += 128 - (size % 128);
+  if (size <= cache_max)
+  {
+    Thread_cache* cache = thread_cache();
+    unsigned      cls   = order - min_order;
 
-  char*  prev  = 0;
-  char*  ptr   = free_;
-  size_t avail = ptr ? ((size_t*)ptr)[1] : 0;
+    if (cache->head[cls] == 0)
+    {
+      // Refill the cache with half of its capacity.
+      length_type limit = std::max<size_t>(cache_bytes_ >> order, 1);
+      length_type n     = 0;
+
+      threads::Scoped_lock lock(lock_);
+      for (; n < (limit + 1) / 2; ++n)
+      {
+	Free_block* block = reinterpret_cast<Free_block*>(take(order));
+	if (block == 0)
+	  break;
+	block->next = cache->head[cls];
+	cache->head[cls] = block;
+      }
+      if (n == 0)
+      {
+	// Give back the other classes cached by this thread and retry.
+	drain(cache);
+	char* ptr = take(order);
+	if (ptr == 0)
+	  VSIP_IMPL_THROW(std::bad_alloc());
+	thread_cached_ += size_t(1) << order;
+	return ptr;
+      }
+      cache->count[cls] = n;
+      thread_cached_ += n << order;
+    }
 
-  while (ptr && avail < size)
-  {
-    prev  = ptr;
-    ptr   = *(char**)ptr;
-    avail = ptr ? ((size_t*)ptr)[1] : 0;
+    Free_block* block = cache->head[cls];
+    cache->head[cls] = block->next;
+    --cache->count[cls];
+    return block;
   }
 
+  threads::Scoped_lock lock(lock_);
+  char* ptr = take(order);
   if (ptr == 0)
     VSIP_IMPL_THROW(std::bad_alloc());
 
-  total_avail_ -= size;
-
-  if (avail == size)
+  // Free the unused tail of the block: while SIZE exceeds half of the
+  // remaining block keep the lower half, otherwise free the upper half.
+  size_t node = (size_t(1) << (top_order_ - order)) + ((ptr - pool_) >> order);
+  while (size < (size_t(1) << order))
   {
-    // Exact match.
-    if (prev == 0)
-      free_ = *(char**)ptr;
+    size_t half = size_t(1) << --order;
+    node *= 2;
+    if (size <= half)
+      total_avail_ += half;	// node + 1 is still marked free
     else
-      *(char**)prev = *(char**)ptr;
+    {
+      tree_[node++] = 0;
+      size -= half;
+    }
+    tree_[node] = 0;
   }
-  else
+  update(node, order);
+  return ptr;
+}
+
+void
+Huge_page_pool::impl_deallocate(void* return_ptr, size_t size)
+{
+  char* ptr = static_cast<char*>(return_ptr);
+  size = round_size(size);
+  unsigned order = order_of(size);
+
+  if (size <= cache_max)
   {
-    // Larger match, carve out chunk.
-    if (prev == 0)
+    Thread_cache* cache = thread_cache();
+    unsigned      cls   = order - min_order;
+    length_type   limit = std::max<size_t>(cache_bytes_ >> order, 1);
+
+    Free_block* block = reinterpret_cast<Free_block*>(ptr);
+    block->next = cache->head[cls];
+    cache->head[cls] = block;
+
+    if (++cache->count[cls] > limit)
     {
-      free_ = ptr + size;
+      // Return blocks until the cache is half full.
+      threads::Scoped_lock lock(lock_);
+      length_type n = cache->count[cls] - limit / 2;
+      for (length_type i=0; i<n; ++i)
+      {
+	block = cache->head[cls];
+	cache->head[cls] = block->next;
+	give(reinterpret_cast<char*>(block), order);
+      }
+      cache->count[cls] -= n;
+      thread_cached_ -= n << order;
     }
-    else
+    return;
+  }
+
+  // Free the pieces kept by impl_allocate().
+  threads::Scoped_lock lock(lock_);
+  while (size < (size_t(1) << order))
+  {
+    size_t half = size_t(1) << --order;
+    if (size > half)
     {
-      *(char**)prev = ptr + size;
+      give(ptr, order);
+      ptr  += half;
+      size -= half;
     }
-
-    *(char**)(ptr + size) = *(char**)ptr;
-    ((size_t*)(ptr + size))[1] = avail - size;
   }
-
-  return (void*)ptr;
+  give(ptr, order);
 }
 
-void 
-Huge_page_pool::impl_deallocate(void* return_ptr, size_t size)
+char const*
+Huge_page_pool::name()
 {
-  if (size < 2*sizeof(char*))
-    size = 2*sizeof(char*);
+  return "Huge_page_pool";
+}
 
-  // Maintain 128 B alignment
-  if (size % 128 != 0)
-    size += 128 - (size % 128);
+size_t
+Huge_page_pool::total_avail()
+{
+  threads::Scoped_lock lock(lock_);
+  return total_avail_;
+}
 
-  char*  prev  = 0;
-  char*  ptr   = free_;
+Huge_page_pool::Stats
+Huge_page_pool::stats()
+{
+  threads::Scoped_lock lock(lock_);
+  Stats stats;
+  stats.total         = size_;
+  stats.free          = total_avail_;
+  stats.largest_free  = tree_[1] ? size_t(1) << (tree_[1] - 1) : 0;
+  stats.free_blocks   = count_free(1, top_order_);
+  stats.thread_cached = thread_cached_;
+  return stats;
+}
 
-  while (ptr && ptr < return_ptr)
+void
+Huge_page_pool::flush_thread_cache()
+{
+  Thread_cache* cache = static_cast<Thread_cache*>(pthread_getspecific(key_));
+  if (cache)
   {
-    prev  = ptr;
-    ptr   = *(char**)ptr;
+    threads::Scoped_lock lock(lock_);
+    drain(cache);
   }
+}
 
-  if (ptr == 0)
+// Return the calling thread's cache, creating it on first use.
+
+Huge_page_pool::Thread_cache*
+Huge_page_pool::thread_cache()
+{
+  Thread_cache* cache = static_cast<Thread_cache*>(pthread_getspecific(key_));
+  if (cache)
+    return cache;
+
+  cache = new Thread_cache;
+  cache->pool = this;
+  cache->prev = 0;
+  for (unsigned i=0; i<num_classes; ++i)
   {
-    // Free list empty.
-    ((size_t*)(return_ptr))[1] = size;
-    free_ = (char*)return_ptr;
+    cache->head[i]  = 0;
+    cache->count[i] = 0;
   }
-  else if (prev == 0)
   {
-    assert(free_ == ptr);
-    assert(ptr-(char*)return_ptr >= (ptrdiff_t)size);
-    if ((ptrdiff_t)size == ptr - (char*)return_ptr)
-    {
-      // Insert at front of free list, merge with next entry.
-      *(char**)(return_ptr)      = *(char**)ptr;
-      ((size_t*)(return_ptr))[1] = size + ((size_t*)(ptr))[1];
-      free_ = (char*)return_ptr;
-    }
-    else
-    {
-      // Insert at front of free list, no merge.
-      *(char**)(return_ptr)      = ptr;
-      ((size_t*)(return_ptr))[1] = size;
-      free_ = (char*)return_ptr;
-    }
+    threads::Scoped_lock lock(lock_);
+    cache->next = caches_;
+    if (caches_)
+      caches_->prev = cache;
+    caches_ = cache;
   }
+  pthread_setspecific(key_, cache);
+  return cache;
+}
+
+// Called on thread exit.
+
+void
+Huge_page_pool::destroy_thread_cache(void* cache)
+{
+  Thread_cache* c = static_cast<Thread_cache*>(cache);
+  c->pool->release(c);
+}
+
+void
+Huge_page_pool::release(Thread_cache* cache)
+{
+  threads::Scoped_lock lock(lock_);
+  drain(cache);
+  if (cache->prev)
+    cache->prev->next = cache->next;
   else
+    caches_ = cache->next;
+  if (cache->next)
+    cache->next->prev = cache->prev;
+  delete cache;
+}
+
+void
+Huge_page_pool::drain(Thread_cache* cache)
+{
+  for (unsigned cls=0; cls<num_classes; ++cls)
   {
-    assert(ptr-(char*)return_ptr >= (ptrdiff_t)size);
-    if ((ptrdiff_t)size == ptr - (char*)return_ptr)
-    {
-      // Insert in middle of free list, merge
-      *(char**)(return_ptr)      = *(char**)ptr;
-      ((size_t*)(return_ptr))[1] = size + ((size_t*)(ptr))[1];
-    }
-    else
+    unsigned order = cls + min_order;
+    while (Free_block* block = cache->head[cls])
     {
-      // Insert in middle of free list, no merge
-      *(char**)(return_ptr)      = ptr;
-      ((size_t*)(return_ptr))[1] = size;
+      cache->head[cls] = block->next;
+      give(reinterpret_cast<char*>(block), order);
     }
+    thread_cached_ -= cache->count[cls] << order;
+    cache->count[cls] = 0;
+  }
+}
 
-    size_t prev_size = ((size_t*)prev)[1];
+// Allocate the lowest-addressed free block of ORDER.  Returns 0 if
+// there is none.
 
-    if ((ptrdiff_t)prev_size == (char*)return_ptr - prev)
-    {
-      // Merge with prev.
-      *(char**)(prev) = *(char**)return_ptr;
-      ((size_t*)(prev))[1] = size + ((size_t*)(return_ptr))[1];
-    }
-    else
-      // No merge with prev.
-      *(char**)(prev) = (char*)return_ptr;
+char*
+Huge_page_pool::take(unsigned order)
+{
+  if (order > top_order_ || tree_[1] <= order)
+    return 0;
+
+  size_t node = 1;
+  for (unsigned k = top_order_; k > order; --k)
+  {
+    node *= 2;
+    if (tree_[node] <= order)
+      ++node;
   }
+  tree_[node] = 0;
+  update(node, order);
+  total_avail_ -= size_t(1) << order;
+  return pool_ + ((node - (size_t(1) << (top_order_ - order))) << order);
+}
+
+// Free a block of ORDER, merging it with its buddies.
 
-  total_avail_ += size;
+void
+Huge_page_pool::give(char* ptr, unsigned order)
+{
+  size_t node = (size_t(1) << (top_order_ - order)) + ((ptr - pool_) >> order);
+  assert(tree_[node] == 0);
+  tree_[node] = order + 1;
+  update(node, order);
+  total_avail_ += size_t(1) << order;
 }
 
-char const* 
-Huge_page_pool::name()
+// Recompute the ancestors of NODE, a node of ORDER.  A node is free as
+// a whole if both of its children are.
+
+void
+Huge_page_pool::update(size_t node, unsigned order)
 {
-  return "Huge_page_pool";
+  for (; node > 1; node /= 2)
+  {
+    unsigned char l = tree_[node & ~size_t(1)];
+    unsigned char r = tree_[node | 1];
+    ++order;
+    tree_[node / 2] = (l == order && r == order) ? order + 1 : std::max(l, r);
+  }
+}
+
+// Count the maximal free blocks below NODE, a node of ORDER.
+
+length_type
+Huge_page_pool::count_free(size_t node, unsigned order) const
+{
+  if (tree_[node] == order + 1)
+    return 1;
+  if (tree_[node] == 0 || order == min_order)
+    return 0;
+  return count_free(2*node, order-1) + count_free(2*node+1, order-1);
 }
 
 } // namespace vsip::impl
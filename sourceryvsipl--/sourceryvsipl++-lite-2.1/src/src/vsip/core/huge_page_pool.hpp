@@ -18,6 +18,9 @@
 
 #include <vsip/core/memory_pool.hpp>
 #include <vsip/core/aligned_pool.hpp>
+#if VSIP_IMPL_ENABLE_HUGE_PAGE_POOL
+#  include <vsip/core/threads/sync.hpp>
+#endif
 
 
 
@@ -28,15 +31,52 @@
 namespace vsip
 {
 
-namespace impl 
+namespace impl
 {
 
 #if VSIP_IMPL_ENABLE_HUGE_PAGE_POOL
+/// Memory pool carved out of huge pages.
+///
+/// The pages are managed as a binary buddy system with 128 byte
+/// minimum blocks.  A complete binary tree over the blocks records
+/// the largest free block below each node, so that allocation takes
+/// the lowest-addressed free block that fits, which keeps free memory
+/// in large blocks, and allocation and deallocation take
+/// O(log(pool size)) steps.
+///
+/// Requests up to CACHE_MAX bytes are rounded to a power of two and
+/// served in O(1) from a per-thread cache of free blocks, which
+/// exchanges batches of blocks with the buddy system.  Larger requests
+/// are rounded to 128 bytes: the tail of their power-of-two block is
+/// freed, and deallocate() uses the size of the request to free the
+/// remaining pieces.
+///
+/// All member functions may be called concurrently.
+
 class Huge_page_pool : public Memory_pool
 {
 public:
   static size_t const align = 128;
 
+  // Largest request served from the per-thread caches.
+  static size_t const cache_max = 65536;
+
+  /// Snapshot of the state of the buddy system.
+  struct Stats
+  {
+    size_t      total;		// size of the pool
+    size_t      free;		// bytes in free blocks
+    size_t      largest_free;	// largest free block
+    length_type free_blocks;	// number of free blocks
+    size_t      thread_cached;	// bytes in cached or allocated
+				// small blocks
+
+    /// External fragmentation: the fraction of free memory that is
+    /// not in the largest free block.
+    float fragmentation() const
+    { return free ? 1.f - float(largest_free) / float(free) : 0.f; }
+  };
+
   // Constructors and destructor.
 public:
   Huge_page_pool(const char* file, int pages);
@@ -51,15 +91,45 @@ public:
 
   // Impl accessors.
 public:
-  size_t total_avail() { return total_avail_; }
+  size_t total_avail();
+  Stats  stats();
+
+  /// Return the blocks cached by the calling thread to the buddy system.
+  void flush_thread_cache();
 
-  // Member data.
 private:
-  char*  pool_;
-  size_t size_;
-  char*  free_;
+  struct Free_block;
+  struct Thread_cache;
 
-  size_t total_avail_;
+  static unsigned const min_order   = 7;
+  static unsigned const num_classes = 10;	// orders 7 .. 16
+
+  Thread_cache* thread_cache();
+  static void   destroy_thread_cache(void* cache);
+  void          release(Thread_cache* cache);
+
+  // These require lock_ to be held.
+  void        drain(Thread_cache* cache);
+  char*       take(unsigned order);
+  void        give(char* ptr, unsigned order);
+  void        update(size_t node, unsigned order);
+  length_type count_free(size_t node, unsigned order) const;
+
+  // Member data.
+private:
+  char*          pool_;
+  size_t         size_;
+  unsigned       top_order_;		// order of the tree root
+
+  threads::Mutex lock_;
+  unsigned char* tree_;			// 1 + order of the largest free
+					// block below each node, or 0
+  size_t         total_avail_;
+  size_t         thread_cached_;
+  size_t         cache_bytes_;		// per-class thread cache limit
+
+  pthread_key_t  key_;
+  Thread_cache*  caches_;		// list of all thread caches
 };
 #else
 typedef Aligned_pool Huge_page_pool;
@@ -41,6 +41,7 @@ struct Simd_builtin_tag {};	// Builtin SIMD routines (non loop fusion)
 struct Dense_expr_tag {};	// Dense multi-dim expr reduction
 struct Copy_tag {};		// Optimized Copy
 struct Op_expr_tag {};		// Special expr handling (vmmul, etc)
+struct Simd_threaded_loop_fusion_tag {}; // Threaded SIMD Loop Fusion.
 struct Simd_loop_fusion_tag {};	// SIMD Loop Fusion.
 struct Simd_unaligned_loop_fusion_tag {};
 struct Fc_expr_tag {};		// Fused Fastconv RBO evaluator.
@@ -35,6 +35,7 @@
 # ifdef VSIP_IMPL_HAVE_CUDA
 #  include <vsip/opt/cuda/matvec.hpp>
 # endif
+# include <vsip/opt/simd/matvec.hpp>
 #endif
 #if VSIP_IMPL_HAVE_CVSIP
 # include <vsip/core/cvsip/matvec.hpp>
@@ -145,7 +146,7 @@ template<>
 struct List<Op_prod_gemp>
 {
   typedef Make_type_list<Cml_tag, Blas_tag, Mercury_sal_tag, 
-    Cvsip_tag, Generic_tag>::type type;
+    Cvsip_tag, Simd_builtin_tag, Generic_tag>::type type;
 };
 #endif
 
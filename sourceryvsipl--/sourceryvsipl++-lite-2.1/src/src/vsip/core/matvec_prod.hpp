@@ -30,6 +30,7 @@
 # ifdef VSIP_IMPL_HAVE_SAL
 #  include <vsip/opt/sal/eval_misc.hpp>
 # endif
+# include <vsip/opt/simd/matvec.hpp>
 #endif
 
 
@@ -52,7 +53,7 @@ template<>
 struct List<Op_prod_mm>
 {
   typedef Make_type_list<Cml_tag, Blas_tag, Mercury_sal_tag, 
-    Cvsip_tag, Generic_tag>::type type;
+    Cvsip_tag, Simd_builtin_tag, Generic_tag>::type type;
 };
 #endif
 
@@ -90,7 +91,7 @@ template<>
 struct List<Op_prod_mm_conj>
 {
   typedef Make_type_list<Cml_tag, Blas_tag, Mercury_sal_tag, 
-    Cvsip_tag, Generic_tag>::type type;
+    Cvsip_tag, Simd_builtin_tag, Generic_tag>::type type;
 };
 #endif
 
@@ -128,7 +129,7 @@ template<>
 struct List<Op_prod_mv>
 {
   typedef Make_type_list<Cml_tag, Blas_tag, Mercury_sal_tag, 
-    Cvsip_tag, Generic_tag>::type type;
+    Cvsip_tag, Simd_builtin_tag, Generic_tag>::type type;
 };
 #endif
 
@@ -165,7 +166,7 @@ template<>
 struct List<Op_prod_vm>
 {
   typedef Make_type_list<Cml_tag, Blas_tag, Mercury_sal_tag, 
-    Cvsip_tag, Generic_tag>::type type;
+    Cvsip_tag, Simd_builtin_tag, Generic_tag>::type type;
 };
 #endif
 
@@ -12,9 +12,23 @@
 
 #include <limits>
 #include <cstdlib>
+#include <cstring>
+#include <iostream>
 
 #include <vsip/core/memory_pool.hpp>
 #include <vsip/core/aligned_pool.hpp>
+#include <vsip/core/arena_pool.hpp>
+#include <vsip/core/huge_page_pool.hpp>
+#include <vsip/core/argv_utils.hpp>
+#if defined(VSIP_IMPL_NUMA) && !defined(VSIP_IMPL_REF_IMPL)
+#  include <vsip/opt/numa.hpp>
+#endif
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
+#if VSIP_IMPL_PAR_SERVICE == 3
+#  include <vsip/core/parallel/services.hpp>
+#endif
 
 
 
@@ -33,14 +47,117 @@ Memory_pool::~Memory_pool()
 
 Memory_pool* default_pool = 0;
 
-void initialize_default_pool(int& /*argc*/, char**& /*argv*/)
+namespace
 {
-  default_pool = new Aligned_pool();
+
+Memory_pool*
+create_huge_page_pool(char const* file, int size_mb)
+{
+#if VSIP_IMPL_ENABLE_HUGE_PAGE_POOL
+  // Whole 16 MB pages.
+  int pages = size_mb > 0 ? (size_mb + 15) / 16 : 1;
+  Huge_page_pool* pool = new Huge_page_pool(file, pages);
+  if (pool->total_avail() != 0)
+    return pool;
+  delete pool;
+#else
+  (void)file; (void)size_mb;
+  std::cerr << "WARNING: huge page pool not configured\n";
+#endif
+  return 0;
+}
+
+Memory_pool*
+create_numa_pool()
+{
+#if defined(VSIP_IMPL_NUMA) && !defined(VSIP_IMPL_REF_IMPL)
+  if (numa::Numa_pool::available())
+    return new numa::Numa_pool();
+  std::cerr << "WARNING: NUMA not available on this system\n";
+#else
+  std::cerr << "WARNING: NUMA pool not configured\n";
+#endif
+  return 0;
+}
+
+// Whether several threads of this process may allocate from the
+// default pool.
+bool
+pool_is_shared()
+{
+#if VSIP_IMPL_HAVE_THREAD_POOL
+  threads::Thread_pool* workers = threads::Thread_pool::instance();
+  if (workers && workers->num_workers() > 1)
+    return true;
+#endif
+#if VSIP_IMPL_PAR_SERVICE == 3
+  if (vsipl::impl_par_service()->team_size() > 1)
+    return true;
+#endif
+  return false;
+}
+
+Memory_pool*
+create_arena_pool(int size_mb)
+{
+  // Arena_pool is not thread-safe.
+  if (pool_is_shared())
+  {
+    std::cerr << "WARNING: arena pool cannot be shared by threads, "
+	      << "using aligned pool\n";
+    return 0;
+  }
+  return new Arena_pool(size_mb > 0 ? size_t(size_mb) << 20
+			: Arena_pool::default_chunk_size);
+}
+
+} // namespace vsip::impl::<unnamed>
+
+void initialize_default_pool(int& argc, char**& argv)
+{
+  char const* kind    = "aligned";
+  char const* file    = "/huge/svpp-pool.bin";
+  int         size_mb = 0;
+
+  for (int i=1; i<argc; )
+  {
+    if (!strcmp(argv[i], "--svpp-pool") && i+1 < argc)
+    {
+      kind = argv[i+1];
+      shift_argv(argc, argv, i, 2);
+    }
+    else if (!strcmp(argv[i], "--svpp-pool-size") && i+1 < argc)
+    {
+      size_mb = atoi(argv[i+1]);
+      shift_argv(argc, argv, i, 2);
+    }
+    else if (!strcmp(argv[i], "--svpp-pool-file") && i+1 < argc)
+    {
+      file = argv[i+1];
+      shift_argv(argc, argv, i, 2);
+    }
+    else
+      ++i;
+  }
+
+  default_pool = 0;
+  if (!strcmp(kind, "huge"))
+    default_pool = create_huge_page_pool(file, size_mb);
+  else if (!strcmp(kind, "numa"))
+    default_pool = create_numa_pool();
+  else if (!strcmp(kind, "arena"))
+    default_pool = create_arena_pool(size_mb);
+  else if (strcmp(kind, "aligned"))
+    std::cerr << "WARNING: unknown memory pool '" << kind << "'\n";
+
+  if (default_pool == 0)
+    default_pool = new Aligned_pool();
 }
 
 void finalize_default_pool()
 {
   delete default_pool;
+  default_pool = 0;
 }
 
 
@@ -16,6 +16,7 @@
 #include <limits>
 #include <cstdlib>
 #include <stdexcept>
+#include <new>
 
 #include <vsip/support.hpp>
 
@@ -61,10 +62,103 @@ public:
 
 extern Memory_pool* default_pool;
 
+/// Select and create the default pool.
+///
+/// Options:
+///   --svpp-pool KIND        one of 'aligned' (the default), 'huge',
+///                           'numa' or 'arena'.
+///   --svpp-pool-size MB     size of the huge page pool, or of the
+///                           chunks of the arena pool.
+///   --svpp-pool-file FILE   file backing the huge page pool.
+///
+/// Kinds that are not available fall back to Aligned_pool.
+/// The arena pool is not thread-safe; when more than one thread may
+/// allocate from the default pool, Aligned_pool is used instead.
+
 void initialize_default_pool(int& argc, char**&argv);
 
 void finalize_default_pool();
 
+/// Return the pool for temporary storage: the calling thread's
+/// scratch arena while a Scratch_scope is active, the default pool
+/// otherwise.
+
+Memory_pool* temporary_pool();
+
+
+
+/// Allocator drawing from the temporary pool current at its
+/// construction.  Used for the copies made by Ext_data.
+
+template <typename T>
+class Temporary_allocator
+{
+  // Type definitions.
+public:
+  typedef T              value_type;
+  typedef T*             pointer;
+  typedef T const*       const_pointer;
+  typedef T&             reference;
+  typedef T const&       const_reference;
+  typedef std::size_t    size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  // rebind allocator to type U
+  template <class U>
+  struct rebind
+  {
+    typedef Temporary_allocator<U> other;
+  };
+
+  // Constructors and destructor.
+public:
+  Temporary_allocator() throw() : pool_(temporary_pool()) {}
+  Temporary_allocator(Temporary_allocator const& a) throw()
+    : pool_(a.pool()) {}
+
+  template <class U>
+  Temporary_allocator(Temporary_allocator<U> const& a) throw()
+    : pool_(a.pool()) {}
+
+  ~Temporary_allocator() throw() {}
+
+  pointer address (reference value) const
+    { return &value; }
+
+  const_pointer address (const_reference value) const
+    { return &value; }
+
+  size_type max_size() const throw()
+    { return std::numeric_limits<std::size_t>::max() / sizeof(T); }
+
+  // allocate but don't initialize num elements of type T
+  pointer allocate(size_type num, const void* = 0)
+  {
+    // If num == 0, allocate 1 element.
+    return pool_->template allocate<T>(num ? num : 1);
+  }
+
+  void construct(pointer p, const T& value)
+  {
+    new((void*)p)T(value);
+  }
+
+  void destroy(pointer p)
+  {
+    p->~T();
+  }
+
+  void deallocate(pointer p, size_type num)
+  {
+    pool_->deallocate(p, num ? num : 1);
+  }
+
+  Memory_pool* pool() const { return pool_; }
+
+private:
+  Memory_pool* pool_;
+};
+
 
 } // namespace vsip::impl
 
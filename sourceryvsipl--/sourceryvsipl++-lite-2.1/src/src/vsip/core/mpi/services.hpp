@@ -332,8 +332,18 @@ public:
 
   void recv(processor_type src_proc, chain_type& chain);
 
+  void recv(processor_type src_proc, chain_type& chain, request_type& req);
+
   void wait(request_type& req);
 
+  bool test(request_type& req);
+
+  template <typename T>
+  void alltoallv(T const* send, int const* send_counts,
+		 int const* send_displs,
+		 T* recv, int const* recv_counts, int const* recv_displs,
+		 request_type& req);
+
   template <typename T>
   void broadcast(processor_type root_proc, T* data, length_type size);
 
@@ -566,6 +576,22 @@ Communicator::recv(
 
 
 
+/// Start receiving into CHAIN from SRC_PROC.  The data has been
+/// received once REQ has been waited for.
+
+inline void
+Communicator::recv(
+  processor_type   src_proc,
+  chain_type&      chain,
+  request_type&    req)
+{
+  int ierr = MPI_Irecv(MPI_BOTTOM, 1, chain, src_proc, 0, comm_, &req);
+  if (ierr != MPI_SUCCESS)
+    VSIP_IMPL_THROW(impl::unimplemented("MPI error handling."));
+}
+
+
+
 /// Wait for a previous communication (send or receive) to complete.
 
 inline void
@@ -578,6 +604,69 @@ Communicator::wait(
 
 
 
+/// Check whether a previous communication (send or receive) has
+/// completed, without waiting for it.
+
+inline bool
+Communicator::test(
+  request_type& req)
+{
+  MPI_Status status;
+  int        flag;
+  int ierr = MPI_Test(&req, &flag, &status);
+  if (ierr != MPI_SUCCESS)
+    VSIP_IMPL_THROW(impl::unimplemented("MPI error handling."));
+  return flag != 0;
+}
+
+
+
+/// Exchange data between all processors: this processor sends
+/// SEND_COUNTS[i] values from SEND + SEND_DISPLS[i] to processor i,
+/// and receives RECV_COUNTS[i] values from processor i into RECV +
+/// RECV_DISPLS[i].  The exchange is complete once REQ has been
+/// waited for.  Every processor of the communicator must take part.
+
+template <typename T>
+inline void
+Communicator::alltoallv(
+  T const*      send,
+  int const*    send_counts,
+  int const*    send_displs,
+  T*            recv,
+  int const*    recv_counts,
+  int const*    recv_displs,
+  request_type& req)
+{
+#if MPI_VERSION >= 3
+  int ierr = MPI_Ialltoallv(const_cast<T*>(send),
+			    const_cast<int*>(send_counts),
+			    const_cast<int*>(send_displs),
+			    Mpi_datatype<T>::value(),
+			    recv,
+			    const_cast<int*>(recv_counts),
+			    const_cast<int*>(recv_displs),
+			    Mpi_datatype<T>::value(),
+			    comm_, &req);
+#else
+  // Without non-blocking collectives, exchange the data now.
+  int ierr = MPI_Alltoallv(const_cast<T*>(send),
+			   const_cast<int*>(send_counts),
+			   const_cast<int*>(send_displs),
+			   Mpi_datatype<T>::value(),
+			   recv,
+			   const_cast<int*>(recv_counts),
+			   const_cast<int*>(recv_displs),
+			   Mpi_datatype<T>::value(),
+			   comm_);
+  req = MPI_REQUEST_NULL;
+#endif
+  if (ierr != MPI_SUCCESS)
+    VSIP_IMPL_THROW(impl::unimplemented("MPI error handling."));
+}
+
+
+
 /// Broadcast a value from root processor to other processors.
 
 template <typename T>
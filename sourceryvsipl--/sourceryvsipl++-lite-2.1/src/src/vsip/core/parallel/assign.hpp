@@ -19,9 +19,13 @@
 #include <vsip/core/parallel/assign_fwd.hpp>
 #include <vsip/core/parallel/choose_assign_impl.hpp>
 
-#if VSIP_IMPL_PAR_SERVICE == 0 || VSIP_IMPL_PAR_SERVICE == 1
+#if VSIP_IMPL_PAR_SERVICE == 0 || VSIP_IMPL_PAR_SERVICE == 1 || \
+    VSIP_IMPL_PAR_SERVICE == 3
 #  include <vsip/core/parallel/assign_chain.hpp>
 #  include <vsip/core/parallel/assign_block_vector.hpp>
+#  if VSIP_IMPL_PAR_SERVICE == 1
+#    include <vsip/core/parallel/assign_alltoall.hpp>
+#  endif
 #elif VSIP_IMPL_PAR_SERVICE == 2
 #  include <vsip/opt/pas/assign.hpp>
 #  include <vsip/opt/pas/assign_eb.hpp>
@@ -0,0 +1,739 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/parallel/assign_alltoall.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: All-to-all parallel assignment algorithm.
+
+    Corner turns, where each processor holding part of the source
+    sends part of it to every processor holding the destination, are
+    performed as one collective exchange of packed buffers instead of
+    one message per pair of processors.
+*/
+
+#ifndef VSIP_CORE_PARALLEL_ASSIGN_ALLTOALL_HPP
+#define VSIP_CORE_PARALLEL_ASSIGN_ALLTOALL_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vector>
+#include <algorithm>
+
+#include <vsip/support.hpp>
+#include <vsip/domain.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/core/domain_utils.hpp>
+#include <vsip/core/parallel/services.hpp>
+#include <vsip/core/profile.hpp>
+#include <vsip/core/parallel/assign.hpp>
+#include <vsip/core/parallel/assign_common.hpp>
+#include <vsip/core/parallel/assign_chain.hpp>
+
+/// Number of bytes each processor sends in one step of an all-to-all
+/// assignment.  Larger assignments are exchanged in chunks of about
+/// this size, packing and unpacking each chunk while the next is in
+/// flight.  0 exchanges all data in one step.
+#ifndef VSIP_IMPL_PAR_ALLTOALL_CHUNK_SIZE
+#  define VSIP_IMPL_PAR_ALLTOALL_CHUNK_SIZE (1 << 20)
+#endif
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+
+namespace impl
+{
+
+namespace par_alltoall_assign
+{
+
+/// Copy a LEN0 x LEN1 array at DATA, with strides STRIDE0 and
+/// STRIDE1, to (Pack) or from (!Pack) the contiguous buffer BUF.
+/// Returns the end of the data in BUF.
+
+template <bool     Pack,
+	  typename T>
+inline T*
+copy_data(T*          buf,
+	  T*          data,
+	  stride_type stride0, length_type len0,
+	  stride_type stride1, length_type len1)
+{
+  for (index_type i=0; i<len0; ++i, data += stride0, buf += len1)
+  {
+    if (stride1 == 1)
+    {
+      if (Pack) std::copy(data, data + len1, buf);
+      else      std::copy(buf, buf + len1, data);
+    }
+    else
+    {
+      for (index_type j=0; j<len1; ++j)
+	if (Pack) buf[j] = data[j*stride1];
+	else      data[j*stride1] = buf[j];
+    }
+  }
+  return buf;
+}
+
+
+
+/// Copy the elements of the local domain DOM of the block accessed
+/// by EXT to or from BUF, in OrderT dimension order.
+
+template <bool     Pack,
+	  typename OrderT,
+	  typename T,
+	  typename ExtDataT>
+inline T*
+copy_data(T* buf, ExtDataT& ext, Domain<2> const& dom)
+{
+  dimension_type const dim0 = OrderT::impl_dim0;
+  dimension_type const dim1 = OrderT::impl_dim1;
+
+  T* data = ext.data() + dom[dim0].first() * ext.stride(dim0)
+                       + dom[dim1].first() * ext.stride(dim1);
+
+  return copy_data<Pack>(
+    buf, data,
+    dom[dim0].stride() * ext.stride(dim0), dom[dim0].length(),
+    dom[dim1].stride() * ext.stride(dim1), dom[dim1].length());
+}
+
+template <bool     Pack,
+	  typename OrderT,
+	  typename T,
+	  typename ExtDataT>
+inline T*
+copy_data(T* buf, ExtDataT& ext, Domain<3> const& dom)
+{
+  dimension_type const dim0 = OrderT::impl_dim0;
+  dimension_type const dim1 = OrderT::impl_dim1;
+  dimension_type const dim2 = OrderT::impl_dim2;
+
+  T* data = ext.data() + dom[dim0].first() * ext.stride(dim0)
+                       + dom[dim1].first() * ext.stride(dim1)
+                       + dom[dim2].first() * ext.stride(dim2);
+
+  for (index_type i=0; i<dom[dim0].length(); ++i)
+    buf = copy_data<Pack>(
+      buf, data + i * dom[dim0].stride() * ext.stride(dim0),
+      dom[dim1].stride() * ext.stride(dim1), dom[dim1].length(),
+      dom[dim2].stride() * ext.stride(dim2), dom[dim2].length());
+  return buf;
+}
+
+
+
+/// Return the part CHUNK of CHUNKS of DOM, splitting it along
+/// dimension D.  The parts of the domains of an intersection on the
+/// sending and receiving processors hold the same elements.
+/// Returns false if the part is empty.
+
+template <dimension_type Dim>
+inline bool
+chunk_domain(
+  Domain<Dim> const& dom,
+  dimension_type     d,
+  index_type         chunk,
+  length_type        chunks,
+  Domain<Dim>&       part)
+{
+  length_type len   = dom[d].length();
+  index_type  first = chunk * len / chunks;
+  index_type  last  = (chunk + 1) * len / chunks;
+  if (first == last)
+    return false;
+
+  Domain<1> dims[Dim];
+  for (dimension_type i=0; i<Dim; ++i)
+    dims[i] = dom[i];
+  dims[d] = Domain<1>(dom[d].impl_nth(first), dom[d].stride(), last - first);
+  part = construct_domain<Dim>(dims);
+  return true;
+}
+
+} // namespace par_alltoall_assign
+
+
+// All-to-all parallel assignment.
+//
+// Requires block distributions, so that each subblock is one patch,
+// and direct access to interleaved data.  The collective exchange is
+// used when both views are distributed over all processors of the
+// communicator and no dimension is distributed in both, that is for
+// corner turns.  Other assignments use Chained_assign.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+class Par_assign<Dim, T1, T2, Block1, Block2, Alltoall_assign>
+  : Compile_time_assert<Type_equal<T1, T2>::value &&
+                        !Is_split_block<Block1>::value &&
+                        !Is_split_block<Block2>::value>
+{
+  static dimension_type const dim = Dim;
+
+  typedef typename Distributed_local_block<Block1>::type dst_local_block;
+  typedef typename Distributed_local_block<Block2>::type src_local_block;
+
+  typedef typename View_of_dim<dim, T1, dst_local_block>::type
+		dst_lview_type;
+
+  typedef typename View_of_dim<dim, T2, src_local_block>::const_type
+		src_lview_type;
+
+  typedef impl::Persistent_ext_data<src_local_block> src_ext_type;
+  typedef impl::Persistent_ext_data<dst_local_block> dst_ext_type;
+
+  typedef typename Block1::map_type dst_appmap_t;
+  typedef typename Block2::map_type src_appmap_t;
+
+  typedef typename Block_layout<Block1>::order_type dst_order_t;
+
+  typedef impl::Communicator::request_type request_type;
+
+  typedef Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>
+		chained_type;
+
+  /// A Msg_record holds the part of the local subblock to send to,
+  /// or receive from, processor PROC_.
+  struct Msg_record
+  {
+    Msg_record(processor_type proc, Domain<Dim> const& dom)
+      : proc_(proc), dom_(dom)
+      {}
+
+  public:
+    processor_type proc_;
+    Domain<Dim>    dom_;
+  };
+
+  /// A Copy_record holds part of a data transfer where the source
+  /// and destination processors are the same.
+  struct Copy_record
+  {
+    Copy_record(Domain<Dim> const& src_dom, Domain<Dim> const& dst_dom)
+      : src_dom_(src_dom), dst_dom_(dst_dom)
+      {}
+
+  public:
+    Domain<Dim>    src_dom_;
+    Domain<Dim>    dst_dom_;
+  };
+
+  // Constructor.
+public:
+  /// CHUNKS is the number of steps in which to exchange the data.  By
+  /// default it is chosen from VSIP_IMPL_PAR_ALLTOALL_CHUNK_SIZE.
+  Par_assign(
+    typename View_of_dim<Dim, T1, Block1>::type       dst,
+    typename View_of_dim<Dim, T2, Block2>::const_type src,
+    length_type                                       chunks = 0)
+    : dst_      (dst),
+      src_      (src.block()),
+      dst_am_   (dst_.block().map()),
+      src_am_   (src_.block().map()),
+      comm_     (dst_am_.impl_comm()),
+      chained_  (0),
+      src_ext_  (0),
+      dst_ext_  (0),
+      chunks_   (chunks),
+      send_size_(0),
+      recv_size_(0),
+      send_buf_ (0),
+      recv_buf_ (0),
+      pending_  (false)
+  {
+    static profile::Event event = { "Par_assign<Alltoall_assign>-cons", 0 };
+    profile::Scope<profile::par> scope(event);
+    assert(src_am_.impl_comm() == dst_am_.impl_comm());
+
+    if (!is_corner_turn())
+    {
+      chained_ = new chained_type(dst_, src_);
+      return;
+    }
+
+    processor_type rank = local_processor();
+
+    index_type src_sb = src_am_.subblock(rank);
+    if (src_sb != no_subblock)
+      src_ext_ = new src_ext_type(get_local_view(src_).block(), SYNC_IN);
+
+    index_type dst_sb = dst_am_.subblock(rank);
+    if (dst_sb != no_subblock)
+      dst_ext_ = new dst_ext_type(get_local_view(dst_).block(), SYNC_OUT);
+
+    if (chunks_ == 0)
+      chunks_ = default_chunks();
+
+    build_lists();
+    build_counts();
+  }
+
+  ~Par_assign()
+  {
+    delete chained_;
+    delete src_ext_;
+    delete dst_ext_;
+    free_align(send_buf_);
+    free_align(recv_buf_);
+  }
+
+  // Implementation functions.
+private:
+  bool        is_corner_turn() const;
+  length_type default_chunks() const;
+
+  void build_lists();
+  void build_counts();
+
+  void exec_copy_list();
+  void pack(index_type chunk, T1* buf);
+  void unpack(index_type chunk, T1* buf);
+
+  T1* send_buf(index_type chunk)
+  { return send_buf_ + (chunk % 2) * send_size_; }
+  T1* recv_buf(index_type chunk)
+  { return recv_buf_ + (chunk % 2) * recv_size_; }
+
+  int const* counts(std::vector<int> const& v, index_type chunk) const
+  { return &v[chunk * comm_.size()]; }
+
+  // Unpack the last chunk and release the local data.
+  void finish()
+  {
+    unpack(chunks_ - 1, recv_buf(chunks_ - 1));
+    pending_ = false;
+
+    if (dst_ext_) dst_ext_->end();
+    if (src_ext_) src_ext_->end();
+  }
+
+  // Invoke the parallel assignment
+public:
+  void operator()()
+  {
+    begin();
+    wait();
+  }
+
+  // Start the parallel assignment.  All chunks but the last are
+  // exchanged before begin() returns.  The last one is complete once
+  // test() has returned true or wait() has returned.  Until then, the
+  // source must not be modified and the destination must not be
+  // accessed.
+  void begin()
+  {
+    if (chained_)
+    {
+      chained_->begin();
+      return;
+    }
+
+    static profile::Event event = { "Par_assign<Alltoall_assign>-begin", 0 };
+    profile::Scope<profile::par> scope(event);
+
+    if (src_ext_) src_ext_->begin();
+    if (dst_ext_) dst_ext_->begin();
+
+    // Pack chunk C while chunk C-1 is exchanged, then unpack chunk
+    // C-1 while chunk C is exchanged.
+    for (index_type c=0; c<chunks_; ++c)
+    {
+      pack(c, send_buf(c));
+      if (c > 0)
+	comm_.wait(req_);
+      comm_.alltoallv(send_buf(c),
+		      counts(send_counts_, c), counts(send_displs_, c),
+		      recv_buf(c),
+		      counts(recv_counts_, c), counts(recv_displs_, c),
+		      req_);
+      if (c == 0)
+	exec_copy_list();
+      if (c > 0)
+	unpack(c - 1, recv_buf(c - 1));
+    }
+    pending_ = true;
+  }
+
+  bool test()
+  {
+    if (chained_)
+      return chained_->test();
+
+    if (pending_)
+    {
+      if (!comm_.test(req_))
+	return false;
+      finish();
+    }
+    return true;
+  }
+
+  void wait()
+  {
+    if (chained_)
+    {
+      chained_->wait();
+      return;
+    }
+
+    if (pending_)
+    {
+      static profile::Event event = { "Par_assign<Alltoall_assign>-wait", 0 };
+      profile::Scope<profile::par> scope(event);
+      comm_.wait(req_);
+      finish();
+    }
+  }
+
+  // Private member data.
+private:
+  typename View_of_dim<Dim, T1, Block1>::type       dst_;
+  typename View_of_dim<Dim, T2, Block2>::const_type src_;
+
+  dst_appmap_t const& dst_am_;
+  src_appmap_t const& src_am_;
+  impl::Communicator& comm_;
+
+  chained_type*             chained_;
+
+  src_ext_type*             src_ext_;
+  dst_ext_type*             dst_ext_;
+
+  std::vector<Msg_record>   send_list_;
+  std::vector<Msg_record>   recv_list_;
+  std::vector<Copy_record>  copy_list_;
+
+  length_type               chunks_;
+
+  // Counts and displacements of each processor, for each chunk.
+  std::vector<int>          send_counts_;
+  std::vector<int>          send_displs_;
+  std::vector<int>          recv_counts_;
+  std::vector<int>          recv_displs_;
+
+  length_type               send_size_;
+  length_type               recv_size_;
+  T1*                       send_buf_;
+  T1*                       recv_buf_;
+
+  request_type              req_;
+  bool                      pending_;
+};
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+// Check whether the assignment is a corner turn.  The result depends
+// only on the maps, so that all processors agree on it.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+bool
+Par_assign<Dim, T1, T2, Block1, Block2, Alltoall_assign>::is_corner_turn()
+  const
+{
+  length_type size = comm_.size();
+
+  if (size < 2 ||
+      src_am_.num_processors() != size ||
+      dst_am_.num_processors() != size)
+    return false;
+
+  for (dimension_type d=0; d<Dim; ++d)
+    if (src_am_.num_subblocks(d) > 1 && dst_am_.num_subblocks(d) > 1)
+      return false;
+
+  return true;
+}
+
+
+
+// Choose the number of chunks so that each processor sends about
+// VSIP_IMPL_PAR_ALLTOALL_CHUNK_SIZE bytes per chunk.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+length_type
+Par_assign<Dim, T1, T2, Block1, Block2, Alltoall_assign>::default_chunks()
+  const
+{
+  length_type const chunk_size = VSIP_IMPL_PAR_ALLTOALL_CHUNK_SIZE;
+  if (chunk_size == 0)
+    return 1;
+
+  length_type bytes  = dst_.block().size() * sizeof(T1) / comm_.size();
+  length_type chunks = (bytes + chunk_size - 1) / chunk_size;
+  length_type max    = dst_.block().size(Dim, dst_order_t::impl_dim0);
+  return std::max<length_type>(1, std::min(chunks, max));
+}
+
+
+
+// Build the send, receive and copy lists, as Chained_assign does.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+void
+Par_assign<Dim, T1, T2, Block1, Block2, Alltoall_assign>::build_lists()
+{
+  static profile::Event event =
+    { "Par_assign<Alltoall_assign>-build_lists", 0 };
+  profile::Scope<profile::par> scope(event);
+  processor_type rank = local_processor();
+
+  index_type src_sb = src_am_.subblock(rank);
+  index_type dst_sb = dst_am_.subblock(rank);
+
+  // Parts of the local source subblock to send.
+  if (src_sb != no_subblock)
+  {
+    for (index_type pi=0; pi<dst_am_.impl_working_size(); ++pi)
+    {
+      processor_type proc = dst_am_.impl_proc_from_rank(pi);
+      index_type     sb   = dst_am_.subblock(proc);
+      if (sb == no_subblock)
+	continue;
+
+      for (index_type dp=0; dp<num_patches(dst_, sb); ++dp)
+      {
+	Domain<dim> dst_dom = global_domain(dst_, sb, dp);
+
+	for (index_type sp=0; sp<num_patches(src_, src_sb); ++sp)
+	{
+	  Domain<dim> src_dom  = global_domain(src_, src_sb, sp);
+	  Domain<dim> src_ldom = local_domain(src_, src_sb, sp);
+	  Domain<dim> intr;
+
+	  if (intersect(src_dom, dst_dom, intr))
+	  {
+	    if (proc == rank)
+	      copy_list_.push_back(Copy_record(
+		apply_intr(src_ldom, src_dom, intr),
+		apply_intr(local_domain(dst_, sb, dp), dst_dom, intr)));
+	    else
+	      send_list_.push_back(Msg_record(
+		proc, apply_intr(src_ldom, src_dom, intr)));
+	  }
+	}
+      }
+    }
+  }
+
+  // Parts of the local destination subblock to receive.
+  if (dst_sb != no_subblock)
+  {
+    for (index_type pi=0; pi<src_am_.impl_working_size(); ++pi)
+    {
+      processor_type proc = src_am_.impl_proc_from_rank(pi);
+      index_type     sb   = src_am_.subblock(proc);
+      if (proc == rank || sb == no_subblock)
+	continue;
+
+      for (index_type dp=0; dp<num_patches(dst_, dst_sb); ++dp)
+      {
+	Domain<dim> dst_dom  = global_domain(dst_, dst_sb, dp);
+	Domain<dim> dst_ldom = local_domain(dst_, dst_sb, dp);
+
+	for (index_type sp=0; sp<num_patches(src_, sb); ++sp)
+	{
+	  Domain<dim> src_dom = global_domain(src_, sb, sp);
+	  Domain<dim> intr;
+
+	  if (intersect(dst_dom, src_dom, intr))
+	    recv_list_.push_back(Msg_record(
+	      proc, apply_intr(dst_ldom, dst_dom, intr)));
+	}
+      }
+    }
+  }
+}
+
+
+
+// Compute the counts and displacements of each chunk, and allocate
+// the buffers.  The parts for one processor are consecutive in the
+// lists, and so are contiguous in the buffers.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+void
+Par_assign<Dim, T1, T2, Block1, Block2, Alltoall_assign>::build_counts()
+{
+  using par_alltoall_assign::chunk_domain;
+
+  length_type    size = comm_.size();
+  dimension_type d    = dst_order_t::impl_dim0;
+
+  send_counts_.assign(chunks_ * size, 0);
+  send_displs_.assign(chunks_ * size, 0);
+  recv_counts_.assign(chunks_ * size, 0);
+  recv_displs_.assign(chunks_ * size, 0);
+
+  for (index_type c=0; c<chunks_; ++c)
+  {
+    length_type offset = 0;
+    for (index_type i=0; i<send_list_.size(); ++i)
+    {
+      index_type  pos = c * size + send_list_[i].proc_;
+      Domain<Dim> part;
+      if (i == 0 || send_list_[i].proc_ != send_list_[i-1].proc_)
+	send_displs_[pos] = offset;
+      if (chunk_domain(send_list_[i].dom_, d, c, chunks_, part))
+      {
+	send_counts_[pos] += part.size();
+	offset            += part.size();
+      }
+    }
+    send_size_ = std::max(send_size_, offset);
+
+    offset = 0;
+    for (index_type i=0; i<recv_list_.size(); ++i)
+    {
+      index_type  pos = c * size + recv_list_[i].proc_;
+      Domain<Dim> part;
+      if (i == 0 || recv_list_[i].proc_ != recv_list_[i-1].proc_)
+	recv_displs_[pos] = offset;
+      if (chunk_domain(recv_list_[i].dom_, d, c, chunks_, part))
+      {
+	recv_counts_[pos] += part.size();
+	offset            += part.size();
+      }
+    }
+    recv_size_ = std::max(recv_size_, offset);
+  }
+
+  // Two buffers each when pipelining, at least one element each so
+  // that the buffers passed to the communicator are valid.
+  length_type nbuf = (chunks_ > 1) ? 2 : 1;
+  send_size_ = std::max<length_type>(send_size_, 1);
+  recv_size_ = std::max<length_type>(recv_size_, 1);
+  send_buf_  = alloc_align<T1>(VSIP_IMPL_ALLOC_ALIGNMENT, nbuf * send_size_);
+  recv_buf_  = alloc_align<T1>(VSIP_IMPL_ALLOC_ALIGNMENT, nbuf * recv_size_);
+}
+
+
+
+// Execute the copy_list.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+void
+Par_assign<Dim, T1, T2, Block1, Block2, Alltoall_assign>::exec_copy_list()
+{
+  if (copy_list_.size() == 0)
+    return;
+
+  static profile::Event event =
+    { "Par_assign<Alltoall_assign>-exec_copy_list", 0 };
+  profile::Scope<profile::par> scope(event);
+
+  src_lview_type src_lview = get_local_view(src_);
+  dst_lview_type dst_lview = get_local_view(dst_);
+
+  typedef typename std::vector<Copy_record>::iterator cl_iterator;
+  for (cl_iterator cl_cur = copy_list_.begin();
+       cl_cur != copy_list_.end();
+       ++cl_cur)
+  {
+    dst_lview((*cl_cur).dst_dom_) = src_lview((*cl_cur).src_dom_);
+  }
+}
+
+
+
+// Pack chunk CHUNK of the send_list into BUF.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+void
+Par_assign<Dim, T1, T2, Block1, Block2, Alltoall_assign>::pack(
+  index_type chunk,
+  T1*        buf)
+{
+  static profile::Event event = { "Par_assign<Alltoall_assign>-pack", 0 };
+  profile::Scope<profile::par> scope(event);
+
+  typedef typename std::vector<Msg_record>::iterator sl_iterator;
+  for (sl_iterator sl_cur = send_list_.begin();
+       sl_cur != send_list_.end();
+       ++sl_cur)
+  {
+    Domain<Dim> part;
+    if (par_alltoall_assign::chunk_domain((*sl_cur).dom_,
+					  dst_order_t::impl_dim0,
+					  chunk, chunks_, part))
+      buf = par_alltoall_assign::copy_data<true, dst_order_t>(
+	buf, *src_ext_, part);
+  }
+}
+
+
+
+// Unpack chunk CHUNK of the recv_list from BUF.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+void
+Par_assign<Dim, T1, T2, Block1, Block2, Alltoall_assign>::unpack(
+  index_type chunk,
+  T1*        buf)
+{
+  static profile::Event event = { "Par_assign<Alltoall_assign>-unpack", 0 };
+  profile::Scope<profile::par> scope(event);
+
+  typedef typename std::vector<Msg_record>::iterator rl_iterator;
+  for (rl_iterator rl_cur = recv_list_.begin();
+       rl_cur != recv_list_.end();
+       ++rl_cur)
+  {
+    Domain<Dim> part;
+    if (par_alltoall_assign::chunk_domain((*rl_cur).dom_,
+					  dst_order_t::impl_dim0,
+					  chunk, chunks_, part))
+      buf = par_alltoall_assign::copy_data<false, dst_order_t>(
+	buf, *dst_ext_, part);
+  }
+}
+
+} // namespace vsip::impl
+
+} // namespace vsip
+
+#endif // VSIP_CORE_PARALLEL_ASSIGN_ALLTOALL_HPP
@@ -176,7 +176,8 @@ public:
       src_ext_  (src_.local().block(), impl::SYNC_IN),
       dst_ext_  (dst_.local().block(), impl::SYNC_OUT)
   {
-    profile::Scope<profile::par> scope("Par_assign<Blkvec_assign>-cons");
+    static profile::Event event = { "Par_assign<Blkvec_assign>-cons", 0 };
+    profile::Scope<profile::par> scope(event);
     assert(src_am_.impl_comm() == dst_am_.impl_comm());
 
     build_send_list();
@@ -332,7 +333,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Blkvec_assign>::build_send_list()
 {
-  profile::Scope<profile::par> scope("Par_assign<Blkvec_assign>-build_send_list");
+  static profile::Event event =
+    { "Par_assign<Blkvec_assign>-build_send_list", 0 };
+  profile::Scope<profile::par> scope(event);
   processor_type rank = local_processor();
 
   length_type dsize  = dst_am_.impl_working_size();
@@ -405,8 +408,9 @@ Par_assign<Dim, T1, T2, Block1, Block2, Blkvec_assign>::build_send_list()
 			<< std::endl;
 #endif
 	}
-	profile::Scope<profile::par> 
-          scope("Par_assign<Blkvec_assign>-build_send_list-d");
+	static profile::Event event =
+	  { "Par_assign<Blkvec_assign>-build_send_list-d", 0 };
+	profile::Scope<profile::par> scope(event);
       }
     }
     src_ext_.end();
@@ -426,8 +430,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Blkvec_assign>::build_recv_list()
 {
-  profile::Scope<profile::par> 
-    scope("Par_assign<Blkvec_assign>-build_recv_list");
+  static profile::Event event =
+    { "Par_assign<Blkvec_assign>-build_recv_list", 0 };
+  profile::Scope<profile::par> scope(event);
   processor_type rank = local_processor();
 
   length_type ssize  = src_am_.impl_working_size();
@@ -521,8 +526,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Blkvec_assign>::build_copy_list()
 {
-  profile::Scope<profile::par>
-    scope("Par_assign<Blkvec_assign>-build_copy_list");
+  static profile::Event event =
+    { "Par_assign<Blkvec_assign>-build_copy_list", 0 };
+  profile::Scope<profile::par> scope(event);
   processor_type rank = local_processor();
 
 #if VSIP_IMPL_ABV_VERBOSE >= 1
@@ -582,8 +588,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Blkvec_assign>::exec_send_list()
 {
-  profile::Scope<profile::par>
-    scope("Par_assign<Blkvec_assign>-exec_send_list");
+  static profile::Event event =
+    { "Par_assign<Blkvec_assign>-exec_send_list", 0 };
+  profile::Scope<profile::par> scope(event);
 
 #if VSIP_IMPL_ABV_VERBOSE >= 1
   processor_type rank = local_processor();
@@ -620,8 +627,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Blkvec_assign>::exec_recv_list()
 {
-  profile::Scope<profile::par>
-    scope("Par_assign<Blkvec_assign>-exec_recv_list");
+  static profile::Event event =
+    { "Par_assign<Blkvec_assign>-exec_recv_list", 0 };
+  profile::Scope<profile::par> scope(event);
 
 #if VSIP_IMPL_ABV_VERBOSE >= 1
   processor_type rank = local_processor();
@@ -660,8 +668,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Blkvec_assign>::exec_copy_list()
 {
-  profile::Scope<profile::par>
-    scope("Par_assign<Blkvec_assign>-exec_copy_list");
+  static profile::Event event =
+    { "Par_assign<Blkvec_assign>-exec_copy_list", 0 };
+  profile::Scope<profile::par> scope(event);
 
 #if VSIP_IMPL_ABV_VERBOSE >= 1
   processor_type rank = local_processor();
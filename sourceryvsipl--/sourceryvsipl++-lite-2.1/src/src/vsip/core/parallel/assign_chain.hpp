@@ -280,11 +280,13 @@ public:
       recv_list (),
       copy_list (),
       req_list  (),
+      recv_req_list (),
       msg_count (0),
       src_ext_ (new src_ext_type*[src_.block().map().num_subblocks()]),
       dst_ext_ (new dst_ext_type*[dst_.block().map().num_subblocks()])
   {
-    profile::Scope<profile::par> scope("Par_assign<Chained_assign>-cons");
+    static profile::Event event = { "Par_assign<Chained_assign>-cons", 0 };
+    profile::Scope<profile::par> scope(event);
     assert(src_am_.impl_comm() == dst_am_.impl_comm());
 
     par_chain_assign::build_ext_array<Dim, T2, Block2>(
@@ -306,6 +308,7 @@ public:
     //    processing it (library design error), or
     //  - User executed send() without a corresponding wait().
     assert(req_list.size() == 0);
+    assert(recv_req_list.size() == 0);
 
     if (send_list.size() > 0)
     {
@@ -349,6 +352,7 @@ private:
   void exec_copy_list();
 
   void wait_send_list();
+  void wait_recv_list();
 
   void cleanup() {}	// Cleanup send_list buffers.
 
@@ -356,12 +360,29 @@ private:
   // Invoke the parallel assignment
 public:
   void operator()()
+  {
+    begin();
+    wait();
+  }
+
+  // Start the parallel assignment: post the sends and receives, and
+  // copy the data that stays on this processor.  The assignment is
+  // complete once test() has returned true or wait() has returned.
+  // Until then, the source must not be modified and the destination
+  // must not be accessed.
+  void begin()
   {
     if (send_list.size() > 0) exec_send_list();
-    if (copy_list.size() > 0) exec_copy_list();
     if (recv_list.size() > 0) exec_recv_list();
+    if (copy_list.size() > 0) exec_copy_list();
+  }
 
-    if (req_list.size() > 0)  wait_send_list();
+  bool test();
+
+  void wait()
+  {
+    if (recv_req_list.size() > 0) wait_recv_list();
+    if (req_list.size() > 0)      wait_send_list();
 
     cleanup();
   }
@@ -381,6 +402,7 @@ private:
   std::vector<Copy_record>   copy_list;
 
   std::vector<request_type> req_list;
+  std::vector<request_type> recv_req_list;
 
   int                       msg_count;
 
@@ -405,7 +427,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::build_send_list()
 {
-  profile::Scope<profile::par> scope("Par_assign<Chained_assign>-build_send_list");
+  static profile::Event event =
+    { "Par_assign<Chained_assign>-build_send_list", 0 };
+  profile::Scope<profile::par> scope(event);
   processor_type rank = local_processor();
 
 #if VSIPL_IMPL_PCA_ROTATE
@@ -509,7 +533,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::build_recv_list()
 {
-  profile::Scope<profile::par> scope("Par_assign<Chained_assign>-build_recv_list");
+  static profile::Event event =
+    { "Par_assign<Chained_assign>-build_recv_list", 0 };
+  profile::Scope<profile::par> scope(event);
   processor_type rank = local_processor();
 
 #if VSIPL_IMPL_PCA_ROTATE
@@ -607,7 +633,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::build_copy_list()
 {
-  profile::Scope<profile::par> scope("Par_assign<Chained_assign>-build_copy_list");
+  static profile::Event event =
+    { "Par_assign<Chained_assign>-build_copy_list", 0 };
+  profile::Scope<profile::par> scope(event);
   processor_type rank = local_processor();
 
 #if VSIP_IMPL_PCA_VERBOSE >= 1
@@ -687,7 +715,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::exec_send_list()
 {
-  profile::Scope<profile::par> scope("Par_assign<Chained_assign>-exec_send_list");
+  static profile::Event event =
+    { "Par_assign<Chained_assign>-exec_send_list", 0 };
+  profile::Scope<profile::par> scope(event);
 
 #if VSIP_IMPL_PCA_VERBOSE >= 1
   processor_type rank = local_processor();
@@ -731,7 +761,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::exec_recv_list()
 {
-  profile::Scope<profile::par> scope("Par_assign<Chained_assign>-exec_recv_list");
+  static profile::Event event =
+    { "Par_assign<Chained_assign>-exec_recv_list", 0 };
+  profile::Scope<profile::par> scope(event);
 
 #if VSIP_IMPL_PCA_VERBOSE >= 1
   processor_type rank = local_processor();
@@ -755,8 +787,10 @@ Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::exec_recv_list()
     ext->end();
 
     chain_type chain = builder.get_chain();
-    comm_.recv(proc, chain);
+    request_type   req;
+    comm_.recv(proc, chain, req);
     impl::free_chain(chain);
+    recv_req_list.push_back(req);
   }
 }
 
@@ -772,7 +806,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::exec_copy_list()
 {
-  profile::Scope<profile::par> scope("Par_assign<Chained_assign>-exec_copy_list");
+  static profile::Event event =
+    { "Par_assign<Chained_assign>-exec_copy_list", 0 };
+  profile::Scope<profile::par> scope(event);
 
 #if VSIP_IMPL_PCA_VERBOSE >= 1
   processor_type rank = local_processor();
@@ -829,6 +865,63 @@ Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::wait_send_list()
 
 
 
+// Wait for the recv_list instructions to be completed.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+void
+Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::wait_recv_list()
+{
+  static profile::Event event =
+    { "Par_assign<Chained_assign>-wait_recv_list", 0 };
+  profile::Scope<profile::par> scope(event);
+
+  typename std::vector<request_type>::iterator
+		cur = recv_req_list.begin(),
+		end = recv_req_list.end();
+  for(; cur != end; ++cur)
+  {
+    comm_.wait(*cur);
+  }
+  recv_req_list.clear();
+}
+
+
+
+// Check whether the receives and sends have completed, without
+// waiting for them.  Receives are tested in the order they were
+// posted.
+
+template <dimension_type Dim,
+	  typename       T1,
+	  typename       T2,
+	  typename       Block1,
+	  typename       Block2>
+bool
+Par_assign<Dim, T1, T2, Block1, Block2, Chained_assign>::test()
+{
+  typename std::vector<request_type>::iterator cur, end;
+
+  for (cur = recv_req_list.begin(), end = recv_req_list.end();
+       cur != end; ++cur)
+    if (!comm_.test(*cur))
+      return false;
+
+  for (cur = req_list.begin(), end = req_list.end(); cur != end; ++cur)
+    if (!comm_.test(*cur))
+      return false;
+
+  recv_req_list.clear();
+  req_list.clear();
+  cleanup();
+  return true;
+}
+
+
+
 } // namespace vsip::impl
 
 } // namespace vsip
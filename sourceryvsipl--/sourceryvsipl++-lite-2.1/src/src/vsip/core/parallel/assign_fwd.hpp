@@ -30,6 +30,7 @@ namespace impl
 
 struct Chained_assign;
 struct Blkvec_assign;
+struct Alltoall_assign;
 struct Pas_assign;
 struct Pas_assign_eb;
 struct Direct_pas_assign;
@@ -43,6 +44,21 @@ template <dimension_type Dim,
 	  typename       ImplTag>
 class Par_assign;
 
+// Parallel assignments that can be split: begin() starts the
+// assignment, and test() or wait() completes it.  Others are only
+// executed as a whole with operator().
+template <typename ImplTag>
+struct Is_par_assign_split
+{ static bool const value = false; };
+
+template <>
+struct Is_par_assign_split<Chained_assign>
+{ static bool const value = true; };
+
+template <>
+struct Is_par_assign_split<Alltoall_assign>
+{ static bool const value = true; };
+
 
 
 } // namespace vsip::impl
@@ -32,7 +32,8 @@ namespace impl
 
 // Only valid if Block1 and Block2 are simple distributed blocks.
 
-#if VSIP_IMPL_PAR_SERVICE == 0 || VSIP_IMPL_PAR_SERVICE == 1
+#if VSIP_IMPL_PAR_SERVICE == 0 || VSIP_IMPL_PAR_SERVICE == 1 || \
+    VSIP_IMPL_PAR_SERVICE == 3
 // MPI
 template <dimension_type Dim,
 	  typename       Block1,
@@ -47,8 +48,28 @@ struct Choose_par_assign_impl
                                     Is_block_dist<0, map1_type>::value &&
                                     Is_block_dist<0, map2_type>::value;
 
+  // Block distributed matrices and tensors, which Alltoall_assign
+  // exchanges collectively when they are corner turned.
+  static int const  is_blkmat     = (Dim >= 2) &&
+                                    Is_block_dist<0, map1_type>::value &&
+                                    Is_block_dist<0, map2_type>::value &&
+                                    Is_block_dist<1, map1_type>::value &&
+                                    Is_block_dist<1, map2_type>::value &&
+                                    (Dim == 2 ||
+                                     (Is_block_dist<2, map1_type>::value &&
+                                      Is_block_dist<2, map2_type>::value));
+
+  static int const  is_alltoall   = (VSIP_IMPL_PAR_SERVICE == 1) &&
+                                    is_blkmat &&
+                                    Type_equal<typename Block1::value_type,
+                                      typename Block2::value_type>::value &&
+                                    !Is_split_block<Block1>::value &&
+                                    !Is_split_block<Block2>::value;
+
   typedef typename
-  ITE_Type<is_blkvec, As_type<Blkvec_assign>, As_type<Chained_assign> >
+  ITE_Type<is_blkvec,   As_type<Blkvec_assign>,
+  ITE_Type<is_alltoall, As_type<Alltoall_assign>,
+	                As_type<Chained_assign> > >
 	::type type;
 };
 #else
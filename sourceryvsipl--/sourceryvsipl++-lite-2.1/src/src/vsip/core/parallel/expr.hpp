@@ -73,7 +73,8 @@ public:
   typedef typename Block_layout<BlockT>::complex_type      complex_type;
   typedef Layout<Dim, order_type, pack_type, complex_type> layout_type;
 
-#if VSIP_IMPL_PAR_SERVICE == 0 || VSIP_IMPL_PAR_SERVICE == 1
+#if VSIP_IMPL_PAR_SERVICE == 0 || VSIP_IMPL_PAR_SERVICE == 1 || \
+    VSIP_IMPL_PAR_SERVICE == 3
   typedef Fast_block<Dim, value_type, layout_type>  local_block_type;
   typedef Distributed_block<local_block_type, MapT> dst_block_type;
 #else
@@ -153,6 +153,18 @@ struct Map_equal<Dim, Local_map, Local_map>
     { return true; }
 };
 
+
+
+/// Return a map whose blocks allocate from the temporary pool.
+
+inline Local_map
+temporary_map()
+{
+  Local_map map;
+  map.impl_set_pool(temporary_pool());
+  return map;
+}
+
 } // namespace impl
 
 } // namespace vsip
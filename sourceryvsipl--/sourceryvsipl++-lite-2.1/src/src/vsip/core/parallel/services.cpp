@@ -59,6 +59,17 @@ num_processors()
 const_Vector<processor_type>
 processor_set()
 {
+#if VSIP_IMPL_PAR_SERVICE == 3
+  // Threads of a team and the serial main thread see different
+  // cliques, hence the set cannot be cached.
+  impl::Communicator::pvec_type const& 
+    pvec = impl::default_communicator().pvec(); 
+
+  Vector<processor_type> pset(pvec.size());
+  for (index_type i=0; i<pvec.size(); ++i)
+    pset.put(i, pvec[i]);
+  return pset;
+#else
   static Dense<1, processor_type>* pset_block_ = NULL;
 
   if (pset_block_ == NULL)
@@ -72,6 +83,7 @@ processor_set()
   }
 
   return Vector<processor_type>(*pset_block_);
+#endif
 }
 
 
@@ -22,6 +22,9 @@
 #  include <vsip/core/mpi/services.hpp>
 #elif VSIP_IMPL_PAR_SERVICE == 2
 #  include <vsip/opt/pas/services.hpp>
+#elif VSIP_IMPL_PAR_SERVICE == 3
+#  include <vsip/core/threads/services.hpp>
+#  include <vsip/initfin.hpp>
 #else
 #  include <vsip/core/parallel/services_none.hpp>
 #endif
@@ -46,6 +49,37 @@ default_communicator()
   return Par_service::default_communicator();
 }
 
+
+
+template <typename FuncT>
+struct Spmd_thunk
+{
+  static void call(void* arg)
+  {
+    // Each processor works on its own copy of the function object.
+    FuncT func(*static_cast<FuncT*>(arg));
+    func();
+  }
+};
+
+// Execute FUNC on every processor of the data parallel clique.
+//
+// With MPI and PAS every processor already executes the program, and
+// FUNC is simply called.  With the threads service, FUNC is executed
+// by every thread of the team and the default communicator spans the
+// team for the duration of the call.
+
+template <typename FuncT>
+inline void
+par_spmd(FuncT func)
+{
+#if VSIP_IMPL_PAR_SERVICE == 3
+  vsipl::impl_par_service()->spmd(&Spmd_thunk<FuncT>::call, &func);
+#else
+  func();
+#endif
+}
+
 } // namespace vsip::impl
 } // namespace vsip
 
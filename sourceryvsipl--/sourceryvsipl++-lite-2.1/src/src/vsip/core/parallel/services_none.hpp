@@ -187,8 +187,12 @@ public:
 
   void recv(processor_type dest, chain_type const& chain);
 
+  void recv(processor_type dest, chain_type const& chain, request_type& req);
+
   void wait(request_type& req);
 
+  bool test(request_type& req);
+
   template <typename T>
   void broadcast(processor_type root_proc, T* data, length_type size);
 
@@ -403,6 +407,21 @@ Communicator::recv(
 
 
 
+/// Receive into CHAIN.  With one processor the message has already
+/// been sent, so the receive completes immediately.
+
+inline void
+Communicator::recv(
+  processor_type    src_proc,
+  chain_type const& chain,
+  request_type&     req)
+{
+  recv(src_proc, chain);
+  req.set(true);
+}
+
+
+
 /// Wait for a previous communication (send or receive) to complete.
 
 inline void
@@ -417,6 +436,18 @@ Communicator::wait(
 
 
 
+/// Check whether a previous communication (send or receive) has
+/// completed.
+
+inline bool
+Communicator::test(
+  request_type& req)
+{
+  return req.get();
+}
+
+
+
 /// Broadcast a value from root processor to other processors.
 
 template <typename T>
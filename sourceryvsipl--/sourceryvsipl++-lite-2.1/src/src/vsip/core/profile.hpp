@@ -74,11 +74,18 @@ public:
   float  mops() const { return 0.;}
 };
 
+struct Event
+{
+  char const* name;
+  unsigned    id;
+};
+
 template <bool>
 class Scope_base : Non_copyable
 {
 public:
   Scope_base(std::string const &, int=0) {}
+  Scope_base(Event&, int=0) {}
 };
 
 enum profiler_mode
@@ -110,6 +117,11 @@ class Scope : public Scope_base<Feature & mask>
   typedef Scope_base<Feature & mask> base;
 public:
   Scope(std::string const &n, int id = 0) : base(n, id) {}
+  Scope(char const *n, int id = 0) : base(n, id) {}
+  Scope(Event& e, int id = 0) : base(e, id) {}
+#ifndef VSIP_IMPL_REF_IMPL
+  Scope(event_id_type e, int id = 0) : base(e, id) {}
+#endif
 };
 
 } // namespace vsip::impl::profile
@@ -18,6 +18,7 @@
 #include <vsip/core/block_traits.hpp>
 #include <vsip/core/parallel/expr.hpp>
 #include <vsip/core/parallel/assign_chain.hpp>
+#include <vsip/core/parallel/assign_fwd.hpp>
 #include <vsip/core/dispatch_assign.hpp>
 #include <vsip/core/metaprogramming.hpp>
 #include <vsip/core/profile.hpp>
@@ -39,6 +40,12 @@ private:
     virtual ~Holder_base() {}
     virtual void exec() = 0;
     virtual char const * type() = 0;
+
+    // Split execution.  By default the assignment is done as a whole
+    // by begin().
+    virtual void begin() { exec(); }
+    virtual bool test() { return true; }
+    virtual void wait() {}
   };
 
   class Null_holder : public Holder_base
@@ -99,6 +106,22 @@ private:
     void exec() { par_assign_();}
     char const * type() { return "Par_assign_holder"; }
 
+    void begin() { begin(split_type()); }
+    bool test()  { return test(split_type()); }
+    void wait()  { wait(split_type()); }
+
+  private:
+    typedef impl::Bool_type<impl::Is_par_assign_split<ParAssignImpl>::value>
+		split_type;
+
+    void begin(impl::Bool_type<true>)  { par_assign_.begin(); }
+    bool test(impl::Bool_type<true>)   { return par_assign_.test(); }
+    void wait(impl::Bool_type<true>)   { par_assign_.wait(); }
+
+    void begin(impl::Bool_type<false>) { par_assign_(); }
+    bool test(impl::Bool_type<false>)  { return true; }
+    void wait(impl::Bool_type<false>)  {}
+
 
     // Member data
   private:
@@ -281,6 +304,8 @@ public:
       dispatch_type;
 
     create_holder<dim>(dst, src, dispatch_type());
+    event_.name = holder_->type();
+    event_.id   = 0;
   }
 
   ~Setup_assign() 
@@ -288,10 +313,46 @@ public:
 
   void operator()()
   { 
-    impl::profile::Scope<impl::profile::par> scope(impl_type());
+    impl::profile::Scope<impl::profile::par> scope(event_);
     holder_->exec();
   }
 
+  /// Handle on an assignment started by exec_async().
+
+  class Async_handle
+  {
+  public:
+    Async_handle(Holder_base* holder) : holder_(holder) {}
+
+    /// Return true if the assignment is complete, without waiting.
+    bool test() { return holder_->test(); }
+
+    /// Wait for the assignment to complete.
+    void wait() { holder_->wait(); }
+
+  private:
+    Holder_base* holder_;
+  };
+
+  /// Start the assignment and return a handle on it.
+  ///
+  /// The assignment is complete once the handle's test() has
+  /// returned true or its wait() has returned; one of them must be
+  /// called.  Until then, the source must not be modified and the
+  /// destination must not be accessed.  Only one assignment may be
+  /// in progress per Setup_assign object.  Assignments of several
+  /// objects may be in progress together, if all processors start
+  /// them in the same order.
+  ///
+  /// Assignments that need communication post it and return;
+  /// others are done before exec_async() returns.
+  Async_handle exec_async()
+  {
+    impl::profile::Scope<impl::profile::par> scope(event_);
+    holder_->begin();
+    return Async_handle(holder_);
+  }
+
   char const * impl_type()
   {
     return holder_->type();
@@ -300,6 +361,7 @@ public:
 // Member Data
 private:
   Holder_base* holder_;
+  impl::profile::Event event_;	// profile event of the assignment
 
 };
 
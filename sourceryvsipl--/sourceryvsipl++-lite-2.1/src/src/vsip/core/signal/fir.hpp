@@ -93,7 +93,8 @@ struct Profile_policy<
                  length_type d,
                  unsigned n,
                  alg_hint_type h)
-    : scope(evaluator_type::name(), evaluator_type::op_count(ks, is, d, n, h)) {}
+    : scope(profile::Type_event<evaluator_type>::get(),
+            evaluator_type::op_count(ks, is, d, n, h)) {}
 
   scope_type scope;  
 };
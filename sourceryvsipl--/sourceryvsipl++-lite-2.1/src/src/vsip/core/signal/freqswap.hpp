@@ -18,6 +18,10 @@
 #include <vsip/matrix.hpp>
 #include <vsip/core/domain_utils.hpp>
 #include <vsip/core/block_traits.hpp>
+#include <vsip/core/extdata.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/core/parallel/map_traits.hpp>
+#include <algorithm>
 #ifndef VSIP_IMPL_REF_IMPL
 # include <vsip/opt/expr/return_block.hpp>
 #endif
@@ -33,6 +37,152 @@ namespace vsip
 namespace impl
 {
 
+namespace freqswap_detail
+{
+
+/// Copy the N values of SRC to DST, rotated left by S:
+///
+///   DST[j] = SRC[(j + S) mod N]
+
+template <typename T>
+inline void
+copy_rotated(T const* src, T* dst, length_type n, index_type s)
+{
+  std::copy(src + s, src + n, dst);
+  std::copy(src, src + s, dst + n - s);
+}
+
+inline length_type
+gcd(length_type a, length_type b)
+{
+  while (b)
+  {
+    length_type r = a % b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
+
+/// Rotate the lines of an array of ROWS unit-stride lines of COLS
+/// values, and the values within each line:
+///
+///   OUT[i][j] = IN[(i + ROW_SHIFT) mod ROWS][(j + COL_SHIFT) mod COLS]
+///
+/// IN and OUT may be the same array.  In that case, lines are moved
+/// along the cycles of the line permutation through a buffer of one
+/// line, so each line is read and written once.
+
+template <typename T>
+void
+rotate(T const*    in,  stride_type in_stride,
+       T*          out, stride_type out_stride,
+       length_type rows,
+       length_type cols,
+       index_type  row_shift,
+       index_type  col_shift)
+{
+  if (in != out)
+  {
+    for (index_type i = 0; i < rows; ++i)
+      copy_rotated(in + ((i + row_shift) % rows) * in_stride,
+		   out + i * out_stride, cols, col_shift);
+    return;
+  }
+
+  aligned_array<T> buf(cols);
+  length_type cycles = gcd(rows, row_shift % rows);
+  for (index_type c = 0; c < cycles; ++c)
+  {
+    std::copy(out + c * out_stride, out + c * out_stride + cols, buf.get());
+    index_type i = c;
+    for (index_type src = (c + row_shift) % rows; src != c;
+	 i = src, src = (src + row_shift) % rows)
+      copy_rotated(out + src * out_stride, out + i * out_stride,
+		   cols, col_shift);
+    copy_rotated(buf.get(), out + i * out_stride, cols, col_shift);
+  }
+}
+
+/// Freqswap with direct data access, for local blocks with interleaved
+/// values.  APPLY returns false if the data does not have unit stride
+/// along a dimension, or if IN and OUT partially overlap.
+
+template <typename Block0,
+	  typename Block1,
+	  dimension_type Dim = Block1::dim,
+	  bool CtValid =
+	    Type_equal<typename Block0::value_type,
+		       typename Block1::value_type>::value &&
+	    Ext_data_cost<Block0>::value == 0 &&
+	    Ext_data_cost<Block1>::value == 0 &&
+	    Is_local_map<typename Block0::map_type>::value &&
+	    Is_local_map<typename Block1::map_type>::value &&
+	    !Is_split_block<Block0>::value &&
+	    !Is_split_block<Block1>::value>
+struct Direct
+{
+  static bool apply(Block0 const&, Block1&) { return false;}
+};
+
+template <typename Block0,
+	  typename Block1>
+struct Direct<Block0, Block1, 1, true>
+{
+  static bool apply(Block0 const& in, Block1& out)
+  {
+    Ext_data<Block0> in_ext(in, SYNC_IN);
+    Ext_data<Block1> out_ext(out, SYNC_OUT);
+
+    length_type const M = out_ext.size(0);
+    if (in_ext.stride(0) != 1 || out_ext.stride(0) != 1)
+      return false;
+
+    if (in_ext.data() == out_ext.data())
+      std::rotate(out_ext.data(), out_ext.data() + M - M / 2,
+		  out_ext.data() + M);
+    else if (!is_same_block(in, out))
+      copy_rotated(in_ext.data(), out_ext.data(), M, M - M / 2);
+    else
+      return false;
+    return true;
+  }
+};
+
+template <typename Block0,
+	  typename Block1>
+struct Direct<Block0, Block1, 2, true>
+{
+  static bool apply(Block0 const& in, Block1& out)
+  {
+    Ext_data<Block0> in_ext(in, SYNC_IN);
+    Ext_data<Block1> out_ext(out, SYNC_OUT);
+
+    // Dimension of the unit-stride lines.
+    dimension_type d;
+    if (in_ext.stride(1) == 1 && out_ext.stride(1) == 1)
+      d = 1;
+    else if (in_ext.stride(0) == 1 && out_ext.stride(0) == 1)
+      d = 0;
+    else
+      return false;
+
+    if (is_same_block(in, out) &&
+	(in_ext.data() != out_ext.data() ||
+	 in_ext.stride(1 - d) != out_ext.stride(1 - d)))
+      return false;
+
+    length_type rows = out_ext.size(1 - d);
+    length_type cols = out_ext.size(d);
+    rotate(in_ext.data(),  in_ext.stride(1 - d),
+	   out_ext.data(), out_ext.stride(1 - d),
+	   rows, cols, rows - rows / 2, cols - cols / 2);
+    return true;
+  }
+};
+
+} // namespace vsip::impl::freqswap_detail
+
 template <typename B, dimension_type D = B::dim> class Freqswap_functor;
 
 template <typename B>
@@ -58,6 +208,9 @@ public:
   template <typename B1>
   void apply(B1 &out) const
   {
+    if (freqswap_detail::Direct<B, B1>::apply(in_, out))
+      return;
+
     // equiv. to r[i] = a[(M/2 + i) mod M],  where i = 0 --> M - 1
 
     length_type const M = in_.size();
@@ -113,6 +266,9 @@ public:
   template <typename B1>
   void apply(B1 & out) const
   {
+    if (freqswap_detail::Direct<B, B1>::apply(in_, out))
+      return;
+
     length_type const M = in_.size(2, 0);
     length_type const N = in_.size(2, 1);
 
@@ -302,4 +458,8 @@ freqswap(const_View<T, B> in) VSIP_NOTHROW
 
 } // namespace vsip
 
+#ifndef VSIP_IMPL_REF_IMPL
+# include <vsip/opt/signal/freqswap_opt.hpp>
+#endif
+
 #endif // VSIP_CORE_SIGNAL_FREQSWAP_HPP
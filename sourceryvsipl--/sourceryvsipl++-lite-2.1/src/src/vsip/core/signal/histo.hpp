@@ -16,6 +16,11 @@
 #include <vsip/support.hpp>
 #include <vsip/vector.hpp>
 #include <vsip/matrix.hpp>
+#include <vsip/core/extdata.hpp>
+#include <vsip/core/signal/histo_common.hpp>
+#if !VSIP_IMPL_REF_IMPL
+# include <vsip/opt/signal/histo_opt.hpp>
+#endif
 
 
 /***********************************************************************
@@ -34,15 +39,11 @@ public:
   // Constructor and destructor [signal.histo.constructors]
   Histogram(T min_value, T max_value, length_type num_bin)
     VSIP_THROW((std::bad_alloc))
-    : min_(min_value),
-      max_(max_value),
-      num_bin_(num_bin),
+    : bins_(min_value, max_value, num_bin),
       hist_(num_bin, 0)
   {
-    assert(min_ < max_);
-    assert(num_bin_ >= 3);
-    
-    delta_ = (max_ - min_) / (num_bin_ - 2);
+    assert(min_value < max_value);
+    assert(num_bin >= 3);
   }
 
   /// This constructor, albeit not required by the VSIPL++ spec, is
@@ -52,14 +53,11 @@ public:
   template <typename Block>
   Histogram(T min_value, T max_value, const_Vector<int, Block> hist)
     VSIP_THROW((std::bad_alloc))
-    : min_(min_value),
-      max_(max_value),
-      num_bin_(hist.size()),
-      hist_(num_bin_)
+    : bins_(min_value, max_value, hist.size()),
+      hist_(hist.size())
   {
-    assert(min_ < max_);
-    assert(num_bin_ >= 3);
-    delta_ = (max_ - min_) / (num_bin_ - 2);
+    assert(min_value < max_value);
+    assert(hist.size() >= 3);
     hist_ = hist;
   }
 
@@ -75,9 +73,9 @@ public:
   {
     if (accumulate == false)
       hist_ = 0;
-    
-    for (index_type i = 0; i < data.size(); ++i)
-      hist_(impl_bin(data(i)))++;
+
+    impl::Ext_data<hist_block_type> ext(hist_.block());
+    impl::histo::accumulate(bins_, data, ext.data());
 
     return hist_;
   }
@@ -91,9 +89,8 @@ public:
     if (accumulate == false)
       hist_ = 0;
 
-    for (index_type i = 0; i < data.size(0); ++i)
-      for (index_type j = 0; j < data.size(1); ++j)
-        hist_(impl_bin(data(i, j)))++;
+    impl::Ext_data<hist_block_type> ext(hist_.block());
+    impl::histo::accumulate(bins_, data, ext.data());
 
     return hist_;
   }
@@ -101,20 +98,14 @@ public:
   inline index_type
   impl_bin(T value)
   {
-    if (value < min_)
-      return 0;
-    else if (value >= max_)
-      return num_bin_ - 1;
-    else
-      return (index_type)(((value - min_) / delta_) + 1);
+    return bins_(value);
   } 
 
 private:
-  T min_;
-  T max_;
-  T delta_;
-  length_type const num_bin_;
-  Vector<scalar_i> hist_;
+  typedef Dense<1, scalar_i> hist_block_type;
+
+  impl::histo::Bins<T> bins_;
+  Vector<scalar_i, hist_block_type> hist_;
 };
 
 
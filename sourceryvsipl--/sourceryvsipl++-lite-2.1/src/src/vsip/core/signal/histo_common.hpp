@@ -0,0 +1,224 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/signal/histo_common.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Common decls and functions for histograms.
+*/
+
+#ifndef VSIP_CORE_SIGNAL_HISTO_COMMON_HPP
+#define VSIP_CORE_SIGNAL_HISTO_COMMON_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <limits>
+
+#include <vsip/support.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/matrix.hpp>
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace histo
+{
+
+/// Mapping of values to histogram bins.
+///
+/// Values below MIN go to the first bin, values at or above MAX to the
+/// last bin, and the others are spread evenly over the bins in between.
+/// Floating-point values are scaled by a precomputed reciprocal of the
+/// bin width.
+
+template <typename T,
+	  bool     IsInteger = std::numeric_limits<T>::is_integer>
+class Bins
+{
+public:
+  Bins(T min_value, T max_value, length_type num_bin)
+    : min_(min_value),
+      max_(max_value),
+      delta_((max_value - min_value) / (num_bin - 2)),
+      num_bin_(num_bin)
+  {}
+
+  index_type operator()(T value) const
+  {
+    if (value < min_)
+      return 0;
+    else if (value >= max_)
+      return num_bin_ - 1;
+    else
+      return (index_type)(((value - min_) / delta_) + 1);
+  }
+
+  T           min()     const { return min_;}
+  T           max()     const { return max_;}
+  length_type num_bin() const { return num_bin_;}
+
+private:
+  T           min_;
+  T           max_;
+  T           delta_;
+  length_type num_bin_;
+};
+
+template <typename T>
+class Bins<T, false>
+{
+public:
+  Bins(T min_value, T max_value, length_type num_bin)
+    : min_(min_value),
+      max_(max_value),
+      scale_(T(num_bin - 2) / (max_value - min_value)),
+      num_bin_(num_bin)
+  {}
+
+  index_type operator()(T value) const
+  {
+    if (value < min_)
+      return 0;
+    else if (value >= max_)
+      return num_bin_ - 1;
+    // Rounding of the scaled value may reach the last bin.
+    index_type bin = (index_type)((value - min_) * scale_) + 1;
+    return bin < num_bin_ - 1 ? bin : num_bin_ - 2;
+  }
+
+  T           min()     const { return min_;}
+  T           max()     const { return max_;}
+  T           scale()   const { return scale_;}
+  length_type num_bin() const { return num_bin_;}
+
+private:
+  T           min_;
+  T           max_;
+  T           scale_;
+  length_type num_bin_;
+};
+
+
+
+// Generic histogram accumulation through view accessors.  W is the
+// weight of each value, 1 for the plain count.  Joint histograms of
+// X and Y are stored row-major, with a row per bin of X.
+
+template <typename T,
+	  typename Block,
+	  typename H>
+void
+generic(Bins<T> const& bins, const_Vector<T, Block> x, H* hist)
+{
+  for (index_type i = 0; i < x.size(); ++i)
+    hist[bins(x.get(i))] += H(1);
+}
+
+template <typename T,
+	  typename Block,
+	  typename H>
+void
+generic(Bins<T> const& bins, const_Matrix<T, Block> x, H* hist)
+{
+  for (index_type i = 0; i < x.size(0); ++i)
+    for (index_type j = 0; j < x.size(1); ++j)
+      hist[bins(x.get(i, j))] += H(1);
+}
+
+template <typename T,
+	  typename Block0,
+	  typename W,
+	  typename Block1,
+	  typename H>
+void
+generic(Bins<T> const& bins, const_Vector<T, Block0> x,
+	const_Vector<W, Block1> w, H* hist)
+{
+  for (index_type i = 0; i < x.size(); ++i)
+    hist[bins(x.get(i))] += w.get(i);
+}
+
+template <typename T,
+	  typename Block0,
+	  typename W,
+	  typename Block1,
+	  typename H>
+void
+generic(Bins<T> const& bins, const_Matrix<T, Block0> x,
+	const_Matrix<W, Block1> w, H* hist)
+{
+  for (index_type i = 0; i < x.size(0); ++i)
+    for (index_type j = 0; j < x.size(1); ++j)
+      hist[bins(x.get(i, j))] += w.get(i, j);
+}
+
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename H>
+void
+generic(Bins<T> const& xbins, Bins<T> const& ybins,
+	const_Vector<T, Block0> x, const_Vector<T, Block1> y, H* hist)
+{
+  length_type num_bin = ybins.num_bin();
+  for (index_type i = 0; i < x.size(); ++i)
+    hist[xbins(x.get(i)) * num_bin + ybins(y.get(i))] += H(1);
+}
+
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename H>
+void
+generic(Bins<T> const& xbins, Bins<T> const& ybins,
+	const_Matrix<T, Block0> x, const_Matrix<T, Block1> y, H* hist)
+{
+  length_type num_bin = ybins.num_bin();
+  for (index_type i = 0; i < x.size(0); ++i)
+    for (index_type j = 0; j < x.size(1); ++j)
+      hist[xbins(x.get(i, j)) * num_bin + ybins(y.get(i, j))] += H(1);
+}
+
+
+
+#if VSIP_IMPL_REF_IMPL
+// Without the optimized implementation, accumulate is generic.
+
+template <typename T,
+	  typename ViewT,
+	  typename H>
+inline void
+accumulate(Bins<T> const& bins, ViewT x, H* hist)
+{ generic(bins, x, hist);}
+
+template <typename T,
+	  typename View0T,
+	  typename View1T,
+	  typename H>
+inline void
+accumulate(Bins<T> const& bins, View0T x, View1T w, H* hist)
+{ generic(bins, x, w, hist);}
+
+template <typename T,
+	  typename View0T,
+	  typename View1T,
+	  typename H>
+inline void
+accumulate(Bins<T> const& xbins, Bins<T> const& ybins,
+	   View0T x, View1T y, H* hist)
+{ generic(xbins, ybins, x, y, hist);}
+#endif
+
+} // namespace vsip::impl::histo
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_CORE_SIGNAL_HISTO_COMMON_HPP
@@ -16,6 +16,7 @@
 #include <vsip/support.hpp>
 #include <vsip/core/signal/types.hpp>
 #include <vsip/core/profile.hpp>
+#include <vsip/core/extdata.hpp>
 
 /***********************************************************************
   Declarations
@@ -135,6 +136,10 @@ Iir<T, C, N, H>::operator()(const_Vector<T, Block0> data,
                             Vector<T, Block1> out)
   VSIP_NOTHROW
 {
+  using vsip::impl::Block_layout;
+  using vsip::impl::Adjust_layout_complex;
+  using vsip::impl::Cmplx_inter_fmt;
+
   typename accumulator_type::Scope scope(*this);
 
   index_type const A1 = 0;
@@ -150,27 +155,54 @@ Iir<T, C, N, H>::operator()(const_Vector<T, Block0> data,
   assert(data.size() == this->input_size());
   assert(out.size()  == this->output_size());
 
+  typedef typename Block_layout<Block0>::layout_type LP0;
+  typedef typename Block_layout<Block1>::layout_type LP1;
+  typedef typename Adjust_layout_complex<Cmplx_inter_fmt, LP0>::type use_LP0;
+  typedef typename Adjust_layout_complex<Cmplx_inter_fmt, LP1>::type use_LP1;
+
   length_type const M = a_.size(0);
+  length_type const n = out.size();
 
-  for (index_type i=0; i<out.size(); ++i)
   {
-    T val = data(i);
+    impl::Ext_data<Block0, use_LP0> ext_in(data.block());
+    impl::Ext_data<Block1, use_LP1> ext_out(out.block());
 
-    for (index_type m=0; m<M; ++m)
-    {
-      T w0 = val
-	   - a_.get(m, A1) * w_.get(m, W1)
-           - a_.get(m, A2) * w_.get(m, W2);
+    T const*          in        = ext_in.data();
+    stride_type const in_stride = ext_in.stride(0);
+    T*                po        = ext_out.data();
+    stride_type const os        = ext_out.stride(0);
 
-      val  = b_.get(m, B0) * w0
-           + b_.get(m, B1) * w_.get(m, W1)
-           + b_.get(m, B2) * w_.get(m, W2);
+    if (M == 0)
+      for (index_type i=0; i<n; ++i)
+	po[i*os] = in[i*in_stride];
 
-      w_.put(m, W2, w_.get(m, W1));
-      w_.put(m, W1, w0);
+    // Run the whole frame through one section at a time, so that the
+    // section's coefficients and state stay in registers.  The first
+    // section reads the input, the others work in place on the output.
+    for (index_type m=0; m<M; ++m)
+    {
+      T const a1 = a_.get(m, A1);
+      T const a2 = a_.get(m, A2);
+      T const b0 = b_.get(m, B0);
+      T const b1 = b_.get(m, B1);
+      T const b2 = b_.get(m, B2);
+      T       w1 = w_.get(m, W1);
+      T       w2 = w_.get(m, W2);
+
+      T const*          src = m == 0 ? in : po;
+      stride_type const ss  = m == 0 ? in_stride : os;
+
+      for (index_type i=0; i<n; ++i)
+      {
+	T const w0 = src[i*ss] - a1 * w1 - a2 * w2;
+	po[i*os] = b0 * w0 + b1 * w1 + b2 * w2;
+	w2 = w1;
+	w1 = w0;
+      }
+
+      w_.put(m, W1, w1);
+      w_.put(m, W2, w2);
     }
-
-    out.put(i, val);
   }
 
   if (C == state_no_save)
@@ -17,35 +17,20 @@
 #include <vsip/core/fft.hpp>
 #include <vsip/core/signal/freqswap.hpp>
 #include <vsip/core/signal/window.hpp>
+#include <map>
 
 /***********************************************************************
   Declarations
 ***********************************************************************/
 
-namespace vsip
-{
-
+/// Maximum number of window weights held by the window cache.
+#ifndef VSIP_IMPL_WINDOW_CACHE_SIZE
+#  define VSIP_IMPL_WINDOW_CACHE_SIZE (1024 * 1024)
+#endif
 
-/// Creates Blackman window.
-/// Requires: len > 1.
-/// Returns: A const_Vector initialized with Blackman window weights 
-/// and having length len.
-/// Throws: std::bad_alloc upon memory allocation error.
-const_Vector<scalar_f>
-blackman(length_type len) VSIP_THROW((std::bad_alloc))
+namespace vsip
 {
-  assert( len > 1 );
-
-  Vector<scalar_f> v(len);
-
-  scalar_f temp1 = 2 * VSIP_IMPL_PI / (len - 1);
-  scalar_f temp2 = 2 * temp1;
 
-  for ( index_type n = 0; n < len; ++n )
-    v.put( n, 0.42 - 0.5 * cos(temp1 * n) + 0.08 * cos(temp2 * n) );
-
-  return v;
-}
 
 namespace impl
 {
@@ -62,88 +47,311 @@ acosh(double f)
 }
 #endif
 
-} // namespace impl
 
-/// Creates Chebyshev window with user-specified ripple.
-/// Requires: len > 1.
-/// Returns: A const_Vector initialized with Dolph-Chebyshev window 
-/// weights and having length len.
-/// Throws: std::bad_alloc upon memory allocation error.
-const_Vector<scalar_f>
-cheby(length_type len, scalar_f ripple) VSIP_THROW((std::bad_alloc))
+
+// Window generators.
+//
+// Blackman and Hanning weights are evaluated as view expressions, so
+// that the cosines are vectorized.  The Kaiser window is symmetric, so
+// only half of its weights need a Bessel function evaluation.
+
+Vector<scalar_f>
+generate_blackman(length_type len, scalar_f)
 {
-  assert( len > 1 );
+  Vector<scalar_f> arg(len);
+  Vector<scalar_f> v(len);
+
+  scalar_f temp1 = 2 * VSIP_IMPL_PI / (len - 1);
 
-  scalar_f dp = pow( 10.0, -ripple / 20.0 );
-  scalar_f df = acos( 1.0 / 
-    cosh( impl::acosh( (1.0 + dp) / dp) / (len - 1.0) ) ) / VSIP_IMPL_PI;
-  scalar_f x0 = (3.0 - cos( 2 * VSIP_IMPL_PI * df )) / (1.0 + cos( 2 * VSIP_IMPL_PI * df ));
+  arg = ramp(0.f, temp1, len);
+  v = 0.42f - 0.5f * cos(arg) + 0.08f * cos(2.f * arg);
 
-  Vector<scalar_f> f = ramp(0.f, 1.f / len, len);
+  return v;
+}
 
-  scalar_f alpha = (x0 + 1.0) / 2.0;
-  scalar_f beta  = (x0 - 1.0) / 2.0;
-  Vector<scalar_f> x(len);
-  x = alpha * cos( 2.0 * VSIP_IMPL_PI * f ) + beta;
 
-  // tmp = (mag(x) > 1);
-  Vector<scalar_f> tmp(len);
-  for ( index_type i = 0; i < len; ++i )
-    tmp.put( i, (((x.get(i) >= 0) ? x.get(i) : -x.get(i)) > 1) ? 1.0 : 0.0 );
 
+// The Dolph-Chebyshev window is computed from its frequency response.
+// The response is Hermitian, so only its first len/2 + 1 values are
+// computed and a complex-to-real FFT of size len gives the weights.
+//
+// For even len, the response is delayed by half a sample, which centers
+// the weights between samples len/2 - 1 and len/2 after freqswap.
 
-  Vector<std::complex<scalar_f> > wf(len, 0.0);
-  Vector<std::complex<scalar_f> >::realview_type wfR( wf.real() );
-  Vector<std::complex<scalar_f> > Cfoo(len, 0.0);
+Vector<scalar_f>
+generate_cheby(length_type len, scalar_f ripple)
+{
+  typedef Fft<const_Vector, std::complex<scalar_f>, scalar_f, 0,
+    by_value, 1, alg_noise> i_fft_type;
 
-  /* wf = dp*(tmp.*(cosh(((len-1.0)/2).*acosh(x)))+
-     (1-tmp).*cos(((len-1.0)/2).*acos(x)));*/
-  { 
-    wfR = clip( x, -1.0, 1.0, -1.0, 1.0 );
+  double dp = pow( 10.0, -ripple / 20.0 );
+  double df = acos( 1.0 /
+    cosh( acosh( (1.0 + dp) / dp) / (len - 1.0) ) ) / VSIP_IMPL_PI;
+  double x0 = (3.0 - cos( 2 * VSIP_IMPL_PI * df )) /
+    (1.0 + cos( 2 * VSIP_IMPL_PI * df ));
 
-    wfR = (1.0 - tmp) * cos( ((len - 1.0) / 2.0) * acos( wfR ) );
-    impl::acosh( x, Cfoo );
-    Cfoo = tmp * cosh( static_cast<scalar_f>((len - 1.0) / 2.0) * Cfoo );
+  double alpha = (x0 + 1.0) / 2.0;
+  double beta  = (x0 - 1.0) / 2.0;
+  double order = (len - 1.0) / 2.0;
+  bool   odd   = len % 2;
 
-    wf = dp * (Cfoo + wf);
+  length_type half = len / 2 + 1;
+  Vector<std::complex<scalar_f> > wf(half);
+
+  for ( index_type k = 0; k < half; ++k )
+  {
+    double x = alpha * cos( 2 * VSIP_IMPL_PI * k / len ) + beta;
+    double w;
+    if ( x > 1.0 )
+      w = cosh( order * acosh(x) );
+    else
+      w = cos( order * acos( x < -1.0 ? -1.0 : x ) );
+
+    if ( odd )
+      wf.put( k, std::complex<scalar_f>(w) );
+    else
+      wf.put( k, std::polar(scalar_f(w), scalar_f(VSIP_IMPL_PI * k / len)) );
   }
 
-  int odd = len % 2;
-  if ( !odd )
+  i_fft_type i_fft( Domain<1>(len), 1.f );
+  Vector<scalar_f> wt(len);
+  wt = i_fft( wf );
+
+  scalar_f scale = 1.f / wt.get(0);
+  Vector<scalar_f> ret(len);
+  ret = scale * freqswap(wt);
+
+  return ret;
+}
+
+
+
+Vector<scalar_f>
+generate_hanning(length_type len, scalar_f)
+{
+  Vector<scalar_f> arg(len);
+  Vector<scalar_f> v(len);
+
+  scalar_f temp = 2 * VSIP_IMPL_PI / (len + 1);
+
+  arg = ramp(temp, temp, len);
+  v = 0.5f * (1.f - cos(arg));
+
+  return v;
+}
+
+
+
+Vector<scalar_f>
+generate_kaiser(length_type len, scalar_f beta)
+{
+  scalar_f Ibeta = bessel_I_0(beta);
+  scalar_f c1 = 2.0 / (len - 1);
+
+  Vector<scalar_f> v(len);
+  for ( length_type n = 0; n < (len + 1) / 2; ++n )
   {
-    /*wf = real(wf).*exp(-j*pi*f);*/ 
-    { 
-      wf = wfR * euler( static_cast<scalar_f>(-1 * VSIP_IMPL_PI) * f );
+    scalar_f c3 = c1 * n - 1;
+    scalar_f x = beta * static_cast<scalar_f>( sqrt(1 - (c3 * c3)) );
+    scalar_f w = bessel_I_0(x) / Ibeta;
+    v.put( n, w );
+    v.put( len - 1 - n, w );
+  }
+
+  return v;
+}
+
+
+
+/// Window types held by the window cache.
+enum window_type
+{
+  blackman_window,
+  cheby_window,
+  hanning_window,
+  kaiser_window
+};
+
+typedef Vector<scalar_f> (*window_generator_type)(length_type, scalar_f);
+
+/// Process-wide cache of windows, keyed by window type, length and
+/// parameter.
+///
+/// Windows may be requested from several threads (user threads or
+/// tasks of the worker pool), and block reference counts may not be
+/// updated concurrently.  The cache is therefore guarded by a spin
+/// lock, its blocks are only touched while it is held, and LOOKUP
+/// returns a copy of the cached weights.  Windows are generated
+/// without holding the lock.
+///
+/// Once the cache holds more than VSIP_IMPL_WINDOW_CACHE_SIZE values,
+/// the least recently used windows are released.
+class Window_cache
+{
+  // Hold the cache lock for the lifetime of the object.
+  class Lock
+  {
+  public:
+#if defined(__GNUC__)
+    Lock()
+    {
+      while (__sync_lock_test_and_set(&lock_, 1))
+	;
     }
+    ~Lock() { __sync_lock_release(&lock_); }
+#else
+    // Without atomic operations windows may only be requested by one
+    // thread.
+    Lock() {}
+#endif
+  };
 
-    /* wf(n2+1:len) = -wf(n2+1:len); */
-    { 
-      for ( index_type i = len / 2; i < len; ++i )
-        wf.put( i, -wf.get(i) );
+  struct Key
+  {
+    window_type type;
+    length_type len;
+    scalar_f    param;
+
+    bool operator<(Key const& other) const
+    {
+      if (type != other.type) return type < other.type;
+      if (len  != other.len)  return len  < other.len;
+      return param < other.param;
     }
+  };
+
+  struct Entry
+  {
+    Entry(Vector<scalar_f> w, unsigned long u) : window(w), last_use(u) {}
+
+    Vector<scalar_f> window;
+    unsigned long    last_use;
+  };
+
+  typedef std::map<Key, Entry> map_type;
+
+public:
+  static const_Vector<scalar_f>
+  lookup(window_type type, length_type len, scalar_f param,
+	 window_generator_type generate)
+  {
+    if (len > VSIP_IMPL_WINDOW_CACHE_SIZE)
+      return generate(len, param);
+
+    Key key = { type, len, param };
+
+    Vector<scalar_f> copy(len);
+    {
+      Lock lock;
+      if (entries_)
+      {
+	map_type::iterator pos = entries_->find(key);
+	if (pos != entries_->end())
+	{
+	  pos->second.last_use = ++clock_;
+	  copy = pos->second.window;
+	  return copy;
+	}
+      }
+    }
+
+    // The window is private to this call until its weights are copied
+    // into a new cache entry.  Another thread may have added the same
+    // window in the meantime.
+    Vector<scalar_f> window = generate(len, param);
+
+    Lock lock;
+    if (!entries_)
+      entries_ = new map_type;
+
+    map_type::iterator pos = entries_->find(key);
+    if (pos == entries_->end())
+    {
+      evict(len);
+      pos = entries_->insert(
+	std::make_pair(key, Entry(Vector<scalar_f>(len), 0))).first;
+      pos->second.window = window;
+      size_ += len;
+    }
+    pos->second.last_use = ++clock_;
+    return window;
   }
 
-  /* wt = fft(wf); */
-  { 
-    typedef Fft<const_Vector, std::complex<scalar_f>, std::complex<scalar_f>, 
-      fft_fwd, by_value, 1, alg_noise> f_fft_type;
-
-    f_fft_type f_fft( Domain<1>(len), 1.0 / len );
-    wf = f_fft( wf );
-    
-    std::complex<scalar_f> scale = wf.get(0);
-    scale /= magsq(scale);
-    wf = scale * wf;
+  static void clear()
+  {
+    Lock lock;
+    delete entries_;
+    entries_ = 0;
+    size_    = 0;
   }
-  
-  Vector<scalar_f> ret(len);
-  ret = freqswap(wfR);
 
-  return ret;
+private:
+  // Release least recently used windows until LEN more values fit.
+  static void evict(length_type len)
+  {
+    while (!entries_->empty() && size_ + len > VSIP_IMPL_WINDOW_CACHE_SIZE)
+    {
+      map_type::iterator oldest = entries_->begin();
+      for (map_type::iterator pos = entries_->begin();
+	   pos != entries_->end(); ++pos)
+	if (pos->second.last_use < oldest->second.last_use)
+	  oldest = pos;
+      size_ -= oldest->first.len;
+      entries_->erase(oldest);
+    }
+  }
+
+  static map_type*     entries_;
+  static length_type   size_;
+  static unsigned long clock_;
+  static int volatile  lock_;
+};
+
+Window_cache::map_type* Window_cache::entries_ = 0;
+length_type             Window_cache::size_    = 0;
+unsigned long           Window_cache::clock_   = 0;
+int volatile            Window_cache::lock_    = 0;
+
+void
+clear_window_cache()
+{
+  Window_cache::clear();
 }
 
+} // namespace impl
+
+
+
+/// Creates Blackman window.
+/// Requires: len > 1.
+/// Returns: A const_Vector initialized with Blackman window weights 
+/// and having length len.
+/// Throws: std::bad_alloc upon memory allocation error.
+const_Vector<scalar_f>
+blackman(length_type len) VSIP_THROW((std::bad_alloc))
+{
+  assert( len > 1 );
+
+  return impl::Window_cache::lookup(impl::blackman_window, len, 0.f,
+				    impl::generate_blackman);
+}
+
+
+
+/// Creates Chebyshev window with user-specified ripple.
+/// Requires: len > 1.
+/// Returns: A const_Vector initialized with Dolph-Chebyshev window 
+/// weights and having length len.
+/// Throws: std::bad_alloc upon memory allocation error.
+const_Vector<scalar_f>
+cheby(length_type len, scalar_f ripple) VSIP_THROW((std::bad_alloc))
+{
+  assert( len > 1 );
+
+  return impl::Window_cache::lookup(impl::cheby_window, len, ripple,
+				    impl::generate_cheby);
+}
 
-        
 
 
 /// Creates Hanning window.
@@ -156,14 +364,8 @@ hanning(length_type len) VSIP_THROW((std::bad_alloc))
 {
   assert( len > 1 );
 
-  Vector<scalar_f> v(len);
-
-  scalar_f temp = 2 * VSIP_IMPL_PI / (len + 1);
-
-  for ( unsigned int n = 0; n < len; ++n )
-    v.put( n, 0.5 * (1 - static_cast<scalar_f>(cos(temp * (n + 1)))) );
-
-  return v;
+  return impl::Window_cache::lookup(impl::hanning_window, len, 0.f,
+				    impl::generate_hanning);
 }
 
 
@@ -178,23 +380,8 @@ kaiser( length_type len, scalar_f beta ) VSIP_THROW((std::bad_alloc))
 {
   assert( len > 1 );
 
-  scalar_f Ibeta;
-  scalar_f x = beta;
-  scalar_f c1 = 2.0 / (len -1 );
-
-  Ibeta = impl::bessel_I_0(x);
- 
-  Vector<scalar_f> v(len);
-  for ( length_type n = 0; n < len; ++n )
-  {
-    scalar_f c3 = c1 * n - 1;
-    if ( c3 > 1.0 )
-      c3 = 1.0;
-    x = beta * static_cast<scalar_f>( sqrt(1 - (c3 * c3)) );
-    v.put( n, impl::bessel_I_0(x) / Ibeta );
-  }
-
-  return v;
+  return impl::Window_cache::lookup(impl::kaiser_window, len, beta,
+				    impl::generate_kaiser);
 }
 
 
@@ -216,9 +403,7 @@ kaiser( length_type len, scalar_f beta ) VSIP_THROW((std::bad_alloc))
 
 #pragma instantiate vsip::const_Vector<float, const vsip::impl::Generator_expr_block<(unsigned int)1, vsip::impl::Ramp_generator<float> > > vsip::ramp<float>(float, float, unsigned int)
 
-#pragma instantiate vsip::impl::Clip_return_type<double, float, double, Vector, Dense<1, float, row1_type, Local_map> >::type vsip::clip<double, float, double, Vector, Dense<1, float, row1_type, Local_map> >(Vector<float, Dense<1, float, row1_type, Local_map> >, double, double, double, double)
 
-#pragma instantiate void vsip::impl::acosh<float>(vsip::Vector<float, vsip::Dense<(unsigned int)1, float, vsip::tuple<(unsigned int)0, (unsigned int)1, (unsigned int)2>, vsip::Local_map> > &, vsip::Vector<std::complex<float>, vsip::Dense<(unsigned int)1, std::complex<float>, vsip::tuple<(unsigned int)0, (unsigned int)1, (unsigned int)2>, vsip::Local_map> > &)
 
 #pragma instantiate Vector<complex<float>, impl::Fast_block<1, complex<float>, impl::Layout<1, row1_type, impl::Stride_unit_dense, impl::Cmplx_inter_fmt>, Local_map> > vsip::impl::fft::new_view<Vector<complex<float>, impl::Fast_block<1, complex<float>, impl::Layout<1, row1_type, impl::Stride_unit_dense, impl::Cmplx_inter_fmt>, Local_map> > >(const Domain<1>&)
 
@@ -44,6 +44,10 @@ kaiser( length_type len, scalar_f beta ) VSIP_THROW((std::bad_alloc));
 namespace impl
 {
 
+/// Release the windows held by the window cache.
+/// Called by vsipl::finalize_library().
+void clear_window_cache();
+
 template <typename T, typename B1, typename B2>
 void 
 acosh(const_Vector<T, B1> x, Vector<std::complex<T>, B2> r)
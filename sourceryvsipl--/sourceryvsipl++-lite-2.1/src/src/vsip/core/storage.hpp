@@ -15,6 +15,7 @@
 
 #include <vsip/core/layout.hpp>
 #include <vsip/core/aligned_allocator.hpp>
+#include <vsip/core/memory_pool.hpp>
 #include <vsip/core/metaprogramming.hpp>
 #include <vsip/core/noncopyable.hpp>
 
@@ -269,6 +270,9 @@ private:
 
 
 /// Allocated storage, with complex format determined at run-time.
+///
+/// Storage is allocated from the temporary pool, since
+/// Rt_allocated_storage holds the copies made by Rt_ext_data.
 template <typename T>
 class Rt_allocated_storage : Non_copyable
 {
@@ -292,36 +296,42 @@ public:
   // Constructors and destructor.
 public:
   static Rt_pointer<T> allocate_(
+    Memory_pool*    pool,
     rt_complex_type cformat,
     length_type     size)
   {
+    if (size == 0)
+      size = 1;
     if (!Is_complex<T>::value || cformat == cmplx_inter_fmt)
     {
-      return Rt_pointer<T>(alloc_align<T>(VSIP_IMPL_ALLOC_ALIGNMENT, size));
+      return Rt_pointer<T>(pool->allocate<T>(size));
     }
     else
     {
       typedef typename Scalar_of<T>::type scalar_type;
       return Rt_pointer<T>(std::pair<scalar_type*, scalar_type*>(
-	alloc_align<scalar_type>(VSIP_IMPL_ALLOC_ALIGNMENT, size),
-	alloc_align<scalar_type>(VSIP_IMPL_ALLOC_ALIGNMENT, size)));
+	pool->allocate<scalar_type>(size),
+	pool->allocate<scalar_type>(size)));
     }
   }
 
   static void deallocate_(
+    Memory_pool*    pool,
     Rt_pointer<T>   ptr,
     rt_complex_type cformat,
-    length_type     /*size*/
-    )
+    length_type     size)
   {
-    if (cformat == cmplx_inter_fmt)
+    if (size == 0)
+      size = 1;
+    if (!Is_complex<T>::value || cformat == cmplx_inter_fmt)
     {
-      free_align(ptr.as_inter());
+      pool->deallocate(ptr.as_inter(), size);
     }
     else
     {
-      free_align(ptr.as_split().first);
-      free_align(ptr.as_split().second);
+      // Release in the reverse order of allocation.
+      pool->deallocate(ptr.as_split().second, size);
+      pool->deallocate(ptr.as_split().first, size);
     }
   }
 
@@ -358,11 +368,12 @@ public:
 		       rt_complex_type cformat,
 		       type            buffer = type())
     VSIP_THROW((std::bad_alloc))
-    : cformat_(cformat),
+    : pool_   (temporary_pool()),
+      cformat_(cformat),
       state_ (size == 0         ? no_data   :
 	      buffer.is_null()  ? alloc_data
 		                : user_data),
-      data_  (state_ == alloc_data ? allocate_ (cformat_, size) :
+      data_  (state_ == alloc_data ? allocate_ (pool_, cformat_, size) :
 	      state_ == user_data  ? partition_(cformat, buffer, size)
 	                           : type())
   {}
@@ -372,11 +383,12 @@ public:
 		       T               val,
 		       type            buffer = type())
   VSIP_THROW((std::bad_alloc))
-    : cformat_(cformat),
+    : pool_   (temporary_pool()),
+      cformat_(cformat),
       state_ (size == 0         ? no_data   :
 	      buffer.is_null() ? alloc_data
 		                : user_data),
-      data_  (state_ == alloc_data ? allocate_ (cformat, size) :
+      data_  (state_ == alloc_data ? allocate_ (pool_, cformat, size) :
 	      state_ == user_data  ? partition_(cformat, buffer, size)
 	                           : type())
   {
@@ -409,7 +421,7 @@ public:
   {
     if (state_ == alloc_data)
     {
-      deallocate_(data_, cformat_, size);
+      deallocate_(pool_, data_, cformat_, size);
       data_ = type();
     }
   }
@@ -421,6 +433,7 @@ public:
 
   // Member data.
 private:
+  Memory_pool*    pool_;
   rt_complex_type cformat_;
   state_type      state_;
   type            data_;
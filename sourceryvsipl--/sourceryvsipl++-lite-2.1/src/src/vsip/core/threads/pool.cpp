@@ -0,0 +1,225 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/threads/pool.cpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Persistent pool of worker threads.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <unistd.h>
+
+#include <vsip/core/config.hpp>
+#include <vsip/core/argv_utils.hpp>
+#include <vsip/core/threads/pool.hpp>
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace threads
+{
+
+Thread_pool* Thread_pool::instance_ = 0;
+
+
+
+void
+Thread_pool::initialize(int& argc, char**& argv)
+{
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  length_type num_workers = ncpu > 0 ? static_cast<length_type>(ncpu) : 1;
+  // Below this size, the cost of waking the workers exceeds the
+  // benefit of splitting the operation.
+  length_type threshold   = 65536;
+  // 64 KB of output per task keeps the operands of a typical
+  // expression resident in L2.
+  length_type chunk_size  = 65536;
+
+  for (int i=1; i<argc; )
+  {
+    if (!strcmp(argv[i], "--svpp-num-workers") && i+1 < argc)
+    {
+      int n = atoi(argv[i+1]);
+      num_workers = n > 0 ? static_cast<length_type>(n) : 1;
+      shift_argv(argc, argv, i, 2);
+    }
+    else if (!strcmp(argv[i], "--svpp-thread-threshold") && i+1 < argc)
+    {
+      int n = atoi(argv[i+1]);
+      threshold = n > 0 ? static_cast<length_type>(n) : 0;
+      shift_argv(argc, argv, i, 2);
+    }
+    else if (!strcmp(argv[i], "--svpp-thread-chunk") && i+1 < argc)
+    {
+      int n = atoi(argv[i+1]);
+      if (n > 0) chunk_size = static_cast<length_type>(n);
+      shift_argv(argc, argv, i, 2);
+    }
+    else
+      ++i;
+  }
+
+  assert(instance_ == 0);
+  instance_ = new Thread_pool(num_workers, threshold, chunk_size);
+}
+
+
+
+void
+Thread_pool::finalize()
+{
+  delete instance_;
+  instance_ = 0;
+}
+
+
+
+Thread_pool::Thread_pool(
+  length_type num_workers,
+  length_type threshold,
+  length_type chunk_size)
+  : num_workers_ (num_workers),
+    threshold_   (threshold),
+    chunk_size_  (chunk_size),
+    thread_      (num_workers),
+    generation_  (0),
+    busy_        (false),
+    shutdown_    (false),
+    func_        (0),
+    arg_         (0),
+    next_        (0),
+    num_tasks_   (0),
+    pending_     (0)
+{
+  // Thread 0 is the caller of parallel_for.
+  for (index_type i=1; i<num_workers_; ++i)
+    pthread_create(&thread_[i], 0, &Thread_pool::worker_main, this);
+}
+
+
+
+Thread_pool::~Thread_pool()
+{
+  {
+    Scoped_lock lock(mutex_);
+    shutdown_ = true;
+    work_cond_.broadcast();
+  }
+  for (index_type i=1; i<num_workers_; ++i)
+    pthread_join(thread_[i], 0);
+}
+
+
+
+void*
+Thread_pool::worker_main(void* ptr)
+{
+  static_cast<Thread_pool*>(ptr)->worker();
+  return 0;
+}
+
+
+
+void
+Thread_pool::worker()
+{
+  unsigned generation = 0;
+  while (true)
+  {
+    {
+      Scoped_lock lock(mutex_);
+      while (!shutdown_ && generation == generation_)
+	work_cond_.wait(mutex_);
+      if (shutdown_)
+	return;
+      generation = generation_;
+    }
+    while (run_task())
+      ;
+  }
+}
+
+
+
+/// Claim and execute one task of the current loop.  Returns false
+/// once all tasks have been claimed.
+
+bool
+Thread_pool::run_task()
+{
+  task_type  func;
+  void*      arg;
+  index_type task;
+  {
+    Scoped_lock lock(mutex_);
+    if (next_ >= num_tasks_)
+      return false;
+    func = func_;
+    arg  = arg_;
+    task = next_++;
+  }
+
+  // An exception cannot be propagated out of a worker thread.
+  try { func(arg, task); }
+  catch (...) { std::terminate(); }
+
+  Scoped_lock lock(mutex_);
+  if (--pending_ == 0)
+    done_cond_.broadcast();
+  return true;
+}
+
+
+
+void
+Thread_pool::parallel_for(task_type func, void* arg, length_type num_tasks)
+{
+  bool serial;
+  {
+    Scoped_lock lock(mutex_);
+    serial = busy_ || num_workers_ == 1 || num_tasks <= 1;
+    if (!serial)
+    {
+      busy_      = true;
+      func_      = func;
+      arg_       = arg;
+      next_      = 0;
+      num_tasks_ = num_tasks;
+      pending_   = num_tasks;
+      ++generation_;
+      work_cond_.broadcast();
+    }
+  }
+
+  if (serial)
+  {
+    for (index_type i=0; i<num_tasks; ++i)
+      func(arg, i);
+    return;
+  }
+
+  while (run_task())
+    ;
+
+  Scoped_lock lock(mutex_);
+  while (pending_ != 0)
+    done_cond_.wait(mutex_);
+  busy_ = false;
+}
+
+} // namespace vsip::impl::threads
+} // namespace vsip::impl
+} // namespace vsip
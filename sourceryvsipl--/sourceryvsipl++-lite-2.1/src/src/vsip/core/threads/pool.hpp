@@ -0,0 +1,121 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/threads/pool.hpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Persistent pool of worker threads.
+
+    The pool is created by vsipl initialization and is used to split
+    large operations (expressions, FFTs, etc) across the cores of a
+    shared-memory node.  It is independent of the parallel service.
+*/
+
+#ifndef VSIP_CORE_THREADS_POOL_HPP
+#define VSIP_CORE_THREADS_POOL_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vector>
+
+#include <vsip/support.hpp>
+#include <vsip/core/threads/sync.hpp>
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace threads
+{
+
+/// Pool of worker threads executing data-parallel loops.
+///
+/// Options (processed by initialize()):
+///   --svpp-num-workers N      number of threads, including the
+///                             calling thread (default: online CPUs).
+///   --svpp-thread-threshold N minimum number of elements for which
+///                             an operation is split across threads.
+///   --svpp-thread-chunk N     preferred chunk size in bytes.
+
+class Thread_pool : Non_copyable
+{
+public:
+  typedef void (*task_type)(void* arg, index_type task);
+
+  static void initialize(int& argc, char**& argv);
+  static void finalize();
+
+  static Thread_pool* instance() { return instance_; }
+
+  /// Number of threads that execute tasks, including the caller.
+  length_type num_workers() const { return num_workers_; }
+
+  /// Minimum number of elements worth splitting across threads.
+  length_type threshold() const { return threshold_; }
+
+  /// Preferred amount of data processed by one task, in bytes.
+  length_type chunk_size() const { return chunk_size_; }
+
+  /// Execute FUNC(ARG, i) for each i in [0, NUM_TASKS).
+  ///
+  /// The calling thread participates and the call returns once all
+  /// tasks have completed.  If the pool is already busy (for example
+  /// when called from within a task, or from another thread), the
+  /// tasks are executed serially by the caller.
+  void parallel_for(task_type func, void* arg, length_type num_tasks);
+
+private:
+  Thread_pool(length_type num_workers,
+	      length_type threshold,
+	      length_type chunk_size);
+  ~Thread_pool();
+
+  static void* worker_main(void*);
+  void worker();
+  bool run_task();
+
+  static Thread_pool* instance_;
+
+  length_type              num_workers_;
+  length_type              threshold_;
+  length_type              chunk_size_;
+  std::vector<pthread_t>   thread_;
+
+  Mutex       mutex_;
+  Condition   work_cond_;
+  Condition   done_cond_;
+  unsigned    generation_;
+  bool        busy_;
+  bool        shutdown_;
+  task_type   func_;
+  void*       arg_;
+  index_type  next_;
+  length_type num_tasks_;
+  length_type pending_;
+};
+
+
+
+/// Return the number of tasks of roughly CHUNK elements needed to
+/// cover SIZE elements, rounding CHUNK to a multiple of ALIGN.
+
+inline length_type
+num_chunks(length_type size, length_type& chunk, length_type align)
+{
+  if (chunk < align) chunk = align;
+  chunk -= chunk % align;
+  return (size + chunk - 1) / chunk;
+}
+
+} // namespace vsip::impl::threads
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_CORE_THREADS_POOL_HPP
@@ -0,0 +1,383 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/threads/services.cpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Parallel Services: shared-memory threads
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <unistd.h>
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+
+#include <vsip/core/config.hpp>
+#include <vsip/core/argv_utils.hpp>
+#include <vsip/core/parallel/services.hpp>
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace threads
+{
+
+namespace
+{
+
+pthread_key_t  comm_key;
+pthread_once_t comm_key_once = PTHREAD_ONCE_INIT;
+
+void
+create_comm_key()
+{
+  pthread_key_create(&comm_key, 0);
+}
+
+struct Worker_arg
+{
+  Team*          team;
+  processor_type rank;
+};
+
+/// Pin the calling thread to CPU.
+
+void
+pin_thread(processor_type cpu)
+{
+#if defined(__linux__) && defined(CPU_SET)
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  if (ncpu <= 0) return;
+
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(cpu % ncpu, &mask);
+  pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask);
+#else
+  (void)cpu;
+#endif
+}
+
+} // namespace <unnamed>
+
+
+
+void
+set_thread_communicator(Communicator* comm)
+{
+  pthread_once(&comm_key_once, create_comm_key);
+  pthread_setspecific(comm_key, comm);
+}
+
+
+
+Communicator*
+thread_communicator()
+{
+  pthread_once(&comm_key_once, create_comm_key);
+  return static_cast<Communicator*>(pthread_getspecific(comm_key));
+}
+
+
+
+Team::Team(length_type size, bool pin)
+  : size_              (size),
+    pin_               (pin),
+    thread_            (size),
+    mailbox_           (size),
+    slot_              (size, 0),
+    barrier_           (size),
+    region_generation_ (0),
+    region_func_       (0),
+    region_arg_        (0),
+    shutdown_          (false)
+{
+  for (index_type i=0; i<size_; ++i)
+  {
+    mailbox_[i] = new Mailbox;
+    mailbox_[i]->queue.resize(size_);
+    mailbox_[i]->posted.resize(size_);
+  }
+
+  for (index_type i=1; i<size_; ++i)
+  {
+    Worker_arg* arg = new Worker_arg;
+    arg->team = this;
+    arg->rank = i;
+    pthread_create(&thread_[i], 0, &Team::worker_main, arg);
+  }
+}
+
+
+
+Team::~Team()
+{
+  {
+    Scoped_lock lock(region_mutex_);
+    shutdown_ = true;
+    region_cond_.broadcast();
+  }
+  for (index_type i=1; i<size_; ++i)
+    pthread_join(thread_[i], 0);
+
+  for (index_type i=0; i<size_; ++i)
+  {
+    // Messages that were never received: release buffered sends.
+    for (index_type j=0; j<size_; ++j)
+      for (index_type k=0; k<mailbox_[i]->queue[j].size(); ++k)
+	mailbox_[i]->queue[j][k].free_memory();
+    delete mailbox_[i];
+  }
+}
+
+
+
+void*
+Team::worker_main(void* ptr)
+{
+  Worker_arg* arg = static_cast<Worker_arg*>(ptr);
+  Team*          team = arg->team;
+  processor_type rank = arg->rank;
+  delete arg;
+
+  team->worker(rank);
+  return 0;
+}
+
+
+
+void
+Team::worker(processor_type rank)
+{
+  if (pin_) pin_thread(rank);
+
+  unsigned generation = 0;
+  while (true)
+  {
+    void (*func)(void*);
+    void* arg;
+    {
+      Scoped_lock lock(region_mutex_);
+      while (!shutdown_ && generation == region_generation_)
+	region_cond_.wait(region_mutex_);
+      if (shutdown_)
+	return;
+      generation = region_generation_;
+      func       = region_func_;
+      arg        = region_arg_;
+    }
+
+    Communicator comm(this, rank);
+    set_thread_communicator(&comm);
+    // An exception escaping a worker thread cannot be propagated to
+    // the other processors, just like an exception escaping an MPI
+    // process.
+    try { func(arg); }
+    catch (...) { std::terminate(); }
+    set_thread_communicator(0);
+
+    barrier_.wait();
+  }
+}
+
+
+
+void
+Team::run(void (*func)(void*), void* arg)
+{
+  {
+    Scoped_lock lock(region_mutex_);
+    region_func_ = func;
+    region_arg_  = arg;
+    ++region_generation_;
+    region_cond_.broadcast();
+  }
+
+  Communicator comm(this, 0);
+  set_thread_communicator(&comm);
+  try { func(arg); }
+  catch (...) { std::terminate(); }
+  set_thread_communicator(0);
+
+  barrier_.wait();
+}
+
+
+
+void
+Team::post(processor_type src, processor_type dst, Msg const& msg)
+{
+  assert(dst < size_);
+  Mailbox& box = *mailbox_[dst];
+  Req_entry* recv;
+  {
+    Scoped_lock lock(box.mutex);
+    if (box.posted[src].empty())
+    {
+      box.queue[src].push_back(msg);
+      box.cond.broadcast();
+      return;
+    }
+    recv = box.posted[src].front();
+    box.posted[src].pop_front();
+  }
+  // The oldest receive posted for SRC takes the message.
+  deliver(msg, recv);
+}
+
+
+
+Msg
+Team::take(processor_type src, processor_type dst)
+{
+  assert(src < size_);
+  Mailbox& box = *mailbox_[dst];
+  Scoped_lock lock(box.mutex);
+  while (box.queue[src].empty())
+    box.cond.wait(box.mutex);
+  Msg msg = box.queue[src].front();
+  box.queue[src].pop_front();
+  return msg;
+}
+
+
+
+// Post a receive of the next message from SRC to DST.  Receive it
+// now if it has arrived, otherwise leave it for post() to deliver.
+
+void
+Team::post_recv(processor_type src, processor_type dst, Req_entry* req)
+{
+  assert(src < size_);
+  Mailbox& box = *mailbox_[dst];
+  Msg msg(Copy_chain(), 0);
+  {
+    Scoped_lock lock(box.mutex);
+    if (box.queue[src].empty())
+    {
+      box.posted[src].push_back(req);
+      return;
+    }
+    msg = box.queue[src].front();
+    box.queue[src].pop_front();
+  }
+  deliver(msg, req);
+}
+
+
+
+// Copy MSG into the posted receive REQ, and complete both.
+
+void
+Team::deliver(Msg const& msg, Req_entry* req)
+{
+  assert(msg.chain_.data_size() == req->chain.data_size());
+  msg.chain_.copy_into(req->chain);
+
+  if (msg.memory_) msg.free_memory();
+  else             complete(msg.req_);
+  complete(req);
+}
+
+
+
+void
+Team::complete(Req_entry* req)
+{
+  Mailbox& box = *mailbox_[req->owner];
+  Scoped_lock lock(box.mutex);
+  req->done = true;
+  box.cond.broadcast();
+}
+
+
+
+void
+Team::wait(processor_type rank, Request& req)
+{
+  Mailbox& box = *mailbox_[rank];
+  Scoped_lock lock(box.mutex);
+  while (!req.entry().done)
+    box.cond.wait(box.mutex);
+}
+
+
+
+bool
+Team::test(processor_type rank, Request& req)
+{
+  Mailbox& box = *mailbox_[rank];
+  Scoped_lock lock(box.mutex);
+  return req.entry().done;
+}
+
+} // namespace vsip::impl::threads
+
+
+
+Par_service::Par_service(int& argc, char**& argv)
+  : serial_ (0),
+    team_   (0)
+{
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  length_type size = ncpu > 0 ? static_cast<length_type>(ncpu) : 1;
+  bool pin = true;
+
+  for (int i=1; i<argc; )
+  {
+    if (!strcmp(argv[i], "--svpp-num-threads") && i+1 < argc)
+    {
+      int n = atoi(argv[i+1]);
+      size = n > 0 ? static_cast<length_type>(n) : 1;
+      shift_argv(argc, argv, i, 2);
+    }
+    else if (!strcmp(argv[i], "--svpp-no-pin-threads"))
+    {
+      pin = false;
+      shift_argv(argc, argv, i, 1);
+    }
+    else
+      ++i;
+  }
+
+  serial_ = new threads::Team(1, false);
+  team_   = new threads::Team(size, pin);
+  default_communicator_ = communicator_type(serial_, 0);
+}
+
+
+
+Par_service::~Par_service()
+{
+  default_communicator_ = communicator_type();
+  delete team_;
+  delete serial_;
+}
+
+
+
+void
+Par_service::spmd(void (*func)(void*), void* arg)
+{
+  // Nested SPMD regions execute on the enclosing region's processor.
+  if (threads::thread_communicator())
+    func(arg);
+  else
+    team_->run(func, arg);
+}
+
+} // namespace vsip::impl
+} // namespace vsip
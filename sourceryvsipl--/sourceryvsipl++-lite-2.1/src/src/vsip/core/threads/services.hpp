@@ -0,0 +1,627 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/threads/services.hpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Parallel Services: shared-memory threads
+
+    Each processor of the data parallel clique is a (pinned) thread of
+    a single process.  Since all processors share one address space,
+    point-to-point messages are handed off as copy chains describing the
+    sender's data and are copied once, directly into the receiver's
+    memory.
+*/
+
+#ifndef VSIP_CORE_THREADS_SERVICES_HPP
+#define VSIP_CORE_THREADS_SERVICES_HPP
+
+// Only one parallel/xxx.hpp header should be included
+#ifdef VSIP_IMPL_PAR_SERVICES_UNIQUE
+#  error "Only one parallel/xxx.hpp should be included"
+#endif
+#define VSIP_IMPL_PAR_SERVICES_UNIQUE
+
+
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstring>
+#include <deque>
+#include <vector>
+#include <algorithm>
+
+#include <vsip/support.hpp>
+#include <vsip/core/refcount.hpp>
+#include <vsip/core/noncopyable.hpp>
+#include <vsip/core/parallel/copy_chain.hpp>
+#include <vsip/core/reductions/types.hpp>
+#include <vsip/core/parallel/assign_fwd.hpp>
+#include <vsip/core/threads/sync.hpp>
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+
+namespace impl
+{
+
+typedef int par_ll_pbuf_type;
+typedef int par_ll_pset_type;
+
+namespace threads
+{
+
+/// DMA Chain builder.
+
+class Chain_builder
+{
+public:
+  Chain_builder()
+    : chain_ ()
+  {}
+
+  ~Chain_builder()
+  {}
+
+  template <typename T>
+  void add(ptrdiff_t start, int stride, unsigned length)
+  {
+    chain_.add(reinterpret_cast<void*>(start), sizeof(T), stride, length);
+  }
+
+  template <typename T>
+  void add(ptrdiff_t start,
+	   int stride0, unsigned length0,
+	   int stride1, unsigned length1)
+  {
+    for (unsigned i=0; i<length1; ++i)
+      chain_.add(reinterpret_cast<void*>(start + sizeof(T)*i*stride1),
+		 sizeof(T), stride0, length0);
+  }
+
+  void* base() { return 0; }
+
+  Copy_chain get_chain()
+  { return chain_; }
+
+  void stitch(void* base, Copy_chain chain)
+  { chain_.append_offset(base, chain); }
+
+  void stitch(std::pair<void*, void*> base, Copy_chain chain)
+  {
+    chain_.append_offset(base.first,  chain);
+    chain_.append_offset(base.second, chain);
+  }
+
+  bool is_empty() const { return (chain_.size() == 0); }
+
+  // Private member data.
+private:
+  Copy_chain                    chain_;
+};
+
+
+
+/// Completion state of a send or of a posted receive.  A send is
+/// done once the data has been copied out of the sender's memory, a
+/// receive once it has been copied into CHAIN.
+
+struct Req_entry : public impl::Ref_count<Req_entry>
+{
+  Req_entry() : done(false), owner(0) {}
+
+  bool           done;
+  processor_type owner;
+  Copy_chain     chain;
+};
+
+class Request
+{
+public:
+  Request() : entry_(new Req_entry, impl::noincrement) {}
+
+  Req_entry& entry() { return *entry_; }
+
+private:
+  impl::Ref_counted_ptr<Req_entry> entry_;
+};
+
+
+
+/// A message in flight: the sender's data (as a copy chain), its
+/// completion state, and optionally memory owned by the message.
+///
+/// The completion state is referenced by plain pointer: the reference
+/// count of a Request is only manipulated by the sending thread, which
+/// must keep the request alive until it has waited on it.
+///
+/// Owned memory is a byte buffer allocated with new char[], released
+/// by free_memory() once the message has been received.
+
+struct Msg
+{
+  Msg(Copy_chain const& chain, Req_entry* req, char* memory = 0)
+    : chain_  (chain),
+      req_    (req),
+      memory_ (memory)
+  {}
+
+  void free_memory() const { delete[] memory_; }
+
+  Copy_chain chain_;
+  Req_entry* req_;
+  char*      memory_;
+};
+
+
+
+/// A team of threads forming a data parallel clique.
+
+/// The thread that creates the team is rank 0; SIZE-1 worker threads
+/// are created with ranks 1 ... SIZE-1 and wait for SPMD regions to
+/// execute.
+
+class Team : Non_copyable
+{
+  typedef std::deque<Msg> msg_queue_type;
+
+  typedef std::deque<Req_entry*> recv_queue_type;
+
+  // One mailbox per rank, with one FIFO per source rank of messages
+  // not yet received, and one of receives posted before their
+  // message arrived.  For a given source, only one of them is
+  // non-empty.  The mailbox condition is also used to signal
+  // completion of sends and receives owned by the rank.
+  struct Mailbox
+  {
+    Mutex                        mutex;
+    Condition                    cond;
+    std::vector<msg_queue_type>  queue;
+    std::vector<recv_queue_type> posted;
+  };
+
+public:
+  Team(length_type size, bool pin);
+  ~Team();
+
+  length_type size() const { return size_; }
+
+  /// Run FUNC(ARG) on all ranks of the team, the calling thread
+  /// acting as rank 0.  Returns once all ranks have finished.
+  void run(void (*func)(void*), void* arg);
+
+  void barrier() { barrier_.wait(); }
+
+  void post(processor_type src, processor_type dst, Msg const& msg);
+  Msg  take(processor_type src, processor_type dst);
+  void post_recv(processor_type src, processor_type dst, Req_entry* req);
+  void complete(Req_entry* req);
+  void wait(processor_type rank, Request& req);
+  bool test(processor_type rank, Request& req);
+
+  /// Collective scratch space: one pointer slot per rank.
+  void*& slot(processor_type rank) { return slot_[rank]; }
+
+private:
+  static void* worker_main(void* arg);
+  void         worker(processor_type rank);
+  void         deliver(Msg const& msg, Req_entry* req);
+
+  length_type            size_;
+  bool                   pin_;
+  std::vector<pthread_t> thread_;
+  std::vector<Mailbox*>  mailbox_;
+  std::vector<void*>     slot_;
+  Barrier                barrier_;
+
+  // SPMD region dispatch.
+  Mutex                  region_mutex_;
+  Condition              region_cond_;
+  unsigned               region_generation_;
+  void                 (*region_func_)(void*);
+  void*                  region_arg_;
+  bool                   shutdown_;
+};
+
+
+
+/// Communicator class for shared-memory threads.
+
+class Communicator
+{
+public:
+  typedef Request                     request_type;
+  typedef Copy_chain                  chain_type;
+  typedef std::vector<processor_type> pvec_type;
+
+public:
+  Communicator()
+    : team_(0), rank_(0), size_(0), pvec_(0)
+  {}
+
+  Communicator(Team* team, processor_type rank)
+    : team_(team),
+      rank_(rank),
+      size_(team->size()),
+      pvec_(size_)
+  {
+    for (index_type i=0; i<size_; ++i)
+      pvec_[i] = static_cast<processor_type>(i);
+  }
+
+  processor_type   rank() const { return rank_; }
+  length_type      size() const { return size_; }
+  pvec_type const& pvec() const { return pvec_; }
+
+  void barrier() const { if (size_ > 1) team_->barrier(); }
+
+  template <typename T>
+  void buf_send(processor_type dest_proc, T* data, length_type size);
+
+  template <typename T>
+  void send(processor_type dest_proc, T* data, length_type size,
+	    request_type& req);
+
+  void send(processor_type dest, chain_type const& chain, request_type& req);
+
+  template <typename T>
+  void recv(processor_type src_proc, T* data, length_type size);
+
+  void recv(processor_type dest, chain_type const& chain);
+
+  void recv(processor_type dest, chain_type const& chain, request_type& req);
+
+  void wait(request_type& req);
+
+  bool test(request_type& req);
+
+  template <typename T>
+  void broadcast(processor_type root_proc, T* data, length_type size);
+
+  template <typename T>
+  T allreduce(reduction_type rdx, T value);
+
+  par_ll_pset_type impl_ll_pset() const VSIP_NOTHROW
+  { return par_ll_pset_type(); }
+
+  Team* impl_team() const { return team_; }
+
+  friend bool operator==(Communicator const&, Communicator const&);
+
+private:
+  Team*                 team_;
+  processor_type	rank_;
+  length_type		size_;
+  pvec_type		pvec_;
+};
+
+/// Set the communicator of the calling thread (0 to reset it).
+void set_thread_communicator(Communicator* comm);
+
+/// Return the communicator of the calling thread, or 0 if the thread
+/// is not executing an SPMD region.
+Communicator* thread_communicator();
+
+} // namespace vsip::impl::threads
+
+
+
+typedef threads::Communicator Communicator;
+typedef threads::Chain_builder Chain_builder;
+typedef Chained_assign par_assign_impl_type;
+
+inline void
+create_ll_pset(
+  std::vector<processor_type> const&,
+  par_ll_pset_type&)
+{}
+
+inline void
+destroy_ll_pset(par_ll_pset_type&)
+{}
+
+inline void
+free_chain(Copy_chain const& /*chain*/)
+{
+}
+
+
+
+/// Par_service class for shared-memory threads.
+
+/// Recognized options:
+///   --svpp-num-threads N  Number of threads (processors) in the
+///                         clique.  Defaults to the number of online
+///                         CPUs.
+///   --svpp-no-pin-threads Do not pin threads to CPUs.
+///
+/// Outside of an SPMD region (see par_spmd()), the default
+/// communicator of the main thread contains only that thread.
+
+class Par_service
+{
+  // Compile-time values and typedefs.
+public:
+  typedef threads::Communicator communicator_type;
+
+  // Constructors.
+public:
+  Par_service(int& argc, char**& argv);
+  ~Par_service();
+
+  static communicator_type& default_communicator()
+  {
+    communicator_type* comm = threads::thread_communicator();
+    return comm ? *comm : default_communicator_;
+  }
+
+  /// Run FUNC(ARG) on every thread of the team.
+  void spmd(void (*func)(void*), void* arg);
+
+  /// Number of threads of the team.
+  length_type team_size() const { return team_->size(); }
+
+private:
+  static communicator_type default_communicator_;
+
+  threads::Team*           serial_;
+  threads::Team*           team_;
+};
+
+
+
+// Reductions that are sums or logical combinations can be done for
+// any value type.
+
+template <reduction_type rtype,
+	  typename       T>
+struct Reduction_supported
+{
+  static bool const value = rtype == reduce_all_true      ||
+                            rtype == reduce_all_true_bool ||
+                            rtype == reduce_any_true      ||
+                            rtype == reduce_any_true_bool ||
+                            rtype == reduce_sum           ||
+                            rtype == reduce_sum_bool      ||
+                            rtype == reduce_sum_sq        ||
+                            rtype == reduce_mean          ||
+                            rtype == reduce_mean_magsq;
+};
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace threads
+{
+
+inline bool
+operator==(Communicator const& comm1, Communicator const& comm2)
+{
+  return comm1.team_ == comm2.team_;
+}
+
+
+
+inline bool
+operator!=(Communicator const& comm1, Communicator const& comm2)
+{
+  return !operator==(comm1, comm2);
+}
+
+
+
+template <typename T>
+inline void
+Communicator::buf_send(
+  processor_type dest_proc,
+  T*             data,
+  length_type    size)
+{
+  // The message is received as bytes, so it is buffered as bytes.
+  char* raw = new char[size * sizeof(T)];
+  std::memcpy(raw, data, size * sizeof(T));
+
+  Copy_chain chain;
+  chain.add(reinterpret_cast<void*>(raw), sizeof(T), 1, size);
+
+  team_->post(rank_, dest_proc, Msg(chain, 0, raw));
+}
+
+
+
+template <typename T>
+inline void
+Communicator::send(
+  processor_type dest_proc,
+  T*             data,
+  length_type    size,
+  request_type&  req)
+{
+  Copy_chain chain;
+  chain.add(reinterpret_cast<void*>(data), sizeof(T), 1, size);
+
+  req.entry().done  = false;
+  req.entry().owner = rank_;
+  team_->post(rank_, dest_proc, Msg(chain, &req.entry()));
+}
+
+
+
+inline void
+Communicator::send(
+  processor_type    dest_proc,
+  chain_type const& chain,
+  request_type&     req)
+{
+  req.entry().done  = false;
+  req.entry().owner = rank_;
+  team_->post(rank_, dest_proc, Msg(chain, &req.entry()));
+}
+
+
+
+template <typename T>
+inline void
+Communicator::recv(
+  processor_type   src_proc,
+  T*               data,
+  length_type      size)
+{
+  Msg msg = team_->take(src_proc, rank_);
+
+  assert(msg.chain_.data_size() == size * sizeof(T));
+  msg.chain_.copy_into(data, size * sizeof(T));
+
+  if (msg.memory_) msg.free_memory();
+  else             team_->complete(msg.req_);
+}
+
+
+
+inline void
+Communicator::recv(
+  processor_type    src_proc,
+  chain_type const& chain)
+{
+  Msg msg = team_->take(src_proc, rank_);
+
+  assert(msg.chain_.data_size() == chain.data_size());
+  msg.chain_.copy_into(chain);
+
+  assert(msg.memory_ == 0);
+  team_->complete(msg.req_);
+}
+
+
+
+/// Post a receive into CHAIN from SRC_PROC.  If the message has not
+/// arrived yet, the sending thread copies it when it is sent.
+
+inline void
+Communicator::recv(
+  processor_type    src_proc,
+  chain_type const& chain,
+  request_type&     req)
+{
+  req.entry().done  = false;
+  req.entry().owner = rank_;
+  req.entry().chain = chain;
+  team_->post_recv(src_proc, rank_, &req.entry());
+}
+
+
+
+/// Wait for a previous send to be received, or for a posted receive
+/// to complete.
+
+inline void
+Communicator::wait(
+  request_type& req)
+{
+  team_->wait(rank_, req);
+}
+
+
+
+/// Check whether a previous send has been received, or a posted
+/// receive has completed, without waiting.
+
+inline bool
+Communicator::test(
+  request_type& req)
+{
+  return team_->test(rank_, req);
+}
+
+
+
+/// Broadcast a value from root processor to other processors.
+
+/// The root publishes its buffer and the other processors copy
+/// directly out of it.
+
+template <typename T>
+inline void
+Communicator::broadcast(processor_type root_proc, T* data, length_type size)
+{
+  if (size_ == 1)
+    return;
+
+  if (rank_ == root_proc)
+    team_->slot(rank_) = data;
+  team_->barrier();
+  if (rank_ != root_proc)
+  {
+    T const* src = static_cast<T const*>(team_->slot(root_proc));
+    std::copy(src, src + size, data);
+  }
+  team_->barrier();
+}
+
+
+
+template <typename T>
+inline T
+par_land(T a, T b)
+{ return (a != T() && b != T()) ? T(1) : T(); }
+
+template <typename T>
+inline T
+par_lor(T a, T b)
+{ return (a != T() || b != T()) ? T(1) : T(); }
+
+
+
+/// Reduce a value from all processors to all processors.
+
+/// Every processor combines the values in rank order, so all
+/// processors compute bit-identical results.
+
+template <typename T>
+inline T
+Communicator::allreduce(reduction_type rtype, T value)
+{
+  if (size_ == 1)
+    return value;
+
+  team_->slot(rank_) = &value;
+  team_->barrier();
+
+  T result = *static_cast<T*>(team_->slot(0));
+  for (index_type i=1; i<size_; ++i)
+  {
+    T const& other = *static_cast<T*>(team_->slot(i));
+    switch (rtype)
+    {
+    case reduce_all_true:
+    case reduce_all_true_bool: result = par_land(result, other); break;
+    case reduce_any_true:
+    case reduce_any_true_bool: result = par_lor(result, other); break;
+    case reduce_sum:
+    case reduce_sum_bool:
+    case reduce_sum_sq:
+    case reduce_mean:
+    case reduce_mean_magsq:    result = result + other; break;
+    default: assert(false);
+    }
+  }
+  // Keep VALUE alive until every processor has read it.
+  team_->barrier();
+  return result;
+}
+
+} // namespace vsip::impl::threads
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_CORE_THREADS_SERVICES_HPP
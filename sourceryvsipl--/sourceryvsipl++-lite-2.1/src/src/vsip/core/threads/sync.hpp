@@ -0,0 +1,124 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/core/threads/sync.hpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Thread synchronization primitives.
+
+    Thin wrappers around POSIX threads mutexes and condition variables,
+    used by the threads parallel service and the worker pool.
+*/
+
+#ifndef VSIP_CORE_THREADS_SYNC_HPP
+#define VSIP_CORE_THREADS_SYNC_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <pthread.h>
+#include <cassert>
+
+#include <vsip/core/noncopyable.hpp>
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace threads
+{
+
+/// Mutual exclusion lock.
+
+class Mutex : Non_copyable
+{
+  friend class Condition;
+public:
+  Mutex()  { pthread_mutex_init(&mutex_, 0); }
+  ~Mutex() { pthread_mutex_destroy(&mutex_); }
+
+  void lock()   { pthread_mutex_lock(&mutex_); }
+  void unlock() { pthread_mutex_unlock(&mutex_); }
+
+private:
+  pthread_mutex_t mutex_;
+};
+
+
+
+/// Hold a Mutex for the lifetime of the lock object.
+
+class Scoped_lock : Non_copyable
+{
+public:
+  Scoped_lock(Mutex& mutex) : mutex_(mutex) { mutex_.lock(); }
+  ~Scoped_lock() { mutex_.unlock(); }
+
+private:
+  Mutex& mutex_;
+};
+
+
+
+/// Condition variable.  The associated Mutex must be held when
+/// calling wait().
+
+class Condition : Non_copyable
+{
+public:
+  Condition()  { pthread_cond_init(&cond_, 0); }
+  ~Condition() { pthread_cond_destroy(&cond_); }
+
+  void wait(Mutex& mutex) { pthread_cond_wait(&cond_, &mutex.mutex_); }
+  void signal()           { pthread_cond_signal(&cond_); }
+  void broadcast()        { pthread_cond_broadcast(&cond_); }
+
+private:
+  pthread_cond_t cond_;
+};
+
+
+
+/// Sense-reversing barrier for a fixed number of threads.
+
+class Barrier : Non_copyable
+{
+public:
+  Barrier(unsigned count)
+    : count_(count), waiting_(0), generation_(0)
+  { assert(count_ > 0); }
+
+  void wait()
+  {
+    Scoped_lock lock(mutex_);
+    unsigned generation = generation_;
+    if (++waiting_ == count_)
+    {
+      waiting_ = 0;
+      ++generation_;
+      cond_.broadcast();
+    }
+    else
+      while (generation == generation_)
+	cond_.wait(mutex_);
+  }
+
+private:
+  Mutex     mutex_;
+  Condition cond_;
+  unsigned  count_;
+  unsigned  waiting_;
+  unsigned  generation_;
+};
+
+} // namespace vsip::impl::threads
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_CORE_THREADS_SYNC_HPP
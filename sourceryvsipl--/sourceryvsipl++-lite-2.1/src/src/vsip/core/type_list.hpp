@@ -39,12 +39,17 @@ template <typename T1 = None_type,
 	  typename T13 = None_type,
 	  typename T14 = None_type,
 	  typename T15 = None_type,
-	  typename T16 = None_type>
+	  typename T16 = None_type,
+	  typename T17 = None_type,
+	  typename T18 = None_type,
+	  typename T19 = None_type,
+	  typename T20 = None_type>
 struct Make_type_list
 {
 private:
   typedef typename 
-  Make_type_list<T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::type Rest;
+  Make_type_list<T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16,
+		 T17, T18, T19, T20>::type Rest;
 public:
   typedef Type_list<T1, Rest> type;
 };
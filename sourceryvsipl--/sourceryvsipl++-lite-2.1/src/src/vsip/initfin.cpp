@@ -14,6 +14,7 @@
 #include <vsip/vector.hpp>
 #include <vsip/core/parallel/services.hpp>
 #include <vsip/core/memory_pool.hpp>
+#include <vsip/core/signal/window.hpp>
 #if defined(VSIP_IMPL_CBE_SDK) && !defined(VSIP_IMPL_REF_IMPL)
 # include <vsip/opt/cbe/ppu/task_manager.hpp>
 #endif
@@ -23,6 +24,16 @@
 #if defined(VSIP_IMPL_HAVE_CUDA) && !defined(VSIP_IMPL_REF_IMPL)
 # include <vsip/opt/cuda/bindings.hpp>
 #endif
+#if defined(VSIP_IMPL_HAVE_THREAD_POOL) && !defined(VSIP_IMPL_REF_IMPL)
+# include <vsip/core/threads/pool.hpp>
+#endif
+#if defined(VSIP_IMPL_FFTW3) && !defined(VSIP_IMPL_REF_IMPL)
+# include <vsip/opt/fftw3/wisdom.hpp>
+#endif
+#if !defined(VSIP_IMPL_REF_IMPL)
+# include <vsip/opt/simd/isa.hpp>
+# include <vsip/opt/fft/threads.hpp>
+#endif
 #include <cstring>
 
 using namespace vsip;
@@ -204,6 +215,8 @@ vsipl::initialize_library(int& argc, char**& argv)
   // remaining options are left intact.
   profiler_opts_ = new impl::profile::Profiler_options(use_argc, use_argv);
 
+  impl::simd::initialize_isa(use_argc, use_argv);
+
 # if defined(VSIP_IMPL_NUMA)
   impl::numa::initialize(use_argc, use_argv);
 # endif
@@ -213,6 +226,13 @@ vsipl::initialize_library(int& argc, char**& argv)
 # if defined(VSIP_IMPL_HAVE_CUDA)
   impl::cuda::initialize(use_argc, use_argv);
 # endif
+# if defined(VSIP_IMPL_HAVE_THREAD_POOL)
+  impl::threads::Thread_pool::initialize(use_argc, use_argv);
+# endif
+  impl::fft::initialize_threads(use_argc, use_argv);
+# if defined(VSIP_IMPL_FFTW3)
+  impl::fftw3::initialize(use_argc, use_argv);
+# endif
 
 #endif
 
@@ -248,17 +268,25 @@ vsipl::finalize_library()
   if (--use_count != 0)
     return;
 
+  impl::clear_window_cache();
+
   delete par_service_;
   par_service_ = 0;
 
 #ifndef VSIP_IMPL_REF_IMPL
 
+# if defined(VSIP_IMPL_FFTW3)
+  impl::fftw3::finalize();
+# endif
 # if defined(VSIP_IMPL_CBE_SDK)
   impl::cbe::Task_manager::finalize();
 # endif
 # if defined(VSIP_IMPL_HAVE_CUDA)
   impl::cuda::finalize();
 # endif
+# if defined(VSIP_IMPL_HAVE_THREAD_POOL)
+  impl::threads::Thread_pool::finalize();
+# endif
 
   delete profiler_opts_;
   profiler_opts_ = 0;
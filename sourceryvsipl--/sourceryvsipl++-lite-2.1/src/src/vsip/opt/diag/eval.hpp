@@ -87,6 +87,7 @@ VSIP_IMPL_DISPATCH_NAME(Dense_expr_tag)
 VSIP_IMPL_DISPATCH_NAME(Copy_tag)
 VSIP_IMPL_DISPATCH_NAME(Op_expr_tag)
 VSIP_IMPL_DISPATCH_NAME(Simd_builtin_tag)
+VSIP_IMPL_DISPATCH_NAME_AS(Simd_threaded_loop_fusion_tag, Simd_tlf_tag)
 VSIP_IMPL_DISPATCH_NAME(Simd_loop_fusion_tag)
 VSIP_IMPL_DISPATCH_NAME_AS(Simd_unaligned_loop_fusion_tag, Simd_ulf_tag)
 VSIP_IMPL_DISPATCH_NAME(Fc_expr_tag)
@@ -104,7 +104,8 @@ struct Profile_policy<O, R(A), B>
   typedef profile::Scope<Profile_feature<O>::value> scope_type;
   typedef Evaluator<O, B, R(A)> evaluator_type;
   Profile_policy(A a)
-    : scope(evaluator_type::name(), evaluator_type::op_count(a)) {}
+    : scope(profile::Type_event<evaluator_type>::get(),
+            evaluator_type::op_count(a)) {}
     
   scope_type scope;  
 };
@@ -117,7 +118,8 @@ struct Profile_policy<O, R(A1, A2), B>
   typedef profile::Scope<Profile_feature<O>::value> scope_type;
   typedef Evaluator<O, B, R(A1, A2)> evaluator_type;
   Profile_policy(A1 a1, A2 a2)
-    : scope(evaluator_type::name(), evaluator_type::op_count(a1, a2)) {}
+    : scope(profile::Type_event<evaluator_type>::get(),
+            evaluator_type::op_count(a1, a2)) {}
     
   scope_type scope;  
 };
@@ -130,7 +132,8 @@ struct Profile_policy<O, R(A1, A2, A3), B>
   typedef profile::Scope<Profile_feature<O>::value> scope_type;
   typedef Evaluator<O, B, R(A1, A2, A3)> evaluator_type;
   Profile_policy(A1 a1, A2 a2, A3 a3)
-    : scope(evaluator_type::name(), evaluator_type::op_count(a1, a2, a3)) {}
+    : scope(profile::Type_event<evaluator_type>::get(),
+            evaluator_type::op_count(a1, a2, a3)) {}
     
   scope_type scope;  
 };
@@ -143,7 +146,8 @@ struct Profile_policy<O, R(A1, A2, A3, A4), B>
   typedef profile::Scope<Profile_feature<O>::value> scope_type;
   typedef Evaluator<O, B, R(A1, A2, A3, A4)> evaluator_type;
   Profile_policy(A1 a1, A2 a2, A3 a3, A4 a4)
-    : scope(evaluator_type::name(), evaluator_type::op_count(a1, a2, a3, a4)) {}
+    : scope(profile::Type_event<evaluator_type>::get(),
+            evaluator_type::op_count(a1, a2, a3, a4)) {}
     
   scope_type scope;  
 };
@@ -156,7 +160,8 @@ struct Profile_policy<O, R(A1, A2, A3, A4, A5), B>
   typedef profile::Scope<Profile_feature<O>::value> scope_type;
   typedef Evaluator<O, B, R(A1, A2, A3, A4, A5)> evaluator_type;
   Profile_policy(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5)
-    : scope(evaluator_type::name(), evaluator_type::op_count(a1, a2, a3, a4, a5)) {}
+    : scope(profile::Type_event<evaluator_type>::get(),
+            evaluator_type::op_count(a1, a2, a3, a4, a5)) {}
     
   scope_type scope;  
 };
@@ -169,7 +174,8 @@ struct Profile_policy<O, R(A1, A2, A3, A4, A5, A6), B>
   typedef profile::Scope<Profile_feature<O>::value> scope_type;
   typedef Evaluator<O, B, R(A1, A2, A3, A4, A5, A6)> evaluator_type;
   Profile_policy(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6)
-    : scope(evaluator_type::name(), evaluator_type::op_count(a1, a2, a3, a4, a5, a6)) {}
+    : scope(profile::Type_event<evaluator_type>::get(),
+            evaluator_type::op_count(a1, a2, a3, a4, a5, a6)) {}
     
   scope_type scope;  
 };
@@ -14,8 +14,27 @@
   Included Files
 ***********************************************************************/
 
+#include <algorithm>
+
 #include <vsip/core/fft.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/core/extdata.hpp>
 #include <vsip/opt/expr/return_block.hpp>
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
+
+
+
+/// Size in bytes of the spectra computed for one batch of rows.
+///
+/// The fast convolution evaluators transform, weight and inverse
+/// transform a batch of rows at a time, which should fit in L2 along
+/// with the input and output rows.
+
+#ifndef VSIP_IMPL_FASTCONV_BATCH_SIZE
+#  define VSIP_IMPL_FASTCONV_BATCH_SIZE (128 * 1024)
+#endif
 
 
 
@@ -29,6 +48,367 @@ namespace vsip
 namespace impl
 {
 
+namespace fastconv_detail
+{
+
+/// Number of rows of COLS values of type T in one batch.
+
+template <typename T>
+inline length_type
+batch_rows(length_type cols)
+{
+  length_type rows = VSIP_IMPL_FASTCONV_BATCH_SIZE / (cols * sizeof(T));
+  return rows > 0 ? rows : 1;
+}
+
+
+
+// Multiply the spectra in TMP, of the rows starting at R0, by the
+// weights.
+
+template <typename T,
+	  typename Block0,
+	  typename Block1>
+inline void
+apply_weights(Matrix<T, Block0> tmp, Vector<T, Block1> w, index_type)
+{
+  for (index_type r=0; r<tmp.size(0); ++r)
+    tmp.row(r) *= w;
+}
+
+template <typename T,
+	  typename Block0,
+	  typename Block1>
+inline void
+apply_weights(Matrix<T, Block0> tmp, Matrix<T, Block1> w, index_type r0)
+{
+  tmp *= w(Domain<2>(Domain<1>(r0, 1, tmp.size(0)), tmp.size(1)));
+}
+
+
+
+// Direct access to the weights, with unit-stride rows.  A vector of
+// weights has a row stride of 0.
+
+template <typename ViewT>
+struct Weights_ext;
+
+template <typename T,
+	  typename BlockT>
+struct Weights_ext<Vector<T, BlockT> >
+{
+  typedef Layout<1, row1_type, Stride_unit, Cmplx_inter_fmt> layout_type;
+  static bool const ct_valid = Ext_data_cost<BlockT, layout_type>::value == 0;
+
+  Weights_ext(Vector<T, BlockT> w) : ext_(w.block()) {}
+
+  T const*    data()       { return ext_.data(); }
+  stride_type row_stride() { return 0; }
+
+  Ext_data<BlockT, layout_type> ext_;
+};
+
+template <typename T,
+	  typename BlockT>
+struct Weights_ext<Matrix<T, BlockT> >
+{
+  typedef Layout<2, row2_type, Stride_unit, Cmplx_inter_fmt> layout_type;
+  static bool const ct_valid = Ext_data_cost<BlockT, layout_type>::value == 0;
+
+  Weights_ext(Matrix<T, BlockT> w) : ext_(w.block()) {}
+
+  T const*    data()       { return ext_.data(); }
+  stride_type row_stride() { return ext_.stride(0); }
+
+  Ext_data<BlockT, layout_type> ext_;
+};
+
+
+
+// Check whether BACKEND accepts rows of interleaved complex values at
+// PTR, ROW_STRIDE apart, as its input (if INPUT) or output, without
+// copying them.
+
+template <typename BE,
+	  typename T>
+bool
+accepts(BE& backend, bool input, T const* ptr, stride_type row_stride)
+{
+  Rt_layout<2> rtl_in(stride_unit_dense, tuple<0, 1, 2>(), cmplx_inter_fmt, 0);
+  Rt_layout<2> rtl_out(rtl_in);
+  backend.query_layout(rtl_in, rtl_out);
+
+  Rt_layout<2>& rtl = input ? rtl_in : rtl_out;
+  if (rtl.complex != cmplx_inter_fmt || rtl.order.impl_dim0 != 0)
+    return false;
+  if (input && backend.requires_copy(rtl))
+    return false;
+  if (rtl.pack == stride_unit_align &&
+      (reinterpret_cast<size_t>(ptr) % rtl.align != 0 ||
+       (row_stride * sizeof(T)) % rtl.align != 0))
+    return false;
+  return true;
+}
+
+
+
+/// Fast convolution of the rows of a matrix, given direct access to
+/// the data, in batches of rows.
+///
+/// Each batch is transformed, weighted and inverse transformed into
+/// a private buffer with the FFTM backends.  If both backends are
+/// reentrant, the batches are distributed across the thread pool.
+
+template <typename T,
+	  typename Backend1T,
+	  typename Backend2T>
+class Direct_rows
+{
+  typedef typename Scalar_of<T>::type scalar_type;
+
+public:
+  Direct_rows(
+    Backend2T&  fwd_backend,
+    Backend1T&  inv_backend,
+    scalar_type scale,
+    length_type rows,
+    length_type cols,
+    T const*    in,  stride_type in_stride,
+    T const*    w,   stride_type w_stride,
+    T*          out, stride_type out_stride)
+  : fwd_backend_(fwd_backend),
+    inv_backend_(inv_backend),
+    scale_      (scale),
+    rows_       (rows),
+    cols_       (cols),
+    batch_      (std::min(rows, batch_rows<T>(cols))),
+    num_batches_((rows + batch_ - 1) / batch_),
+    num_tasks_  (1),
+    in_         (in),  in_stride_ (in_stride),
+    w_          (w),   w_stride_  (w_stride),
+    out_        (out), out_stride_(out_stride),
+    tmp_        (batch_ * cols)
+  {}
+
+  /// Check that the backends can work on the data directly.
+  bool valid()
+  {
+    return accepts(fwd_backend_, true,  in_,        in_stride_)  &&
+           accepts(fwd_backend_, false, tmp_.get(), cols_)       &&
+           accepts(inv_backend_, true,  tmp_.get(), cols_)       &&
+           accepts(inv_backend_, false, out_,       out_stride_);
+  }
+
+  void operator()()
+  {
+#if VSIP_IMPL_HAVE_THREAD_POOL
+    threads::Thread_pool* pool = threads::Thread_pool::instance();
+    if (pool && pool->num_workers() > 1 && num_batches_ > 1 &&
+	rows_ * cols_ >= pool->threshold() &&
+	fwd_backend_.reentrant() && inv_backend_.reentrant())
+    {
+      num_tasks_ = std::min(pool->num_workers(), num_batches_);
+      pool->parallel_for(task, this, num_tasks_);
+      return;
+    }
+#endif
+    apply(0, num_batches_, tmp_.get());
+  }
+
+private:
+  static void task(void* arg, index_type t)
+  {
+    Direct_rows* self = static_cast<Direct_rows*>(arg);
+    index_type first = t * self->num_batches_ / self->num_tasks_;
+    index_type last  = (t + 1) * self->num_batches_ / self->num_tasks_;
+
+    if (t == 0)
+      self->apply(first, last, self->tmp_.get());
+    else
+    {
+      aligned_array<T> tmp(self->batch_ * self->cols_);
+      self->apply(first, last, tmp.get());
+    }
+  }
+
+  // Process batches [FIRST, LAST), using TMP for the spectra.
+  void apply(index_type first, index_type last, T* tmp)
+  {
+    for (index_type b = first; b < last; ++b)
+    {
+      index_type  r0 = b * batch_;
+      length_type n  = std::min(batch_, rows_ - r0);
+
+      fwd_backend_.by_reference(const_cast<T*>(in_ + r0 * in_stride_),
+				in_stride_, 1,
+				tmp, cols_, 1,
+				n, cols_);
+
+      for (index_type r = 0; r < n; ++r)
+      {
+	T*       t  = tmp + r * cols_;
+	T const* wr = w_ + (r0 + r) * w_stride_;
+	if (scale_ == scalar_type(1))
+	  for (index_type c = 0; c < cols_; ++c)
+	    t[c] *= wr[c];
+	else
+	  for (index_type c = 0; c < cols_; ++c)
+	    t[c] *= scale_ * wr[c];
+      }
+
+      inv_backend_.by_reference(tmp, cols_, 1,
+				out_ + r0 * out_stride_, out_stride_, 1,
+				n, cols_);
+    }
+  }
+
+  Backend2T&       fwd_backend_;
+  Backend1T&       inv_backend_;
+  scalar_type      scale_;
+  length_type      rows_;
+  length_type      cols_;
+  length_type      batch_;
+  length_type      num_batches_;
+  length_type      num_tasks_;
+  T const*         in_;
+  stride_type      in_stride_;
+  T const*         w_;
+  stride_type      w_stride_;
+  T*               out_;
+  stride_type      out_stride_;
+  aligned_array<T> tmp_;
+};
+
+
+
+// Fast convolution through direct data access, if the blocks support
+// it (Valid).  exec() returns false if the data cannot be used
+// directly.
+
+template <bool Valid>
+struct Fastconv_direct
+{
+  template <typename T,
+	    typename InBlockT,
+	    typename WViewT,
+	    typename OutBlockT,
+	    typename Backend1T,
+	    typename Workspace1T,
+	    typename Backend2T,
+	    typename Workspace2T>
+  static bool exec(Matrix<T, InBlockT>, WViewT, Matrix<T, OutBlockT>,
+		   Backend2T&, Workspace2T const&,
+		   Backend1T&, Workspace1T const&)
+  { return false; }
+};
+
+template <>
+struct Fastconv_direct<true>
+{
+  template <typename T,
+	    typename InBlockT,
+	    typename WViewT,
+	    typename OutBlockT,
+	    typename Backend1T,
+	    typename Workspace1T,
+	    typename Backend2T,
+	    typename Workspace2T>
+  static bool exec(
+    Matrix<T, InBlockT>  in,
+    WViewT               w,
+    Matrix<T, OutBlockT> out,
+    Backend2T&           fwd_backend,
+    Workspace2T const&   fwd_workspace,
+    Backend1T&           inv_backend,
+    Workspace1T const&   inv_workspace)
+  {
+    typedef typename Scalar_of<T>::type scalar_type;
+    typedef Layout<2, row2_type, Stride_unit, Cmplx_inter_fmt> layout_type;
+
+    // Scaling not done by the backends is folded into the weights.
+    scalar_type scale = scalar_type(1);
+    if (!fwd_backend.supports_scale()) scale *= fwd_workspace.scale();
+    if (!inv_backend.supports_scale()) scale *= inv_workspace.scale();
+
+    Ext_data<InBlockT,  layout_type> in_ext (in.block(),  SYNC_IN);
+    Ext_data<OutBlockT, layout_type> out_ext(out.block(), SYNC_OUT);
+    Weights_ext<WViewT>              w_ext  (w);
+
+    Direct_rows<T, Backend1T, Backend2T> rows(
+      fwd_backend, inv_backend, scale,
+      out.size(0), out.size(1),
+      in_ext.data(),  in_ext.stride(0),
+      w_ext.data(),   w_ext.row_stride(),
+      out_ext.data(), out_ext.stride(0));
+
+    if (!rows.valid())
+      return false;
+    rows();
+    return true;
+  }
+};
+
+
+
+/// Fast convolution of the rows of IN into OUT:
+///
+///   out.row(r) = inv_fft(w.row(r) * fwd_fft(in.row(r)))
+///
+/// where W is a matrix of weights, or a vector of weights common to
+/// all rows.  Rows are processed in batches, so that each batch is
+/// still in cache when it is weighted and inverse transformed.
+
+template <typename T,
+	  typename InBlockT,
+	  typename WViewT,
+	  typename OutBlockT,
+	  typename Backend1T,
+	  typename Workspace1T,
+	  typename Backend2T,
+	  typename Workspace2T>
+void
+fastconv_rows(
+  Matrix<T, InBlockT>  in,
+  WViewT               w,
+  Matrix<T, OutBlockT> out,
+  Backend2T&           fwd_backend,
+  Workspace2T const&   fwd_workspace,
+  Backend1T&           inv_backend,
+  Workspace1T const&   inv_workspace)
+{
+  typedef Layout<2, row2_type, Stride_unit, Cmplx_inter_fmt> layout_type;
+  static bool const direct =
+    Ext_data_cost<InBlockT,  layout_type>::value == 0 &&
+    Ext_data_cost<OutBlockT, layout_type>::value == 0 &&
+    Weights_ext<WViewT>::ct_valid;
+
+  if (out.size(0) == 0)
+    return;
+
+  if (Fastconv_direct<direct>::exec(in, w, out,
+				    fwd_backend, fwd_workspace,
+				    inv_backend, inv_workspace))
+    return;
+
+  length_type rows  = out.size(0);
+  length_type cols  = out.size(1);
+  length_type batch = std::min(rows, batch_rows<T>(cols));
+  Matrix<T> tmp(batch, cols, temporary_map());
+
+  for (index_type r=0; r<rows; r+=batch)
+  {
+    length_type n = std::min(batch, rows - r);
+    Domain<2>   dom(Domain<1>(r, 1, n), cols);
+    Domain<2>   tmp_dom(n, cols);
+
+    fwd_workspace.by_reference(&fwd_backend, in(dom), tmp(tmp_dom));
+    apply_weights(tmp(tmp_dom), w, r);
+    inv_workspace.by_reference(&inv_backend, tmp(tmp_dom), out(dom));
+  }
+}
+
+} // namespace vsip::impl::fastconv_detail
+
 /// Evaluator for return expression block.
 
 template <typename       DstBlock,
@@ -107,10 +487,6 @@ struct Serial_expr_evaluator<2, DstBlock,
   
   static void exec(DstBlock& dst, SrcBlock const& src)
   {
-    length_type rows = dst.size(2, 0);
-    length_type cols = dst.size(2, 1);
-    Matrix<T> tmp(1, cols);
-
     Vector<T, VecBlockT> w  (
       const_cast<VecBlockT&>(src.functor().block().get_vblk()));
     Matrix<T, MatBlockT> in (
@@ -126,16 +502,9 @@ struct Serial_expr_evaluator<2, DstBlock,
     Workspace1T const& inv_workspace(src.functor().workspace());
     Backend1T&         inv_backend  (const_cast<Backend1T&>(src.functor().backend()));
 
-    for (index_type r=0; r<rows; ++r)
-    {
-      fwd_workspace.by_reference(&fwd_backend,
-				 in (Domain<2>(Domain<1>(r, 1, 1), cols)),
-				 tmp(Domain<2>(Domain<1>(0, 1, 1), cols)) );
-      tmp.row(0) *= w;
-      inv_workspace.by_reference(&inv_backend,
-				 tmp(Domain<2>(Domain<1>(0, 1, 1), cols)),
-				 out(Domain<2>(Domain<1>(r, 1, 1), cols)) );
-    }
+    fastconv_detail::fastconv_rows(in, w, out,
+				   fwd_backend, fwd_workspace,
+				   inv_backend, inv_workspace);
   }
 };
 
@@ -198,10 +567,6 @@ struct Serial_expr_evaluator<2, DstBlock,
   
   static void exec(DstBlock& dst, SrcBlock const& src)
   {
-    length_type rows = dst.size(2, 0);
-    length_type cols = dst.size(2, 1);
-    Matrix<T> tmp(1, cols);
-
     Matrix<T, CoeffsMatBlockT> w 
       (const_cast<CoeffsMatBlockT&>(src.functor().block().left()));
     Matrix<T, MatBlockT> in 
@@ -217,16 +582,9 @@ struct Serial_expr_evaluator<2, DstBlock,
     Workspace1T const& inv_workspace(src.functor().workspace());
     Backend1T&         inv_backend  (const_cast<Backend1T&>(src.functor().backend()));
 
-    for (index_type r=0; r<rows; ++r)
-    {
-      fwd_workspace.by_reference(&fwd_backend,
-				 in (Domain<2>(Domain<1>(r, 1, 1), cols)),
-				 tmp(Domain<2>(Domain<1>(0, 1, 1), cols)) );
-      tmp.row(0) *= w.row(r);
-      inv_workspace.by_reference(&inv_backend,
-				 tmp(Domain<2>(Domain<1>(0, 1, 1), cols)),
-				 out(Domain<2>(Domain<1>(r, 1, 1), cols)) );
-    }
+    fastconv_detail::fastconv_rows(in, w, out,
+				   fwd_backend, fwd_workspace,
+				   inv_backend, inv_workspace);
   }
 };
 
@@ -289,10 +647,6 @@ struct Serial_expr_evaluator<2, DstBlock,
   
   static void exec(DstBlock& dst, SrcBlock const& src)
   {
-    length_type rows = dst.size(2, 0);
-    length_type cols = dst.size(2, 1);
-    Matrix<T> tmp(1, cols);
-
     Matrix<T, CoeffsMatBlockT> w 
       (const_cast<CoeffsMatBlockT&>(src.functor().block().right()));
     Matrix<T, MatBlockT> in 
@@ -308,16 +662,9 @@ struct Serial_expr_evaluator<2, DstBlock,
     Workspace1T const& inv_workspace(src.functor().workspace());
     Backend1T&         inv_backend  (const_cast<Backend1T&>(src.functor().backend()));
 
-    for (index_type r=0; r<rows; ++r)
-    {
-      fwd_workspace.by_reference(&fwd_backend,
-				 in (Domain<2>(Domain<1>(r, 1, 1), cols)),
-				 tmp(Domain<2>(Domain<1>(0, 1, 1), cols)) );
-      tmp.row(0) *= w.row(r);
-      inv_workspace.by_reference(&inv_backend,
-				 tmp(Domain<2>(Domain<1>(0, 1, 1), cols)),
-				 out(Domain<2>(Domain<1>(r, 1, 1), cols)) );
-    }
+    fastconv_detail::fastconv_rows(in, w, out,
+				   fwd_backend, fwd_workspace,
+				   inv_backend, inv_workspace);
   }
 };
 
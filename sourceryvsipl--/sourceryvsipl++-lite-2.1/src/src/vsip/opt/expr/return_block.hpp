@@ -23,6 +23,7 @@
 #include <vsip/core/block_traits.hpp>
 #include <vsip/core/view_traits.hpp>
 #include <vsip/core/domain_utils.hpp>
+#include <vsip/core/parallel/local_map.hpp>
 
 
 
@@ -106,7 +107,7 @@ public:
 
   void loop_fusion_init()
   {
-    block_.reset(new block_type(block_domain<Dim>(*this)));
+    block_.reset(new block_type(block_domain<Dim>(*this), temporary_map()));
     rf_.apply(*(block_.get()));
   }
 
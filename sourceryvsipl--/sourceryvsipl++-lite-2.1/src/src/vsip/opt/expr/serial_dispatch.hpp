@@ -52,6 +52,10 @@
 #ifdef VSIP_IMPL_HAVE_SIMD_LOOP_FUSION
 #  include <vsip/opt/simd/expr_evaluator.hpp>
 #endif
+#if defined(VSIP_IMPL_HAVE_SIMD_LOOP_FUSION) && \
+    defined(VSIP_IMPL_HAVE_THREAD_POOL)
+#  include <vsip/opt/simd/eval_threaded.hpp>
+#endif
 #ifdef VSIP_IMPL_HAVE_SIMD_UNALIGNED_LOOP_FUSION
 #  include <vsip/opt/simd/eval_unaligned.hpp>
 #endif
@@ -80,7 +84,7 @@ struct Eval_profile_policy
   template <typename DstBlock,
 	    typename SrcBlock>
   Eval_profile_policy(DstBlock const&, SrcBlock const& src)
-    : scope_(Expr_op_name<EvalExpr, SrcBlock>::tag(src), 
+    : scope_(event(src),
              Expr_ops_per_point<SrcBlock>::value == 0
              // If ops_per_point is 0, then assume that operations
              // is a copy and record the number of bytes written.
@@ -92,6 +96,34 @@ struct Eval_profile_policy
   {}
 
 private:
+  // Return the interned tag of SRC, or 0 if the profiler is off.
+  // Tags of one evaluator and block type differ only in the size of
+  // SRC, so the last one is remembered by each thread.
+  template <typename SrcBlock>
+  static profile::event_id_type event(SrcBlock const& src)
+  {
+    if (profile::prof->mode() == profile::pm_none)
+      return 0;
+#ifdef VSIP_IMPL_THREAD_LOCAL
+    dimension_type const dim = SrcBlock::dim;
+    static VSIP_IMPL_THREAD_LOCAL profile::event_id_type id = 0;
+    static VSIP_IMPL_THREAD_LOCAL length_type size[3];
+    length_type s0 = src.size(dim, 0);
+    length_type s1 = dim > 1 ? src.size(dim, 1) : 1;
+    length_type s2 = dim > 2 ? src.size(dim, 2) : 1;
+    if (id == 0 || size[0] != s0 || size[1] != s1 || size[2] != s2)
+    {
+      id = profile::prof->intern(Expr_op_name<EvalExpr, SrcBlock>::tag(src));
+      size[0] = s0;
+      size[1] = s1;
+      size[2] = s2;
+    }
+    return id;
+#else
+    return profile::prof->intern(Expr_op_name<EvalExpr, SrcBlock>::tag(src));
+#endif
+  }
+
   scope_type scope_;
 };
 
@@ -107,7 +139,7 @@ struct Eval_lw_profile_policy
   template <typename DstBlock,
 	    typename SrcBlock>
   Eval_lw_profile_policy(DstBlock const&, SrcBlock const& src)
-    : scope_(EvalExpr::name(),
+    : scope_(profile::Type_event<EvalExpr>::get(),
              Expr_ops_per_point<SrcBlock>::value == 0
              // If ops_per_point is 0, then assume that operations
              // is a copy and record the number of bytes written.
@@ -52,6 +52,7 @@ typedef Make_type_list<Intel_ipp_tag,
 #endif
 		       Copy_tag,
 		       Op_expr_tag,
+		       Simd_threaded_loop_fusion_tag,
 		       Simd_loop_fusion_tag,
 		       Simd_unaligned_loop_fusion_tag,
 		       Fc_expr_tag,
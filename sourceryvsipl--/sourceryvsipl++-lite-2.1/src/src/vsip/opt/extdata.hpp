@@ -261,7 +261,11 @@ public:
 
   typedef Layout<dim, order_type, pack_type, complex_type> actual_layout_type;
 
-  typedef Allocated_storage<complex_type, value_type> storage_type;
+  typedef Temporary_allocator<
+            typename Storage<complex_type, value_type>::alloc_type>
+                                                      alloc_type;
+  typedef Allocated_storage<complex_type, value_type, alloc_type>
+                                                      storage_type;
   typedef typename storage_type::type                 raw_ptr_type;
   typedef typename storage_type::const_type           const_raw_ptr_type;
 
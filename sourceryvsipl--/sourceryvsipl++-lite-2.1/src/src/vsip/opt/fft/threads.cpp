@@ -0,0 +1,115 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/fft/threads.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Number of threads used by FFT backends.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+#include <vsip/opt/fft/threads.hpp>
+#include <vsip/core/argv_utils.hpp>
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace fft
+{
+
+namespace
+{
+
+length_type default_threads  = 1;
+length_type default_min_size = 32768;
+
+// Count of the innermost active Threads_hint of each thread, or 0.
+// Without thread-local storage the hints are shared by all threads.
+#ifdef VSIP_IMPL_THREAD_LOCAL
+VSIP_IMPL_THREAD_LOCAL length_type hint_threads = 0;
+#else
+length_type hint_threads = 0;
+#endif
+
+length_type
+online_processors()
+{
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  return ncpu > 0 ? static_cast<length_type>(ncpu) : 1;
+}
+
+} // namespace vsip::impl::fft::<unnamed>
+
+
+
+void
+initialize_threads(int& argc, char**& argv)
+{
+  length_type num_threads = 1;
+  length_type min_size    = 32768;
+
+  for (int i=1; i<argc; )
+  {
+    if (!strcmp(argv[i], "--svpp-fft-threads") && i+1 < argc)
+    {
+      int n = atoi(argv[i+1]);
+      num_threads = n > 0 ? static_cast<length_type>(n) : online_processors();
+      shift_argv(argc, argv, i, 2);
+    }
+    else if (!strcmp(argv[i], "--svpp-fft-threads-min") && i+1 < argc)
+    {
+      int n = atoi(argv[i+1]);
+      min_size = n > 0 ? static_cast<length_type>(n) : 0;
+      shift_argv(argc, argv, i, 2);
+    }
+    else
+      ++i;
+  }
+
+  set_threads(num_threads, min_size);
+}
+
+void
+set_threads(length_type num_threads, length_type min_size)
+{
+  default_threads  = num_threads > 0 ? num_threads : 1;
+  default_min_size = min_size;
+}
+
+length_type
+num_threads(length_type size)
+{
+  if (hint_threads)
+    return hint_threads;
+  return size >= default_min_size ? default_threads : 1;
+}
+
+
+
+Threads_hint::Threads_hint(length_type num_threads)
+  : prev_(hint_threads)
+{
+  hint_threads = num_threads > 0 ? num_threads : online_processors();
+}
+
+Threads_hint::~Threads_hint()
+{
+  hint_threads = prev_;
+}
+
+} // namespace vsip::impl::fft
+} // namespace vsip::impl
+} // namespace vsip
@@ -0,0 +1,85 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/fft/threads.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Number of threads used by FFT backends.
+*/
+
+#ifndef VSIP_OPT_FFT_THREADS_HPP
+#define VSIP_OPT_FFT_THREADS_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/support.hpp>
+#include <vsip/core/noncopyable.hpp>
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace fft
+{
+
+/// Process the FFT threading options of the command line:
+///
+///   --svpp-fft-threads N      number of threads used by one large
+///                             FFT or FFTM (default: 1, 0 for one per
+///                             online processor).
+///   --svpp-fft-threads-min N  minimum number of points for an FFT or
+///                             FFTM to be large (default: 32768).
+///
+/// The count applies to FFT objects created afterwards.  Backends
+/// that cannot use threads ignore it.
+void initialize_threads(int& argc, char**& argv);
+
+/// Set the library-wide thread count and size threshold.
+void set_threads(length_type num_threads, length_type min_size);
+
+/// Number of threads for an FFT or FFTM of SIZE points that is created
+/// by the calling thread.
+length_type num_threads(length_type size);
+
+
+
+/// Per-object thread count.
+///
+/// FFT and FFTM objects created by the calling thread while a
+/// Threads_hint is active use NUM_THREADS threads (0 for one per
+/// online processor), whatever their size.  Hints nest.
+///
+/// Typical usage:
+/// \code
+/// {
+///   Threads_hint hint(8);
+///   fftm_type fftm(Domain<2>(4096, 8192), 1.f);
+/// }
+/// \endcode
+
+class Threads_hint : Non_copyable
+{
+public:
+  explicit Threads_hint(length_type num_threads);
+  ~Threads_hint();
+
+private:
+  length_type prev_;
+};
+
+} // namespace vsip::impl::fft
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_FFT_THREADS_HPP
@@ -94,11 +94,12 @@ struct Create_plan<vsip::impl::Cmplx_inter_fmt>
             typename T, dimension_type Dim>
   static PlanT
   create(std::complex<T>* ptr1, std::complex<T>* ptr2,
-         int exp, int flags, Domain<Dim> const& size)
+         int exp, int flags, int nthreads,
+         Domain<Dim> const& size)
   {
     int sz[Dim];
     for(dimension_type i=0;i<Dim;i++) sz[i] = size[i].size();
-    return create_fftw_plan(Dim, sz, ptr1,ptr2,exp,flags);
+    return create_fftw_plan(Dim, sz, ptr1,ptr2,exp,flags,nthreads);
   }
 
   // create function for real -> complex
@@ -106,12 +107,13 @@ struct Create_plan<vsip::impl::Cmplx_inter_fmt>
             typename T, dimension_type Dim>
   static PlanT
   create(T* ptr1, std::complex<T>* ptr2,
-         int A, int flags, Domain<Dim> const& size)
+         int A, int flags, int nthreads,
+         Domain<Dim> const& size)
   {
     int sz[Dim];
     for(dimension_type i=0;i<Dim;i++) sz[i] = size[i].size();
     if(A != Dim-1) std::swap(sz[A], sz[Dim-1]);
-    return create_fftw_plan(Dim,sz,ptr1,ptr2,flags);
+    return create_fftw_plan(Dim,sz,ptr1,ptr2,flags,nthreads);
   }
 
   // create function for complex -> real
@@ -119,12 +121,13 @@ struct Create_plan<vsip::impl::Cmplx_inter_fmt>
             typename T, dimension_type Dim>
   static PlanT
   create(std::complex<T>* ptr1, T* ptr2,
-         int A, int flags, Domain<Dim> const& size)
+         int A, int flags, int nthreads,
+         Domain<Dim> const& size)
   {
     int sz[Dim];
     for(dimension_type i=0;i<Dim;i++) sz[i] = size[i].size();
     if(A != Dim-1) std::swap(sz[A], sz[Dim-1]);
-    return create_fftw_plan(Dim,sz,ptr1,ptr2,flags);
+    return create_fftw_plan(Dim,sz,ptr1,ptr2,flags,nthreads);
   }
 
   static rt_complex_type const format = cmplx_inter_fmt;  
@@ -141,7 +144,8 @@ struct Create_plan<vsip::impl::Cmplx_split_fmt>
             typename T, dimension_type Dim>
   static PlanT
   create(std::pair<T*,T*> ptr1, std::pair<T*,T*> ptr2,
-         int /*exp*/, int flags, Domain<Dim> const& size)
+         int /*exp*/, int flags, int nthreads,
+         Domain<Dim> const& size)
   {
     IodimT iodims[Dim];
 
@@ -156,7 +160,7 @@ struct Create_plan<vsip::impl::Cmplx_split_fmt>
       iodims[i].is = iodims[i].os = app_layout.stride(i);
     }
 
-    return create_fftw_plan(Dim, iodims, ptr1,ptr2, flags);
+    return create_fftw_plan(Dim, iodims, ptr1,ptr2, flags, nthreads);
 
   }
 
@@ -165,7 +169,8 @@ struct Create_plan<vsip::impl::Cmplx_split_fmt>
             typename T, dimension_type Dim>
   static PlanT
   create(T *ptr1, std::pair<T*, T*> ptr2, 
-         int A, int flags, Domain<Dim> const& size)
+         int A, int flags, int nthreads,
+         Domain<Dim> const& size)
   {
     IodimT iodims[Dim];
 
@@ -182,7 +187,7 @@ struct Create_plan<vsip::impl::Cmplx_split_fmt>
       iodims[i].is = iodims[i].os = app_layout.stride(i); 
     }
 
-    return create_fftw_plan(Dim, iodims, ptr1,ptr2, flags);
+    return create_fftw_plan(Dim, iodims, ptr1,ptr2, flags, nthreads);
   }
 
   // create for complex -> real
@@ -190,7 +195,8 @@ struct Create_plan<vsip::impl::Cmplx_split_fmt>
             typename T, dimension_type Dim>
   static PlanT
   create(std::pair<T*,T*> ptr1, T* ptr2,
-         int A, int flags, Domain<Dim> const& size)
+         int A, int flags, int nthreads,
+         Domain<Dim> const& size)
   {
     IodimT iodims[Dim];
 
@@ -207,7 +213,7 @@ struct Create_plan<vsip::impl::Cmplx_split_fmt>
       iodims[i].is = iodims[i].os = app_layout.stride(i);
     }
 
-    return create_fftw_plan(Dim, iodims, ptr1,ptr2, flags);
+    return create_fftw_plan(Dim, iodims, ptr1,ptr2, flags, nthreads);
   }
 
   static rt_complex_type const format = cmplx_split_fmt;  
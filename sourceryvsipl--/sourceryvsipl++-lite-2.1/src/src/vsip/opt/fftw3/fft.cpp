@@ -15,8 +15,22 @@
   Included Files
 ***********************************************************************/
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
 #include <vsip/core/config.hpp>
 #include <vsip/support.hpp>
+#include <vsip/core/argv_utils.hpp>
+#include <vsip/opt/fftw3/wisdom.hpp>
+#include <vsip/opt/fft/threads.hpp>
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
 #include <fftw3.h>
 
 // We need to include this create_plan.hpp header file because fft_impl.cpp
@@ -35,16 +49,136 @@ namespace impl
 namespace fftw3
 {
 
+namespace
+{
+planning_effort effort = effort_hint;
+std::string     wisdom_file;
+}
+
 inline int
 convert_NoT(unsigned int number)
 {
   // a number value of '0' means 'infinity', and so is captured
   // by a wrap-around.
-  if (number - 1 > 30) return FFTW_PATIENT;
-  if (number - 1 > 10) return FFTW_MEASURE;
-  return FFTW_ESTIMATE;
+  int hint = FFTW_ESTIMATE;
+  if (number - 1 > 30) hint = FFTW_PATIENT;
+  else if (number - 1 > 10) hint = FFTW_MEASURE;
+
+  switch (effort)
+  {
+  case effort_estimate:   return FFTW_ESTIMATE;
+  case effort_measure:    return FFTW_MEASURE;
+  case effort_patient:    return FFTW_PATIENT;
+  case effort_exhaustive: return FFTW_EXHAUSTIVE;
+  case effort_wisdom:
+    return hint == FFTW_ESTIMATE ? hint : hint | FFTW_WISDOM_ONLY;
+  default:                return hint;
+  }
+}
+
+// Number of threads used by the plan of an FFT of SIZE points.
+inline int
+plan_threads(length_type size)
+{
+#if VSIP_IMPL_FFTW3_HAVE_THREADS
+  return static_cast<int>(fft::num_threads(size));
+#else
+  (void)size;
+  return 1;
+#endif
+}
+
+// Number of threads used by the single-row plan of an FFTM of
+// N_FFT rows of SIZE points.  If there are enough rows to keep the
+// worker pool busy, the rows are split across it instead.
+inline int
+fftm_plan_threads(length_type n_fft, length_type size)
+{
+  int nthreads = plan_threads(n_fft * size);
+#if VSIP_IMPL_HAVE_THREAD_POOL
+  if (n_fft >= static_cast<length_type>(nthreads))
+    return 1;
+#endif
+  return nthreads;
 }
 
+// Number of threads across which the rows of such an FFTM are split.
+inline length_type
+fftm_row_threads(length_type n_fft, length_type size, int plan_nthreads)
+{
+#if VSIP_IMPL_HAVE_THREAD_POOL
+  if (plan_nthreads == 1)
+    return fft::num_threads(n_fft * size);
+#else
+  (void)n_fft; (void)size; (void)plan_nthreads;
+#endif
+  return 1;
+}
+
+// Apply a single-row plan to N_FFT rows, with a contiguous block of
+// rows per thread.  EXECUTE is one of FFTW's new-array execute
+// functions, which may be called concurrently with the same plan.
+
+template <typename P, typename I, typename O>
+class Fftm_rows
+{
+public:
+  typedef void (*execute_type)(P, I*, O*);
+
+  Fftm_rows(execute_type execute, P plan,
+	    I* in,  stride_type in_stride,
+	    O* out, stride_type out_stride)
+    : execute_(execute), plan_(plan),
+      in_(in), in_stride_(in_stride),
+      out_(out), out_stride_(out_stride)
+  {}
+
+  void operator()(length_type n_fft, length_type num_threads)
+  {
+    n_fft_ = n_fft;
+#if VSIP_IMPL_HAVE_THREAD_POOL
+    num_tasks_ = std::min(num_threads, n_fft);
+    if (num_tasks_ > 1)
+    {
+      threads::Thread_pool::instance()->parallel_for(task, this, num_tasks_);
+      return;
+    }
+#else
+    (void)num_threads;
+#endif
+    apply(0, n_fft);
+  }
+
+private:
+  static void task(void* arg, index_type t)
+  {
+    Fftm_rows* self = static_cast<Fftm_rows*>(arg);
+    self->apply(t * self->n_fft_ / self->num_tasks_,
+		(t + 1) * self->n_fft_ / self->num_tasks_);
+  }
+
+  void apply(index_type first, index_type last)
+  {
+    I* in  = in_  + first * in_stride_;
+    O* out = out_ + first * out_stride_;
+    for (index_type i = first; i != last; ++i)
+    {
+      execute_(plan_, in, out);
+      in  += in_stride_;
+      out += out_stride_;
+    }
+  }
+
+  execute_type execute_;
+  P            plan_;
+  I*           in_;
+  stride_type  in_stride_;
+  O*           out_;
+  stride_type  out_stride_;
+  length_type  n_fft_;
+  length_type  num_tasks_;
+};
+
 template <dimension_type D, typename I, typename O> struct Fft_base;
 template <dimension_type D, typename I, typename O, int A, int E> class Fft_impl;
 template <typename I, typename O, int A, int E> class Fftm_impl;
@@ -74,3 +208,257 @@ template <typename I, typename O, int A, int E> class Fftm_impl;
 #  undef SCALAR_TYPE
 #  undef FFTW
 #endif
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace fftw3
+{
+
+namespace
+{
+
+// Wisdom of one precision, as loaded from or last saved to the
+// store.  It is saved again only if it has changed.
+
+struct Wisdom
+{
+  char const* suffix;
+  std::string saved;
+};
+
+#define VSIP_IMPL_DCL_WISDOM(fT)					\
+Wisdom fT##_wisdom = { "." #fT, std::string() };			\
+									\
+std::string								\
+fT##_export()								\
+{									\
+  Planner_lock lock;							\
+  char* str = fT##_export_wisdom_to_string();				\
+  std::string wisdom = str ? str : "";					\
+  fT##_free(str);							\
+  return wisdom;							\
+}									\
+									\
+bool									\
+fT##_import(std::string const& file)					\
+{									\
+  FILE* fp = fopen((file + fT##_wisdom.suffix).c_str(), "r");		\
+  if (!fp) return false;						\
+  int ok;								\
+  {									\
+    Planner_lock lock;							\
+    ok = fT##_import_wisdom_from_file(fp);				\
+  }									\
+  fclose(fp);								\
+  if (!ok)								\
+    std::cerr << "WARNING: could not read FFTW wisdom from '"		\
+	      << file << fT##_wisdom.suffix << "'\n";			\
+  return ok;								\
+}									\
+									\
+bool									\
+fT##_save(std::string const& file)					\
+{									\
+  /* Merge with wisdom saved meanwhile by other processes. */		\
+  fT##_import(file);							\
+  std::string wisdom = fT##_export();					\
+  if (wisdom == fT##_wisdom.saved) return true;				\
+  if (!write_file(file + fT##_wisdom.suffix, wisdom)) return false;	\
+  fT##_wisdom.saved = wisdom;						\
+  return true;								\
+}
+
+// Replace FILE by CONTENTS.  The new contents are written to a
+// temporary file first, so that readers never see a partial store.
+
+bool
+write_file(std::string const& file, std::string const& contents)
+{
+  char pid[32];
+  sprintf(pid, ".%d", int(getpid()));
+  std::string tmp = file + pid;
+
+  FILE* fp = fopen(tmp.c_str(), "w");
+  bool ok = fp && fwrite(contents.data(), 1, contents.size(), fp)
+    == contents.size();
+  if (fp && fclose(fp) != 0) ok = false;
+  if (ok && rename(tmp.c_str(), file.c_str()) != 0) ok = false;
+  if (!ok)
+  {
+    std::cerr << "WARNING: could not write FFTW wisdom to '" << file << "'\n";
+    remove(tmp.c_str());
+  }
+  return ok;
+}
+
+#ifdef VSIP_IMPL_FFTW3_HAVE_FLOAT
+VSIP_IMPL_DCL_WISDOM(fftwf)
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_DOUBLE
+VSIP_IMPL_DCL_WISDOM(fftw)
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_LONG_DOUBLE
+VSIP_IMPL_DCL_WISDOM(fftwl)
+#endif
+
+#undef VSIP_IMPL_DCL_WISDOM
+
+} // namespace vsip::impl::fftw3::<unnamed>
+
+
+
+void
+initialize(int& argc, char**& argv)
+{
+#if VSIP_IMPL_FFTW3_HAVE_THREADS
+  // Threads must be initialized before the first plan is created.
+  // They are never cleaned up, as that would invalidate live plans.
+  static bool threads_initialized = false;
+  if (!threads_initialized)
+  {
+#ifdef VSIP_IMPL_FFTW3_HAVE_FLOAT
+    fftwf_init_threads();
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_DOUBLE
+    fftw_init_threads();
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_LONG_DOUBLE
+    fftwl_init_threads();
+#endif
+    threads_initialized = true;
+  }
+#endif
+
+  for (int i=1; i<argc; )
+  {
+    if (!strcmp(argv[i], "--svpp-fftw-wisdom") && i+1 < argc)
+    {
+      wisdom_file = argv[i+1];
+      shift_argv(argc, argv, i, 2);
+    }
+    else if (!strcmp(argv[i], "--svpp-fftw-effort") && i+1 < argc)
+    {
+      char const* name = argv[i+1];
+      if      (!strcmp(name, "hint"))       effort = effort_hint;
+      else if (!strcmp(name, "estimate"))   effort = effort_estimate;
+      else if (!strcmp(name, "measure"))    effort = effort_measure;
+      else if (!strcmp(name, "patient"))    effort = effort_patient;
+      else if (!strcmp(name, "exhaustive")) effort = effort_exhaustive;
+      else if (!strcmp(name, "wisdom"))     effort = effort_wisdom;
+      else
+	std::cerr << "WARNING: unknown FFTW planning effort '" << name
+		  << "'\n";
+      shift_argv(argc, argv, i, 2);
+    }
+    else if (!strcmp(argv[i], "--svpp-fftw-timelimit") && i+1 < argc)
+    {
+      double seconds = atof(argv[i+1]);
+      if (seconds <= 0) seconds = FFTW_NO_TIMELIMIT;
+#ifdef VSIP_IMPL_FFTW3_HAVE_FLOAT
+      fftwf_set_timelimit(seconds);
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_DOUBLE
+      fftw_set_timelimit(seconds);
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_LONG_DOUBLE
+      fftwl_set_timelimit(seconds);
+#endif
+      shift_argv(argc, argv, i, 2);
+    }
+    else
+      ++i;
+  }
+
+  if (!wisdom_file.empty())
+    import_wisdom(wisdom_file.c_str());
+}
+
+void
+finalize()
+{
+  if (!wisdom_file.empty())
+    export_wisdom(wisdom_file.c_str());
+  wisdom_file.clear();
+  effort = effort_hint;
+}
+
+
+
+void
+set_planning_effort(planning_effort e)
+{
+  effort = e;
+}
+
+planning_effort
+get_planning_effort()
+{
+  return effort;
+}
+
+
+
+bool
+import_wisdom(char const* file)
+{
+  bool ok = false;
+#ifdef VSIP_IMPL_FFTW3_HAVE_FLOAT
+  if (fftwf_import(file)) ok = true;
+  fftwf_wisdom.saved = fftwf_export();
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_DOUBLE
+  if (fftw_import(file)) ok = true;
+  fftw_wisdom.saved = fftw_export();
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_LONG_DOUBLE
+  if (fftwl_import(file)) ok = true;
+  fftwl_wisdom.saved = fftwl_export();
+#endif
+  return ok;
+}
+
+bool
+export_wisdom(char const* file)
+{
+  bool ok = true;
+#ifdef VSIP_IMPL_FFTW3_HAVE_FLOAT
+  if (!fftwf_save(file)) ok = false;
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_DOUBLE
+  if (!fftw_save(file)) ok = false;
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_LONG_DOUBLE
+  if (!fftwl_save(file)) ok = false;
+#endif
+  return ok;
+}
+
+void
+forget_wisdom()
+{
+  Planner_lock lock;
+#ifdef VSIP_IMPL_FFTW3_HAVE_FLOAT
+  fftwf_forget_wisdom();
+  fftwf_wisdom.saved.clear();
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_DOUBLE
+  fftw_forget_wisdom();
+  fftw_wisdom.saved.clear();
+#endif
+#ifdef VSIP_IMPL_FFTW3_HAVE_LONG_DOUBLE
+  fftwl_forget_wisdom();
+  fftwl_wisdom.saved.clear();
+#endif
+}
+
+} // namespace vsip::impl::fftw3
+} // namespace vsip::impl
+} // namespace vsip
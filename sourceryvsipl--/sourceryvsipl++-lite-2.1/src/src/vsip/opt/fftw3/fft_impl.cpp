@@ -68,14 +68,19 @@ typedef vsip::impl::dense_complex_type fftw3_complex_type;
 typedef Cmplx_inter_fmt fftw3_complex_type;
 #endif
 
+// NTHREADS is the number of threads used by the plans, or 0 to
+// choose it from the size of the transform.
+
 template <dimension_type D>
 struct Fft_base<D, std::complex<SCALAR_TYPE>, std::complex<SCALAR_TYPE> >
 {
-  Fft_base(Domain<D> const& dom, int exp, int flags, bool aligned = false)
+  Fft_base(Domain<D> const& dom, int exp, int flags, bool aligned = false,
+	   int nthreads = 0)
     VSIP_THROW((std::bad_alloc))
       : in_buffer_(dom.size()),
 	out_buffer_(dom.size()),
-        aligned_(aligned)
+        aligned_(aligned),
+        nthreads_(nthreads ? nthreads : plan_threads(dom.size()))
   {
     if (!aligned) flags |= FFTW_UNALIGNED;
     // For multi-dimensional transforms, these plans assume both
@@ -86,24 +91,24 @@ struct Fft_base<D, std::complex<SCALAR_TYPE>, std::complex<SCALAR_TYPE> >
     plan_in_place_ =
       Create_plan<fftw3_complex_type>
         ::create<FFTW(plan), FFTW(iodim)>
-        (in_buffer_.ptr(), in_buffer_.ptr(), exp, flags, dom);
+        (in_buffer_.ptr(), in_buffer_.ptr(), exp, flags, nthreads_, dom);
     
     if (!plan_in_place_) VSIP_IMPL_THROW(std::bad_alloc());
 
     plan_by_reference_ = Create_plan<fftw3_complex_type>
       ::create<FFTW(plan), FFTW(iodim)>
-      (in_buffer_.ptr(), out_buffer_.ptr(), exp, flags, dom);
+      (in_buffer_.ptr(), out_buffer_.ptr(), exp, flags, nthreads_, dom);
 
     if (!plan_by_reference_)
     {
-      FFTW(destroy_plan)(plan_in_place_);
+      destroy_fftw_plan(plan_in_place_);
       VSIP_IMPL_THROW(std::bad_alloc());
     }
   }
   ~Fft_base() VSIP_NOTHROW
   {
-    if (plan_in_place_) FFTW(destroy_plan)(plan_in_place_);
-    if (plan_by_reference_) FFTW(destroy_plan)(plan_by_reference_);
+    if (plan_in_place_) destroy_fftw_plan(plan_in_place_);
+    if (plan_by_reference_) destroy_fftw_plan(plan_by_reference_);
   }
 
   Cmplx_buffer<fftw3_complex_type, SCALAR_TYPE> in_buffer_;
@@ -112,16 +117,19 @@ struct Fft_base<D, std::complex<SCALAR_TYPE>, std::complex<SCALAR_TYPE> >
   FFTW(plan) plan_by_reference_;
   int size_[D];
   bool aligned_;
+  int nthreads_;
 };
 
 template <vsip::dimension_type D>
 struct Fft_base<D, SCALAR_TYPE, std::complex<SCALAR_TYPE> >
 {
-  Fft_base(Domain<D> const& dom, int A, int flags, bool aligned = false)
+  Fft_base(Domain<D> const& dom, int A, int flags, bool aligned = false,
+	   int nthreads = 0)
     VSIP_THROW((std::bad_alloc))
     : in_buffer_(32, dom.size()),
       out_buffer_(dom.size()),
-      aligned_(aligned)
+      aligned_(aligned),
+      nthreads_(nthreads ? nthreads : plan_threads(dom.size()))
   { 
     if (!aligned) flags |= FFTW_UNALIGNED;
     for (vsip::dimension_type i = 0; i < D; ++i) size_[i] = dom[i].size();  
@@ -130,12 +138,12 @@ struct Fft_base<D, SCALAR_TYPE, std::complex<SCALAR_TYPE> >
     if (A != D - 1) std::swap(size_[A], size_[D - 1]);
     plan_by_reference_ = Create_plan<fftw3_complex_type>::
       create<FFTW(plan), FFTW(iodim)>
-      (in_buffer_.get(), out_buffer_.ptr(), A, flags, dom);
+      (in_buffer_.get(), out_buffer_.ptr(), A, flags, nthreads_, dom);
     if (!plan_by_reference_) VSIP_IMPL_THROW(std::bad_alloc());
   }
   ~Fft_base() VSIP_NOTHROW
   {
-    if (plan_by_reference_) FFTW(destroy_plan)(plan_by_reference_);
+    if (plan_by_reference_) destroy_fftw_plan(plan_by_reference_);
   }
 
   aligned_array<SCALAR_TYPE> in_buffer_;
@@ -143,16 +151,19 @@ struct Fft_base<D, SCALAR_TYPE, std::complex<SCALAR_TYPE> >
   FFTW(plan) plan_by_reference_;
   int size_[D];
   bool aligned_;
+  int nthreads_;
 };
 
 template <vsip::dimension_type D>
 struct Fft_base<D, std::complex<SCALAR_TYPE>, SCALAR_TYPE>
 {
-  Fft_base(Domain<D> const& dom, int A, int flags, bool aligned = false)
+  Fft_base(Domain<D> const& dom, int A, int flags, bool aligned = false,
+	   int nthreads = 0)
     VSIP_THROW((std::bad_alloc))
     : in_buffer_(dom.size()),
       out_buffer_(32, dom.size()),
-      aligned_(aligned)
+      aligned_(aligned),
+      nthreads_(nthreads ? nthreads : plan_threads(dom.size()))
   {
     if (!aligned) flags |= FFTW_UNALIGNED;
     for (vsip::dimension_type i = 0; i < D; ++i) size_[i] = dom[i].size();
@@ -161,13 +172,13 @@ struct Fft_base<D, std::complex<SCALAR_TYPE>, SCALAR_TYPE>
     if (A != D - 1) std::swap(size_[A], size_[D - 1]);
     plan_by_reference_ = Create_plan<fftw3_complex_type>::
       create<FFTW(plan), FFTW(iodim)>
-      (in_buffer_.ptr(), out_buffer_.get(), A, flags, dom);
+      (in_buffer_.ptr(), out_buffer_.get(), A, flags, nthreads_, dom);
 
     if (!plan_by_reference_) VSIP_IMPL_THROW(std::bad_alloc());
   }
   ~Fft_base() VSIP_NOTHROW
   {
-    if (plan_by_reference_) FFTW(destroy_plan)(plan_by_reference_);
+    if (plan_by_reference_) destroy_fftw_plan(plan_by_reference_);
   }
 
   Cmplx_buffer<fftw3_complex_type, SCALAR_TYPE> in_buffer_;
@@ -175,6 +186,7 @@ struct Fft_base<D, std::complex<SCALAR_TYPE>, SCALAR_TYPE>
   FFTW(plan) plan_by_reference_;
   int size_[D];
   bool aligned_;
+  int nthreads_;
 };
 
 // 1D complex -> complex FFT
@@ -853,8 +865,10 @@ public:
        // Only require aligned arrays if FFTW3 can actually take 
        // advantage from it by using SIMD kernels.
        !(VSIP_IMPL_ALLOC_ALIGNMENT % sizeof(rtype)) &&
-       !((sizeof(rtype) * dom[A].length()) % VSIP_IMPL_ALLOC_ALIGNMENT)),
-      mult_(dom[1-A].size())
+       !((sizeof(rtype) * dom[A].length()) % VSIP_IMPL_ALLOC_ALIGNMENT),
+       fftm_plan_threads(dom[1-A].size(), dom[A].size())),
+      mult_(dom[1-A].size()),
+      threads_(fftm_row_threads(mult_, dom[A].size(), this->nthreads_))
   {
   }
   virtual char const* name() { return "fftm-fftw3-real-forward"; }
@@ -881,13 +895,11 @@ public:
     if (A == 1) assert(rows <= mult_ && static_cast<int>(cols) == size_[0]);
     else        assert(cols <= mult_ && static_cast<int>(rows) == size_[0]);
 
-    for (index_type i = 0; i < n_fft; ++i)
-    {
-      FFTW(execute_dft_r2c)(plan_by_reference_, 
-			    in, reinterpret_cast<FFTW(complex)*>(out));
-      in  += in_fft_stride;
-      out += out_fft_stride;
-    }
+    Fftm_rows<FFTW(plan), rtype, FFTW(complex)>
+      (FFTW(execute_dft_r2c), plan_by_reference_,
+       in, in_fft_stride,
+       reinterpret_cast<FFTW(complex)*>(out), out_fft_stride)
+      (n_fft, threads_);
   }
   virtual void by_reference(
     rtype*      in,
@@ -934,6 +946,7 @@ public:
 
 private:
   length_type mult_;
+  length_type threads_;
 };
 
 // complex -> real FFTM
@@ -954,8 +967,10 @@ public:
        // Only require aligned arrays if FFTW3 can actually take 
        // advantage from it by using SIMD kernels.
        !(VSIP_IMPL_ALLOC_ALIGNMENT % sizeof(rtype)) &&
-       !((sizeof(rtype) * dom[A].length()) % VSIP_IMPL_ALLOC_ALIGNMENT)),
-      mult_(dom[1-A].size())
+       !((sizeof(rtype) * dom[A].length()) % VSIP_IMPL_ALLOC_ALIGNMENT),
+       fftm_plan_threads(dom[1-A].size(), dom[A].size())),
+      mult_(dom[1-A].size()),
+      threads_(fftm_row_threads(mult_, dom[A].size(), this->nthreads_))
   {
   }
 
@@ -986,13 +1001,11 @@ public:
     if (A == 1) assert(rows <= mult_ && static_cast<int>(cols) == size_[0]);
     else        assert(cols <= mult_ && static_cast<int>(rows) == size_[0]);
 
-    for (index_type i = 0; i < n_fft; ++i)
-    {
-      FFTW(execute_dft_c2r)(plan_by_reference_, 
-			    reinterpret_cast<FFTW(complex)*>(in), out);
-      in  += in_fft_stride;
-      out += out_fft_stride;
-    }
+    Fftm_rows<FFTW(plan), FFTW(complex), rtype>
+      (FFTW(execute_dft_c2r), plan_by_reference_,
+       reinterpret_cast<FFTW(complex)*>(in), in_fft_stride,
+       out, out_fft_stride)
+      (n_fft, threads_);
   }
   virtual void by_reference(
     ztype       in,
@@ -1039,6 +1052,7 @@ public:
 
 private:
   length_type mult_;
+  length_type threads_;
 };
 
 // complex -> complex FFTM
@@ -1059,13 +1073,21 @@ public:
        // Only require aligned arrays if FFTW3 can actually take 
        // advantage from it by using SIMD kernels.
        !(VSIP_IMPL_ALLOC_ALIGNMENT % sizeof(ctype)) &&
-       !((sizeof(ctype) * dom[A].length()) % VSIP_IMPL_ALLOC_ALIGNMENT)),
-      mult_(dom[1-A].size())
+       !((sizeof(ctype) * dom[A].length()) % VSIP_IMPL_ALLOC_ALIGNMENT),
+       fftm_plan_threads(dom[1-A].size(), dom[A].size())),
+      mult_(dom[1-A].size()),
+      threads_(fftm_row_threads(mult_, dom[A].size(), this->nthreads_))
   {
   }
 
   virtual char const* name() { return "fftm-fftw3-complex"; }
 
+  // With interleaved complex data, by_reference only uses the plan, and
+  // FFTW's new-array execute functions may be called concurrently.
+  // The split-complex functions share the member buffers.
+  virtual bool reentrant()
+  { return Type_equal<fftw3_complex_type, Cmplx_inter_fmt>::value;}
+
   virtual void query_layout(Rt_layout<2> &rtl_inout)
   {
     // By default use unit_stride,
@@ -1102,13 +1124,11 @@ public:
     else        assert(cols <= mult_ && static_cast<int>(rows) == size_[0]);
     assert(((A == 1) ? str_1 : str_0) == 1);
 
-    for (index_type i = 0; i != n_fft; ++i)
-    {
-      FFTW(execute_dft)(this->plan_in_place_, 
- 			reinterpret_cast<FFTW(complex)*>(inout),
- 			reinterpret_cast<FFTW(complex)*>(inout));
-      inout += fft_stride;
-    }
+    Fftm_rows<FFTW(plan), FFTW(complex), FFTW(complex)>
+      (FFTW(execute_dft), this->plan_in_place_,
+       reinterpret_cast<FFTW(complex)*>(inout), fft_stride,
+       reinterpret_cast<FFTW(complex)*>(inout), fft_stride)
+      (n_fft, threads_);
   }
 
   virtual void in_place(
@@ -1177,14 +1197,11 @@ public:
     if (A == 1) assert(rows <= mult_ && static_cast<int>(cols) == size_[0]);
     else        assert(cols <= mult_ && static_cast<int>(rows) == size_[0]);
 
-    for (index_type i = 0; i != n_fft; ++i)
-    {
-      FFTW(execute_dft)(plan_by_reference_, 
-			reinterpret_cast<FFTW(complex)*>(in), 
-			reinterpret_cast<FFTW(complex)*>(out));
-      in  += in_fft_stride;
-      out += out_fft_stride;
-    }
+    Fftm_rows<FFTW(plan), FFTW(complex), FFTW(complex)>
+      (FFTW(execute_dft), plan_by_reference_,
+       reinterpret_cast<FFTW(complex)*>(in), in_fft_stride,
+       reinterpret_cast<FFTW(complex)*>(out), out_fft_stride)
+      (n_fft, threads_);
   }
 
   virtual void by_reference(
@@ -1228,6 +1245,7 @@ public:
 
 private:
   length_type mult_;
+  length_type threads_;
 };
 
 #define VSIPL_IMPL_PROVIDE(D, I, O, A, E)	       \
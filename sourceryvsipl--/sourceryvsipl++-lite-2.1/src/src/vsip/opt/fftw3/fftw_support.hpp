@@ -14,6 +14,11 @@
 #ifndef VSIP_OPT_FFTW3_FFTW_SUPPORT_HPP
 #define VSIP_OPT_FFTW3_FFTW_SUPPORT_HPP
 
+#include <vsip/core/config.hpp>
+#if VSIP_IMPL_PAR_SERVICE == 3
+#  include <vsip/core/threads/sync.hpp>
+#endif
+
 namespace vsip
 {
 namespace impl
@@ -21,55 +26,110 @@ namespace impl
 namespace fftw3
 {
 
+// Only the FFTW execute functions are thread-safe.  When processors
+// are threads of one process, plan creation and destruction must be
+// serialized.
+
+#if VSIP_IMPL_PAR_SERVICE == 3
+threads::Mutex planner_mutex;
+
+class Planner_lock
+{
+public:
+  Planner_lock() : lock_(planner_mutex) {}
+private:
+  threads::Scoped_lock lock_;
+};
+#else
+class Planner_lock
+{
+public:
+  Planner_lock() {}
+};
+#endif
+
+// Plans requested with FFTW_WISDOM_ONLY that are not in the wisdom
+// store are created again with ESTIMATE.  These are the flags to do so.
+
+inline int
+estimate_flags(int flags)
+{
+  return (flags & ~(FFTW_WISDOM_ONLY | FFTW_PATIENT | FFTW_EXHAUSTIVE))
+    | FFTW_ESTIMATE;
+}
+
+// Plans use NTHREADS threads if FFTW3 supports them.
+
+#if VSIP_IMPL_FFTW3_HAVE_THREADS
+#  define VSIP_IMPL_FFTW_NTHREADS(fT) fT##_plan_with_nthreads(nthreads);
+#else
+#  define VSIP_IMPL_FFTW_NTHREADS(fT) (void)nthreads;
+#endif
+
+#define VSIP_IMPL_FFTW_PLAN(fT, CALL, FLAGS) \
+{ Planner_lock lock; \
+  VSIP_IMPL_FFTW_NTHREADS(fT) \
+  int flags_ = FLAGS; \
+  fT##_plan plan_ = CALL; \
+  if (!plan_ && (FLAGS & FFTW_WISDOM_ONLY)) \
+  { \
+    flags_ = estimate_flags(FLAGS); \
+    plan_ = CALL; \
+  } \
+  return plan_; \
+}
+
 #define DCL_FFTW_PLAN_FUNC_C2C(T, fT) \
 fT##_plan create_fftw_plan(int dim, int *sz, \
                       std::complex<T>* ptr1, std::complex<T>* ptr2,\
-                      int exp, int flags) \
-{ return fT##_plan_dft(dim,sz,reinterpret_cast<fT##_complex*>(ptr1), \
-                     reinterpret_cast<fT##_complex*>(ptr2), exp, flags); \
-} \
+                      int exp, int flags, int nthreads) \
+VSIP_IMPL_FFTW_PLAN(fT, fT##_plan_dft(dim,sz,reinterpret_cast<fT##_complex*>(ptr1), \
+                     reinterpret_cast<fT##_complex*>(ptr2), exp, flags_), \
+                    flags) \
 \
 fT##_plan create_fftw_plan(int dim, fT##_iodim *iodim, \
                       std::pair<T*,T*> ptr1, std::pair<T*,T*> ptr2,\
-                      int flags) \
-{ return fT##_plan_guru_split_dft(dim,iodim,0,NULL, \
+                      int flags, int nthreads) \
+VSIP_IMPL_FFTW_PLAN(fT, fT##_plan_guru_split_dft(dim,iodim,0,NULL, \
                             ptr1.first,ptr1.second,ptr2.first,ptr2.second, \
-                            flags); \
-}
+                            flags_), flags)
 
 #define DCL_FFTW_PLAN_FUNC_R2C(T, fT) \
 fT##_plan create_fftw_plan(int dim, int *sz, \
                       T* ptr1, std::complex<T>* ptr2,\
-                      int flags) \
-{ return fT##_plan_dft_r2c(dim,sz,ptr1, \
-                     reinterpret_cast<fT##_complex*>(ptr2), flags); \
-} \
+                      int flags, int nthreads) \
+VSIP_IMPL_FFTW_PLAN(fT, fT##_plan_dft_r2c(dim,sz,ptr1, \
+                     reinterpret_cast<fT##_complex*>(ptr2), flags_), flags) \
 \
 fT##_plan create_fftw_plan(int dim, fT##_iodim *iodim, \
                       T* ptr1, std::pair<T*,T*> ptr2,\
-                      int flags) \
-{ return fT##_plan_guru_split_dft_r2c(dim,iodim,0,NULL, \
+                      int flags, int nthreads) \
+VSIP_IMPL_FFTW_PLAN(fT, fT##_plan_guru_split_dft_r2c(dim,iodim,0,NULL, \
                             ptr1,ptr2.first,ptr2.second, \
-                            flags); \
-}
+                            flags_), flags)
 
 #define DCL_FFTW_PLAN_FUNC_C2R(T, fT) \
 fT##_plan create_fftw_plan(int dim, int *sz, \
                       std::complex<T>* ptr1, T* ptr2,\
-                      int flags) \
-{ return fT##_plan_dft_c2r(dim,sz,reinterpret_cast<fT##_complex*>(ptr1), \
-                     ptr2, flags); \
-} \
+                      int flags, int nthreads) \
+VSIP_IMPL_FFTW_PLAN(fT, fT##_plan_dft_c2r(dim,sz,reinterpret_cast<fT##_complex*>(ptr1), \
+                     ptr2, flags_), flags) \
 \
 fT##_plan create_fftw_plan(int dim, fT##_iodim *iodim, \
                       std::pair<T*,T*> ptr1, T* ptr2,\
-                      int flags) \
-{ return fT##_plan_guru_split_dft_c2r(dim,iodim,0,NULL, \
+                      int flags, int nthreads) \
+VSIP_IMPL_FFTW_PLAN(fT, fT##_plan_guru_split_dft_c2r(dim,iodim,0,NULL, \
                             ptr1.first,ptr1.second,ptr2, \
-                            flags); \
+                            flags_), flags)
+
+#define DCL_FFTW_DESTROY_PLAN(T, fT) \
+void destroy_fftw_plan(fT##_plan plan) \
+{ Planner_lock lock; \
+  fT##_destroy_plan(plan); \
 }
 
 #define DCL_FFTW_PLANS(T, fT) \
+  DCL_FFTW_DESTROY_PLAN(T, fT) \
   DCL_FFTW_PLAN_FUNC_C2C(T, fT) \
   DCL_FFTW_PLAN_FUNC_R2C(T, fT) \
   DCL_FFTW_PLAN_FUNC_C2R(T, fT)
@@ -85,6 +145,9 @@ fT##_plan create_fftw_plan(int dim, fT##_iodim *iodim, \
   DCL_FFTW_PLANS(long double, fftwl)
 #endif
 
+#undef VSIP_IMPL_FFTW_PLAN
+#undef VSIP_IMPL_FFTW_NTHREADS
+
 } // namespace vsip::impl::fftw3
 } // namespace vsip::impl
 } // namespace vsip
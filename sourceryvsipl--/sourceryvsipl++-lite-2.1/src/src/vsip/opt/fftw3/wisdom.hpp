@@ -0,0 +1,85 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/fftw3/wisdom.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: FFTW3 wisdom store and planning effort.
+*/
+
+#ifndef VSIP_OPT_FFTW3_WISDOM_HPP
+#define VSIP_OPT_FFTW3_WISDOM_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/core/config.hpp>
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace fftw3
+{
+
+/// Planning effort of FFTW3 plans.
+///
+/// By default the effort follows the number_of_times template
+/// parameter of Fft and Fftm: ESTIMATE for up to 10 uses, MEASURE for
+/// up to 30, and PATIENT for more (or 0).  Any other effort overrides
+/// the hint for all FFTs created afterwards.  effort_wisdom only
+/// creates plans that the wisdom store already holds for the hinted
+/// effort, and falls back to ESTIMATE plans otherwise; startup then
+/// never spends time measuring.
+
+enum planning_effort
+{
+  effort_hint,
+  effort_estimate,
+  effort_measure,
+  effort_patient,
+  effort_exhaustive,
+  effort_wisdom
+};
+
+/// Process the FFTW3 options of the command line:
+///
+///   --svpp-fftw-wisdom FILE  Load wisdom at initialization, and save
+///                            it at finalization if it has grown.
+///   --svpp-fftw-effort E     Set the planning effort: hint, estimate,
+///                            measure, patient, exhaustive or wisdom.
+///   --svpp-fftw-timelimit S  Limit the time spent creating one plan
+///                            to S seconds.
+///
+/// FFTW keeps separate wisdom for each precision, which is stored in
+/// FILE.fftwf, FILE.fftw and FILE.fftwl.  Wisdom records the size,
+/// strides, alignment and planner flags of each problem, so one store
+/// serves all FFTs of a program.
+void initialize(int& argc, char**& argv);
+void finalize();
+
+void            set_planning_effort(planning_effort effort);
+planning_effort get_planning_effort();
+
+/// Import the wisdom stored under FILE.  Return true if the store of
+/// at least one precision was read.
+bool import_wisdom(char const* file);
+
+/// Merge the wisdom of this process into the store under FILE.
+/// Return false if a store could not be written.
+bool export_wisdom(char const* file);
+
+/// Forget all wisdom accumulated so far.
+void forget_wisdom();
+
+} // namespace vsip::impl::fftw3
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_FFTW3_WISDOM_HPP
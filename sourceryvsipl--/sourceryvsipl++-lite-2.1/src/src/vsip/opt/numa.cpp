@@ -12,6 +12,8 @@
  
 #include <vsip/core/argv_utils.hpp>
 #include <vsip/opt/numa.hpp>
+// local_spes_only() uses the libnuma version 1 API.
+#define NUMA_VERSION1_COMPATIBILITY
 #include <numa.h>
 
 namespace vsip
@@ -42,6 +44,30 @@ void initialize(int argc, char **&argv)
     }
   }
 }
+
+bool Numa_pool::available()
+{
+  return numa_available() >= 0;
+}
+
+void* Numa_pool::impl_allocate(size_t size)
+{
+  // If size == 0, allocate 1 byte.
+  void* ptr = numa_alloc_local(size ? size : 1);
+  if (ptr == 0)
+    VSIP_IMPL_THROW(std::bad_alloc());
+  return ptr;
+}
+
+void Numa_pool::impl_deallocate(void* ptr, size_t size)
+{
+  numa_free(ptr, size ? size : 1);
+}
+
+char const* Numa_pool::name()
+{
+  return "Numa_pool";
+}
 }
 }
 }
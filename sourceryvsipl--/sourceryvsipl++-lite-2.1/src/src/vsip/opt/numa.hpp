@@ -13,13 +13,29 @@
 #ifndef VSIP_OPT_NUMA_HPP
 #define VSIP_OPT_NUMA_HPP
 
+#include <vsip/core/memory_pool.hpp>
+
 namespace vsip
 {
 namespace impl
 {
 namespace numa
 {
-void initialize(int argv, char **&argv);
+void initialize(int argc, char **&argv);
+
+/// Memory pool allocating pages local to the node of the calling
+/// thread.  Blocks are page-aligned, so the pool suits views that are
+/// large compared to a page.
+class Numa_pool : public Memory_pool
+{
+public:
+  static bool available();
+
+  void* impl_allocate(size_t size);
+  void  impl_deallocate(void* ptr, size_t size);
+
+  char const* name();
+};
 }
 }
 }
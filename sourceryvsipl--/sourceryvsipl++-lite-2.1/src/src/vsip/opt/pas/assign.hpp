@@ -78,8 +78,8 @@ public:
   {
     long rc;
     long const reserved_flags = 0;
-    impl::profile::Scope<impl::profile::par>
-      scope("Par_assign<Pas_assign>-cons");
+    static impl::profile::Event event = { "Par_assign<Pas_assign>-cons", 0 };
+    impl::profile::Scope<impl::profile::par> scope(event);
 
     PAS_id src_pset = src_.block().map().impl_ll_pset();
     PAS_id dst_pset = dst_.block().map().impl_ll_pset();
@@ -414,7 +414,8 @@ public:
       src_ext_  (src_.local().block(), impl::SYNC_IN),
       dst_ext_  (dst_.local().block(), impl::SYNC_OUT)
   {
-    profile::Scope<profile::par> scope ("Par_assign<Direct_pas_assign>-cons");
+    static profile::Event event = { "Par_assign<Direct_pas_assign>-cons", 0 };
+    profile::Scope<profile::par> scope(event);
     assert(src_am_.impl_comm() == dst_am_.impl_comm());
 
     build_send_list();
@@ -518,8 +519,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Direct_pas_assign>::build_send_list()
 {
-  profile::Scope<profile::par>
-    scope("Par_assign<Direct_pas_assign>-build_send_list");
+  static profile::Event event =
+    { "Par_assign<Direct_pas_assign>-build_send_list", 0 };
+  profile::Scope<profile::par> scope(event);
   processor_type rank = local_processor();
 
   length_type dsize  = dst_am_.impl_working_size();
@@ -640,8 +642,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Direct_pas_assign>::build_recv_list()
 {
-  profile::Scope<profile::par> 
-    scope("Par_assign<Direct_pas_assign>-build_recv_list");
+  static profile::Event event =
+    { "Par_assign<Direct_pas_assign>-build_recv_list", 0 };
+  profile::Scope<profile::par> scope(event);
 }
 
 
@@ -654,8 +657,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Direct_pas_assign>::build_copy_list()
 {
-  profile::Scope<profile::par>
-    scope("Par_assign<Direct_pas_assign>-build_copy_list");
+  static profile::Event event =
+    { "Par_assign<Direct_pas_assign>-build_copy_list", 0 };
+  profile::Scope<profile::par> scope(event);
   processor_type rank = local_processor();
 
 #if VSIP_IMPL_PCA_VERBOSE >= 1
@@ -726,8 +730,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Direct_pas_assign>::exec_send_list()
 {
-  profile::Scope<profile::par> 
-    scope("Par_assign<Direct_pas_assign>-exec_send_list");
+  static profile::Event event =
+    { "Par_assign<Direct_pas_assign>-exec_send_list", 0 };
+  profile::Scope<profile::par> scope(event);
 
   PAS_id src_pnum          = local_processor();
   PAS_pbuf_handle src_pbuf = src_.block().impl_ll_pbuf();
@@ -786,8 +791,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Direct_pas_assign>::exec_recv_list()
 {
-  profile::Scope<profile::par>
-    scope("Par_assign<Direct_pas_assign>-exec_recv_list");
+  static profile::Event event =
+    { "Par_assign<Direct_pas_assign>-exec_recv_list", 0 };
+  profile::Scope<profile::par> scope(event);
   PAS_id dst_pset = dst_.block().map().impl_ll_pset();
   PAS_id src_pset = src_.block().map().impl_ll_pset();
 
@@ -815,8 +821,9 @@ template <dimension_type Dim,
 void
 Par_assign<Dim, T1, T2, Block1, Block2, Direct_pas_assign>::exec_copy_list()
 {
-  profile::Scope<profile::par>
-    scope("Par_assign<Direct_pas_assign>-exec_copy_list");
+  static profile::Event event =
+    { "Par_assign<Direct_pas_assign>-exec_copy_list", 0 };
+  profile::Scope<profile::par> scope(event);
 
 #if VSIP_IMPL_PCA_VERBOSE >= 1
   processor_type rank = local_processor();
@@ -77,8 +77,8 @@ public:
   {
     long rc;
     long const reserved_flags = 0;
-    profile::Scope<profile::par>
-      scope("Par_assign<Pas_assign_eb>-cons");
+    static profile::Event event = { "Par_assign<Pas_assign_eb>-cons", 0 };
+    profile::Scope<profile::par> scope(event);
 
     PAS_id src_pset = src_.block().map().impl_ll_pset();
     PAS_id dst_pset = dst_.block().map().impl_ll_pset();
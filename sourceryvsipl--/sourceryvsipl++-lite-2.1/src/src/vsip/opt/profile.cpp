@@ -14,9 +14,11 @@
   Included Files
 ***********************************************************************/
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <cstring>
+#include <cstdlib>
 
 // Profiling should be enabled when compiling this module so that
 // these functions are available if the user enables profiling.
@@ -164,22 +166,296 @@ public:
 
 SetupProf obj;
 
+namespace
+{
+
+// Size of the per-thread caches of interned names.
+unsigned const cache_size = 256;
+
+// Size of the hash table of interned names.
+unsigned const table_size = 2 * Profiler::max_events;
+
+// Distinguishes Profiler objects that reuse the same address.
+unsigned volatile profiler_serial = 0;
+
+#if defined(__GNUC__)
+inline unsigned
+atomic_increment(unsigned volatile& value)
+{ return __sync_fetch_and_add(&value, 1); }
+
+template <typename T>
+inline bool
+compare_and_swap(T* volatile& ptr, T* old_value, T* new_value)
+{ return __sync_bool_compare_and_swap(&ptr, old_value, new_value); }
+
+inline void
+acquire(int volatile& lock)
+{
+  while (__sync_lock_test_and_set(&lock, 1))
+    while (lock)
+      ;
+}
+
+inline void
+release(int volatile& lock)
+{ __sync_lock_release(&lock); }
+#else
+// Without atomic operations the profiler may only be used by one
+// thread.
+inline unsigned
+atomic_increment(unsigned volatile& value)
+{ return value++; }
+
+template <typename T>
+inline bool
+compare_and_swap(T* volatile& ptr, T* old_value, T* new_value)
+{ ptr = new_value; return true; }
+
+inline void acquire(int volatile&) {}
+inline void release(int volatile&) {}
+#endif
+
+// FNV-1a hash of NAME.  Sets LENGTH to the length of NAME.
+inline unsigned
+hash_name(char const* name, size_t& length)
+{
+  unsigned hash = 2166136261u;
+  char const* p = name;
+  for (; *p; ++p)
+    hash = (hash ^ static_cast<unsigned char>(*p)) * 16777619u;
+  length = p - name;
+  return hash;
+}
+
+} // namespace vsip::impl::profile::<unnamed>
+
+
+
+/// Events recorded by one thread.
+struct Profiler::Thread_log
+{
+  struct Cache_entry
+  {
+    void const*   key;
+    unsigned      hash;
+    event_id_type id;
+  };
+
+  Thread_log*                next;
+  unsigned                   tid;
+
+  // Trace mode.
+  Trace_record*              ring;
+  size_t                     mask;
+  size_t                     head;	// number of records written
+
+  // Accumulate mode.
+  std::vector<Accum_entry>   accum;
+  std::vector<event_id_type> stack;	// open events, for nesting
+
+  // Recently interned names, by address and by hash.
+  Cache_entry                ptr_cache[cache_size];
+  Cache_entry                str_cache[cache_size];
+};
+
+namespace
+{
+
+#ifdef VSIP_IMPL_THREAD_LOCAL
+VSIP_IMPL_THREAD_LOCAL Profiler::Thread_log* current_log    = 0;
+VSIP_IMPL_THREAD_LOCAL unsigned              current_serial = 0;
+#else
+Profiler::Thread_log* current_log    = 0;
+unsigned              current_serial = 0;
+#endif
+
+} // namespace vsip::impl::profile::<unnamed>
+
+
+
 Profiler::Profiler()
-  : mode_(pm_none)
+  : mode_       (pm_none),
+    format_     (pf_text),
+    buffer_size_(default_buffer_size),
+    names_      (new char const*[max_events]),
+    table_      (new event_id_type[table_size]),
+    num_events_ (0),
+    lock_       (0),
+    logs_       (0),
+    num_threads_(0),
+    serial_     (atomic_increment(profiler_serial) + 1)
 {
+  names_[0] = "";
+  for (unsigned i=0; i<table_size; ++i)
+    table_[i] = 0;
+  // Events beyond max_events are recorded under the last ID.
+  names_[max_events - 1] = "(other events)";
 }
 
 
 
 Profiler::~Profiler()
 {
+  while (logs_)
+  {
+    Thread_log* next = logs_->next;
+    delete[] logs_->ring;
+    delete logs_;
+    logs_ = next;
+  }
+  for (unsigned id=1; id<=num_events_; ++id)
+    delete[] names_[id];
+  delete[] table_;
+  delete[] names_;
 }
 
 
+
+void
+Profiler::set_buffer_size(unsigned size)
+{
+  buffer_size_ = 1;
+  while (buffer_size_ < size)
+    buffer_size_ *= 2;
+}
+
+
+
+// Return the calling thread's log, creating it if necessary.
+
+Profiler::Thread_log*
+Profiler::thread_log()
+{
+  if (current_serial == serial_)
+    return current_log;
+
+  Thread_log* log = new Thread_log;
+  log->tid  = atomic_increment(num_threads_);
+  log->ring = 0;
+  log->mask = 0;
+  log->head = 0;
+  for (unsigned i=0; i<cache_size; ++i)
+  {
+    log->ptr_cache[i].key = 0;
+    log->str_cache[i].key = 0;
+  }
+
+  do
+    log->next = logs_;
+  while (!compare_and_swap(logs_, log->next, log));
+
+  current_log    = log;
+  current_serial = serial_;
+  return log;
+}
+
+
+
+event_id_type
+Profiler::intern(char const* name)
+{
+  // String literals are looked up by address.  The name is compared
+  // as well, in case the address is reused for another name.
+  Thread_log* log = thread_log();
+  size_t key = reinterpret_cast<size_t>(name);
+  Thread_log::Cache_entry& entry =
+    log->ptr_cache[(key ^ (key >> 8)) % cache_size];
+  if (entry.key == name && !strcmp(names_[entry.id], name))
+    return entry.id;
+
+  size_t   length;
+  unsigned hash = hash_name(name, length);
+  entry.id  = intern(name, length, hash);
+  entry.key = name;
+  return entry.id;
+}
+
+
+
+event_id_type
+Profiler::intern(std::string const& name)
+{
+  Thread_log* log = thread_log();
+  size_t   length;
+  unsigned hash = hash_name(name.c_str(), length);
+  Thread_log::Cache_entry& entry = log->str_cache[hash % cache_size];
+  if (entry.key && entry.hash == hash && name == names_[entry.id])
+    return entry.id;
+
+  entry.id   = intern(name.c_str(), length, hash);
+  entry.hash = hash;
+  entry.key  = &entry;
+  return entry.id;
+}
+
+
+
+// Look up NAME in the table of interned names, adding it if
+// necessary.
+
+event_id_type
+Profiler::intern(char const* name, size_t length, unsigned hash)
+{
+  acquire(lock_);
+  event_id_type id;
+  for (unsigned i = hash % table_size; ; i = (i + 1) % table_size)
+  {
+    id = table_[i];
+    if (id == 0)
+    {
+      if (num_events_ + 2 >= max_events)
+      {
+	id = max_events - 1;
+	break;
+      }
+      char* copy = new char[length + 1];
+      memcpy(copy, name, length + 1);
+      id = num_events_ + 1;
+      names_[id] = copy;
+      table_[i]  = id;
+      num_events_ = id;
+      break;
+    }
+    if (!strcmp(names_[id], name))
+      break;
+  }
+  release(lock_);
+  return id;
+}
+
+
+
+// Return the ID of the nested event name for ID.
+
+event_id_type
+Profiler::nested(Thread_log* log, event_id_type id, int open_id)
+{
+  if (open_id != 0)
+  {
+    if (log->stack.empty())
+      return id;
+    id = log->stack.back();
+    log->stack.pop_back();
+    return id;
+  }
+
+  if (!log->stack.empty())
+  {
+    std::string name(names_[log->stack.back()]);
+    name += "\\,";
+    name += names_[id];
+    id = intern(name);
+  }
+  log->stack.push_back(id);
+  return id;
+}
+
+
+
 // Create a profiler event.
 //
 // Requires
-//   NAME to be the event name.
+//   ID to be the interned event name.
 //   VALUE to be a value associated with the event (such as number of
 //      operations, number of bytes, etc).
 //   OPEN_ID to be event's start ID if this is the close of an event.
@@ -190,50 +466,44 @@ Profiler::~Profiler()
 //   The ID of the event.
 //
 int
-Profiler::event(std::string const &name, int value, int open_id, stamp_type stamp)
+Profiler::event(event_id_type id, int value, int open_id, stamp_type stamp)
 {
+  if (mode_ == pm_none || id == 0)
+    return 0;
+
+  // Obtain a stamp if one is not provided.
+  if (TP::is_zero(stamp))
+    TP::sample(stamp);
+
+  Thread_log* log = thread_log();
+
   if (mode_ == pm_trace)
   {
-    // Obtain a stamp if one is not provided.
-    if (TP::is_zero(stamp))
-      TP::sample(stamp);
-
-    count_++;
-    data_.push_back(Trace_entry(count_, name, stamp, open_id, value));
-    return count_;
+    if (log->ring == 0)
+    {
+      log->ring = new Trace_record[buffer_size_];
+      log->mask = buffer_size_ - 1;
+    }
+    Trace_record& record = log->ring[log->head & log->mask];
+    int idx = static_cast<int>(++log->head);
+    record.ticks = TP::ticks(stamp);
+    record.event = id;
+    record.idx   = idx;
+    record.end   = open_id;
+    record.value = value;
+    return idx;
   }
   else if (mode_ == pm_accum)
   {
 #if VSIP_IMPL_PROFILE_NESTING
-    // Push event onto stack if this is start of event.
-    if (open_id == 0)
-      event_stack_.push_back(name);
-
-    // Build nested event name from stack.
-    std::string event_name(event_stack_[0]);
-    for (unsigned i=1; i<event_stack_.size(); ++i)
-    {
-      event_name += "\\,";
-      event_name += event_stack_[i];
-    }
-
-    // Pop event from stack if this is end of event.
-    if (open_id != 0)
-      event_stack_.pop_back();
-#else
-    std::string event_name(name);
+    id = nested(log, id, open_id);
 #endif
-    // Obtain a stamp if one is not provided.
-    if (TP::is_zero(stamp))
-      TP::sample(stamp);
-
-    accum_type::iterator pos = accum_.find(event_name);
-    if (pos == accum_.end())
+    if (id >= log->accum.size())
     {
-      accum_.insert(std::make_pair(event_name, 
-                      Accum_entry(TP::zero(), 0, value)));
-      pos = accum_.find(event_name);
+      Accum_entry zero = { 0, 0, 0 };
+      log->accum.resize(id + 1, zero);
     }
+    Accum_entry& entry = log->accum[id];
 
     // The value of 'open_id' determines if it is entering scope or exiting 
     // scope.  This allows it to work with the Scope classes, which call 
@@ -241,11 +511,15 @@ Profiler::event(std::string const &name, int value, int open_id, stamp_type stam
     // function body) and with a non-zero value in it's destructor.  The net 
     // result is that it accumulates time when it is alive.
     if (open_id == 0)
-      pos->second.total = TP::sub(pos->second.total, stamp);
+    {
+      if (entry.count == 0)
+	entry.value = value;
+      entry.total -= TP::ticks(stamp);
+    }
     else
     {
-      pos->second.total = TP::add(pos->second.total, stamp);
-      pos->second.count++;
+      entry.total += TP::ticks(stamp);
+      entry.count++;
     }
     // A non-zero value is returned for the benefit of the Scope classes,
     // which turns around and passes it back as the 'open_id' parameter in 
@@ -256,68 +530,225 @@ Profiler::event(std::string const &name, int value, int open_id, stamp_type stam
 }
 
 
+
+int
+Profiler::event(std::string const &name, int value, int open_id,
+		stamp_type stamp)
+{
+  if (mode_ == pm_none)
+    return 0;
+  return event(intern(name), value, open_id, stamp);
+}
+
+
+
+namespace
+{
+
+bool
+by_tid(Profiler::Thread_log const* a, Profiler::Thread_log const* b)
+{
+  return a->tid < b->tid;
+}
+
+template <typename T>
+inline void
+put(std::ostream& os, T value)
+{
+  os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+char const* const binary_magic = "SVPPTRC1";
+
+} // namespace vsip::impl::profile::<unnamed>
+
+
+
 void
 Profiler::dump(std::string const &filename, char /*mode*/)
 {
+  bool binary = mode_ == pm_trace && format_ == pf_binary;
   std::ofstream os;
-  char const *delim = " : ";
-  if (filename != "" && filename != "-") os.open(filename.c_str());
+  if (filename != "" && filename != "-")
+    os.open(filename.c_str(), binary ? std::ios::out | std::ios::binary
+	                             : std::ios::out);
   else
   {
     os.copyfmt(std::cout);
     static_cast<std::basic_ios<char> &>(os).rdbuf(std::cout.rdbuf());
   }
 
-  if (mode_ == pm_trace)
+  if (mode_ == pm_trace && binary)
+    dump_binary(os);
+  else if (mode_ == pm_trace)
+    dump_trace(os);
+  else if (mode_ == pm_accum)
+    dump_accum(os);
+  else
+  {
+    os << "# mode: pm_none" << std::endl;
+  }
+
+  for (Thread_log* log = logs_; log; log = log->next)
   {
-    os << "# mode: pm_trace\n"
-       << "# timer: " << TP::name() << '\n'
-       << "# clocks_per_sec: " << TP::ticks(TP::clocks_per_sec) << '\n'
-       << "# \n"
-       << "# index" << delim << "tag" << delim << "ticks" << delim << "open id" 
-       << delim << "op count" << std::endl;
+    log->head = 0;
+    log->accum.clear();
+    log->stack.clear();
+  }
+}
+
 
-    typedef trace_type::iterator iterator;
 
-    for (iterator cur = data_.begin(); cur != data_.end(); ++cur)
+void
+Profiler::dump_trace(std::ostream& os)
+{
+  char const *delim = " : ";
+
+  os << "# mode: pm_trace\n"
+     << "# timer: " << TP::name() << '\n'
+     << "# clocks_per_sec: " << TP::ticks(TP::clocks_per_sec) << '\n'
+     << "# \n"
+     << "# index" << delim << "tag" << delim << "ticks" << delim << "open id" 
+     << delim << "op count" << std::endl;
+
+  std::vector<Thread_log*> logs;
+  for (Thread_log* log = logs_; log; log = log->next)
+    if (log->head)
+      logs.push_back(log);
+  std::sort(logs.begin(), logs.end(), by_tid);
+
+  for (size_t t=0; t<logs.size(); ++t)
+  {
+    Thread_log* log = logs[t];
+    size_t first = log->head > log->mask + 1 ? log->head - log->mask - 1 : 0;
+    if (logs.size() > 1)
+      os << "# thread: " << log->tid << '\n';
+    if (first)
+      os << "# dropped: " << first << '\n';
+
+    for (size_t i=first; i<log->head; ++i)
     {
-      os << (*cur).idx
-         << delim << (*cur).name
-         << delim << TP::ticks((*cur).stamp)
-         << delim << (*cur).end
-         << delim << (*cur).value 
-         << std::endl;
+      Trace_record const& record = log->ring[i & log->mask];
+      os << record.idx
+	 << delim << names_[record.event]
+	 << delim << record.ticks
+	 << delim << record.end
+	 << delim << record.value 
+	 << '\n';
     }
-    data_.clear();
   }
-  else if (mode_ == pm_accum)
+  os.flush();
+}
+
+
+
+// Binary trace format, in the byte order of the host:
+//
+//   char[8]  magic "SVPPTRC1"
+//   uint32   0x01020304, to identify the byte order
+//   uint64   clocks per second
+//   uint32   number of event names N, followed by N names
+//            (uint32 length, characters) with IDs 1 to N
+//   uint32   number of threads, followed for each thread by
+//            uint32 thread ID, uint32 0, uint64 number of records R,
+//            uint64 number of dropped records, and R records
+//            (uint64 ticks, uint32 event ID, int32 index,
+//             int32 index of the opening record or 0, int32 value).
+
+void
+Profiler::dump_binary(std::ostream& os)
+{
+  os.write(binary_magic, 8);
+  put<unsigned int>(os, 0x01020304);
+  put<unsigned long long>(os, TP::ticks(TP::clocks_per_sec));
+
+  // The overflow ID is written as one more name.
+  unsigned num_names = num_events_ + 1;
+  put<unsigned int>(os, num_names);
+  for (unsigned id=1; id<=num_names; ++id)
   {
-    os << "# mode: pm_accum\n"
-       << "# timer: " << TP::name() << '\n'
-       << "# clocks_per_sec: " << TP::ticks(TP::clocks_per_sec) << '\n'
-       << "# \n"
-       << "# tag" << delim << "total ticks" << delim << "num calls" 
-       << delim << "op count" << delim << "mops" << std::endl;
+    char const* name = names_[id == num_names ? max_events - 1 : id];
+    unsigned int length = strlen(name);
+    put(os, length);
+    os.write(name, length);
+  }
 
-    typedef accum_type::iterator iterator;
+  std::vector<Thread_log*> logs;
+  for (Thread_log* log = logs_; log; log = log->next)
+    if (log->head)
+      logs.push_back(log);
+  std::sort(logs.begin(), logs.end(), by_tid);
 
-    for (iterator cur = accum_.begin(); cur != accum_.end(); ++cur)
+  put<unsigned int>(os, logs.size());
+  for (size_t t=0; t<logs.size(); ++t)
+  {
+    Thread_log* log = logs[t];
+    size_t first = log->head > log->mask + 1 ? log->head - log->mask - 1 : 0;
+    put<unsigned int>(os, log->tid);
+    put<unsigned int>(os, 0);
+    put<unsigned long long>(os, log->head - first);
+    put<unsigned long long>(os, first);
+    for (size_t i=first; i<log->head; ++i)
     {
-      float mops = (*cur).second.count * (*cur).second.value /
-        (1e6 * TP::seconds((*cur).second.total));
-      os << (*cur).first
-         << delim << TP::ticks((*cur).second.total)
-         << delim << (*cur).second.count
-         << delim << (*cur).second.value
-         << delim << mops
-         << std::endl;
+      Trace_record const& record = log->ring[i & log->mask];
+      put<unsigned long long>(os, record.ticks);
+      put<unsigned int>(os, record.event == max_events - 1 ? num_names
+			                                    : record.event);
+      put<int>(os, record.idx);
+      put<int>(os, record.end);
+      put<int>(os, record.value);
     }
-    accum_.clear();
   }
-  else
+  os.flush();
+}
+
+
+
+void
+Profiler::dump_accum(std::ostream& os)
+{
+  char const *delim = " : ";
+
+  os << "# mode: pm_accum\n"
+     << "# timer: " << TP::name() << '\n'
+     << "# clocks_per_sec: " << TP::ticks(TP::clocks_per_sec) << '\n'
+     << "# \n"
+     << "# tag" << delim << "total ticks" << delim << "num calls" 
+     << delim << "op count" << delim << "mops" << std::endl;
+
+  // Merge the threads' entries, sorted by name.
+  typedef std::map<std::string, Accum_entry> accum_type;
+  accum_type accum;
+  for (Thread_log* log = logs_; log; log = log->next)
+    for (event_id_type id=1; id<log->accum.size(); ++id)
+    {
+      Accum_entry const& entry = log->accum[id];
+      if (entry.count == 0 && entry.total == 0)
+	continue;
+      accum_type::iterator pos = accum.find(names_[id]);
+      if (pos == accum.end())
+	accum.insert(std::make_pair(std::string(names_[id]), entry));
+      else
+      {
+	pos->second.total += entry.total;
+	pos->second.count += entry.count;
+      }
+    }
+
+  double clocks_per_sec = TP::ticks(TP::clocks_per_sec);
+  typedef accum_type::iterator iterator;
+  for (iterator cur = accum.begin(); cur != accum.end(); ++cur)
   {
-    os << "# mode: pm_none" << std::endl;
+    float mops = (*cur).second.count * (*cur).second.value /
+      (1e6 * ((*cur).second.total / clocks_per_sec));
+    os << (*cur).first
+       << delim << (*cur).second.total
+       << delim << (*cur).second.count
+       << delim << (*cur).second.value
+       << delim << mops
+       << '\n';
   }
+  os.flush();
 }
 
 
@@ -325,6 +756,10 @@ char const *mode_option = "--vsipl++-profile-mode";
 unsigned int const mode_length = sizeof("--vsipl++-profile-mode") - 1;
 char const *output_option = "--vsipl++-profile-output";
 unsigned int const output_length = sizeof("--vsipl++-profile-output") - 1;
+char const *format_option = "--vsipl++-profile-format";
+unsigned int const format_length = sizeof("--vsipl++-profile-format") - 1;
+char const *buffer_option = "--vsipl++-profile-buffer";
+unsigned int const buffer_length = sizeof("--vsipl++-profile-buffer") - 1;
 
 Profiler_options::Profiler_options(int& argc, char**& argv)
     : profile_(0)
@@ -332,6 +767,7 @@ Profiler_options::Profiler_options(int& argc, char**& argv)
   int count = argc;
   char** value = argv;
   profiler_mode mode = pm_none;
+  profiler_format format = pf_text;
   std::string filename = "-"; // default is stdout
   while (--count)
   {
@@ -352,9 +788,24 @@ Profiler_options::Profiler_options(int& argc, char**& argv)
       if (strlen(*value) > output_length + 1)
         filename = &(*value)[output_length + 1];
     }
+    else if (!strncmp(*value, format_option, format_length))
+    {
+      if (strlen(*value) > format_length + 1 &&
+          !strcmp(&(*value)[format_length + 1], "binary"))
+        format = pf_binary;
+    }
+    else if (!strncmp(*value, buffer_option, buffer_length))
+    {
+      if (strlen(*value) > buffer_length + 1)
+      {
+        int size = atoi(&(*value)[buffer_length + 1]);
+        if (size > 0)
+          prof->set_buffer_size(size);
+      }
+    }
   }
   if (mode != pm_none)
-    this->profile_ = new Profile(filename, mode);
+    this->profile_ = new Profile(filename, mode, format);
 
   this->strip_args(argc, argv);
 }
@@ -370,7 +821,9 @@ Profiler_options::strip_args(int& argc, char**& argv)
   for (int i = 1; i < argc;)
   {
     if ( !strncmp(argv[i], mode_option, mode_length) ||
-         !strncmp(argv[i], output_option, output_length) )
+         !strncmp(argv[i], output_option, output_length) ||
+         !strncmp(argv[i], format_option, format_length) ||
+         !strncmp(argv[i], buffer_option, buffer_length) )
     {
       for (int j = i; j < argc; ++j)
         argv[j] = argv[j + 1];
@@ -20,6 +20,7 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <iosfwd>
 
 #include <vsip/core/config.hpp>
 #include <vsip/core/noncopyable.hpp>
@@ -467,69 +468,174 @@ enum profiler_mode
   pm_none
 };
 
+/// Output format of trace mode.
+enum profiler_format
+{
+  pf_text,
+  pf_binary
+};
+
+/// Interned event name.  IDs are positive; 0 denotes no event.
+typedef unsigned int event_id_type;
+
+/// Profiler.
+///
+/// Event names are interned into small integer IDs.  Call sites with
+/// a constant name keep its ID in a static Event, or in Type_event
+/// for the name of a type, and intern it on first use only.  Names
+/// built at run time are looked up in per-thread caches of recently
+/// interned names.  Events are recorded by
+/// each thread into its own log without locking: in trace mode into
+/// a ring buffer, which keeps the most recent events, and in
+/// accumulate mode into a table indexed by ID.  dump() must not run
+/// concurrently with threads recording events.
+///
+/// In trace mode dump() can write a compact binary file, which
+/// scripts/trace2json.pl converts into the Chrome trace event format
+/// understood by chrome://tracing and Perfetto.
+
 class Profiler
 {
   typedef DefaultTime    TP;
   typedef TP::stamp_type stamp_type;
-  struct Entry;
-  friend struct Entry;
+  typedef TP::tick_type  tick_type;
+
+public:
+  struct Thread_log;
 
-  struct Trace_entry
+  /// Trace record, as stored in the ring buffers and binary traces.
+  struct Trace_record
   {
-    int         idx;
-    std::string name;
-    stamp_type  stamp;
-    int         end;
-    int         value;
-    
-    Trace_entry(int i, std::string const &n, stamp_type s, int e, int v)
-      : idx(i), name(n), stamp(s), end(e), value(v) {}
+    tick_type     ticks;
+    event_id_type event;
+    int           idx;		// position in the thread's trace
+    int           end;		// idx of the opening record, or 0
+    int           value;
   };
 
   struct Accum_entry
   {
-    stamp_type total;  // total time spent
-    size_t     count;  // # times called
-    int        value;  // op count per call
-    
-    Accum_entry(stamp_type t, size_t c, int v)
-      : total(t), count(c), value(v) {}
+    tick_type total;  // total time spent
+    size_t    count;  // # times called
+    int       value;  // op count per call
   };
 
+  /// Maximum number of distinct event names.
+  static unsigned const max_events = 16384;
+
+  /// Default size of the per-thread trace buffers, in records.
+  static unsigned const default_buffer_size = 65536;
+
 public:
 
   Profiler();
   ~Profiler();
 
+  /// Return the ID of the event NAME, adding it if necessary.
+  event_id_type intern(char const* name);
+  event_id_type intern(std::string const& name);
+
+  /// Return the name of the event ID.
+  char const* name(event_id_type id) const { return names_[id]; }
+
+  int event(event_id_type id, int value, int open_id,
+            stamp_type stamp = stamp_type());
   int event(std::string const &name, int value, int id, 
             stamp_type stamp = stamp_type());
   void dump(std::string const &filename, char mode='w');
   void set_mode(profiler_mode mode) { mode_ = mode; }
+  profiler_mode mode() const { return mode_; }
+  void set_format(profiler_format format) { format_ = format; }
+
+  /// Set the size of the trace buffers of threads that start
+  /// recording afterwards.  SIZE is rounded up to a power of two.
+  void set_buffer_size(unsigned size);
 
 private:
-  typedef std::map<std::string, Accum_entry> accum_type;
-  typedef std::vector<Trace_entry> trace_type;
+  Thread_log*   thread_log();
+  event_id_type intern(char const* name, size_t length, unsigned hash);
+  event_id_type nested(Thread_log* log, event_id_type id, int open_id);
 
-  profiler_mode              mode_;
-  int                        count_;
-  trace_type                 data_;
-  accum_type                 accum_;
+  void dump_trace(std::ostream& os);
+  void dump_binary(std::ostream& os);
+  void dump_accum(std::ostream& os);
 
-#if VSIP_IMPL_PROFILE_NESTING
-  typedef std::vector<std::string> event_stack_type;
-  event_stack_type           event_stack_;
-#endif
+  profiler_mode              mode_;
+  profiler_format            format_;
+  unsigned                   buffer_size_;
+
+  // Interned names.  NAMES_ has a fixed capacity, so that it can be
+  // read without locking; TABLE_ is an open-addressed hash table of
+  // IDs, protected by LOCK_.
+  char const**               names_;
+  event_id_type*             table_;
+  unsigned                   num_events_;
+  int volatile               lock_;
+
+  Thread_log* volatile       logs_;	// list of all thread logs
+  unsigned volatile          num_threads_;
+  unsigned                   serial_;
 };
 
 
 extern Profiler* prof;
 
+
+
+/// An event with a constant name, interned on first use.  Declared
+/// static at a call site, as
+///
+///   static profile::Event event = { "name", 0 };
+///
+/// it is initialized statically and interned once per program.
+
+struct Event
+{
+  /// Return the ID of the event, or 0 if the profiler is off.
+  event_id_type get()
+  {
+    if (prof->mode() == pm_none)
+      return 0;
+    // Threads racing here intern the same name to the same ID.
+    if (id == 0)
+      id = prof->intern(name);
+    return id;
+  }
+
+  char const*            name;
+  event_id_type volatile id;
+};
+
+
+
+/// The event named by T::name(), interned once per type T.
+
+template <typename T>
+struct Type_event
+{
+  /// Return the ID of the event, or 0 if the profiler is off.
+  static event_id_type get()
+  {
+    if (prof->mode() == pm_none)
+      return 0;
+    if (id == 0)
+      id = prof->intern(T::name());
+    return id;
+  }
+
+  static event_id_type volatile id;
+};
+
+template <typename T>
+event_id_type volatile Type_event<T>::id = 0;
+
 class Profile
 {
 public:
-  Profile(std::string const &filename, profiler_mode mode = pm_accum)
+  Profile(std::string const &filename, profiler_mode mode = pm_accum,
+          profiler_format format = pf_text)
     : filename_(filename), mode_(mode)
-  { prof->set_mode(mode);}
+  { prof->set_mode(mode); prof->set_format(format); }
   ~Profile() { prof->dump(this->filename_);}
 
 private:
@@ -582,10 +688,10 @@ public:
     Accumulator_base & scope_;
     int id_;
   };
-  friend struct Scope;
+  friend class Scope;
 
   Accumulator_base(std::string const &name, unsigned int ops)
-    : name_(name), ops_(ops)
+    : name_(name), event_id_(prof ? prof->intern(name) : 0), ops_(ops)
   {}
 
   void ops(unsigned int ops_count) { this->ops_ = ops_count;}
@@ -602,18 +708,19 @@ public:
 
 private:
   std::string name_;
+  event_id_type event_id_;
   unsigned int ops_;
   Acc_timer timer_;
 };
 
 inline Accumulator_base<true>::Scope::Scope(Accumulator_base<true> &a)
   : scope_(a),
-    id_(prof->event(scope_.name(), scope_.ops(), 0, scope_.enter()))
+    id_(prof->event(scope_.event_id_, scope_.ops(), 0, scope_.enter()))
 {}
 
 inline Accumulator_base<true>::Scope::~Scope()
 {
-  prof->event(scope_.name(), 0, id_, scope_.leave());
+  prof->event(scope_.event_id_, 0, id_, scope_.leave());
 }
 
 template <bool enabled> class Scope_base;
@@ -623,19 +730,35 @@ class Scope_base<false> : Non_copyable
 {
 public:
   Scope_base(std::string const &, int) {}
+  Scope_base(char const *, int) {}
+  Scope_base(event_id_type, int) {}
+  Scope_base(Event&, int) {}
 };
 
+/// Record an event while the object is in scope.  Nothing is
+/// recorded, and the name is not interned, when the profiler is off.
+
 template <>
 class Scope_base<true> : Non_copyable
 {
 public:
   Scope_base(std::string const &name, int value=0)
-    : name_(name), id_  (prof->event(name, value, 0)) {}
-  ~Scope_base() { prof->event(name_, 0, id_, DefaultTime::stamp_type());}
+    : event_(prof->mode() != pm_none ? prof->intern(name) : 0),
+      id_   (event_ ? prof->event(event_, value, 0) : 0) {}
+  Scope_base(char const *name, int value=0)
+    : event_(prof->mode() != pm_none ? prof->intern(name) : 0),
+      id_   (event_ ? prof->event(event_, value, 0) : 0) {}
+  Scope_base(event_id_type event, int value=0)
+    : event_(event),
+      id_   (event_ ? prof->event(event_, value, 0) : 0) {}
+  Scope_base(Event& event, int value=0)
+    : event_(event.get()),
+      id_   (event_ ? prof->event(event_, value, 0) : 0) {}
+  ~Scope_base() { if (id_) prof->event(event_, 0, id_); }
 
 private:
-  std::string name_;
-  int   id_;
+  event_id_type event_;
+  int           id_;
 };
 
 
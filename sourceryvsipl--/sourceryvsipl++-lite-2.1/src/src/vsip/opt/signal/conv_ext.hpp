@@ -21,6 +21,8 @@
   Included Files
 ***********************************************************************/
 
+#include <memory>
+
 #include <vsip/support.hpp>
 #include <vsip/domain.hpp>
 #include <vsip/vector.hpp>
@@ -31,6 +33,7 @@
 #include <vsip/core/signal/conv_common.hpp>
 #include <vsip/core/extdata_dist.hpp>
 #include <vsip/opt/dispatch.hpp>
+#include <vsip/opt/signal/conv_fft.hpp>
 
 /***********************************************************************
   Declarations
@@ -74,6 +77,9 @@ public:
     out_buffer_(output_size_.size()),
     tmp_buffer_(input_size_.size() + kernel_size_.size() - 1),
     decimation_ (decimation),
+    fft_        (Conv_fft_factory<dim, T>::create(
+		   coeff_, input_size_, output_size_, Supp, decimation_,
+		   a_hint)),
     pm_non_opt_calls_ (0)
   {}
   Convolution(Convolution const&) VSIP_NOTHROW;
@@ -95,6 +101,7 @@ public:
     if (!strcmp(what, "in_ext_cost"))        return pm_in_ext_cost_;
     else if (!strcmp(what, "out_ext_cost"))  return pm_out_ext_cost_;
     else if (!strcmp(what, "non-opt-calls")) return pm_non_opt_calls_;
+    else if (!strcmp(what, "fft"))           return fft_.get() ? 1.f : 0.f;
     else return 0.f;
   }
 
@@ -136,6 +143,7 @@ private:
   aligned_array<T> out_buffer_;
   aligned_array<T> tmp_buffer_;
   length_type     decimation_;
+  std::auto_ptr<Conv_fft<dim, T> > fft_; // FFT implementation, if faster
 
   int             pm_non_opt_calls_;
   size_t          pm_in_ext_cost_;
@@ -196,7 +204,11 @@ VSIP_NOTHROW
   stride_type s_in  = in_ext.stride(0);
   stride_type s_out = out_ext.stride(0);
 
-  if (Supp == support_full)
+  if (fft_.get())
+  {
+    (*fft_)(pin, s_in, pout, s_out);
+  }
+  else if (Supp == support_full)
   {
     conv_full<T>(pcoeff_, M, pin, N, s_in, pout, P, s_out, decimation_);
   }
@@ -272,7 +284,12 @@ VSIP_NOTHROW
   stride_type out_row_stride   = out_ext.stride(0);
   stride_type out_col_stride   = out_ext.stride(1);
 
-  if (Supp == support_full)
+  if (fft_.get())
+  {
+    (*fft_)(pin, in_row_stride, in_col_stride,
+	    pout, out_row_stride, out_col_stride);
+  }
+  else if (Supp == support_full)
   {
     conv_full<T>(pcoeff_, Mr, Mc, coeff_row_stride, coeff_col_stride,
 		 pin, Nr, Nc, in_row_stride, in_col_stride,
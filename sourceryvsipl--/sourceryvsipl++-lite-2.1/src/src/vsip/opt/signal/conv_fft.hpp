@@ -0,0 +1,462 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    vsip/opt/signal/conv_fft.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Convolution using FFT overlap and save.
+*/
+
+#ifndef VSIP_OPT_SIGNAL_CONV_FFT_HPP
+#define VSIP_OPT_SIGNAL_CONV_FFT_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include <vsip/support.hpp>
+#include <vsip/domain.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/core/fft.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/core/domain_utils.hpp>
+#include <vsip/core/metaprogramming.hpp>
+#include <vsip/core/signal/types.hpp>
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+
+/// Cost of the FFT convolution in direct convolution flops, measured
+/// with benchmarks/conv and benchmarks/conv2d (cases 11 to 26): each
+/// FFT flop of a D-dimensional convolution costs
+/// conv_fft_flop_cost[D-1], and each segment conv_fft_segment_cost[D-1]
+/// more.  The direct loops test the input bounds for every product, so
+/// FFT flops are cheaper.
+double const conv_fft_flop_cost[]    = { 0.75, 0.3 };
+double const conv_fft_segment_cost[] = { 0.,   3500. };
+
+/// Length of the overlap-save FFTs along a dimension for a kernel of
+/// M samples and an extended input of E samples: a power of 2 of at
+/// least four times the kernel size, unless the whole input fits in
+/// less.
+inline length_type
+conv_fft_size(length_type m, length_type e)
+{
+  length_type size = 1;
+  while (size < 4 * m && size < e)
+    size *= 2;
+  return size;
+}
+
+/// Index in the full convolution of the first output of a convolution
+/// with support SUPP and a kernel of M samples.
+inline length_type
+conv_fft_offset(support_region_type supp, length_type m)
+{
+  if      (supp == support_full) return 0;
+  else if (supp == support_same) return m / 2;
+  else                           return m - 1;
+}
+
+template <dimension_type D>
+Index<D>
+conv_fft_offset(support_region_type supp, Domain<D> const& kernel_size)
+{
+  Index<D> offset;
+  for (dimension_type d = 0; d < D; ++d)
+    offset[d] = conv_fft_offset(supp, kernel_size[d].size());
+  return offset;
+}
+
+/// Return true if computing a convolution of type T with the given
+/// kernel and output sizes with FFTs takes fewer operations than
+/// computing it directly.
+template <typename T, dimension_type D>
+bool
+conv_fft_profitable(
+  Domain<D> const& kernel_size,
+  Domain<D> const& output_size,
+  length_type      decimation)
+{
+  bool const is_complex = Is_complex<T>::value;
+
+  double points = 1;
+  double tiles  = 1;
+  double direct = is_complex ? 8 : 2;
+
+  for (dimension_type d = 0; d < D; ++d)
+  {
+    length_type const m = kernel_size[d].size();
+    length_type const j = (output_size[d].size() - 1) * decimation + 1;
+    length_type const n = conv_fft_size(m, j + m - 1);
+
+    points *= n;
+    tiles  *= (j + n - m) / (n - m + 1);
+    direct *= m * output_size[d].size();
+  }
+
+  // Forward and inverse transform, and the frequency domain product.
+  double flops = points *
+    (is_complex ? 10 * std::log(points) / std::log(2.) + 6
+                :  5 * std::log(points) / std::log(2.) + 3);
+  double fft = tiles * (conv_fft_flop_cost[D-1] * flops +
+			conv_fft_segment_cost[D-1]);
+
+  return fft < direct;
+}
+
+
+
+// Convolution implementation, based on FFT overlap-save.
+//
+// Outputs are taken from the full convolution, starting at OFFSET and
+// every DECIMATION samples along each dimension.  The full convolution
+// outputs covering them are computed in segments (tiles in 2-D).  Each segment is the
+// circular convolution of a window of the input, zero-extended
+// beyond its bounds, with the kernel; the first M - 1 samples along
+// each dimension wrap around and are discarded.  The outputs kept by
+// the decimation are copied out.
+
+template <dimension_type D, typename T>
+class Conv_fft;
+
+template <typename T>
+class Conv_fft<1, T>
+{
+  typedef typename Complex_of<T>::type complex_type;
+  typedef Dense<1, T> block_type;
+
+  typedef Fft<const_Vector, T, complex_type,
+	      Type_equal<T, complex_type>::value ? fft_fwd : 0, by_reference>
+		f_fft_type;
+  typedef Fft<const_Vector, complex_type, T,
+	      Type_equal<T, complex_type>::value ? fft_inv : 0, by_reference>
+		i_fft_type;
+
+public:
+  Conv_fft(
+    Domain<1> const& kernel_size,
+    Domain<1> const& input_size,
+    Domain<1> const& output_size,
+    Index<1> const&  offset,
+    length_type      decimation)
+    VSIP_THROW((std::bad_alloc))
+  : m_        (kernel_size.size()),
+    n_        (input_size.size()),
+    p_        (output_size.size()),
+    offset_   (offset[0]),
+    decimation_(decimation),
+    n_fft_    (conv_fft_size(m_, (p_ - 1) * decimation_ + m_)),
+    f_fft_    (Domain<1>(n_fft_), 1.0),
+    i_fft_    (Domain<1>(n_fft_), 1.0 / n_fft_),
+    buf_      (n_fft_),
+    block_    (Domain<1>(n_fft_), buf_.get()),
+    f_buf_    (f_fft_.output_size().size()),
+    f_kernel_ (f_fft_.output_size().size())
+  {}
+
+  /// Transform the kernel.
+  template <typename Block>
+  void set_kernel(const_Vector<T, Block> kernel) VSIP_NOTHROW
+  {
+    Vector<T, block_type> t_buf(block_);
+
+    assert(kernel.size() == m_);
+    block_.admit(false);
+    t_buf(Domain<1>(m_)) = kernel;
+    t_buf(Domain<1>(m_, 1, n_fft_ - m_)) = T();
+    f_fft_(t_buf, f_kernel_);
+    block_.release(false);
+  }
+
+  /// Convolve the N samples at IN with the kernel into the P outputs
+  /// at OUT.
+  void operator()(T const* in, stride_type in_stride,
+		  T*       out, stride_type out_stride)
+    VSIP_NOTHROW
+  {
+    Vector<T, block_type> t_buf(block_);
+    T* buf = buf_.get();
+
+    length_type const m     = m_ - 1;          // wrapped samples
+    length_type const valid = n_fft_ - m;      // outputs per segment
+    length_type const span  = (p_ - 1) * decimation_ + 1;
+
+    for (index_type pos = 0; pos < span; pos += valid)
+    {
+      index_type const p0 = (pos + decimation_ - 1) / decimation_;
+      index_type const p1 = std::min(p_, (pos + valid + decimation_ - 1) /
+				     decimation_);
+      if (p0 >= p1)
+	continue;
+
+      // Full convolution outputs offset_ + pos + i, for i < valid, come
+      // from inputs offset_ + pos - m to offset_ + pos - m + n_fft_ - 1.
+      stride_type const start = stride_type(offset_ + pos) - stride_type(m);
+      fill_segment(in, in_stride, start, buf);
+
+      block_.admit(true);
+      f_fft_(t_buf, f_buf_);
+      f_buf_ *= f_kernel_;
+      i_fft_(f_buf_, t_buf);
+      block_.release(true);
+
+      for (index_type p = p0; p < p1; ++p)
+	out[p * out_stride] = buf[m + p * decimation_ - pos];
+    }
+  }
+
+private:
+  // Copy inputs START to START + n_fft_ - 1 to BUF, zero outside the
+  // input.
+  void fill_segment(T const* in, stride_type in_stride, stride_type start,
+		    T* buf)
+  {
+    stride_type const n  = n_;
+    stride_type const lo = std::max<stride_type>(0, -start);
+    stride_type const hi = std::max<stride_type>(
+      lo, std::min<stride_type>(n_fft_, n - start));
+
+    std::fill(buf, buf + lo, T());
+    for (stride_type i = lo; i < hi; ++i)
+      buf[i] = in[(start + i) * in_stride];
+    std::fill(buf + hi, buf + n_fft_, T());
+  }
+
+  Conv_fft(Conv_fft const&);
+  Conv_fft& operator=(Conv_fft const&);
+
+  length_type          m_;          // kernel size
+  length_type          n_;          // input size
+  length_type          p_;          // output size
+  length_type          offset_;     // full convolution index of output 0
+  length_type          decimation_;
+  length_type          n_fft_;      // length of the overlap-save FFTs
+  f_fft_type           f_fft_;
+  i_fft_type           i_fft_;
+  aligned_array<T>     buf_;        // segment - time domain
+  block_type           block_;
+  Vector<complex_type> f_buf_;      // segment - freq domain
+  Vector<complex_type> f_kernel_;   // kernel  - freq domain
+};
+
+
+
+template <typename T>
+class Conv_fft<2, T>
+{
+  typedef typename Complex_of<T>::type complex_type;
+  typedef Dense<2, T> block_type;
+
+  // Real transforms halve the row dimension.
+  typedef Fft<const_Matrix, T, complex_type,
+	      Type_equal<T, complex_type>::value ? fft_fwd : 1, by_reference>
+		f_fft_type;
+  typedef Fft<const_Matrix, complex_type, T,
+	      Type_equal<T, complex_type>::value ? fft_inv : 1, by_reference>
+		i_fft_type;
+
+public:
+  Conv_fft(
+    Domain<2> const& kernel_size,
+    Domain<2> const& input_size,
+    Domain<2> const& output_size,
+    Index<2> const&  offset,
+    length_type      decimation)
+    VSIP_THROW((std::bad_alloc))
+  : mr_       (kernel_size[0].size()),
+    mc_       (kernel_size[1].size()),
+    nr_       (input_size[0].size()),
+    nc_       (input_size[1].size()),
+    pr_       (output_size[0].size()),
+    pc_       (output_size[1].size()),
+    offset_r_ (offset[0]),
+    offset_c_ (offset[1]),
+    decimation_(decimation),
+    n_fft_r_  (conv_fft_size(mr_, (pr_ - 1) * decimation_ + mr_)),
+    n_fft_c_  (conv_fft_size(mc_, (pc_ - 1) * decimation_ + mc_)),
+    f_fft_    (Domain<2>(n_fft_r_, n_fft_c_), 1.0),
+    i_fft_    (Domain<2>(n_fft_r_, n_fft_c_), 1.0 / (n_fft_r_ * n_fft_c_)),
+    buf_      (n_fft_r_ * n_fft_c_),
+    block_    (Domain<2>(n_fft_r_, n_fft_c_), buf_.get()),
+    f_buf_    (f_fft_.output_size()[0].size(),
+	       f_fft_.output_size()[1].size()),
+    f_kernel_ (f_fft_.output_size()[0].size(),
+	       f_fft_.output_size()[1].size())
+  {}
+
+  /// Transform the kernel.
+  template <typename Block>
+  void set_kernel(const_Matrix<T, Block> kernel) VSIP_NOTHROW
+  {
+    Matrix<T, block_type> t_buf(block_);
+
+    assert(kernel.size(0) == mr_ && kernel.size(1) == mc_);
+    block_.admit(false);
+    t_buf = T();
+    t_buf(Domain<2>(mr_, mc_)) = kernel;
+    f_fft_(t_buf, f_kernel_);
+    block_.release(false);
+  }
+
+  /// Convolve the NR x NC input at IN with the kernel into the PR x PC
+  /// outputs at OUT.
+  void operator()(
+    T const* in,  stride_type in_row_stride,  stride_type in_col_stride,
+    T*       out, stride_type out_row_stride, stride_type out_col_stride)
+    VSIP_NOTHROW
+  {
+    Matrix<T, block_type> t_buf(block_);
+    T* buf = buf_.get();
+
+    length_type const mr      = mr_ - 1;
+    length_type const mc      = mc_ - 1;
+    length_type const valid_r = n_fft_r_ - mr;
+    length_type const valid_c = n_fft_c_ - mc;
+    length_type const span_r  = (pr_ - 1) * decimation_ + 1;
+    length_type const span_c  = (pc_ - 1) * decimation_ + 1;
+    length_type const dec     = decimation_;
+
+    for (index_type pos_r = 0; pos_r < span_r; pos_r += valid_r)
+    {
+      index_type const r0 = (pos_r + dec - 1) / dec;
+      index_type const r1 = std::min(pr_, (pos_r + valid_r + dec - 1) / dec);
+      if (r0 >= r1)
+	continue;
+      stride_type const start_r = stride_type(offset_r_ + pos_r) -
+	                          stride_type(mr);
+
+      for (index_type pos_c = 0; pos_c < span_c; pos_c += valid_c)
+      {
+	index_type const c0 = (pos_c + dec - 1) / dec;
+	index_type const c1 = std::min(pc_,
+				       (pos_c + valid_c + dec - 1) / dec);
+	if (c0 >= c1)
+	  continue;
+	stride_type const start_c = stride_type(offset_c_ + pos_c) -
+	                            stride_type(mc);
+
+	fill_tile(in, in_row_stride, in_col_stride, start_r, start_c, buf);
+
+	block_.admit(true);
+	f_fft_(t_buf, f_buf_);
+	f_buf_ *= f_kernel_;
+	i_fft_(f_buf_, t_buf);
+	block_.release(true);
+
+	for (index_type r = r0; r < r1; ++r)
+	{
+	  T const* row = buf + (mr + r * dec - pos_r) * n_fft_c_ +
+	                 mc - pos_c;
+	  for (index_type c = c0; c < c1; ++c)
+	    out[r * out_row_stride + c * out_col_stride] = row[c * dec];
+	}
+      }
+    }
+  }
+
+private:
+  // Copy the tile of inputs starting at row START_R and column START_C
+  // to BUF, zero outside the input.
+  void fill_tile(T const* in, stride_type in_row_stride,
+		 stride_type in_col_stride,
+		 stride_type start_r, stride_type start_c, T* buf)
+  {
+    stride_type const nr = nr_;
+    stride_type const nc = nc_;
+    stride_type const lo = std::max<stride_type>(0, -start_c);
+    stride_type const hi = std::max<stride_type>(
+      lo, std::min<stride_type>(n_fft_c_, nc - start_c));
+
+    for (stride_type r = 0; r < stride_type(n_fft_r_); ++r)
+    {
+      T* row = buf + r * n_fft_c_;
+      stride_type const ir = start_r + r;
+      if (ir < 0 || ir >= nr)
+      {
+	std::fill(row, row + n_fft_c_, T());
+	continue;
+      }
+      T const* in_row = in + ir * in_row_stride + start_c * in_col_stride;
+      std::fill(row, row + lo, T());
+      for (stride_type c = lo; c < hi; ++c)
+	row[c] = in_row[c * in_col_stride];
+      std::fill(row + hi, row + n_fft_c_, T());
+    }
+  }
+
+  Conv_fft(Conv_fft const&);
+  Conv_fft& operator=(Conv_fft const&);
+
+  length_type          mr_, mc_;         // kernel size
+  length_type          nr_, nc_;         // input size
+  length_type          pr_, pc_;         // output size
+  length_type          offset_r_, offset_c_;
+  length_type          decimation_;
+  length_type          n_fft_r_, n_fft_c_;
+  f_fft_type           f_fft_;
+  i_fft_type           i_fft_;
+  aligned_array<T>     buf_;             // tile - time domain
+  block_type           block_;
+  Matrix<complex_type> f_buf_;           // tile   - freq domain
+  Matrix<complex_type> f_kernel_;        // kernel - freq domain
+};
+
+
+
+/// Create a Conv_fft if FFTs of T are available and faster than the
+/// direct convolution, otherwise return 0.
+template <dimension_type D,
+	  typename       T,
+	  bool           Avail = Is_fft_avail<T>::value>
+struct Conv_fft_factory
+{
+  template <typename ViewT>
+  static Conv_fft<D, T>*
+  create(ViewT kernel, Domain<D> const& input_size,
+	 Domain<D> const& output_size, support_region_type supp,
+	 length_type decimation, alg_hint_type h)
+  {
+    Domain<D> kernel_size = view_domain(kernel);
+    if (h != alg_time ||
+	!conv_fft_profitable<T>(kernel_size, output_size, decimation))
+      return 0;
+    Conv_fft<D, T>* fft = new Conv_fft<D, T>(
+      kernel_size, input_size, output_size,
+      conv_fft_offset(supp, kernel_size), decimation);
+    fft->set_kernel(kernel);
+    return fft;
+  }
+};
+
+template <dimension_type D, typename T>
+struct Conv_fft_factory<D, T, false>
+{
+  template <typename ViewT>
+  static Conv_fft<D, T>*
+  create(ViewT, Domain<D> const&, Domain<D> const&, support_region_type,
+	 length_type, alg_hint_type)
+  { return 0;}
+};
+
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_SIGNAL_CONV_FFT_HPP
@@ -8,7 +8,8 @@
     @author  Jules Bergmann
     @date    2005-10-05
     @brief   VSIPL++ Library: Correlation class implementation using 
-			      FFT overlap and add algorithm.
+			      FFT overlap and add (1-D) and overlap
+			      save (2-D) algorithms.
 */
 
 #ifndef VSIP_OPT_SIGNAL_CORR_OPT_HPP
@@ -23,6 +24,7 @@
 ***********************************************************************/
 
 #include <algorithm>
+#include <memory>
 
 #include <vsip/support.hpp>
 #include <vsip/domain.hpp>
@@ -34,6 +36,9 @@
 #include <vsip/core/profile.hpp>
 #include <vsip/core/signal/conv_common.hpp>
 #include <vsip/core/signal/corr_common.hpp>
+#include <vsip/core/extdata_dist.hpp>
+#include <vsip/core/fft.hpp>
+#include <vsip/opt/signal/conv_fft.hpp>
 #include <vsip/opt/dispatch.hpp>
 
 /***********************************************************************
@@ -122,16 +127,6 @@ public:
 	    Vector<T, Block2>       out)
     VSIP_NOTHROW;
 
-  template <typename Block0,
-	    typename Block1,
-	    typename Block2>
-  void
-  impl_correlate(bias_type               bias,
-	    const_Matrix<T, Block0> ref,
-	    const_Matrix<T, Block1> in,
-	    Matrix<T, Block2>       out)
-    VSIP_NOTHROW;
-
   typedef Layout<1, row1_type, Stride_unit, Cmplx_inter_fmt> layout_type;
   typedef Vector<T> coeff_view_type;
   typedef impl::Ext_data<typename coeff_view_type::block_type, layout_type> c_ext_type;
@@ -169,6 +164,92 @@ private:
 
 
 
+/// 2-D correlation.
+///
+/// The correlation is computed as the conjugate of the convolution of
+/// the input with the reversed, conjugated reference, using Conv_fft,
+/// when that is estimated to be faster than the direct algorithm.
+/// The transformed reference is kept between calls and only
+/// recomputed when the reference values change.
+
+template <support_region_type Supp,
+	  typename            T,
+	  unsigned            n_times,
+          alg_hint_type       a_hint>
+class Correlation_fft<2, Supp, T, n_times, a_hint>
+{
+  static dimension_type const dim = 2;
+
+  // Compile-time constants.
+public:
+  static support_region_type const supprt  = Supp;
+
+  // Constructors, copies, assignments, and destructors.
+public:
+  Correlation_fft(
+    Domain<dim> const&   ref_size,
+    Domain<dim> const&   input_size)
+    VSIP_THROW((std::bad_alloc));
+
+  Correlation_fft(Correlation_fft const&) VSIP_NOTHROW;
+  Correlation_fft& operator=(Correlation_fft const&) VSIP_NOTHROW;
+  ~Correlation_fft() VSIP_NOTHROW {}
+
+  // Accessors.
+public:
+  Domain<dim> const& reference_size() const VSIP_NOTHROW  { return ref_size_; }
+  Domain<dim> const& input_size() const VSIP_NOTHROW   { return input_size_; }
+  Domain<dim> const& output_size() const VSIP_NOTHROW  { return output_size_; }
+
+  float impl_performance(char* what) const
+  {
+    if (!strcmp(what, "in_ext_cost")) return pm_in_ext_cost_;
+    else if (!strcmp(what, "out_ext_cost")) return pm_out_ext_cost_;
+    else if (!strcmp(what, "fft")) return fft_.get() ? 1.f : 0.f;
+    else return 0.f;
+  }
+
+  // Implementation functions.
+public:
+  template <typename Block0,
+	    typename Block1,
+	    typename Block2>
+  void
+  impl_correlate(bias_type               bias,
+	    const_Matrix<T, Block0> ref,
+	    const_Matrix<T, Block1> in,
+	    Matrix<T, Block2>       out)
+    VSIP_NOTHROW;
+
+private:
+  template <typename Block0>
+  void set_reference(const_Matrix<T, Block0> ref) VSIP_NOTHROW;
+
+  void finish(bias_type bias, T* out,
+	      stride_type out_row_stride, stride_type out_col_stride)
+    VSIP_NOTHROW;
+
+  // Member data.
+private:
+  Domain<dim>     ref_size_;
+  Domain<dim>     input_size_;
+  Domain<dim>     output_size_;
+
+  std::auto_ptr<Conv_fft<2, T> > fft_;
+  Matrix<T>       ref_;		// reference of the cached transform
+  bool            ref_valid_;
+
+  aligned_array<T> in_buffer_;
+  aligned_array<T> out_buffer_;
+  aligned_array<T> ref_buffer_;
+
+  size_t          pm_ref_ext_cost_;
+  size_t          pm_in_ext_cost_;
+  size_t          pm_out_ext_cost_;
+};
+
+
+
 /***********************************************************************
   Definitions
 ***********************************************************************/
@@ -337,10 +418,163 @@ VSIP_NOTHROW
 
 
 
+
+/// Construct a 2-D correlation object.
+
+template <support_region_type Supp,
+	  typename            T,
+	  unsigned            n_times,
+          alg_hint_type       a_hint>
+Correlation_fft<2, Supp, T, n_times, a_hint>::Correlation_fft(
+  Domain<dim> const&   ref_size,
+  Domain<dim> const&   input_size)
+VSIP_THROW((std::bad_alloc))
+  : ref_size_   (normalize(ref_size)),
+    input_size_ (normalize(input_size)),
+    output_size_(conv_output_size(Supp, ref_size_, input_size_, 1)),
+    ref_        (ref_size_[0].size(), ref_size_[1].size()),
+    ref_valid_  (false),
+    in_buffer_  (input_size_.size()),
+    out_buffer_ (output_size_.size()),
+    ref_buffer_ (ref_size_.size()),
+    pm_ref_ext_cost_(0),
+    pm_in_ext_cost_ (0),
+    pm_out_ext_cost_(0)
+{
+  if (a_hint == alg_time &&
+      conv_fft_profitable<T>(ref_size_, output_size_, 1))
+  {
+    // Output (0, 0) is at (M-1-shift) in the full convolution.
+    length_type const Mr = ref_size_[0].size();
+    length_type const Mc = ref_size_[1].size();
+    Index<2> offset;
+    if (Supp == support_full)
+      offset = Index<2>(0, 0);
+    else if (Supp == support_same)
+      offset = Index<2>(Mr - 1 - Mr/2, Mc - 1 - Mc/2);
+    else
+      offset = Index<2>(Mr - 1, Mc - 1);
+
+    fft_.reset(new Conv_fft<2, T>(ref_size_, input_size_, output_size_,
+				  offset, 1));
+  }
+}
+
+
+
+// Transform the reference, unless it is the one already transformed.
+
+template <support_region_type Supp,
+	  typename            T,
+	  unsigned            n_times,
+          alg_hint_type       a_hint>
+template <typename Block0>
+void
+Correlation_fft<2, Supp, T, n_times, a_hint>::set_reference(
+  const_Matrix<T, Block0> ref)
+VSIP_NOTHROW
+{
+  length_type const Mr = ref_size_[0].size();
+  length_type const Mc = ref_size_[1].size();
+
+  if (ref_valid_)
+  {
+    bool same = true;
+    for (index_type r = 0; same && r < Mr; ++r)
+      for (index_type c = 0; c < Mc; ++c)
+	if (ref.get(r, c) != ref_.get(r, c))
+	{
+	  same = false;
+	  break;
+	}
+    if (same)
+      return;
+  }
+
+  ref_ = ref;
+  fft_->set_kernel(impl_conj(ref_(Domain<2>(Domain<1>(Mr - 1, -1, Mr),
+					    Domain<1>(Mc - 1, -1, Mc)))));
+  ref_valid_ = true;
+}
+
+
+
+// Conjugate (complex T) and unbias (if requested) the convolution
+// outputs at OUT.
+
+template <support_region_type Supp,
+	  typename            T,
+	  unsigned            n_times,
+          alg_hint_type       a_hint>
+void
+Correlation_fft<2, Supp, T, n_times, a_hint>::finish(
+  bias_type   bias,
+  T*          out,
+  stride_type out_row_stride,
+  stride_type out_col_stride)
+VSIP_NOTHROW
+{
+  typedef typename Scalar_of<T>::type scalar_type;
+
+  length_type const Mr = ref_size_[0].size();
+  length_type const Mc = ref_size_[1].size();
+  length_type const Nr = input_size_[0].size();
+  length_type const Nc = input_size_[1].size();
+  length_type const Pr = output_size_[0].size();
+  length_type const Pc = output_size_[1].size();
+
+  bool const is_complex = !Type_equal<T, scalar_type>::value;
+  if (!is_complex && bias != unbiased)
+    return;
+
+  // Same shifts and edges as corr_full, corr_same and corr_min.
+  length_type row_shift, col_shift, row_edge, col_edge;
+  if (Supp == support_full)
+  {
+    row_shift = Mr - 1; col_shift = Mc - 1;
+    row_edge  = 0;      col_edge  = 0;
+  }
+  else if (Supp == support_same)
+  {
+    row_shift = Mr / 2; col_shift = Mc / 2;
+    row_edge  = Mr / 2; col_edge  = Mc / 2;
+  }
+  else
+  {
+    row_shift = 0; col_shift = 0;
+    row_edge  = 0; col_edge  = 0;
+  }
+
+  for (index_type r = 0; r < Pr; ++r)
+  {
+    T* row = out + r * out_row_stride;
+
+    scalar_type row_scale;
+    if (r < row_shift)            row_scale = scalar_type(r + Mr - row_shift);
+    else if (r >= Nr - row_edge)  row_scale = scalar_type(Nr + row_shift - r);
+    else                          row_scale = scalar_type(Mr);
+
+    for (index_type c = 0; c < Pc; ++c)
+    {
+      T value = impl_conj(row[c * out_col_stride]);
+      if (bias == unbiased)
+      {
+	scalar_type scale = row_scale;
+	if (c < col_shift)            scale *= scalar_type(c + Mc - col_shift);
+	else if (c >= Nc - col_edge)  scale *= scalar_type(Nc + col_shift - c);
+	else                          scale *= scalar_type(Mc);
+	value /= scale;
+      }
+      row[c * out_col_stride] = value;
+    }
+  }
+}
+
+
+
 // Perform 2-D correlation.
 
-template <dimension_type      D,
-	  support_region_type Supp,
+template <support_region_type Supp,
 	  typename            T,
 	  unsigned            n_times,
           alg_hint_type       a_hint>
@@ -348,17 +582,100 @@ template <typename Block0,
 	  typename Block1,
 	  typename Block2>
 void
-Correlation_fft<D, Supp, T, n_times, a_hint>::impl_correlate(
+Correlation_fft<2, Supp, T, n_times, a_hint>::impl_correlate(
   bias_type               bias,
   const_Matrix<T, Block0> ref,
   const_Matrix<T, Block1> in,
   Matrix<T, Block2>       out)
 VSIP_NOTHROW
 {
-  VSIP_IMPL_THROW(vsip::impl::unimplemented(
-    "Correlation_fft: 2D correlation not implemented."));
+  length_type const Mr = this->ref_size_[0].size();
+  length_type const Mc = this->ref_size_[1].size();
+  length_type const Nr = this->input_size_[0].size();
+  length_type const Nc = this->input_size_[1].size();
+  length_type const Pr = this->output_size_[0].size();
+  length_type const Pc = this->output_size_[1].size();
+
+  assert(Mr == ref.size(0));
+  assert(Mc == ref.size(1));
+  assert(Nr == in.size(0));
+  assert(Nc == in.size(1));
+  assert(Pr == out.size(0));
+  assert(Pc == out.size(1));
+
+  typedef typename Block_layout<Block0>::layout_type LP0;
+  typedef typename Block_layout<Block1>::layout_type LP1;
+  typedef typename Block_layout<Block2>::layout_type LP2;
+
+  typedef Layout<2, Any_type, Any_type, Cmplx_inter_fmt> req_LP;
+
+  typedef typename Adjust_layout<T, req_LP, LP0>::type use_LP0;
+  typedef typename Adjust_layout<T, req_LP, LP1>::type use_LP1;
+  typedef typename Adjust_layout<T, req_LP, LP2>::type use_LP2;
+
+  typedef Ext_data_dist<Block1, SYNC_IN,  use_LP1> in_ext_type;
+  typedef Ext_data_dist<Block2, SYNC_OUT, use_LP2> out_ext_type;
+
+  if (fft_.get())
+    set_reference(ref);
+
+  in_ext_type  in_ext (in.block(),  in_buffer_.get());
+  out_ext_type out_ext(out.block(), out_buffer_.get());
+
+  pm_in_ext_cost_  += in_ext.cost();
+  pm_out_ext_cost_ += out_ext.cost();
+
+  T* p_in    = in_ext.data();
+  T* p_out   = out_ext.data();
+
+  stride_type in_row_stride  = in_ext.stride(0);
+  stride_type in_col_stride  = in_ext.stride(1);
+  stride_type out_row_stride = out_ext.stride(0);
+  stride_type out_col_stride = out_ext.stride(1);
+
+  if (fft_.get())
+  {
+    (*fft_)(p_in, in_row_stride, in_col_stride,
+	    p_out, out_row_stride, out_col_stride);
+    finish(bias, p_out, out_row_stride, out_col_stride);
+    return;
+  }
+
+  typedef Ext_data_dist<Block0, SYNC_IN,  use_LP0> ref_ext_type;
+
+  ref_ext_type ref_ext(ref.block(), ref_buffer_.get());
+  pm_ref_ext_cost_ += ref_ext.cost();
+
+  T* p_ref   = ref_ext.data();
+
+  stride_type ref_row_stride = ref_ext.stride(0);
+  stride_type ref_col_stride = ref_ext.stride(1);
+
+  if (Supp == support_full)
+  {
+    corr_full<T>(bias,
+		 p_ref, Mr, Mc, ref_row_stride, ref_col_stride,
+		 p_in, Nr, Nc, in_row_stride, in_col_stride,
+		 p_out, Pr, Pc, out_row_stride, out_col_stride);
+  }
+  else if (Supp == support_same)
+  {
+    corr_same<T>(bias,
+		 p_ref, Mr, Mc, ref_row_stride, ref_col_stride,
+		 p_in, Nr, Nc, in_row_stride, in_col_stride,
+		 p_out, Pr, Pc, out_row_stride, out_col_stride);
+  }
+  else // (Supp == support_min)
+  {
+    corr_min<T>(bias,
+		p_ref, Mr, Mc, ref_row_stride, ref_col_stride,
+		p_in, Nr, Nc, in_row_stride, in_col_stride,
+		p_out, Pr, Pc, out_row_stride, out_col_stride);
+  }
 }
 
+
+
 namespace dispatcher
 {
 template <support_region_type R,
@@ -370,6 +687,18 @@ struct Evaluator<Corr_tag<1, R, T, N, H>, Opt_tag>
   static bool const ct_valid = true;
   typedef Correlation_fft<1, R, T, N, H> backend_type;
 };
+
+// The FFT path is only available for the types the FFT supports;
+// other types use the Generic_tag backend.
+template <support_region_type R,
+          typename            T,
+	  unsigned            N,
+          alg_hint_type       H>
+struct Evaluator<Corr_tag<2, R, T, N, H>, Opt_tag>
+{
+  static bool const ct_valid = Is_fft_avail<T>::value;
+  typedef Correlation_fft<2, R, T, N, H> backend_type;
+};
 } // namespace vsip::impl::dispatcher
 } // namespace vsip::impl
 } // namespace vsip
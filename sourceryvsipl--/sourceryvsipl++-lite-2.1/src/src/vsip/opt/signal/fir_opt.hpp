@@ -21,9 +21,12 @@
   Included Files
 ***********************************************************************/
 
+#include <algorithm>
+
 #include <vsip/support.hpp>
 #include <vsip/core/signal/fir_backend.hpp>
 #include <vsip/core/signal/conv.hpp>
+#include <vsip/core/fft.hpp>
 #include <vsip/opt/dispatch.hpp>
 #include <vsip/vector.hpp>
 #include <vsip/domain.hpp>
@@ -319,6 +322,349 @@ private:
   vsip::Convolution<const_Vector, nonsym, support_min, T> conv_;
 };
 
+// Fir implementation for decimation > 1, based on a polyphase
+// decomposition.
+//
+// The kernel is split into decimation_ sub-filters of q_ taps,
+// h_p[q] = h[q * decimation_ + p], and the extended input (the last
+// order_ samples of the previous frame followed by the new frame) is
+// split into the matching phases.  Each output then is the sum of the
+// phase correlations, so only the (order_ + 1) / decimation_ products
+// per output that survive the decimation are computed.  Outputs are
+// accumulated in blocks of block_size, with unit-stride loops of
+// constant length that the compiler can vectorize.
+
+template <typename T, symmetry_type S, obj_state C> 
+class Fir_poly_impl : public Fir_backend<T, S, C>
+{
+  typedef Fir_backend<T, S, C> base;
+  typedef Dense<1, T> block_type;
+
+  static length_type const block_size = 64;
+
+public:
+  Fir_poly_impl(
+    aligned_array<T> kernel,
+    length_type      k,
+    length_type      i,
+    length_type      d)
+  : base  (i, k, d),
+    skip_ (0),
+    q_    ((this->order_ + d) / d),
+    pad_  (q_ * d - 1),
+    len_  (this->output_size_ + q_ + block_size),
+    sub_  (d * q_),
+    buf_  (pad_ + i),
+    phase_(d * len_)
+  {
+    // spec says a nonsym kernel size has to be >1, but symmetric can be ==1:
+    assert(k > (S == nonsym));
+
+    length_type const size = this->kernel_size();
+    Vector<T, block_type> mirrored =
+      create_kernel<T, block_type, S>(kernel.get(), k, size);
+
+    // sub_[p * q_ + u] holds h_p[q_ - 1 - u], zero beyond the kernel.
+    for (index_type p = 0; p < d; ++p)
+      for (index_type u = 0; u < q_; ++u)
+      {
+	index_type const j = (q_ - 1 - u) * d + p;
+	sub_[p * q_ + u] = j < size ? mirrored.get(size - 1 - j) : T();
+      }
+    std::fill(buf_.get(), buf_.get() + pad_, T());
+    std::fill(phase_.get(), phase_.get() + phase_.size(), T());
+  }
+
+  Fir_poly_impl(Fir_poly_impl const &fir)
+    : base  (fir),
+      skip_ (fir.skip_),
+      q_    (fir.q_),
+      pad_  (fir.pad_),
+      len_  (fir.len_),
+      sub_  (VSIP_IMPL_ALLOC_ALIGNMENT, fir.sub_.size(), fir.sub_.get()),
+      buf_  (VSIP_IMPL_ALLOC_ALIGNMENT, fir.buf_.size(), fir.buf_.get()),
+      phase_(VSIP_IMPL_ALLOC_ALIGNMENT, fir.phase_.size(), fir.phase_.get())
+  {}
+  virtual Fir_poly_impl *clone() { return new Fir_poly_impl(*this);}
+
+  length_type apply(T *in, stride_type in_stride, length_type in_length,
+                    T *out, stride_type out_stride, length_type)
+  {
+    length_type const dec = this->decimation();
+    length_type const m = this->order_;
+    length_type const n = in_length;
+    length_type const skip = this->skip_;
+    length_type const count = (n - skip + dec - 1) / dec;
+
+    // buf_[pad_ - m + t] is sample t of the extended input; the
+    // pad_ - m leading zeros only meet zero-padded taps.
+    T* buf = buf_.get();
+    for (index_type t = 0; t < n; ++t)
+      buf[pad_ + t] = in[t * in_stride];
+
+    // Phase p holds the extended input samples that meet h_p.
+    for (index_type p = 0; p < dec; ++p)
+    {
+      T const* src = buf + pad_ + skip - p - (q_ - 1) * dec;
+      T* phase = phase_.get() + p * len_;
+      for (index_type t = 0; t < count + q_ - 1; ++t)
+	phase[t] = src[t * dec];
+    }
+
+    for (index_type j0 = 0; j0 < count; j0 += block_size)
+    {
+      T acc[block_size];
+      for (index_type j = 0; j < block_size; ++j)
+	acc[j] = T();
+      for (index_type p = 0; p < dec; ++p)
+      {
+	T const* sub = sub_.get() + p * q_;
+	T const* phase = phase_.get() + p * len_ + j0;
+	for (index_type u = 0; u < q_; ++u)
+	{
+	  T const h = sub[u];
+	  T const* x = phase + u;
+	  for (index_type j = 0; j < block_size; ++j)
+	    acc[j] += h * x[j];
+	}
+      }
+      length_type const size =
+	count - j0 < block_size ? count - j0 : block_size;
+      for (index_type j = 0; j < size; ++j)
+	out[(j0 + j) * out_stride] = acc[j];
+    }
+
+    if (C == state_save)
+    {
+      this->skip_ = skip + count * dec - n;
+      std::copy(buf + pad_ + n - m, buf + pad_ + n, buf + pad_ - m);
+    }
+    return count;
+  }
+
+  virtual void reset() VSIP_NOTHROW
+  {
+    skip_ = 0;
+    std::fill(buf_.get(), buf_.get() + pad_, T());
+  }
+
+  virtual char const* name() { return "fir-poly-opt"; }
+
+private:
+  length_type      skip_;  // how much of next input to skip
+  length_type      q_;     // taps per phase
+  length_type      pad_;   // extended input offset in buf_
+  length_type      len_;   // length of each phase in phase_
+  aligned_array<T> sub_;   // reversed sub-filters, one per phase
+  aligned_array<T> buf_;   // extended input
+  aligned_array<T> phase_; // phases of the extended input
+};
+
+
+
+/// Kernel size per decimation step from which Fir<> uses the
+/// polyphase implementation instead of the convolution-based one,
+/// measured with benchmarks/fir (cases 42 and 47).
+length_type const fir_poly_crossover = 4;
+
+/// Kernel size per decimation step from which Fir<> uses the
+/// overlap-save FFT implementation, measured with benchmarks/fir
+/// (cases 41 to 46).  The FFT implementation computes every output,
+/// so the crossover grows with the decimation.
+length_type const fir_fft_crossover = 16;
+
+
+
+// Fir implementation, based on FFT overlap-save
+//
+// The input is extended on the left by the last order_ samples of the
+// previous frame (or zeros).  Segments of n_fft_ samples of the
+// extended input, overlapping by order_ samples, are filtered in the
+// frequency domain; the last n_fft_ - order_ samples of each circular
+// convolution are filter outputs.  All outputs are computed, and the
+// ones kept by the decimation are copied out.
+
+template <typename T, symmetry_type S, obj_state C> 
+class Fir_fft_impl : public Fir_backend<T, S, C>
+{
+  typedef Fir_backend<T, S, C> base;
+  typedef Dense<1, T> block_type;
+  typedef typename Complex_of<T>::type complex_type;
+
+  typedef Fft<const_Vector, T, complex_type,
+	      Type_equal<T, complex_type>::value ? fft_fwd : 0, by_reference>
+		f_fft_type;
+  typedef Fft<const_Vector, complex_type, T,
+	      Type_equal<T, complex_type>::value ? fft_inv : 0, by_reference>
+		i_fft_type;
+
+  // Power of 2 of at least four times the kernel size, unless the
+  // frame is shorter.
+  static length_type fft_size(length_type order, length_type input_size)
+  {
+    length_type size = 1;
+    while (size < 4 * (order + 1) && size < input_size + order)
+      size *= 2;
+    while (size < 2 * (order + 1))
+      size *= 2;
+    return size;
+  }
+
+public:
+  Fir_fft_impl(
+    aligned_array<T> kernel,
+    length_type      k,
+    length_type      i,
+    length_type      d)
+  : base     (i, k, d),
+    skip_    (0),
+    n_fft_   (fft_size(this->order_, i)),
+    f_fft_   (Domain<1>(n_fft_), 1.0),
+    i_fft_   (Domain<1>(n_fft_), 1.0 / n_fft_),
+    t_buf_   (n_fft_, T()),
+    f_buf_   (f_fft_.output_size().size()),
+    f_kernel_(f_fft_.output_size().size()),
+    state_   (this->order_, T())
+  {
+    // spec says a nonsym kernel size has to be >1, but symmetric can be ==1:
+    assert(k > (S == nonsym));
+
+    length_type const size = this->kernel_size();
+    Vector<T, block_type> mirrored =
+      create_kernel<T, block_type, S>(kernel.get(), k, size);
+    t_buf_(Domain<1>(size)) = mirrored(Domain<1>(size - 1, -1, size));
+    f_fft_(t_buf_, f_kernel_);
+  }
+
+  Fir_fft_impl(Fir_fft_impl const &fir)
+    : base     (fir),
+      skip_    (fir.skip_),
+      n_fft_   (fir.n_fft_),
+      f_fft_   (Domain<1>(n_fft_), 1.0),
+      i_fft_   (Domain<1>(n_fft_), 1.0 / n_fft_),
+      t_buf_   (n_fft_),
+      f_buf_   (fir.f_buf_.size()),
+      f_kernel_(fir.f_kernel_),
+      state_   (fir.state_.get(Domain<1>(fir.state_.size()))) // deep copy
+  {}
+  virtual Fir_fft_impl *clone() { return new Fir_fft_impl(*this);}
+
+  length_type apply(T *in, stride_type in_stride, length_type in_length,
+                    T *out, stride_type out_stride, length_type out_length)
+  {
+    typedef impl::Subset_block<Dense<1, T> > block_type;
+    typedef Vector<T, block_type> view_type;
+
+    length_type in_extent = abs(in_stride) * (in_length - 1) + 1;
+    Dense<1, T> in_block(in_extent, in_stride > 0 ? in : in - in_extent + 1);
+    block_type sub_in_block(Domain<1>(in_stride > 0 ? 0 : in_extent - 1,
+                                      in_stride, in_length), in_block);
+    view_type input(sub_in_block);
+
+    length_type out_extent = abs(out_stride) * (out_length - 1) + 1;
+    Dense<1, T> out_block(out_extent, out_stride > 0 ? out : out - out_extent + 1);
+    block_type sub_out_block(Domain<1>(out_stride > 0 ? 0 : out_extent - 1,
+                                       out_stride, out_length), out_block);
+    view_type output(sub_out_block);
+
+    length_type const dec = this->decimation();
+    length_type const m = this->order_;
+    length_type const n = this->input_size_;
+    length_type const valid = n_fft_ - m;
+    length_type oix = 0;
+    index_type  next = this->skip_; // position of the next output
+
+    in_block.admit(true);
+    out_block.admit(false);
+
+    for (index_type pos = 0; next < n; pos += valid)
+    {
+      // Outputs pos to pos + len - 1 come from the extended input
+      // samples pos to pos + n_fft_ - 1.
+      length_type const len = std::min(valid, n - pos);
+      if (next >= pos + len)
+	continue;
+
+      length_type const n_state = pos < m ? m - pos : 0;
+      length_type const start = pos + n_state - m;
+      length_type const n_in = std::min(n_fft_ - n_state, n - start);
+      if (n_state)
+	t_buf_(Domain<1>(n_state)) = state_(Domain<1>(pos, 1, n_state));
+      t_buf_(Domain<1>(n_state, 1, n_in)) = input(Domain<1>(start, 1, n_in));
+      if (n_state + n_in < n_fft_)
+	t_buf_(Domain<1>(n_state + n_in, 1, n_fft_ - n_state - n_in)) = T();
+
+      f_fft_(t_buf_, f_buf_);
+      f_buf_ *= f_kernel_;
+      i_fft_(f_buf_, t_buf_);
+
+      length_type const count = (pos + len - next + dec - 1) / dec;
+      output(Domain<1>(oix, 1, count)) =
+	t_buf_(Domain<1>(m + next - pos, dec, count));
+      oix  += count;
+      next += count * dec;
+    }
+
+    if (C == state_save)
+    {
+      this->skip_ = next - n;
+      this->state_ = input(Domain<1>(n - m, 1, m));
+    }
+
+    in_block.release(false);
+    out_block.release(true);
+
+    return oix;
+  }
+
+  virtual void reset() VSIP_NOTHROW
+  {
+    skip_ = 0;
+    state_ = T(0);
+  }
+
+  virtual char const* name() { return "fir-fft-opt"; }
+
+private:
+  length_type skip_;          // how much of next input to skip
+  length_type n_fft_;         // length of the overlap-save FFTs
+  f_fft_type  f_fft_;
+  i_fft_type  i_fft_;
+  Vector<T, block_type>            t_buf_;    // segment - time domain
+  Vector<complex_type>             f_buf_;    // segment - freq domain
+  Vector<complex_type>             f_kernel_; // kernel  - freq domain
+  Vector<T, block_type>            state_;    // last order_ inputs
+};
+
+
+
+/// Create an Fir_fft_impl if FFTs of T are available and the kernel
+/// is large enough to benefit, otherwise return 0.  K is only taken
+/// over if the implementation is created.
+template <typename T, symmetry_type S, obj_state C,
+	  bool Avail = Is_fft_avail<T>::value>
+struct Fir_fft_factory
+{
+  static Fir_backend<T, S, C>*
+  create(aligned_array<T>& k, length_type ks, length_type is, length_type d,
+	 alg_hint_type h)
+  {
+    if (h != alg_time ||
+	Fir_backend<T, S, C>::order(ks) < fir_fft_crossover * d)
+      return 0;
+    return new Fir_fft_impl<T, S, C>(k, ks, is, d);
+  }
+};
+
+template <typename T, symmetry_type S, obj_state C>
+struct Fir_fft_factory<T, S, C, false>
+{
+  static Fir_backend<T, S, C>*
+  create(aligned_array<T>&, length_type, length_type, length_type,
+	 alg_hint_type)
+  { return 0;}
+};
+
 struct Opt_tag;
 
 namespace dispatcher
@@ -340,8 +686,12 @@ struct Evaluator<Fir_tag, Opt_tag,
   { return true;}
   static return_type exec(aligned_array<T> k, length_type ks,
                           length_type is, length_type d,
-                          unsigned, alg_hint_type)
+                          unsigned, alg_hint_type h)
   {
+    if (Fir_backend<T, S, C>* fft =
+	Fir_fft_factory<T, S, C>::create(k, ks, is, d, h))
+      return return_type(fft, noincrement);
+
     length_type order = Fir_backend<T, S, C>::order(ks);
     length_type start = order%d ? (d-order%d) : 0;
     
@@ -350,7 +700,13 @@ struct Evaluator<Fir_tag, Opt_tag,
     //    otherwise the convolution size changes from frame to frame.
     //  - input size must be greater than the "start" position + order,
     //    otherwise the FIR is too small to perform convolution on a frame.
-    return (is%d == 0 && is > start + order)
+    bool conv_ok = is%d == 0 && is > start + order;
+
+    if (d > 1 && (order >= fir_poly_crossover * d || !conv_ok))
+      return return_type(new Fir_poly_impl<T, S, C>(k, ks, is, d),
+			 noincrement);
+
+    return conv_ok
       ? return_type(new Fir_conv_impl<T, S, C>(k, ks, is, d), noincrement)
       : return_type(new Fir_impl<T, S, C>(k, ks, is, d), noincrement);
   }
@@ -0,0 +1,332 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    vsip/opt/signal/freqswap_opt.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Frequency swap of Fft and Fftm results.
+*/
+
+#ifndef VSIP_OPT_SIGNAL_FREQSWAP_OPT_HPP
+#define VSIP_OPT_SIGNAL_FREQSWAP_OPT_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <algorithm>
+
+#include <vsip/support.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/core/extdata.hpp>
+#include <vsip/core/fft/backend.hpp>
+#include <vsip/core/signal/freqswap.hpp>
+#include <vsip/opt/expr/return_block.hpp>
+#include <vsip/opt/fft/return_functor.hpp>
+#include <vsip/opt/rt_extdata.hpp>
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
+
+/// Size in bytes of a batch of Fftm results that are swapped while
+/// they are in cache.
+#ifndef VSIP_IMPL_FREQSWAP_BATCH_SIZE
+#  define VSIP_IMPL_FREQSWAP_BATCH_SIZE (128 * 1024)
+#endif
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace freqswap_detail
+{
+
+/// Rotate the values of each line of VIEW along dimension D, in place:
+///
+///   VIEW(i, j) = VIEW(i, (j + S) mod N)  for D == 1, and similarly
+///   along columns for D == 0, with S = N - N/2.
+
+template <typename T,
+	  typename Block,
+	  bool     CtValid = Ext_data_cost<Block>::value == 0 &&
+			     !Is_split_block<Block>::value>
+struct Rotate_lines
+{
+  static void exec(Matrix<T, Block> view, dimension_type d)
+  {
+    length_type const n = view.size(d);
+    length_type const s = n - n / 2;
+    Domain<1> all(view.size(1 - d));
+    Domain<2> head = d == 1 ? Domain<2>(all, Domain<1>(0, 1, s))
+                            : Domain<2>(Domain<1>(0, 1, s), all);
+    Domain<2> tail = d == 1 ? Domain<2>(all, Domain<1>(s, 1, n - s))
+                            : Domain<2>(Domain<1>(s, 1, n - s), all);
+    Domain<2> head2 = d == 1 ? Domain<2>(all, Domain<1>(0, 1, n - s))
+                             : Domain<2>(Domain<1>(0, 1, n - s), all);
+    Domain<2> tail2 = d == 1 ? Domain<2>(all, Domain<1>(n - s, 1, s))
+                             : Domain<2>(Domain<1>(n - s, 1, s), all);
+
+    Matrix<T> tmp(view.size(0), view.size(1));
+    tmp = view;
+    view(head2) = tmp(tail);
+    view(tail2) = tmp(head);
+  }
+};
+
+template <typename T,
+	  typename Block>
+struct Rotate_lines<T, Block, true>
+{
+  static void exec(Matrix<T, Block> view, dimension_type d)
+  {
+    Ext_data<Block> ext(view.block(), SYNC_INOUT);
+    length_type const n = ext.size(d);
+    length_type const m = ext.size(1 - d);
+
+    if (ext.stride(d) == 1)
+      rotate(ext.data(), ext.stride(1 - d), ext.data(), ext.stride(1 - d),
+	     m, n, 0, n - n / 2);
+    else if (ext.stride(1 - d) == 1)
+      rotate(ext.data(), ext.stride(d), ext.data(), ext.stride(d),
+	     n, m, n - n / 2, 0);
+    else
+      Rotate_lines<T, Block, false>::exec(view, d);
+  }
+};
+
+} // namespace vsip::impl::freqswap_detail
+
+
+
+/// Freqswap of the result of a by-value Fft.  The transform is
+/// computed into the destination, which is then swapped in place,
+/// rather than computed into a temporary block and copied.
+
+template <dimension_type Dim,
+	  typename       T,
+	  typename       BlockT,
+	  typename       BackendT,
+	  typename       WorkspaceT>
+class Fft_freqswap_functor
+{
+  typedef fft::Fft_return_functor<Dim, T, BlockT, BackendT, WorkspaceT>
+		rf_type;
+  typedef Return_expr_block<Dim, T, rf_type> const block_type;
+
+public:
+  typedef typename block_type::map_type map_type;
+  typedef T                             value_type;
+  typedef typename View_block_storage<block_type>::plain_type block_ref_type;
+
+  typedef Freqswap_functor<typename Distributed_local_block<block_type>::type,
+			   Dim>
+		local_type;
+
+  Fft_freqswap_functor(block_ref_type in) : in_(in) {}
+
+  length_type size(dimension_type block_dim, dimension_type d) const
+  {
+    assert(block_dim == Dim);
+    return in_.size(block_dim, d);
+  }
+  length_type size() const { return in_.size();}
+
+  template <typename B1>
+  void apply(B1& out) const
+  {
+    in_.apply(out);
+    Freqswap_functor<B1>(out).apply(out);
+  }
+
+  local_type local() const
+  {
+    return local_type(get_local_block(in_));
+  }
+
+  map_type const& map() const { return in_.map();}
+
+private:
+  block_ref_type in_;
+};
+
+template <typename T,
+	  typename BlockT,
+	  typename BackendT,
+	  typename WorkspaceT>
+class Freqswap_functor<Return_expr_block<1, T,
+		         fft::Fft_return_functor<1, T, BlockT,
+						 BackendT, WorkspaceT> > const,
+		       1>
+  : public Fft_freqswap_functor<1, T, BlockT, BackendT, WorkspaceT>
+{
+  typedef Fft_freqswap_functor<1, T, BlockT, BackendT, WorkspaceT> base_type;
+
+public:
+  Freqswap_functor(typename base_type::block_ref_type in) : base_type(in) {}
+};
+
+template <typename T,
+	  typename BlockT,
+	  typename BackendT,
+	  typename WorkspaceT>
+class Freqswap_functor<Return_expr_block<2, T,
+		         fft::Fft_return_functor<2, T, BlockT,
+						 BackendT, WorkspaceT> > const,
+		       2>
+  : public Fft_freqswap_functor<2, T, BlockT, BackendT, WorkspaceT>
+{
+  typedef Fft_freqswap_functor<2, T, BlockT, BackendT, WorkspaceT> base_type;
+
+public:
+  Freqswap_functor(typename base_type::block_ref_type in) : base_type(in) {}
+};
+
+
+
+/// Freqswap of the result of a by-value Fftm.
+///
+/// The swap across transforms is an index permutation: the second half
+/// of the input lines is transformed into the first half of the output
+/// lines, and vice versa.  The swap along the transforms is applied to
+/// batches of VSIP_IMPL_FREQSWAP_BATCH_SIZE bytes of results right
+/// after they are computed, while they are in cache.
+
+template <typename       T,
+	  typename       BlockT,
+	  typename       I,
+	  typename       O,
+	  int            A,
+	  int            E,
+	  typename       WorkspaceT>
+class Freqswap_functor<Return_expr_block<2, T,
+		         fft::Fft_return_functor<2, T, BlockT,
+						 fft::fftm<I, O, A, E>,
+						 WorkspaceT> > const,
+		       2>
+{
+  typedef fft::fftm<I, O, A, E> backend_type;
+  typedef fft::Fft_return_functor<2, T, BlockT, backend_type, WorkspaceT>
+		rf_type;
+  typedef Return_expr_block<2, T, rf_type> const block_type;
+  typedef typename BlockT::value_type in_value_type;
+
+public:
+  typedef typename block_type::map_type map_type;
+  typedef T                             value_type;
+  typedef typename View_block_storage<block_type>::plain_type block_ref_type;
+
+  typedef Freqswap_functor<typename Distributed_local_block<block_type>::type,
+			   2>
+		local_type;
+
+  Freqswap_functor(block_ref_type in) : in_(in) {}
+
+  length_type size(dimension_type block_dim, dimension_type d) const
+  {
+    assert(block_dim == 2);
+    return in_.size(block_dim, d);
+  }
+  length_type size() const { return in_.size();}
+
+  template <typename B1>
+  void apply(B1& out) const
+  {
+    rf_type const& rf = in_.functor();
+
+    // Dimension across the transforms.
+    dimension_type const bd = 1 - A;
+
+    length_type const count = out.size(2, bd);
+    length_type const len   = out.size(2, A);
+    length_type const shift = count - count / 2;
+
+    // A Fftm large enough to be split across threads by its backend
+    // is computed at once.
+    bool whole = is_alias(rf.block(), out);
+#if VSIP_IMPL_HAVE_THREAD_POOL
+    threads::Thread_pool* pool = threads::Thread_pool::instance();
+    if (pool && pool->num_workers() > 1 && out.size() >= pool->threshold())
+      whole = true;
+#endif
+    if (whole)
+    {
+      in_.apply(out);
+      Freqswap_functor<B1>(out).apply(out);
+      return;
+    }
+
+    length_type batch = VSIP_IMPL_FREQSWAP_BATCH_SIZE / (len * sizeof(T));
+    batch = std::max<length_type>(batch, 1);
+
+    const_Matrix<in_value_type, BlockT> in(const_cast<BlockT&>(rf.block()));
+    Matrix<T, B1> res(out);
+
+    // Output lines [0, count - shift) hold the transforms of input
+    // lines [shift, count), and output lines [count - shift, count)
+    // those of input lines [0, shift).
+    transform(rf, in, res, shift, 0,             count - shift, batch);
+    transform(rf, in, res, 0,     count - shift, shift,         batch);
+  }
+
+  local_type local() const
+  {
+    return local_type(get_local_block(in_));
+  }
+
+  map_type const& map() const { return in_.map();}
+
+private:
+  // Transform N input lines starting at IN_FIRST into the output lines
+  // starting at OUT_FIRST, BATCH lines at a time, and swap each batch
+  // along the transforms.
+  template <typename B1>
+  static void transform(
+    rf_type const&                      rf,
+    const_Matrix<in_value_type, BlockT> in,
+    Matrix<T, B1>                       res,
+    index_type                          in_first,
+    index_type                          out_first,
+    length_type                         n,
+    length_type                         batch)
+  {
+    dimension_type const bd = 1 - A;
+    backend_type* backend = const_cast<backend_type*>(&rf.backend());
+
+    for (index_type b = 0; b < n; b += batch)
+    {
+      length_type nb = std::min(batch, n - b);
+      Domain<1> in_lines (in_first + b, 1, nb);
+      Domain<1> out_lines(out_first + b, 1, nb);
+      Domain<2> in_dom  = bd == 0 ? Domain<2>(in_lines, in.size(1))
+                                  : Domain<2>(in.size(0), in_lines);
+      Domain<2> out_dom = bd == 0 ? Domain<2>(out_lines, res.size(1))
+                                  : Domain<2>(res.size(0), out_lines);
+
+      typename Matrix<T, B1>::subview_type sub = res(out_dom);
+      rf.workspace().by_reference_blk(backend, in(in_dom).block(),
+				      sub.block());
+      freqswap_detail::Rotate_lines<T, typename Matrix<T, B1>::subview_type
+				    ::block_type>::exec(sub, A);
+    }
+  }
+
+  block_ref_type in_;
+};
+
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_SIGNAL_FREQSWAP_OPT_HPP
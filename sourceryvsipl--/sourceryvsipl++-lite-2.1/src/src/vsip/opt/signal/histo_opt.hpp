@@ -0,0 +1,501 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    vsip/opt/signal/histo_opt.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Histogram accumulation with direct data
+             access, SIMD bin computation and threads.
+*/
+
+#ifndef VSIP_OPT_SIGNAL_HISTO_OPT_HPP
+#define VSIP_OPT_SIGNAL_HISTO_OPT_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include <vsip/support.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/core/extdata.hpp>
+#include <vsip/core/signal/histo_common.hpp>
+#include <vsip/opt/simd/histo.hpp>
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace histo
+{
+
+/// Number of values whose bins are computed at a time.
+
+length_type const chunk_size = 256;
+
+
+
+/// Compute the bins of N values at X, STRIDE apart.  POS is aligned
+/// scratch space for CHUNK_SIZE values.
+
+template <typename T,
+	  bool     IsInteger = std::numeric_limits<T>::is_integer>
+struct Bin_chunk
+{
+  static void exec(Bins<T> const& bins, T const* x, stride_type stride,
+		   length_type n, index_type* bin, T*)
+  {
+    for (index_type i = 0; i < n; ++i)
+      bin[i] = bins(x[i * stride]);
+  }
+};
+
+template <typename T>
+struct Bin_chunk<T, false>
+{
+  static void exec(Bins<T> const& bins, T const* x, stride_type stride,
+		   length_type n, index_type* bin, T* pos)
+  {
+    if (stride != 1)
+    {
+      for (index_type i = 0; i < n; ++i)
+	bin[i] = bins(x[i * stride]);
+      return;
+    }
+
+    simd::histo_bins(pos, x, bins.min(), bins.max(), bins.scale(),
+		     T(bins.num_bin()), n);
+    // Truncate before adding 1, as Bins does.  Signed conversion is a
+    // single instruction.
+    for (index_type i = 0; i < n; ++i)
+      bin[i] = (index_type)((stride_type)pos[i] + 1);
+  }
+};
+
+
+
+/// Direct access to a vector or matrix operand.  A vector is treated
+/// as a matrix with a single row.
+
+template <typename ViewT>
+class Operand;
+
+template <typename T,
+	  typename Block>
+class Operand<const_Vector<T, Block> >
+{
+public:
+  static bool const ct_valid = Ext_data_cost<Block>::value == 0;
+
+  Operand(const_Vector<T, Block> view) : ext_(view.block(), SYNC_IN) {}
+
+  T const*    data()                 { return ext_.data();}
+  length_type size(dimension_type d) { return d == 0 ? 1 : ext_.size(0);}
+  stride_type stride(dimension_type d)
+  { return d == 0 ? ext_.size(0) * ext_.stride(0) : ext_.stride(0);}
+
+private:
+  Ext_data<Block> ext_;
+};
+
+template <typename T,
+	  typename Block>
+class Operand<const_Matrix<T, Block> >
+{
+public:
+  static bool const ct_valid = Ext_data_cost<Block>::value == 0;
+
+  Operand(const_Matrix<T, Block> view) : ext_(view.block(), SYNC_IN) {}
+
+  T const*    data()                   { return ext_.data();}
+  length_type size(dimension_type d)   { return ext_.size(d);}
+  stride_type stride(dimension_type d) { return ext_.stride(d);}
+
+private:
+  Ext_data<Block> ext_;
+};
+
+
+
+/// Values of one operand, as lines of values.
+
+template <typename T>
+struct Lines
+{
+  Lines() : data(0), line_stride(0), stride(0) {}
+
+  T const*    data;
+  stride_type line_stride;
+  stride_type stride;
+};
+
+
+
+/// Histogram accumulation through direct data access.
+///
+/// The values are processed as NUM_LINES lines of LENGTH values.  If
+/// there are enough values and a thread pool, they are split across
+/// its workers, each with a private histogram that is added to HIST
+/// at the end.
+
+template <typename T,
+	  typename W,
+	  typename H>
+class Direct
+{
+public:
+  Direct(Bins<T> const& xbins,
+	 Bins<T> const* ybins,
+	 length_type    num_lines,
+	 length_type    length,
+	 Lines<T>       x,
+	 Lines<T>       y,
+	 Lines<W>       w,
+	 H*             hist)
+  : xbins_    (xbins),
+    ybins_    (ybins),
+    num_lines_(num_lines),
+    length_   (length),
+    x_        (x),
+    y_        (y),
+    w_        (w),
+    hist_     (hist),
+    num_tasks_(1)
+  {}
+
+  void operator()()
+  {
+    length_type size = num_lines_ * length_;
+#if VSIP_IMPL_HAVE_THREAD_POOL
+    threads::Thread_pool* pool = threads::Thread_pool::instance();
+    if (pool && pool->num_workers() > 1 && size >= pool->threshold())
+    {
+      length_type num_bin =
+	xbins_.num_bin() * (ybins_ ? ybins_->num_bin() : 1);
+
+      num_tasks_ = std::min(pool->num_workers(),
+			    (size + chunk_size - 1) / chunk_size);
+      private_.resize(num_tasks_ - 1);
+      for (index_type t = 0; t + 1 < num_tasks_; ++t)
+	private_[t].assign(num_bin, H(0));
+
+      pool->parallel_for(task, this, num_tasks_);
+
+      for (index_type t = 0; t + 1 < num_tasks_; ++t)
+	for (index_type b = 0; b < num_bin; ++b)
+	  hist_[b] += private_[t][b];
+      return;
+    }
+#endif
+    apply(0, size, hist_);
+  }
+
+private:
+  static void task(void* arg, index_type t)
+  {
+    Direct* self = static_cast<Direct*>(arg);
+    length_type size  = self->num_lines_ * self->length_;
+    index_type  first = t * size / self->num_tasks_;
+    index_type  last  = (t + 1) * size / self->num_tasks_;
+
+    self->apply(first, last, t == 0 ? self->hist_ : &self->private_[t-1][0]);
+  }
+
+  // Accumulate values [FIRST, LAST), counting along the lines, into
+  // HIST.  Joint bins are numbered row-major.
+  void apply(index_type first, index_type last, H* hist)
+  {
+    index_type       xbin[chunk_size];
+    index_type       ybin[chunk_size];
+    aligned_array<T> pos(chunk_size);
+    length_type      num_bin = ybins_ ? ybins_->num_bin() : 1;
+
+    for (index_type i = first; i < last; )
+    {
+      index_type  line = i / length_;
+      index_type  pt   = i % length_;
+      length_type n    = std::min(std::min(length_ - pt, last - i),
+				  chunk_size);
+
+      Bin_chunk<T>::exec(xbins_,
+			 x_.data + line * x_.line_stride + pt * x_.stride,
+			 x_.stride, n, xbin, pos.get());
+      if (ybins_)
+      {
+	Bin_chunk<T>::exec(*ybins_,
+			   y_.data + line * y_.line_stride + pt * y_.stride,
+			   y_.stride, n, ybin, pos.get());
+	for (index_type k = 0; k < n; ++k)
+	  xbin[k] = xbin[k] * num_bin + ybin[k];
+      }
+
+      if (w_.data)
+      {
+	W const* w = w_.data + line * w_.line_stride + pt * w_.stride;
+	for (index_type k = 0; k < n; ++k)
+	  hist[xbin[k]] += H(w[k * w_.stride]);
+      }
+      else
+	for (index_type k = 0; k < n; ++k)
+	  hist[xbin[k]] += H(1);
+
+      i += n;
+    }
+  }
+
+  Bins<T> const&                xbins_;
+  Bins<T> const*                ybins_;
+  length_type                   num_lines_;
+  length_type                   length_;
+  Lines<T>                      x_;
+  Lines<T>                      y_;
+  Lines<W>                      w_;
+  H*                            hist_;
+  length_type                   num_tasks_;
+  std::vector<std::vector<H> >  private_;
+};
+
+
+
+/// Choose the lines along which to access operands: along the
+/// dimension with the smallest stride in the first operand, and as a
+/// single line when every operand is contiguous.
+
+class Line_layout
+{
+public:
+  template <typename OpT>
+  Line_layout(OpT& op)
+    : dim_(op.stride(1) <= op.stride(0) ? 1 : 0),
+      num_lines_(op.size(1 - dim_)),
+      length_(op.size(dim_)),
+      flat_(true)
+  { check(op);}
+
+  template <typename OpT>
+  void check(OpT& op)
+  {
+    if (op.stride(1 - dim_) != stride_type(length_) * op.stride(dim_))
+      flat_ = false;
+  }
+
+  length_type num_lines() const { return flat_ ? 1 : num_lines_;}
+  length_type length()    const
+  { return flat_ ? num_lines_ * length_ : length_;}
+
+  template <typename T,
+	    typename OpT>
+  Lines<T> lines(OpT& op) const
+  {
+    Lines<T> l;
+    l.data        = op.data();
+    l.line_stride = flat_ ? 0 : op.stride(1 - dim_);
+    l.stride      = op.stride(dim_);
+    return l;
+  }
+
+private:
+  dimension_type dim_;
+  length_type    num_lines_;
+  length_type    length_;
+  bool           flat_;
+};
+
+
+
+/// Histogram accumulation, through direct data access if the operands
+/// support it (Valid), and generic accessors otherwise.
+
+template <bool Valid>
+struct Accumulate
+{
+  template <typename T,
+	    typename ViewT,
+	    typename H>
+  static void exec(Bins<T> const& bins, ViewT x, H* hist)
+  { generic(bins, x, hist);}
+
+  template <typename T,
+	    typename View0T,
+	    typename View1T,
+	    typename H>
+  static void exec(Bins<T> const& bins, View0T x, View1T w, H* hist)
+  { generic(bins, x, w, hist);}
+
+  template <typename T,
+	    typename View0T,
+	    typename View1T,
+	    typename H>
+  static void exec(Bins<T> const& xbins, Bins<T> const& ybins,
+		   View0T x, View1T y, H* hist)
+  { generic(xbins, ybins, x, y, hist);}
+};
+
+template <>
+struct Accumulate<true>
+{
+  template <typename T,
+	    typename ViewT,
+	    typename H>
+  static void exec(Bins<T> const& bins, ViewT x, H* hist)
+  {
+    Operand<ViewT> xo(x);
+    Line_layout    layout(xo);
+
+    Direct<T, H, H> direct(bins, 0, layout.num_lines(), layout.length(),
+			   layout.template lines<T>(xo), Lines<T>(),
+			   Lines<H>(), hist);
+    direct();
+  }
+
+  template <typename T,
+	    typename View0T,
+	    typename View1T,
+	    typename H>
+  static void exec(Bins<T> const& bins, View0T x, View1T w, H* hist)
+  {
+    typedef typename View1T::value_type weight_type;
+
+    Operand<View0T> xo(x);
+    Operand<View1T> wo(w);
+    Line_layout     layout(xo);
+    layout.check(wo);
+
+    Direct<T, weight_type, H> direct(
+      bins, 0, layout.num_lines(), layout.length(),
+      layout.template lines<T>(xo), Lines<T>(),
+      layout.template lines<weight_type>(wo), hist);
+    direct();
+  }
+
+  template <typename T,
+	    typename View0T,
+	    typename View1T,
+	    typename H>
+  static void exec(Bins<T> const& xbins, Bins<T> const& ybins,
+		   View0T x, View1T y, H* hist)
+  {
+    Operand<View0T> xo(x);
+    Operand<View1T> yo(y);
+    Line_layout     layout(xo);
+    layout.check(yo);
+
+    Direct<T, H, H> direct(xbins, &ybins, layout.num_lines(), layout.length(),
+			   layout.template lines<T>(xo),
+			   layout.template lines<T>(yo),
+			   Lines<H>(), hist);
+    direct();
+  }
+};
+
+
+
+/// Accumulate the histogram of X into HIST.
+
+template <typename T,
+	  typename Block,
+	  typename H>
+inline void
+accumulate(Bins<T> const& bins, const_Vector<T, Block> x, H* hist)
+{
+  typedef const_Vector<T, Block> view_type;
+  Accumulate<Operand<view_type>::ct_valid>::exec(bins, view_type(x), hist);
+}
+
+template <typename T,
+	  typename Block,
+	  typename H>
+inline void
+accumulate(Bins<T> const& bins, const_Matrix<T, Block> x, H* hist)
+{
+  typedef const_Matrix<T, Block> view_type;
+  Accumulate<Operand<view_type>::ct_valid>::exec(bins, view_type(x), hist);
+}
+
+/// Accumulate the histogram of X, weighted by W, into HIST.
+
+template <typename T,
+	  typename Block0,
+	  typename W,
+	  typename Block1,
+	  typename H>
+inline void
+accumulate(Bins<T> const& bins, const_Vector<T, Block0> x,
+	   const_Vector<W, Block1> w, H* hist)
+{
+  typedef const_Vector<T, Block0> view0_type;
+  typedef const_Vector<W, Block1> view1_type;
+  Accumulate<Operand<view0_type>::ct_valid && Operand<view1_type>::ct_valid>
+    ::exec(bins, view0_type(x), view1_type(w), hist);
+}
+
+template <typename T,
+	  typename Block0,
+	  typename W,
+	  typename Block1,
+	  typename H>
+inline void
+accumulate(Bins<T> const& bins, const_Matrix<T, Block0> x,
+	   const_Matrix<W, Block1> w, H* hist)
+{
+  typedef const_Matrix<T, Block0> view0_type;
+  typedef const_Matrix<W, Block1> view1_type;
+  Accumulate<Operand<view0_type>::ct_valid && Operand<view1_type>::ct_valid>
+    ::exec(bins, view0_type(x), view1_type(w), hist);
+}
+
+/// Accumulate the joint histogram of X and Y into HIST.
+
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename H>
+inline void
+accumulate(Bins<T> const& xbins, Bins<T> const& ybins,
+	   const_Vector<T, Block0> x, const_Vector<T, Block1> y, H* hist)
+{
+  typedef const_Vector<T, Block0> view0_type;
+  typedef const_Vector<T, Block1> view1_type;
+  Accumulate<Operand<view0_type>::ct_valid && Operand<view1_type>::ct_valid>
+    ::exec(xbins, ybins, view0_type(x), view1_type(y), hist);
+}
+
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename H>
+inline void
+accumulate(Bins<T> const& xbins, Bins<T> const& ybins,
+	   const_Matrix<T, Block0> x, const_Matrix<T, Block1> y, H* hist)
+{
+  typedef const_Matrix<T, Block0> view0_type;
+  typedef const_Matrix<T, Block1> view1_type;
+  Accumulate<Operand<view0_type>::ct_valid && Operand<view1_type>::ct_valid>
+    ::exec(xbins, ybins, view0_type(x), view1_type(y), hist);
+}
+
+} // namespace vsip::impl::histo
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_SIGNAL_HISTO_OPT_HPP
@@ -0,0 +1,158 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/simd/eval_threaded.hpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Threaded SIMD loop-fusion expression
+             evaluator.
+
+    Large aligned expressions are split into cache-sized chunks that
+    are evaluated by the SIMD loop-fusion kernel on the worker pool.
+*/
+
+#ifndef VSIP_OPT_SIMD_EVAL_THREADED_HPP
+#define VSIP_OPT_SIMD_EVAL_THREADED_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/support.hpp>
+#include <vsip/core/threads/pool.hpp>
+#include <vsip/opt/simd/simd.hpp>
+#include <vsip/opt/simd/expr_iterator.hpp>
+#include <vsip/opt/simd/proxy_factory.hpp>
+#include <vsip/opt/simd/expr_evaluator.hpp>
+#include <vsip/opt/expr/serial_evaluator.hpp>
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+
+// Threaded SIMD Loop Fusion evaluator for aligned expressions.
+//
+// The unaligned head and the tail that does not fill a SIMD vector
+// are handled by the calling thread; the aligned body is divided
+// into chunks of Thread_pool::chunk_size() bytes.
+
+template <typename LB,
+	  typename RB>
+struct Serial_expr_evaluator<1, LB, RB, Simd_threaded_loop_fusion_tag>
+{
+  typedef Serial_expr_evaluator<1, LB, RB, Simd_loop_fusion_tag> base_type;
+  typedef typename base_type::layout_type layout_type;
+
+  typedef typename LB::value_type                               value_type;
+  typedef simd::Simd_traits<value_type>                         simd_traits;
+  typedef simd::Proxy<simd::LValue_access_traits<value_type>, true>
+		lhs_proxy_type;
+  typedef typename simd::Proxy_factory<RB, true>::proxy_type    rhs_proxy_type;
+
+  static char const* name() { return "Expr_SIMD_Thread_Loop"; }
+
+  static bool const ct_valid = base_type::ct_valid;
+
+  static length_type tunable_threshold()
+  {
+    if (VSIP_IMPL_TUNE_MODE)
+      return 0;
+    else
+      return threads::Thread_pool::instance()->threshold();
+  }
+
+  static bool rt_valid(LB& lhs, RB const& rhs)
+  {
+    threads::Thread_pool* pool = threads::Thread_pool::instance();
+    return pool && pool->num_workers() > 1 &&
+           lhs.size() >= tunable_threshold() &&
+           base_type::rt_valid(lhs, rhs);
+  }
+
+  // One chunk of the aligned body.
+  struct Task
+  {
+    Task(lhs_proxy_type const& lp, rhs_proxy_type const& rp,
+	 length_type chunk, length_type size)
+      : lp_(lp), rp_(rp), chunk_(chunk), size_(size)
+    {}
+
+    static void exec(void* arg, index_type i)
+    {
+      Task const& task = *static_cast<Task const*>(arg);
+      length_type const vec_size = simd_traits::vec_size;
+
+      index_type  first = i * task.chunk_;
+      length_type n     = std::min(task.chunk_, task.size_ - first);
+
+      lhs_proxy_type lp(task.lp_);
+      rhs_proxy_type rp(task.rp_);
+      lp.increment_by_element(first);
+      rp.increment_by_element(first);
+
+      while (n >= vec_size)
+      {
+	lp.store(rp.load());
+	n -= vec_size;
+	lp.increment();
+	rp.increment();
+      }
+    }
+
+    lhs_proxy_type lp_;
+    rhs_proxy_type rp_;
+    length_type    chunk_;
+    length_type    size_;
+  };
+
+  static void exec(LB& lhs, RB const& rhs)
+  {
+    length_type const vec_size = simd_traits::vec_size;
+    threads::Thread_pool* pool = threads::Thread_pool::instance();
+
+    Ext_data<LB, layout_type> dda(lhs, SYNC_OUT);
+    length_type const size = dda.size(0);
+
+    // Deal with unaligned head.
+    index_type first = 0;
+    typename Ext_data<LB, layout_type>::raw_ptr_type raw_ptr = dda.data();
+    while (simd_traits::alignment_of(raw_ptr) && first < size)
+    {
+      lhs.put(first, rhs.get(first));
+      ++first;
+      ++raw_ptr;
+    }
+
+    lhs_proxy_type lp(dda.data());
+    rhs_proxy_type rp(simd::Proxy_factory<RB, true>::create(rhs));
+    lp.increment_by_element(first);
+    rp.increment_by_element(first);
+
+    length_type body  = size - first;
+    body -= body % vec_size;
+    length_type chunk = pool->chunk_size() / sizeof(value_type);
+    length_type num   = threads::num_chunks(body, chunk, vec_size);
+
+    Task task(lp, rp, chunk, body);
+    pool->parallel_for(&Task::exec, &task, num);
+
+    // Process the remainder, using simple loop fusion.
+    for (index_type i = first + body; i != size; ++i)
+      lhs.put(i, rhs.get(i));
+  }
+};
+
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_SIMD_EVAL_THREADED_HPP
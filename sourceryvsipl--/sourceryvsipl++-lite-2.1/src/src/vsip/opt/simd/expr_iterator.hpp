@@ -25,6 +25,7 @@
 #include <vsip/support.hpp>
 #include <vsip/core/fns_elementwise.hpp>
 #include <vsip/opt/simd/simd.hpp>
+#include <vsip/opt/simd/simd_math.hpp>
 #include <vsip/core/expr/operations.hpp>
 #include <vsip/core/metaprogramming.hpp>
 
@@ -45,12 +46,15 @@ struct Unary_operator_map
 {
   // The general case, in particular unary functors, are not supported.
   static bool const is_supported = false;
+  typedef T value_type;
+  typedef T return_type;
 };
 
 template <typename T> 
 struct Unary_operator_map<T, op::Plus>
 {
   typedef typename Simd_traits<T>::simd_type simd_type;
+  typedef T return_type;
   static bool const is_supported = true;
   static simd_type 
   apply(simd_type const &op)
@@ -61,6 +65,7 @@ template <typename T>
 struct Unary_operator_map<T, op::Minus>
 {
   typedef typename Simd_traits<T>::simd_type simd_type;
+  typedef T return_type;
   static bool const is_supported = true;
   static simd_type 
   apply(simd_type const &op)
@@ -152,11 +157,39 @@ struct Unary_operator_map<T, OP>					\
   }									\
 };
 
-#define VSIP_OPT_DECL_UNARY_OP_COMPLEX_BLOCK(OP)			\
+// Unary elementary functions of real values, see simd_math.hpp.
+#define VSIP_OPT_DECL_UNARY_MATH_OP(FCN, OP)				\
 template <typename T>							\
-struct Unary_operator_map<complex<T>, OP>				\
+struct Unary_operator_map<T, OP>					\
 {									\
-  static bool const is_supported = false;				\
+  typedef typename Simd_traits<T>::simd_type simd_type;			\
+  typedef T                             return_type;			\
+  typedef T                             value_type;			\
+  									\
+  static bool const is_supported = Simd_math<T>::is_supported;		\
+  static inline simd_type						\
+  apply(simd_type const &arg)						\
+  {									\
+    return Simd_math<T>::FCN(arg);					\
+  }									\
+};
+
+
+
+#define VSIP_OPT_DECL_BINARY_MATH_OP(FCN, OP)				\
+template <typename T>							\
+struct Binary_operator_map<T, OP>					\
+{									\
+  typedef typename Simd_traits<T>::simd_type simd_type;			\
+  typedef T                             return_type;			\
+  typedef T                             value_type;			\
+  									\
+  static bool const is_supported = Simd_math<T>::is_supported;		\
+  static inline simd_type						\
+  apply(simd_type const &left, simd_type const &right)			\
+  {									\
+    return Simd_math<T>::FCN(left, right);				\
+  }									\
 };
 
 
@@ -210,12 +243,103 @@ VSIP_OPT_DECL_BINARY_OP(max, max_functor)
 VSIP_OPT_DECL_BINARY_OP(min, min_functor)
 
 VSIP_OPT_DECL_UNARY_OP(mag, mag_functor)
-VSIP_OPT_DECL_UNARY_OP_COMPLEX_BLOCK(mag_functor)
+
+VSIP_OPT_DECL_UNARY_MATH_OP(exp,   exp_functor)
+VSIP_OPT_DECL_UNARY_MATH_OP(log,   log_functor)
+VSIP_OPT_DECL_UNARY_MATH_OP(log10, log10_functor)
+VSIP_OPT_DECL_UNARY_MATH_OP(sin,   sin_functor)
+VSIP_OPT_DECL_UNARY_MATH_OP(cos,   cos_functor)
+VSIP_OPT_DECL_UNARY_MATH_OP(sqrt,  sqrt_functor)
+
+VSIP_OPT_DECL_BINARY_MATH_OP(atan2, atan2_functor)
 
 #undef VSIP_OPT_DECL_BINARY_CMP_OP
+#undef VSIP_OPT_DECL_BINARY_MATH_OP
 #undef VSIP_OPT_DECL_BINARY_OP
+#undef VSIP_OPT_DECL_UNARY_MATH_OP
 #undef VSIP_OPT_DECL_UNARY_OP
-#undef VSIP_OPT_DECL_UNARY_OP_COMPLEX_BLOCK
+
+// Complex elementary functions.  mag and arg return real values and
+// euler takes a real value; since Simd_traits<complex<T> > holds as
+// many values as Simd_traits<T>, these stay in the fused loop.
+
+template <typename T>
+struct Unary_operator_map<complex<T>, exp_functor>
+{
+  typedef Simd_traits<T>                       simd;
+  typedef typename Simd_traits<complex<T> >::simd_type simd_type;
+  typedef complex<T>                           return_type;
+  typedef complex<T>                           value_type;
+
+  static bool const is_supported = Simd_math<T>::is_supported;
+  static simd_type
+  apply(simd_type const &arg)
+  {
+    typename simd::simd_type m = Simd_math<T>::exp(arg.r);
+    typename simd::simd_type s, c;
+    Simd_math<T>::sincos(arg.i, s, c);
+    simd_type t = { simd::mul(m, c), simd::mul(m, s) };
+    return t;
+  }
+};
+
+template <typename T>
+struct Unary_operator_map<complex<T>, mag_functor>
+{
+  typedef Simd_traits<T>                       simd;
+  typedef typename Simd_traits<complex<T> >::simd_type simd_type;
+  typedef T                                    return_type;
+  typedef complex<T>                           value_type;
+
+  static bool const is_supported = Simd_math<T>::is_supported;
+
+  // max * sqrt(1 + (min/max)^2), to avoid overflow of the squares.
+  static typename simd::simd_type
+  apply(simd_type const &arg)
+  {
+    typedef typename simd::simd_type base_type;
+    base_type ar = simd::mag(arg.r);
+    base_type ai = simd::mag(arg.i);
+    base_type mx = simd::max(ar, ai);
+    base_type q  = simd::div(simd::min(ar, ai), mx);
+    q = simd::select(simd::le(mx, simd::zero()), simd::zero(), q);
+    base_type r = simd::mul(mx, simd::sqrt(simd::fma(q, q,
+				simd::load_scalar_all(T(1)))));
+    return simd::select(simd::gt(mx,
+		simd::load_scalar_all(std::numeric_limits<T>::max())), mx, r);
+  }
+};
+
+template <typename T>
+struct Unary_operator_map<complex<T>, arg_functor>
+{
+  typedef Simd_traits<T>                       simd;
+  typedef typename Simd_traits<complex<T> >::simd_type simd_type;
+  typedef T                                    return_type;
+  typedef complex<T>                           value_type;
+
+  static bool const is_supported = Simd_math<T>::is_supported;
+  static typename simd::simd_type
+  apply(simd_type const &arg)
+  { return Simd_math<T>::atan2(arg.i, arg.r); }
+};
+
+template <typename T>
+struct Unary_operator_map<T, euler_functor>
+{
+  typedef typename Simd_traits<T>::simd_type   simd_type;
+  typedef complex<T>                           return_type;
+  typedef T                                    value_type;
+
+  static bool const is_supported = Simd_math<T>::is_supported;
+  static typename Simd_traits<complex<T> >::simd_type
+  apply(simd_type const &arg)
+  {
+    typename Simd_traits<complex<T> >::simd_type t;
+    Simd_math<T>::sincos(arg, t.i, t.r);
+    return t;
+  }
+};
 
 // Support for ternary maps
 template <typename T>
@@ -272,12 +396,16 @@ template <typename T> struct Complex_split_access_traits
   typedef T value_type;
 };
 
-// Access trait for unary expressions.
+// Access trait for unary expressions.  The value_type is the result
+// of the operator, which may differ from the operand_type (for
+// example mag of a complex value).
 template <typename ProxyT,             // operatory proxy
 	  template <typename> class O> // operator
 struct Unary_access_traits
 {
-  typedef typename ProxyT::value_type value_type;
+  typedef typename ProxyT::value_type operand_type;
+  typedef typename Unary_operator_map<operand_type, O>::return_type
+		value_type;
 };
 
 // Access trait for binary expressions. Both operands have the same value_type.
@@ -490,6 +618,7 @@ class Proxy<Unary_access_traits<ProxyT, O>, IsAligned>
 {
 public:
   typedef Unary_access_traits<ProxyT, O> access_traits;
+  typedef typename access_traits::operand_type operand_type;
   typedef typename access_traits::value_type value_type;
   typedef typename Simd_traits<value_type>::simd_type simd_type;
 
@@ -497,8 +626,8 @@ public:
 
   simd_type load() const 
   {
-    simd_type op = op_.load();
-    return Unary_operator_map<value_type, O>::apply(op);
+    typename Simd_traits<operand_type>::simd_type op = op_.load();
+    return Unary_operator_map<operand_type, O>::apply(op);
   }
 
   void increment(length_type n = 1) { op_.increment(n);}
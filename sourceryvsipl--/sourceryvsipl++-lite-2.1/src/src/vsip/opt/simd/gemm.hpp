@@ -0,0 +1,574 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    vsip/opt/simd/gemm.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Blocked matrix product with SIMD micro-kernels.
+
+    The product is computed in the usual blocked form: KC x NC panels
+    of B and MC x KC blocks of A are packed into contiguous buffers
+    (sized for the L3 and L2 caches), and a register-tiled micro-kernel
+    computes MR x NR tiles of the result from them.
+*/
+
+#ifndef VSIP_OPT_SIMD_GEMM_HPP
+#define VSIP_OPT_SIMD_GEMM_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <algorithm>
+#include <complex>
+
+#include <vsip/support.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/core/metaprogramming.hpp>
+#include <vsip/opt/simd/simd.hpp>
+#include <vsip/opt/simd/wide.hpp>
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
+
+/// Rows of the blocks of A packed for the micro-kernel.
+#ifndef VSIP_IMPL_GEMM_MC
+#  define VSIP_IMPL_GEMM_MC 96
+#endif
+
+/// Length of the inner (K) dimension of the packed blocks.
+#ifndef VSIP_IMPL_GEMM_KC
+#  define VSIP_IMPL_GEMM_KC 256
+#endif
+
+/// Columns of the panels of B packed for the micro-kernel.
+#ifndef VSIP_IMPL_GEMM_NC
+#  define VSIP_IMPL_GEMM_NC 4096
+#endif
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace simd
+{
+
+// Define value_types for which the matrix product is optimized.
+//  - float, complex<float>
+//  - double, complex<double>
+
+template <typename T,
+	  bool     IsSplit>
+struct Is_algorithm_supported<T, IsSplit, Alg_gemm>
+{
+  typedef typename Scalar_of<T>::type scalar_type;
+
+  static bool const value =
+    !IsSplit &&
+    Simd_traits<scalar_type>::is_accel &&
+    (Type_equal<scalar_type, float>::value ||
+     Type_equal<scalar_type, double>::value);
+};
+
+
+
+// Micro-kernel of the blocked matrix product:
+//
+//   AB(i, j) = sum_k A[k*MR + i] * B[k*NR + j]   0 <= i < MR, 0 <= j < NR
+//
+// for packed panels A and B of KC columns (rows).  AB is row-major.
+//
+// Complex panels are split: each column of A holds MR real parts
+// followed by MR imaginary parts, and likewise for the rows of B.  AB
+// holds the real tile followed by the imaginary tile.
+
+template <typename T,
+	  bool     Is_vectorized>
+struct Simd_gemm_kernel;
+
+
+
+// Generic, non-vectorized kernels.
+
+template <typename T>
+struct Simd_gemm_kernel<T, false>
+{
+  static int const mr = 4;
+  static int const nr = 4;
+
+  static void exec(int kc, T const* A, T const* B, T* AB)
+  {
+    for (int i = 0; i < mr * nr; ++i)
+      AB[i] = T();
+    for (; kc; --kc, A += mr, B += nr)
+      for (int i = 0; i < mr; ++i)
+	for (int j = 0; j < nr; ++j)
+	  AB[i * nr + j] += A[i] * B[j];
+  }
+};
+
+template <typename T>
+struct Simd_gemm_kernel<std::complex<T>, false>
+{
+  static int const mr = 4;
+  static int const nr = 4;
+
+  static void exec(int kc, T const* A, T const* B, T* AB)
+  {
+    T* ABi = AB + mr * nr;
+    for (int i = 0; i < mr * nr; ++i)
+      AB[i] = ABi[i] = T();
+    for (; kc; --kc, A += 2 * mr, B += 2 * nr)
+      for (int i = 0; i < mr; ++i)
+	for (int j = 0; j < nr; ++j)
+	{
+	  AB [i * nr + j] += A[i] * B[j] - A[mr + i] * B[nr + j];
+	  ABi[i * nr + j] += A[i] * B[nr + j] + A[mr + i] * B[j];
+	}
+  }
+};
+
+
+
+// Vectorized kernel: 6 rows of 2 vectors.  Panels and AB must be
+// aligned.
+
+template <typename T>
+struct Simd_gemm_kernel<T, true>
+{
+  typedef Simd_traits<T>           simd;
+  typedef typename simd::simd_type simd_type;
+
+  static int const mr = 6;
+  static int const nr = 2 * simd::vec_size;
+
+  static void exec(int kc, T const* A, T const* B, T* AB)
+  {
+    simd::enter();
+
+    simd_type c00 = simd::zero(), c01 = simd::zero();
+    simd_type c10 = simd::zero(), c11 = simd::zero();
+    simd_type c20 = simd::zero(), c21 = simd::zero();
+    simd_type c30 = simd::zero(), c31 = simd::zero();
+    simd_type c40 = simd::zero(), c41 = simd::zero();
+    simd_type c50 = simd::zero(), c51 = simd::zero();
+
+    for (; kc; --kc, A += mr, B += nr)
+    {
+      simd_type b0 = simd::load(B);
+      simd_type b1 = simd::load(B + simd::vec_size);
+      row(A[0], b0, b1, c00, c01);
+      row(A[1], b0, b1, c10, c11);
+      row(A[2], b0, b1, c20, c21);
+      row(A[3], b0, b1, c30, c31);
+      row(A[4], b0, b1, c40, c41);
+      row(A[5], b0, b1, c50, c51);
+    }
+
+    int const vs = simd::vec_size;
+    simd::store(AB + 0 * nr, c00); simd::store(AB + 0 * nr + vs, c01);
+    simd::store(AB + 1 * nr, c10); simd::store(AB + 1 * nr + vs, c11);
+    simd::store(AB + 2 * nr, c20); simd::store(AB + 2 * nr + vs, c21);
+    simd::store(AB + 3 * nr, c30); simd::store(AB + 3 * nr + vs, c31);
+    simd::store(AB + 4 * nr, c40); simd::store(AB + 4 * nr + vs, c41);
+    simd::store(AB + 5 * nr, c50); simd::store(AB + 5 * nr + vs, c51);
+
+    simd::exit();
+  }
+
+private:
+  static void row(T a, simd_type const& b0, simd_type const& b1,
+		  simd_type& c0, simd_type& c1)
+  {
+    simd_type a_v = simd::load_scalar_all(a);
+    c0 = simd::fma(a_v, b0, c0);
+    c1 = simd::fma(a_v, b1, c1);
+  }
+};
+
+// Vectorized complex kernel: 6 rows of 1 vector.
+
+template <typename T>
+struct Simd_gemm_kernel<std::complex<T>, true>
+{
+  typedef Simd_traits<T>           simd;
+  typedef typename simd::simd_type simd_type;
+
+  static int const mr = 6;
+  static int const nr = simd::vec_size;
+
+  static void exec(int kc, T const* A, T const* B, T* AB)
+  {
+    simd::enter();
+
+    simd_type r0 = simd::zero(), i0 = simd::zero();
+    simd_type r1 = simd::zero(), i1 = simd::zero();
+    simd_type r2 = simd::zero(), i2 = simd::zero();
+    simd_type r3 = simd::zero(), i3 = simd::zero();
+    simd_type r4 = simd::zero(), i4 = simd::zero();
+    simd_type r5 = simd::zero(), i5 = simd::zero();
+
+    for (; kc; --kc, A += 2 * mr, B += 2 * nr)
+    {
+      simd_type br  = simd::load(B);
+      simd_type bi  = simd::load(B + nr);
+      simd_type nbi = simd::sub(simd::zero(), bi);
+      row(A[0], A[mr + 0], br, bi, nbi, r0, i0);
+      row(A[1], A[mr + 1], br, bi, nbi, r1, i1);
+      row(A[2], A[mr + 2], br, bi, nbi, r2, i2);
+      row(A[3], A[mr + 3], br, bi, nbi, r3, i3);
+      row(A[4], A[mr + 4], br, bi, nbi, r4, i4);
+      row(A[5], A[mr + 5], br, bi, nbi, r5, i5);
+    }
+
+    T* ABi = AB + mr * nr;
+    simd::store(AB + 0 * nr, r0); simd::store(ABi + 0 * nr, i0);
+    simd::store(AB + 1 * nr, r1); simd::store(ABi + 1 * nr, i1);
+    simd::store(AB + 2 * nr, r2); simd::store(ABi + 2 * nr, i2);
+    simd::store(AB + 3 * nr, r3); simd::store(ABi + 3 * nr, i3);
+    simd::store(AB + 4 * nr, r4); simd::store(ABi + 4 * nr, i4);
+    simd::store(AB + 5 * nr, r5); simd::store(ABi + 5 * nr, i5);
+
+    simd::exit();
+  }
+
+private:
+  static void row(T ar, T ai, simd_type const& br, simd_type const& bi,
+		  simd_type const& nbi, simd_type& cr, simd_type& ci)
+  {
+    simd_type ar_v = simd::load_scalar_all(ar);
+    simd_type ai_v = simd::load_scalar_all(ai);
+    cr = simd::fma(ar_v, br,  cr);
+    cr = simd::fma(ai_v, nbi, cr);
+    ci = simd::fma(ar_v, bi,  ci);
+    ci = simd::fma(ai_v, br,  ci);
+  }
+};
+
+
+
+// Micro-kernel for value type T: the runtime-dispatched wide kernel
+// if the processor has one (see wide.hpp), otherwise the compile-time
+// kernel.
+
+template <typename T>
+struct Gemm_kernel
+{
+  typedef T scalar_type;
+  typedef Simd_gemm_kernel<T,
+    Is_algorithm_supported<T, false, Alg_gemm>::value> simd_kernel;
+
+  static bool wide_shape(int& mr, int& nr)
+  { return wide_gemm_shape<T>(mr, nr); }
+
+  static bool wide_exec(int kc, T const* A, T const* B, T* AB)
+  { return wide_gemm_kernel(kc, A, B, AB); }
+
+  static T value(T const* AB, int, int idx) { return AB[idx]; }
+};
+
+template <typename T>
+struct Gemm_kernel<std::complex<T> >
+{
+  typedef T scalar_type;
+  typedef Simd_gemm_kernel<std::complex<T>,
+    Is_algorithm_supported<std::complex<T>, false, Alg_gemm>::value>
+		simd_kernel;
+
+  static bool wide_shape(int& mr, int& nr)
+  { return wide_cgemm_shape<T>(mr, nr); }
+
+  static bool wide_exec(int kc, T const* A, T const* B, T* AB)
+  { return wide_cgemm_kernel(kc, A, B, AB); }
+
+  static std::complex<T> value(T const* AB, int tile, int idx)
+  { return std::complex<T>(AB[idx], AB[tile + idx]); }
+};
+
+
+
+/// Blocked matrix product
+///
+///   C = alpha A op(B) + beta C
+///
+/// for an M x K matrix A, a K x N matrix B and an M x N matrix C, each
+/// given by a pointer and its row and column strides.  op(B) is B, or
+/// conj(B) if CONJ_B.  C is not read if BETA is zero.
+///
+/// The row blocks of each panel of B are computed in parallel on the
+/// thread pool, if there is one and the product is large enough.
+
+template <typename T>
+class Gemm
+{
+  typedef Gemm_kernel<T>                     kernel_type;
+  typedef typename kernel_type::scalar_type  S;
+  typedef typename kernel_type::simd_kernel  simd_kernel;
+
+  static int const ncomp = Is_complex<T>::value ? 2 : 1;
+
+public:
+  Gemm(length_type M, length_type N, length_type K,
+       T alpha,
+       T const* A, stride_type a_rs, stride_type a_cs,
+       T const* B, stride_type b_rs, stride_type b_cs,
+       bool conj_b,
+       T beta,
+       T* C, stride_type c_rs, stride_type c_cs)
+    : M_(M), N_(N), K_(K), alpha_(alpha), beta_(beta),
+      A_(A), a_rs_(a_rs), a_cs_(a_cs),
+      B_(B), b_rs_(b_rs), b_cs_(b_cs), conj_b_(conj_b),
+      C_(C), c_rs_(c_rs), c_cs_(c_cs)
+  {
+    wide_ = kernel_type::wide_shape(mr_, nr_);
+    if (!wide_)
+    {
+      mr_ = simd_kernel::mr;
+      nr_ = simd_kernel::nr;
+    }
+  }
+
+  void operator()()
+  {
+    if (K_ == 0)
+    {
+      scale();
+      return;
+    }
+
+    length_type const nc_max = VSIP_IMPL_GEMM_NC;
+    length_type const kc_max = VSIP_IMPL_GEMM_KC;
+    length_type const mc_max = VSIP_IMPL_GEMM_MC;
+
+    aligned_array<S> b_buf(64, ncomp * kc_max *
+			   round_up(std::min(N_, nc_max), nr_));
+
+    length_type const num_blocks = (M_ + mc_max - 1) / mc_max;
+
+    for (jc_ = 0; jc_ < N_; jc_ += nc_max)
+    {
+      nc_ = std::min(nc_max, N_ - jc_);
+      for (pc_ = 0; pc_ < K_; pc_ += kc_max)
+      {
+	kc_ = std::min(kc_max, K_ - pc_);
+	pack_b(b_buf.get());
+	b_panel_ = b_buf.get();
+
+#if VSIP_IMPL_HAVE_THREAD_POOL
+	threads::Thread_pool* pool = threads::Thread_pool::instance();
+	if (pool && pool->num_workers() > 1 && num_blocks > 1 &&
+	    M_ * nc_ >= pool->threshold())
+	{
+	  pool->parallel_for(task, this, num_blocks);
+	  continue;
+	}
+#endif
+	for (index_type ib = 0; ib < num_blocks; ++ib)
+	  block(ib);
+      }
+    }
+  }
+
+private:
+  static length_type round_up(length_type n, length_type m)
+  { return (n + m - 1) / m * m; }
+
+  static void task(void* arg, index_type ib)
+  {
+    static_cast<Gemm*>(arg)->block(ib);
+  }
+
+  // Compute row block IB of the current panel of C.
+  void block(index_type ib)
+  {
+    length_type const mc_max = VSIP_IMPL_GEMM_MC;
+    index_type  const ic = ib * mc_max;
+    length_type const mc = std::min(mc_max, M_ - ic);
+
+    aligned_array<S> a_buf(64, ncomp * kc_ * round_up(mc, mr_));
+    aligned_array<S> ab(64, ncomp * mr_ * nr_);
+
+    pack_a(ic, mc, a_buf.get());
+
+    for (index_type jr = 0; jr < nc_; jr += nr_)
+    {
+      S const* b = b_panel_ + ncomp * kc_ * jr;
+      for (index_type ir = 0; ir < mc; ir += mr_)
+      {
+	S const* a = a_buf.get() + ncomp * kc_ * ir;
+	if (!(wide_ && kernel_type::wide_exec(kc_, a, b, ab.get())))
+	  simd_kernel::exec(kc_, a, b, ab.get());
+	update(ic + ir, jc_ + jr,
+	       std::min<length_type>(mr_, mc - ir),
+	       std::min<length_type>(nr_, nc_ - jr),
+	       ab.get());
+      }
+    }
+  }
+
+  // Pack rows [IC, IC + MC) of the current K block of A into MR-row
+  // micro-panels, padded with zeros.
+  void pack_a(index_type ic, length_type mc, S* buf) const
+  {
+    for (index_type ir = 0; ir < mc; ir += mr_)
+    {
+      length_type const m = std::min<length_type>(mr_, mc - ir);
+      T const* a = A_ + (ic + ir) * a_rs_ + pc_ * a_cs_;
+      for (index_type k = 0; k < kc_; ++k, a += a_cs_, buf += ncomp * mr_)
+      {
+	index_type i = 0;
+	for (; i < m; ++i)
+	  put(buf, mr_, i, a[i * a_rs_], false);
+	for (; i < length_type(mr_); ++i)
+	  put(buf, mr_, i, T(), false);
+      }
+    }
+  }
+
+  // Pack the current KC x NC panel of B into NR-column micro-panels,
+  // padded with zeros.
+  void pack_b(S* buf) const
+  {
+    for (index_type jr = 0; jr < nc_; jr += nr_)
+    {
+      length_type const n = std::min<length_type>(nr_, nc_ - jr);
+      T const* b = B_ + pc_ * b_rs_ + (jc_ + jr) * b_cs_;
+      for (index_type k = 0; k < kc_; ++k, b += b_rs_, buf += ncomp * nr_)
+      {
+	index_type j = 0;
+	for (; j < n; ++j)
+	  put(buf, nr_, j, b[j * b_cs_], conj_b_);
+	for (; j < length_type(nr_); ++j)
+	  put(buf, nr_, j, T(), false);
+      }
+    }
+  }
+
+  static void put(S* buf, int, index_type i, S value, bool)
+  { buf[i] = value; }
+
+  static void put(S* buf, int n, index_type i, std::complex<S> const& value,
+		  bool conj)
+  {
+    buf[i]     = value.real();
+    buf[n + i] = conj ? -value.imag() : value.imag();
+  }
+
+  // Accumulate the M x N upper-left part of the tile AB into C at
+  // (I, J).  The first K block applies alpha and beta.
+  void update(index_type i, index_type j, length_type m, length_type n,
+	      S const* ab) const
+  {
+    int const tile = mr_ * nr_;
+    for (index_type ii = 0; ii < m; ++ii)
+    {
+      T* c = C_ + (i + ii) * c_rs_ + j * c_cs_;
+      for (index_type jj = 0; jj < n; ++jj, c += c_cs_)
+      {
+	T v = alpha_ * kernel_type::value(ab, tile, ii * nr_ + jj);
+	if (pc_ != 0)
+	  *c += v;
+	else if (beta_ == T())
+	  *c = v;
+	else
+	  *c = v + beta_ * *c;
+      }
+    }
+  }
+
+  // C = beta C, for an empty inner dimension.
+  void scale() const
+  {
+    for (index_type i = 0; i < M_; ++i)
+      for (index_type j = 0; j < N_; ++j)
+      {
+	T* c = C_ + i * c_rs_ + j * c_cs_;
+	*c = beta_ == T() ? T() : beta_ * *c;
+      }
+  }
+
+  length_type M_, N_, K_;
+  T           alpha_, beta_;
+  T const*    A_;
+  stride_type a_rs_, a_cs_;
+  T const*    B_;
+  stride_type b_rs_, b_cs_;
+  bool        conj_b_;
+  T*          C_;
+  stride_type c_rs_, c_cs_;
+
+  bool        wide_;
+  int         mr_, nr_;
+
+  // Current panel.
+  index_type  jc_, pc_;
+  length_type nc_, kc_;
+  S const*    b_panel_;
+};
+
+
+
+/// Matrix-vector product
+///
+///   Y = A X
+///
+/// for an M x N matrix A.  The product is formed as a sum of scaled
+/// columns if A is stored by column, and as dot products otherwise, so
+/// that A is read contiguously.
+
+template <typename T>
+void
+gemv(length_type M, length_type N,
+     T const* A, stride_type a_rs, stride_type a_cs,
+     T const* X, stride_type x_s,
+     T*       Y, stride_type y_s)
+{
+  if (a_rs == 1 && a_cs != 1)
+  {
+    for (index_type i = 0; i < M; ++i)
+      Y[i * y_s] = T();
+    for (index_type j = 0; j < N; ++j, A += a_cs, X += x_s)
+    {
+      T x = *X;
+      for (index_type i = 0; i < M; ++i)
+	Y[i * y_s] += A[i] * x;
+    }
+  }
+  else
+  {
+    for (index_type i = 0; i < M; ++i, A += a_rs, Y += y_s)
+    {
+      T s0 = T(), s1 = T(), s2 = T(), s3 = T();
+      index_type j = 0;
+      for (; j + 4 <= N; j += 4)
+      {
+	s0 += A[(j + 0) * a_cs] * X[(j + 0) * x_s];
+	s1 += A[(j + 1) * a_cs] * X[(j + 1) * x_s];
+	s2 += A[(j + 2) * a_cs] * X[(j + 2) * x_s];
+	s3 += A[(j + 3) * a_cs] * X[(j + 3) * x_s];
+      }
+      for (; j < N; ++j)
+	s0 += A[j * a_cs] * X[j * x_s];
+      *Y = (s0 + s1) + (s2 + s3);
+    }
+  }
+}
+
+} // namespace vsip::impl::simd
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_SIMD_GEMM_HPP
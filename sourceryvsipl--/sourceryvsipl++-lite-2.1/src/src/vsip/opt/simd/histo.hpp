@@ -0,0 +1,146 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    vsip/opt/simd/histo.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: SIMD histogram bins.
+
+*/
+
+#ifndef VSIP_OPT_SIMD_HISTO_HPP
+#define VSIP_OPT_SIMD_HISTO_HPP
+
+#include <vsip/opt/simd/simd.hpp>
+#include <vsip/core/metaprogramming.hpp>
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace simd
+{
+
+// Define value_types for which histogram bins are optimized.
+//  - float
+//  - double
+//
+// AltiVec does not provide select.
+
+template <typename T,
+	  bool     IsSplit>
+struct Is_algorithm_supported<T, IsSplit, Alg_histo>
+{
+#ifdef VSIP_IMPL_SIMD_ALTIVEC
+  static bool const value = false;
+#else
+  static bool const value =
+    Simd_traits<T>::is_accel &&
+    (Type_equal<T, float>::value ||
+     Type_equal<T, double>::value);
+#endif
+};
+
+
+
+// Class for histogram bins less one, computed as floating-point values:
+//
+//   P[i] = -1                                  if A[i] <  MIN
+//          NUM_BIN - 2                         if A[i] >= MAX
+//          min((A[i] - MIN) * SCALE, NUM_BIN - 3)  otherwise
+//
+// SCALE is the reciprocal of the bin width.  The caller truncates P[i]
+// and then adds 1, as histo::Bins does: adding 1 before truncating
+// may round a value just below a bin edge up into the next bin.  The
+// clamp keeps rounding from moving a value into the last bin.
+
+template <typename T,
+	  bool     Is_vectorized>
+struct Simd_histo_bins;
+
+
+
+// Generic, non-vectorized implementation of histogram bins.
+
+template <typename T>
+struct Simd_histo_bins<T, false>
+{
+  static void exec(T* P, T const* A, T min, T max, T scale, T num_bin, int n)
+  {
+    T hi = num_bin - T(3);
+    while (n)
+    {
+      T p = (*A - min) * scale;
+      p = p > hi ? hi : p;
+      *P = *A < min ? T(-1) : (*A >= max ? num_bin - T(2) : p);
+      A++; P++;
+      n--;
+    }
+  }
+};
+
+// vectorized version.  P must be aligned, A need not be.
+
+template <typename T>
+struct Simd_histo_bins<T, true>
+{
+  static void exec(T* P, T const* A, T min, T max, T scale, T num_bin, int n)
+  {
+    typedef Simd_traits<T>           simd;
+    typedef typename simd::simd_type simd_type;
+
+    assert(simd::alignment_of(P) == 0);
+
+    simd::enter();
+
+    simd_type min_v   = simd::load_scalar_all(min);
+    simd_type max_v   = simd::load_scalar_all(max);
+    simd_type scale_v = simd::load_scalar_all(scale);
+    simd_type first_v = simd::load_scalar_all(T(-1));
+    simd_type hi_v    = simd::load_scalar_all(num_bin - T(3));
+    simd_type last_v  = simd::load_scalar_all(num_bin - T(2));
+
+    while (n >= simd::vec_size)
+    {
+      n -= simd::vec_size;
+
+      simd_type A_v = simd::load_unaligned(A);
+      simd_type P_v = simd::min(simd::mul(simd::sub(A_v, min_v), scale_v),
+				hi_v);
+      P_v = simd::select(simd::lt(A_v, min_v), first_v, P_v);
+      P_v = simd::select(simd::ge(A_v, max_v), last_v, P_v);
+      simd::store(P, P_v);
+
+      A += simd::vec_size;
+      P += simd::vec_size;
+    }
+
+    simd::exit();
+
+    Simd_histo_bins<T, false>::exec(P, A, min, max, scale, num_bin, n);
+  }
+};
+
+
+
+template <typename T>
+inline void
+histo_bins(T* P, T const* A, T min, T max, T scale, T num_bin, int n)
+{
+  static bool const Is_vectorized =
+    Is_algorithm_supported<T, false, Alg_histo>::value;
+  Simd_histo_bins<T, Is_vectorized>::exec(P, A, min, max, scale, num_bin, n);
+}
+
+} // namespace vsip::impl::simd
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif
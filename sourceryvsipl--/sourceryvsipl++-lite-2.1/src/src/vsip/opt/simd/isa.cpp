@@ -0,0 +1,98 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/simd/isa.cpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Runtime selection of the SIMD instruction set.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstring>
+
+#include <vsip/core/config.hpp>
+#include <vsip/core/argv_utils.hpp>
+#include <vsip/opt/simd/isa.hpp>
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace simd
+{
+
+Isa isa_ = isa_native;
+
+
+
+Isa
+detect_isa()
+{
+#if VSIP_IMPL_SIMD_RUNTIME_ISA
+  // __builtin_cpu_supports also checks that the OS saves the
+  // extended register state.
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return isa_avx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return isa_avx2;
+#endif
+  return isa_native;
+}
+
+
+
+void
+set_isa(Isa requested)
+{
+  Isa supported = detect_isa();
+  isa_ = requested < supported ? requested : supported;
+}
+
+
+
+char const*
+isa_name(Isa i)
+{
+  switch (i)
+  {
+  case isa_avx2:   return "avx2";
+  case isa_avx512: return "avx512";
+  default:         return "native";
+  }
+}
+
+
+
+void
+initialize_isa(int& argc, char**& argv)
+{
+  Isa requested = isa_avx512;
+
+  for (int i=1; i<argc; )
+  {
+    if (!strcmp(argv[i], "--svpp-simd-isa") && i+1 < argc)
+    {
+      if      (!strcmp(argv[i+1], "avx512")) requested = isa_avx512;
+      else if (!strcmp(argv[i+1], "avx2"))   requested = isa_avx2;
+      else                                   requested = isa_native;
+      shift_argv(argc, argv, i, 2);
+    }
+    else
+      ++i;
+  }
+
+  set_isa(requested);
+}
+
+} // namespace vsip::impl::simd
+} // namespace vsip::impl
+} // namespace vsip
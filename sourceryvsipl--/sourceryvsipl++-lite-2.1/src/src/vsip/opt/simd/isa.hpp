@@ -0,0 +1,84 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/simd/isa.hpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Runtime selection of the SIMD instruction set.
+
+    The library is compiled for a baseline processor (SSE2 on x86-64).
+    On x86 processors, kernels for wider instruction sets (AVX2+FMA,
+    AVX-512) are compiled alongside and selected at vsipl
+    initialization according to what the running processor supports.
+*/
+
+#ifndef VSIP_OPT_SIMD_ISA_HPP
+#define VSIP_OPT_SIMD_ISA_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Macros
+***********************************************************************/
+
+// Runtime ISA selection requires the GCC target attribute and
+// intrinsic headers that declare all instruction sets (GCC 4.9).
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) && \
+    (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) &&     \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#  define VSIP_IMPL_SIMD_RUNTIME_ISA 1
+#else
+#  define VSIP_IMPL_SIMD_RUNTIME_ISA 0
+#endif
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace simd
+{
+
+/// Instruction sets, ordered by vector width.
+///
+/// isa_native denotes the Simd_traits the library was compiled with.
+
+enum Isa
+{
+  isa_native = 0,
+  isa_avx2   = 1,	// 256-bit AVX2 with FMA.
+  isa_avx512 = 2	// 512-bit AVX-512F.
+};
+
+extern Isa isa_;
+
+/// Return the instruction set used by runtime-dispatched kernels.
+inline Isa isa() { return isa_; }
+
+/// Return the widest instruction set supported by this processor.
+Isa detect_isa();
+
+/// Select the instruction set, limited to what detect_isa() reports.
+void set_isa(Isa);
+
+char const* isa_name(Isa);
+
+/// Select the widest supported instruction set.
+///
+/// Options:
+///   --svpp-simd-isa NAME  limit the instruction set to NAME
+///                         (native, avx2, or avx512).
+void initialize_isa(int& argc, char**& argv);
+
+} // namespace vsip::impl::simd
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_SIMD_ISA_HPP
@@ -0,0 +1,259 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    vsip/opt/simd/matvec.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Builtin matrix and vector products.
+
+    Evaluators for matrix products with the blocked SIMD product of
+    gemm.hpp, used when no BLAS library is configured, and for
+    matrix-vector products with direct data access.
+*/
+
+#ifndef VSIP_OPT_SIMD_MATVEC_HPP
+#define VSIP_OPT_SIMD_MATVEC_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <complex>
+
+#include <vsip/support.hpp>
+#include <vsip/core/dispatch.hpp>
+#include <vsip/core/extdata.hpp>
+#include <vsip/core/impl_tags.hpp>
+#include <vsip/core/metaprogramming.hpp>
+#include <vsip/opt/simd/gemm.hpp>
+
+/// Minimum M * N * K of matrix products computed by the blocked
+/// product.  Smaller products use the generic evaluators.
+#ifndef VSIP_IMPL_GEMM_MIN_SIZE
+#  define VSIP_IMPL_GEMM_MIN_SIZE (8 * 8 * 8)
+#endif
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace simd
+{
+
+/// Value types and blocks supported by the builtin products: float,
+/// double and their complex types, with the same value type for all
+/// blocks, and direct access to interleaved data.
+
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename Block2>
+struct Is_matvec_supported
+{
+  typedef typename Scalar_of<T>::type scalar_type;
+
+  static bool const value =
+    (Type_equal<scalar_type, float>::value ||
+     Type_equal<scalar_type, double>::value) &&
+    Type_equal<T, typename Block0::value_type>::value &&
+    Type_equal<T, typename Block1::value_type>::value &&
+    Type_equal<T, typename Block2::value_type>::value &&
+    Ext_data_cost<Block0>::value == 0 &&
+    Ext_data_cost<Block1>::value == 0 &&
+    Ext_data_cost<Block2>::value == 0 &&
+    !Is_split_block<Block0>::value &&
+    !Is_split_block<Block1>::value &&
+    !Is_split_block<Block2>::value;
+};
+
+
+
+/// C = alpha A op(B) + beta C, for blocks with direct data access.
+
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename Block2>
+void
+gemm(T alpha, Block1 const& a, Block2 const& b, bool conj_b, T beta,
+     Block0& c)
+{
+  Ext_data<Block0> ext_c(c);
+  Ext_data<Block1> ext_a(const_cast<Block1&>(a));
+  Ext_data<Block2> ext_b(const_cast<Block2&>(b));
+
+  Gemm<T> gemm(c.size(2, 0), c.size(2, 1), a.size(2, 1),
+	       alpha,
+	       ext_a.data(), ext_a.stride(0), ext_a.stride(1),
+	       ext_b.data(), ext_b.stride(0), ext_b.stride(1),
+	       conj_b,
+	       beta,
+	       ext_c.data(), ext_c.stride(0), ext_c.stride(1));
+  gemm();
+}
+
+inline bool
+is_gemm_large(length_type m, length_type n, length_type k)
+{
+  return m * n * k >= VSIP_IMPL_GEMM_MIN_SIZE;
+}
+
+} // namespace vsip::impl::simd
+
+
+
+namespace dispatcher
+{
+
+/// Builtin evaluator for matrix-matrix products.
+template <typename Block0,
+	  typename Block1,
+	  typename Block2>
+struct Evaluator<Op_prod_mm, Simd_builtin_tag,
+                 void(Block0&, Block1 const&, Block2 const&)>
+{
+  typedef typename Block0::value_type T;
+
+  static bool const ct_valid =
+    simd::Is_matvec_supported<T, Block0, Block1, Block2>::value;
+
+  static bool rt_valid(Block0& r, Block1 const& a, Block2 const&)
+  { return simd::is_gemm_large(r.size(2, 0), r.size(2, 1), a.size(2, 1)); }
+
+  static void exec(Block0& r, Block1 const& a, Block2 const& b)
+  {
+    simd::gemm(T(1), a, b, false, T(), r);
+  }
+};
+
+
+
+/// Builtin evaluator for matrix-matrix conjugate products.
+template <typename Block0,
+	  typename Block1,
+	  typename Block2>
+struct Evaluator<Op_prod_mm_conj, Simd_builtin_tag,
+                 void(Block0&, Block1 const&, Block2 const&)>
+{
+  typedef typename Block0::value_type T;
+
+  static bool const ct_valid =
+    Is_complex<T>::value &&
+    simd::Is_matvec_supported<T, Block0, Block1, Block2>::value;
+
+  static bool rt_valid(Block0& r, Block1 const& a, Block2 const&)
+  { return simd::is_gemm_large(r.size(2, 0), r.size(2, 1), a.size(2, 1)); }
+
+  static void exec(Block0& r, Block1 const& a, Block2 const& b)
+  {
+    simd::gemm(T(1), a, b, true, T(), r);
+  }
+};
+
+
+
+/// Builtin evaluator for generalized matrix-matrix products.
+template <typename T1,
+	  typename T2,
+	  typename Block0,
+	  typename Block1,
+	  typename Block2>
+struct Evaluator<Op_prod_gemp, Simd_builtin_tag,
+                 void(Block0&, T1, Block1 const&, Block2 const&, T2)>
+{
+  typedef typename Block0::value_type T;
+
+  static bool const ct_valid =
+    simd::Is_matvec_supported<T, Block0, Block1, Block2>::value &&
+    (!Is_complex<T1>::value || Is_complex<T>::value) &&
+    (!Is_complex<T2>::value || Is_complex<T>::value);
+
+  static bool rt_valid(Block0& c, T1, Block1 const& a, Block2 const&, T2)
+  { return simd::is_gemm_large(c.size(2, 0), c.size(2, 1), a.size(2, 1)); }
+
+  static void exec(Block0& c, T1 alpha, Block1 const& a, Block2 const& b,
+		   T2 beta)
+  {
+    simd::gemm(T(alpha), a, b, false, T(beta), c);
+  }
+};
+
+
+
+/// Builtin evaluator for matrix-vector products.
+template <typename Block0,
+	  typename Block1,
+	  typename Block2>
+struct Evaluator<Op_prod_mv, Simd_builtin_tag,
+                 void(Block0&, Block1 const&, Block2 const&)>
+{
+  typedef typename Block0::value_type T;
+
+  static bool const ct_valid =
+    simd::Is_matvec_supported<T, Block0, Block1, Block2>::value;
+
+  static bool rt_valid(Block0&, Block1 const&, Block2 const&)
+  { return true; }
+
+  static void exec(Block0& r, Block1 const& a, Block2 const& b)
+  {
+    Ext_data<Block0> ext_r(r);
+    Ext_data<Block1> ext_a(const_cast<Block1&>(a));
+    Ext_data<Block2> ext_b(const_cast<Block2&>(b));
+
+    simd::gemv(a.size(2, 0), a.size(2, 1),
+	       ext_a.data(), ext_a.stride(0), ext_a.stride(1),
+	       ext_b.data(), ext_b.stride(0),
+	       ext_r.data(), ext_r.stride(0));
+  }
+};
+
+
+
+/// Builtin evaluator for vector-matrix products, as products of the
+/// transpose of the matrix and the vector.
+template <typename Block0,
+	  typename Block1,
+	  typename Block2>
+struct Evaluator<Op_prod_vm, Simd_builtin_tag,
+                 void(Block0&, Block1 const&, Block2 const&)>
+{
+  typedef typename Block0::value_type T;
+
+  static bool const ct_valid =
+    simd::Is_matvec_supported<T, Block0, Block1, Block2>::value;
+
+  static bool rt_valid(Block0&, Block1 const&, Block2 const&)
+  { return true; }
+
+  static void exec(Block0& r, Block1 const& a, Block2 const& b)
+  {
+    Ext_data<Block0> ext_r(r);
+    Ext_data<Block1> ext_a(const_cast<Block1&>(a));
+    Ext_data<Block2> ext_b(const_cast<Block2&>(b));
+
+    simd::gemv(b.size(2, 1), b.size(2, 0),
+	       ext_b.data(), ext_b.stride(1), ext_b.stride(0),
+	       ext_a.data(), ext_a.stride(0),
+	       ext_r.data(), ext_r.stride(0));
+  }
+};
+
+} // namespace vsip::impl::dispatcher
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_SIMD_MATVEC_HPP
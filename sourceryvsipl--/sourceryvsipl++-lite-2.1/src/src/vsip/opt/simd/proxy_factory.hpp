@@ -117,6 +117,12 @@ struct Proxy_factory<Unary_expr_block<D, O, B, T> const, A>
   static bool 
   rt_valid(Unary_expr_block<D, O, B, T> const &b, int alignment)
   {
+    // Operators such as mag and euler change the size of the values,
+    // so ALIGNMENT (in bytes of the result) does not carry over to the
+    // operand.  Only accept them when no unaligned head is processed
+    // first, in which case the operand must be aligned in its own type.
+    if (A && !Type_equal<typename access_traits::value_type, T>::value)
+      return alignment == 0 && Proxy_factory<B, A>::rt_valid(b.op(), 0);
     return Proxy_factory<B, A>::rt_valid(b.op(), alignment);
   }
 
@@ -16,6 +16,7 @@
 ***********************************************************************/
 
 #include <vsip/opt/simd/rscvmul.hpp>
+#include <vsip/opt/simd/wide.hpp>
 
 
 
@@ -40,6 +41,9 @@ rscvmul(
   std::complex<T>* res,
   int size)
 {
+  if (wide_rscvmul(op1, op2, res, size))
+    return;
+
   static bool const Is_vectorized =
     Is_algorithm_supported<T, false, Alg_rscvmul>::value;
   Simd_rscvmul<std::complex<T>, Is_vectorized>::exec(op1, op2, res, size);
@@ -41,6 +41,29 @@
 #include <cassert>
 
 #include <vsip/opt/simd/simd_common.hpp>
+#include <vsip/opt/simd/simd_avx.hpp>
+
+// When the library is compiled for AVX2 or AVX-512, the float, double
+// and int traits are the wide ones.  Otherwise the wide traits are
+// only used by runtime-dispatched kernels (see wide.hpp).
+
+#if VSIP_IMPL_SIMD_RUNTIME_ISA
+#  if defined(__AVX512F__)
+#    define VSIP_IMPL_SIMD_AVX512
+#  elif defined(__AVX2__) && defined(__FMA__)
+#    define VSIP_IMPL_SIMD_AVX2
+#  endif
+#endif
+
+// The x86 float and double traits provide the operations used by the
+// transcendental functions in simd_math.hpp (sqrt, select, pow2,
+// getexp, getmant).
+
+#if !defined(VSIP_IMPL_SIMD_ALTIVEC) && defined(__SSE2__)
+#  define VSIP_IMPL_SIMD_HAVE_MATH 1
+#else
+#  define VSIP_IMPL_SIMD_HAVE_MATH 0
+#endif
 
 
 
@@ -1165,6 +1188,7 @@ struct Simd_traits<short> {
 
 
 
+#if !defined(VSIP_IMPL_SIMD_AVX2) && !defined(VSIP_IMPL_SIMD_AVX512)
 template <>
 struct Simd_traits<int> {
   typedef int		value_type;
@@ -1340,6 +1364,32 @@ struct Simd_traits<float> {
   static int sign_mask(simd_type const& v1)
   { return _mm_movemask_ps(v1); }
 
+  static simd_type sqrt(simd_type const& v1)
+  { return _mm_sqrt_ps(v1); }
+
+  static simd_type select(simd_type const& mask, simd_type const& v1,
+			  simd_type const& v2)
+  { return _mm_or_ps(_mm_and_ps(mask, v1), _mm_andnot_ps(mask, v2)); }
+
+  static simd_type pow2(simd_type const& n)
+  {
+    __m128i e = _mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127));
+    return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+  }
+
+  static simd_type getexp(simd_type const& v1)
+  {
+    __m128i e = _mm_srli_epi32(_mm_castps_si128(v1), 23);
+    e = _mm_and_si128(e, _mm_set1_epi32(0xff));
+    return _mm_cvtepi32_ps(_mm_sub_epi32(e, _mm_set1_epi32(127)));
+  }
+
+  static simd_type getmant(simd_type const& v1)
+  {
+    __m128i m = _mm_and_si128(_mm_castps_si128(v1), _mm_set1_epi32(0x007fffff));
+    return _mm_castsi128_ps(_mm_or_si128(m, _mm_set1_epi32(0x3f800000)));
+  }
+
   static simd_type extend(simd_type const& v)
   { return _mm_shuffle_ps(v, v, 0x00); }
 
@@ -1464,6 +1514,36 @@ struct Simd_traits<double> {
   static int sign_mask(simd_type const& v1)
   { return _mm_movemask_pd(v1); }
 
+  static simd_type sqrt(simd_type const& v1)
+  { return _mm_sqrt_pd(v1); }
+
+  static simd_type select(simd_type const& mask, simd_type const& v1,
+			  simd_type const& v2)
+  { return _mm_or_pd(_mm_and_pd(mask, v1), _mm_andnot_pd(mask, v2)); }
+
+  static simd_type pow2(simd_type const& n)
+  {
+    __m128i e = _mm_add_epi32(_mm_cvtpd_epi32(n), _mm_set1_epi32(1023));
+    e = _mm_unpacklo_epi32(e, _mm_setzero_si128());
+    return _mm_castsi128_pd(_mm_slli_epi64(e, 52));
+  }
+
+  static simd_type getexp(simd_type const& v1)
+  {
+    __m128i e = _mm_srli_epi64(_mm_castpd_si128(v1), 52);
+    e = _mm_and_si128(e, _mm_set1_epi32(0x7ff));
+    e = _mm_shuffle_epi32(e, 0x08);
+    return _mm_cvtepi32_pd(_mm_sub_epi32(e, _mm_set1_epi32(1023)));
+  }
+
+  static simd_type getmant(simd_type const& v1)
+  {
+    __m128i m = _mm_and_si128(_mm_castpd_si128(v1),
+			      _mm_set_epi32(0x000fffff, -1, 0x000fffff, -1));
+    return _mm_castsi128_pd(_mm_or_si128(m, _mm_set_epi32(0x3ff00000, 0,
+							  0x3ff00000, 0)));
+  }
+
   static simd_type extend(simd_type const& v)
   { return _mm_shuffle_pd(v, v, 0x0); }
 
@@ -1487,6 +1567,17 @@ struct Simd_traits<double> {
   static void exit()  {}
 };
 #endif
+#endif // !VSIP_IMPL_SIMD_AVX2 && !VSIP_IMPL_SIMD_AVX512
+
+#if defined(VSIP_IMPL_SIMD_AVX512)
+template <> struct Simd_traits<int>    : Avx512_traits<int> {};
+template <> struct Simd_traits<float>  : Avx512_traits<float> {};
+template <> struct Simd_traits<double> : Avx512_traits<double> {};
+#elif defined(VSIP_IMPL_SIMD_AVX2)
+template <> struct Simd_traits<int>    : Avx_traits<int> {};
+template <> struct Simd_traits<float>  : Avx_traits<float> {};
+template <> struct Simd_traits<double> : Avx_traits<double> {};
+#endif
 #endif
 
 template <typename T>
@@ -1717,6 +1808,8 @@ struct Alg_vbnot;
 struct Alg_threshold;
 struct Alg_vma_cSC;
 struct Alg_vma_ip_cSC;
+struct Alg_histo;
+struct Alg_gemm;
 
 template <typename T,
 	  bool     IsSplit,
@@ -0,0 +1,1014 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/simd/simd_avx.hpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: AVX2 and AVX-512 SIMD traits.
+
+    Avx_traits (256-bit) and Avx512_traits (512-bit) have the same
+    interface as Simd_traits.  Their member functions carry a target
+    attribute, so they may be used by kernels compiled for that
+    instruction set (see wide.cpp) in a library that is otherwise
+    built for a baseline processor.  When the library itself is built
+    for AVX2 or AVX-512, simd.hpp uses them as Simd_traits.
+
+    The interleave/de-interleave operations keep element order across
+    the full vector (unlike the per-128-bit-lane AVX instructions), so
+    that the complex Simd_traits and kernels work unchanged.
+*/
+
+#ifndef VSIP_OPT_SIMD_SIMD_AVX_HPP
+#define VSIP_OPT_SIMD_SIMD_AVX_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/opt/simd/isa.hpp>
+
+#if VSIP_IMPL_SIMD_RUNTIME_ISA
+#  include <immintrin.h>
+#  include <stdint.h>
+#endif
+
+
+
+/***********************************************************************
+  Macros
+***********************************************************************/
+
+#if VSIP_IMPL_SIMD_RUNTIME_ISA
+
+#  if defined(__AVX2__) && defined(__FMA__)
+#    define VSIP_IMPL_AVX2_FUNC
+#  else
+#    define VSIP_IMPL_AVX2_FUNC __attribute__((__target__("avx2,fma")))
+#  endif
+
+#  if defined(__AVX512F__)
+#    define VSIP_IMPL_AVX512_FUNC
+#  else
+#    define VSIP_IMPL_AVX512_FUNC __attribute__((__target__("avx512f")))
+#  endif
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace simd
+{
+
+template <typename T>
+struct Avx_traits;
+
+template <typename T>
+struct Avx512_traits;
+
+
+
+/***********************************************************************
+  AVX2 (256-bit)
+***********************************************************************/
+
+template <>
+struct Avx_traits<int>
+{
+  typedef int		value_type;
+  typedef __m256i	simd_type;
+
+  static int const  vec_size   = 8;
+  static bool const is_accel   = true;
+  static bool const has_perm   = false;
+  static bool const has_div    = false;
+  static int  const alignment  = 32;
+  static unsigned int  const scalar_pos = 0;
+
+  static intptr_t alignment_of(value_type const* addr)
+  { return (intptr_t)addr & (alignment - 1); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type zero()
+  { return _mm256_setzero_si256(); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load(value_type const* addr)
+  { return _mm256_load_si256((simd_type const*)addr); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load_unaligned(value_type const* addr)
+  { return _mm256_loadu_si256((simd_type const*)addr); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load_scalar(value_type value)
+  { return _mm256_setr_epi32(value, 0, 0, 0, 0, 0, 0, 0); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load_scalar_all(value_type value)
+  { return _mm256_set1_epi32(value); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static void store(value_type* addr, simd_type const& vec)
+  { _mm256_store_si256((simd_type*)addr, vec); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static void store_stream(value_type* addr, simd_type const& vec)
+  { _mm256_store_si256((simd_type*)addr, vec); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type add(simd_type const& v1, simd_type const& v2)
+  { return _mm256_add_epi32(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type sub(simd_type const& v1, simd_type const& v2)
+  { return _mm256_sub_epi32(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type band(simd_type const& v1, simd_type const& v2)
+  { return _mm256_and_si256(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type bor(simd_type const& v1, simd_type const& v2)
+  { return _mm256_or_si256(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type bxor(simd_type const& v1, simd_type const& v2)
+  { return _mm256_xor_si256(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type bnot(simd_type const& v1)
+  { return bxor(v1, load_scalar_all(0xFFFFFFFF)); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type interleaved_lo_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    return _mm256_permute2x128_si256(_mm256_unpacklo_epi32(real, imag),
+				     _mm256_unpackhi_epi32(real, imag), 0x20);
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type interleaved_hi_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    return _mm256_permute2x128_si256(_mm256_unpacklo_epi32(real, imag),
+				     _mm256_unpackhi_epi32(real, imag), 0x31);
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type pack(simd_type const& v1, simd_type const& v2)
+  { return _mm256_permute4x64_epi64(_mm256_packs_epi32(v1, v2), 0xD8); }
+
+  static void enter() {}
+  static void exit()  {}
+};
+
+
+
+template <>
+struct Avx_traits<float>
+{
+  typedef float		value_type;
+  typedef __m256	simd_type;
+
+  static int const  vec_size   = 8;
+  static bool const is_accel   = true;
+  static bool const has_perm   = false;
+  static bool const has_div    = true;
+  static int  const alignment  = 32;
+  static unsigned int  const scalar_pos = 0;
+
+  static intptr_t alignment_of(value_type const* addr)
+  { return (intptr_t)addr & (alignment - 1); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type zero()
+  { return _mm256_setzero_ps(); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load(value_type const* addr)
+  { return _mm256_load_ps(addr); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load_unaligned(value_type const* addr)
+  { return _mm256_loadu_ps(addr); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load_scalar(value_type value)
+  { return _mm256_setr_ps(value, 0, 0, 0, 0, 0, 0, 0); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load_scalar_all(value_type value)
+  { return _mm256_set1_ps(value); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static void store(value_type* addr, simd_type const& vec)
+  { _mm256_store_ps(addr, vec); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static void store_stream(value_type* addr, simd_type const& vec)
+  { _mm256_store_ps(addr, vec); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type add(simd_type const& v1, simd_type const& v2)
+  { return _mm256_add_ps(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type sub(simd_type const& v1, simd_type const& v2)
+  { return _mm256_sub_ps(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type mul(simd_type const& v1, simd_type const& v2)
+  { return _mm256_mul_ps(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type div(simd_type const& v1, simd_type const& v2)
+  { return _mm256_div_ps(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type fma(simd_type const& v1, simd_type const& v2,
+		       simd_type const& v3)
+  { return _mm256_fmadd_ps(v1, v2, v3); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type mag(simd_type const& v1)
+  {
+    __m256i mask = _mm256_srli_epi32(_mm256_set1_epi32(-1), 1);
+    return _mm256_and_ps(_mm256_castsi256_ps(mask), v1);
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type min(simd_type const& v1, simd_type const& v2)
+  { return _mm256_min_ps(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type max(simd_type const& v1, simd_type const& v2)
+  { return _mm256_max_ps(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type gt(simd_type const& v1, simd_type const& v2)
+  { return _mm256_cmp_ps(v1, v2, _CMP_GT_OQ); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type lt(simd_type const& v1, simd_type const& v2)
+  { return _mm256_cmp_ps(v1, v2, _CMP_LT_OQ); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type ge(simd_type const& v1, simd_type const& v2)
+  { return _mm256_cmp_ps(v1, v2, _CMP_GE_OQ); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type le(simd_type const& v1, simd_type const& v2)
+  { return _mm256_cmp_ps(v1, v2, _CMP_LE_OQ); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static int sign_mask(simd_type const& v1)
+  { return _mm256_movemask_ps(v1); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type sqrt(simd_type const& v1)
+  { return _mm256_sqrt_ps(v1); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type select(simd_type const& mask, simd_type const& v1,
+			  simd_type const& v2)
+  { return _mm256_or_ps(_mm256_and_ps(mask, v1), _mm256_andnot_ps(mask, v2)); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type pow2(simd_type const& n)
+  {
+    __m256i e = _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type getexp(simd_type const& v1)
+  {
+    __m256i e = _mm256_srli_epi32(_mm256_castps_si256(v1), 23);
+    e = _mm256_and_si256(e, _mm256_set1_epi32(0xff));
+    return _mm256_cvtepi32_ps(_mm256_sub_epi32(e, _mm256_set1_epi32(127)));
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type getmant(simd_type const& v1)
+  {
+    __m256i m = _mm256_and_si256(_mm256_castps_si256(v1),
+				 _mm256_set1_epi32(0x007fffff));
+    return _mm256_castsi256_ps(_mm256_or_si256(m,
+					       _mm256_set1_epi32(0x3f800000)));
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type extend(simd_type const& v)
+  { return _mm256_broadcastss_ps(_mm256_castps256_ps128(v)); }
+
+  // [r0 r1 r4 r5 | r2 r3 r6 r7] -> [r0 .. r7]
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type real_from_interleaved(simd_type const& v1,
+					 simd_type const& v2)
+  {
+    simd_type t = _mm256_shuffle_ps(v1, v2, 0x88);
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(t), 0xD8));
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type imag_from_interleaved(simd_type const& v1,
+					 simd_type const& v2)
+  {
+    simd_type t = _mm256_shuffle_ps(v1, v2, 0xDD);
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(t), 0xD8));
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type interleaved_lo_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    return _mm256_permute2f128_ps(_mm256_unpacklo_ps(real, imag),
+				  _mm256_unpackhi_ps(real, imag), 0x20);
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type interleaved_hi_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    return _mm256_permute2f128_ps(_mm256_unpacklo_ps(real, imag),
+				  _mm256_unpackhi_ps(real, imag), 0x31);
+  }
+
+  static void enter() {}
+  static void exit()  {}
+};
+
+
+
+template <>
+struct Avx_traits<double>
+{
+  typedef double	value_type;
+  typedef __m256d	simd_type;
+
+  static int const  vec_size   = 4;
+  static bool const is_accel   = true;
+  static bool const has_perm   = false;
+  static bool const has_div    = true;
+  static int  const alignment  = 32;
+  static unsigned int  const scalar_pos = 0;
+
+  static intptr_t alignment_of(value_type const* addr)
+  { return (intptr_t)addr & (alignment - 1); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type zero()
+  { return _mm256_setzero_pd(); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load(value_type const* addr)
+  { return _mm256_load_pd(addr); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load_unaligned(value_type const* addr)
+  { return _mm256_loadu_pd(addr); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load_scalar(value_type value)
+  { return _mm256_setr_pd(value, 0, 0, 0); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type load_scalar_all(value_type value)
+  { return _mm256_set1_pd(value); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static void store(value_type* addr, simd_type const& vec)
+  { _mm256_store_pd(addr, vec); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static void store_stream(value_type* addr, simd_type const& vec)
+  { _mm256_store_pd(addr, vec); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static value_type extract(simd_type const& v, int pos)
+  {
+    union
+    {
+      simd_type  vec;
+      value_type val[vec_size];
+    } u;
+    u.vec             = v;
+    return u.val[pos];
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type add(simd_type const& v1, simd_type const& v2)
+  { return _mm256_add_pd(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type sub(simd_type const& v1, simd_type const& v2)
+  { return _mm256_sub_pd(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type mul(simd_type const& v1, simd_type const& v2)
+  { return _mm256_mul_pd(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type div(simd_type const& v1, simd_type const& v2)
+  { return _mm256_div_pd(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type fma(simd_type const& v1, simd_type const& v2,
+		       simd_type const& v3)
+  { return _mm256_fmadd_pd(v1, v2, v3); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type mag(simd_type const& v1)
+  {
+    __m256i mask = _mm256_srli_epi64(_mm256_set1_epi32(-1), 1);
+    return _mm256_and_pd(_mm256_castsi256_pd(mask), v1);
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type min(simd_type const& v1, simd_type const& v2)
+  { return _mm256_min_pd(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type max(simd_type const& v1, simd_type const& v2)
+  { return _mm256_max_pd(v1, v2); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type gt(simd_type const& v1, simd_type const& v2)
+  { return _mm256_cmp_pd(v1, v2, _CMP_GT_OQ); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type lt(simd_type const& v1, simd_type const& v2)
+  { return _mm256_cmp_pd(v1, v2, _CMP_LT_OQ); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type ge(simd_type const& v1, simd_type const& v2)
+  { return _mm256_cmp_pd(v1, v2, _CMP_GE_OQ); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type le(simd_type const& v1, simd_type const& v2)
+  { return _mm256_cmp_pd(v1, v2, _CMP_LE_OQ); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static int sign_mask(simd_type const& v1)
+  { return _mm256_movemask_pd(v1); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type sqrt(simd_type const& v1)
+  { return _mm256_sqrt_pd(v1); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type select(simd_type const& mask, simd_type const& v1,
+			  simd_type const& v2)
+  { return _mm256_or_pd(_mm256_and_pd(mask, v1), _mm256_andnot_pd(mask, v2)); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type pow2(simd_type const& n)
+  {
+    __m128i e = _mm_add_epi32(_mm256_cvtpd_epi32(n), _mm_set1_epi32(1023));
+    return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_cvtepi32_epi64(e), 52));
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type getexp(simd_type const& v1)
+  {
+    __m256i e = _mm256_srli_epi64(_mm256_castpd_si256(v1), 52);
+    e = _mm256_and_si256(e, _mm256_set1_epi64x(0x7ff));
+    e = _mm256_permutevar8x32_epi32(e, _mm256_setr_epi32(0, 2, 4, 6,
+							 0, 2, 4, 6));
+    return _mm256_cvtepi32_pd(_mm_sub_epi32(_mm256_castsi256_si128(e),
+					    _mm_set1_epi32(1023)));
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type getmant(simd_type const& v1)
+  {
+    __m256i m = _mm256_and_si256(_mm256_castpd_si256(v1),
+				 _mm256_set1_epi64x(0x000fffffffffffffLL));
+    return _mm256_castsi256_pd(
+      _mm256_or_si256(m, _mm256_set1_epi64x(0x3ff0000000000000LL)));
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type extend(simd_type const& v)
+  { return _mm256_broadcastsd_pd(_mm256_castpd256_pd128(v)); }
+
+  // [r0 r2 | r1 r3] -> [r0 r1 r2 r3]
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type real_from_interleaved(simd_type const& v1,
+					 simd_type const& v2)
+  { return _mm256_permute4x64_pd(_mm256_shuffle_pd(v1, v2, 0x0), 0xD8); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type imag_from_interleaved(simd_type const& v1,
+					 simd_type const& v2)
+  { return _mm256_permute4x64_pd(_mm256_shuffle_pd(v1, v2, 0xF), 0xD8); }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type interleaved_lo_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    return _mm256_permute2f128_pd(_mm256_unpacklo_pd(real, imag),
+				  _mm256_unpackhi_pd(real, imag), 0x20);
+  }
+
+  VSIP_IMPL_AVX2_FUNC
+  static simd_type interleaved_hi_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    return _mm256_permute2f128_pd(_mm256_unpacklo_pd(real, imag),
+				  _mm256_unpackhi_pd(real, imag), 0x31);
+  }
+
+  static void enter() {}
+  static void exit()  {}
+};
+
+
+
+/***********************************************************************
+  AVX-512 (512-bit)
+***********************************************************************/
+
+// Only AVX-512F instructions are used.  Comparisons produce a mask
+// register, which is expanded to a vector of all-ones/all-zeros
+// elements to match the Simd_traits interface.
+
+template <>
+struct Avx512_traits<int>
+{
+  typedef int		value_type;
+  typedef __m512i	simd_type;
+
+  static int const  vec_size   = 16;
+  static bool const is_accel   = true;
+  static bool const has_perm   = false;
+  static bool const has_div    = false;
+  static int  const alignment  = 64;
+  static unsigned int  const scalar_pos = 0;
+
+  static intptr_t alignment_of(value_type const* addr)
+  { return (intptr_t)addr & (alignment - 1); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type zero()
+  { return _mm512_setzero_si512(); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load(value_type const* addr)
+  { return _mm512_load_si512((void const*)addr); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load_unaligned(value_type const* addr)
+  { return _mm512_loadu_si512((void const*)addr); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load_scalar(value_type value)
+  { return _mm512_maskz_set1_epi32(1, value); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load_scalar_all(value_type value)
+  { return _mm512_set1_epi32(value); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static void store(value_type* addr, simd_type const& vec)
+  { _mm512_store_si512((void*)addr, vec); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static void store_stream(value_type* addr, simd_type const& vec)
+  { _mm512_store_si512((void*)addr, vec); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type add(simd_type const& v1, simd_type const& v2)
+  { return _mm512_add_epi32(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type sub(simd_type const& v1, simd_type const& v2)
+  { return _mm512_sub_epi32(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type band(simd_type const& v1, simd_type const& v2)
+  { return _mm512_and_si512(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type bor(simd_type const& v1, simd_type const& v2)
+  { return _mm512_or_si512(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type bxor(simd_type const& v1, simd_type const& v2)
+  { return _mm512_xor_si512(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type bnot(simd_type const& v1)
+  { return bxor(v1, load_scalar_all(0xFFFFFFFF)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type interleaved_lo_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    simd_type idx = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19,
+				      4, 20, 5, 21, 6, 22, 7, 23);
+    return _mm512_permutex2var_epi32(real, idx, imag);
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type interleaved_hi_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    simd_type idx = _mm512_setr_epi32( 8, 24,  9, 25, 10, 26, 11, 27,
+				      12, 28, 13, 29, 14, 30, 15, 31);
+    return _mm512_permutex2var_epi32(real, idx, imag);
+  }
+
+  // No pack (requires AVX-512BW).
+
+  static void enter() {}
+  static void exit()  {}
+};
+
+
+
+template <>
+struct Avx512_traits<float>
+{
+  typedef float		value_type;
+  typedef __m512	simd_type;
+
+  static int const  vec_size   = 16;
+  static bool const is_accel   = true;
+  static bool const has_perm   = false;
+  static bool const has_div    = true;
+  static int  const alignment  = 64;
+  static unsigned int  const scalar_pos = 0;
+
+  static intptr_t alignment_of(value_type const* addr)
+  { return (intptr_t)addr & (alignment - 1); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type zero()
+  { return _mm512_setzero_ps(); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load(value_type const* addr)
+  { return _mm512_load_ps(addr); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load_unaligned(value_type const* addr)
+  { return _mm512_loadu_ps(addr); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load_scalar(value_type value)
+  { return _mm512_maskz_mov_ps(1, _mm512_set1_ps(value)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load_scalar_all(value_type value)
+  { return _mm512_set1_ps(value); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static void store(value_type* addr, simd_type const& vec)
+  { _mm512_store_ps(addr, vec); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static void store_stream(value_type* addr, simd_type const& vec)
+  { _mm512_store_ps(addr, vec); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type add(simd_type const& v1, simd_type const& v2)
+  { return _mm512_add_ps(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type sub(simd_type const& v1, simd_type const& v2)
+  { return _mm512_sub_ps(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type mul(simd_type const& v1, simd_type const& v2)
+  { return _mm512_mul_ps(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type div(simd_type const& v1, simd_type const& v2)
+  { return _mm512_div_ps(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type fma(simd_type const& v1, simd_type const& v2,
+		       simd_type const& v3)
+  { return _mm512_fmadd_ps(v1, v2, v3); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type mag(simd_type const& v1)
+  {
+    __m512i mask = _mm512_srli_epi32(_mm512_set1_epi32(-1), 1);
+    return _mm512_castsi512_ps(_mm512_and_si512(mask,
+						_mm512_castps_si512(v1)));
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type min(simd_type const& v1, simd_type const& v2)
+  { return _mm512_min_ps(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type max(simd_type const& v1, simd_type const& v2)
+  { return _mm512_max_ps(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type from_mask(__mmask16 m)
+  { return _mm512_castsi512_ps(_mm512_maskz_set1_epi32(m, -1)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type gt(simd_type const& v1, simd_type const& v2)
+  { return from_mask(_mm512_cmp_ps_mask(v1, v2, _CMP_GT_OQ)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type lt(simd_type const& v1, simd_type const& v2)
+  { return from_mask(_mm512_cmp_ps_mask(v1, v2, _CMP_LT_OQ)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type ge(simd_type const& v1, simd_type const& v2)
+  { return from_mask(_mm512_cmp_ps_mask(v1, v2, _CMP_GE_OQ)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type le(simd_type const& v1, simd_type const& v2)
+  { return from_mask(_mm512_cmp_ps_mask(v1, v2, _CMP_LE_OQ)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static int sign_mask(simd_type const& v1)
+  {
+    return _mm512_cmplt_epi32_mask(_mm512_castps_si512(v1),
+				   _mm512_setzero_si512());
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type sqrt(simd_type const& v1)
+  { return _mm512_sqrt_ps(v1); }
+
+  // Bitwise (mask & v1) | (~mask & v2).
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type select(simd_type const& mask, simd_type const& v1,
+			  simd_type const& v2)
+  {
+    return _mm512_castsi512_ps(
+      _mm512_ternarylogic_epi32(_mm512_castps_si512(mask),
+				_mm512_castps_si512(v1),
+				_mm512_castps_si512(v2), 0xCA));
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type pow2(simd_type const& n)
+  { return _mm512_scalef_ps(_mm512_set1_ps(1.f), n); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type getexp(simd_type const& v1)
+  { return _mm512_getexp_ps(v1); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type getmant(simd_type const& v1)
+  { return _mm512_getmant_ps(v1, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type extend(simd_type const& v)
+  { return _mm512_broadcastss_ps(_mm512_castps512_ps128(v)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type real_from_interleaved(simd_type const& v1,
+					 simd_type const& v2)
+  {
+    __m512i idx = _mm512_setr_epi32( 0,  2,  4,  6,  8, 10, 12, 14,
+				    16, 18, 20, 22, 24, 26, 28, 30);
+    return _mm512_permutex2var_ps(v1, idx, v2);
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type imag_from_interleaved(simd_type const& v1,
+					 simd_type const& v2)
+  {
+    __m512i idx = _mm512_setr_epi32( 1,  3,  5,  7,  9, 11, 13, 15,
+				    17, 19, 21, 23, 25, 27, 29, 31);
+    return _mm512_permutex2var_ps(v1, idx, v2);
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type interleaved_lo_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    __m512i idx = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19,
+				    4, 20, 5, 21, 6, 22, 7, 23);
+    return _mm512_permutex2var_ps(real, idx, imag);
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type interleaved_hi_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    __m512i idx = _mm512_setr_epi32( 8, 24,  9, 25, 10, 26, 11, 27,
+				    12, 28, 13, 29, 14, 30, 15, 31);
+    return _mm512_permutex2var_ps(real, idx, imag);
+  }
+
+  static void enter() {}
+  static void exit()  {}
+};
+
+
+
+template <>
+struct Avx512_traits<double>
+{
+  typedef double	value_type;
+  typedef __m512d	simd_type;
+
+  static int const  vec_size   = 8;
+  static bool const is_accel   = true;
+  static bool const has_perm   = false;
+  static bool const has_div    = true;
+  static int  const alignment  = 64;
+  static unsigned int  const scalar_pos = 0;
+
+  static intptr_t alignment_of(value_type const* addr)
+  { return (intptr_t)addr & (alignment - 1); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type zero()
+  { return _mm512_setzero_pd(); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load(value_type const* addr)
+  { return _mm512_load_pd(addr); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load_unaligned(value_type const* addr)
+  { return _mm512_loadu_pd(addr); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load_scalar(value_type value)
+  { return _mm512_maskz_mov_pd(1, _mm512_set1_pd(value)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type load_scalar_all(value_type value)
+  { return _mm512_set1_pd(value); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static void store(value_type* addr, simd_type const& vec)
+  { _mm512_store_pd(addr, vec); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static void store_stream(value_type* addr, simd_type const& vec)
+  { _mm512_store_pd(addr, vec); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static value_type extract(simd_type const& v, int pos)
+  {
+    union
+    {
+      simd_type  vec;
+      value_type val[vec_size];
+    } u;
+    u.vec             = v;
+    return u.val[pos];
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type add(simd_type const& v1, simd_type const& v2)
+  { return _mm512_add_pd(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type sub(simd_type const& v1, simd_type const& v2)
+  { return _mm512_sub_pd(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type mul(simd_type const& v1, simd_type const& v2)
+  { return _mm512_mul_pd(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type div(simd_type const& v1, simd_type const& v2)
+  { return _mm512_div_pd(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type fma(simd_type const& v1, simd_type const& v2,
+		       simd_type const& v3)
+  { return _mm512_fmadd_pd(v1, v2, v3); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type mag(simd_type const& v1)
+  {
+    __m512i mask = _mm512_srli_epi64(_mm512_set1_epi32(-1), 1);
+    return _mm512_castsi512_pd(_mm512_and_si512(mask,
+						_mm512_castpd_si512(v1)));
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type min(simd_type const& v1, simd_type const& v2)
+  { return _mm512_min_pd(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type max(simd_type const& v1, simd_type const& v2)
+  { return _mm512_max_pd(v1, v2); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type from_mask(__mmask8 m)
+  { return _mm512_castsi512_pd(_mm512_maskz_set1_epi64(m, -1)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type gt(simd_type const& v1, simd_type const& v2)
+  { return from_mask(_mm512_cmp_pd_mask(v1, v2, _CMP_GT_OQ)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type lt(simd_type const& v1, simd_type const& v2)
+  { return from_mask(_mm512_cmp_pd_mask(v1, v2, _CMP_LT_OQ)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type ge(simd_type const& v1, simd_type const& v2)
+  { return from_mask(_mm512_cmp_pd_mask(v1, v2, _CMP_GE_OQ)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type le(simd_type const& v1, simd_type const& v2)
+  { return from_mask(_mm512_cmp_pd_mask(v1, v2, _CMP_LE_OQ)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static int sign_mask(simd_type const& v1)
+  {
+    return _mm512_cmplt_epi64_mask(_mm512_castpd_si512(v1),
+				   _mm512_setzero_si512());
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type sqrt(simd_type const& v1)
+  { return _mm512_sqrt_pd(v1); }
+
+  // Bitwise (mask & v1) | (~mask & v2).
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type select(simd_type const& mask, simd_type const& v1,
+			  simd_type const& v2)
+  {
+    return _mm512_castsi512_pd(
+      _mm512_ternarylogic_epi64(_mm512_castpd_si512(mask),
+				_mm512_castpd_si512(v1),
+				_mm512_castpd_si512(v2), 0xCA));
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type pow2(simd_type const& n)
+  { return _mm512_scalef_pd(_mm512_set1_pd(1.), n); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type getexp(simd_type const& v1)
+  { return _mm512_getexp_pd(v1); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type getmant(simd_type const& v1)
+  { return _mm512_getmant_pd(v1, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type extend(simd_type const& v)
+  { return _mm512_broadcastsd_pd(_mm512_castpd512_pd128(v)); }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type real_from_interleaved(simd_type const& v1,
+					 simd_type const& v2)
+  {
+    __m512i idx = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+    return _mm512_permutex2var_pd(v1, idx, v2);
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type imag_from_interleaved(simd_type const& v1,
+					 simd_type const& v2)
+  {
+    __m512i idx = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+    return _mm512_permutex2var_pd(v1, idx, v2);
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type interleaved_lo_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    __m512i idx = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+    return _mm512_permutex2var_pd(real, idx, imag);
+  }
+
+  VSIP_IMPL_AVX512_FUNC
+  static simd_type interleaved_hi_from_split(simd_type const& real,
+					     simd_type const& imag)
+  {
+    __m512i idx = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+    return _mm512_permutex2var_pd(real, idx, imag);
+  }
+
+  static void enter() {}
+  static void exit()  {}
+};
+
+} // namespace vsip::impl::simd
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_IMPL_SIMD_RUNTIME_ISA
+
+#endif // VSIP_OPT_SIMD_SIMD_AVX_HPP
@@ -85,6 +85,13 @@ typedef long intptr_t;
 //  - interleaved_hi_from_split -
 //  - pack                      - pack 2 SIMD vectors into 1, reducing range
 //
+// Math Operations (x86 float and double, see VSIP_IMPL_SIMD_HAVE_MATH)
+//  - sqrt            - square root
+//  - select          - bitwise (mask & v1) | (~mask & v2)
+//  - pow2            - 2^n for integral-valued n in the exponent range
+//  - getexp          - exponent of v as a floating-point value
+//  - getmant         - mantissa of v, in [1, 2)
+//
 // Architecture/Compiler Notes
 //  - GCC support for Intel SSE is good (3.4, 4.0, 4.1 all work)
 //  - GCC 3.4 is broken for Altivec
@@ -0,0 +1,518 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/simd/simd_math.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: SIMD transcendental functions.
+
+    Simd_math<T, SimdT> evaluates elementary functions on SIMD vectors
+    of float or double, using the traits SimdT (Simd_traits<T> by
+    default).  The kernels are the Cephes polynomial and rational
+    approximations, with Cody-Waite argument reduction.
+
+    Maximum error, in units in the last place of the result, measured
+    against a double (for float) or long double (for double) reference
+    with the SSE, AVX2 and AVX-512 traits:
+
+      function        float   double
+      exp             1       2
+      log             1       1
+      log10           2       2
+      sin, cos        3       2
+      atan2           4       2
+      sqrt            0.5     0.5
+
+    Special values (NaN, infinities, zero, overflow and underflow)
+    give the C99 results, except that atan2 of two infinities is NaN.
+
+    sin and cos use the vector kernel for |x| <= 8192 (float) and
+    |x| <= 2^24 (double).  Vectors with a larger (or infinite or NaN)
+    element are evaluated element-wise with the C library.
+
+    Complex functions are built from these (exp, mag, arg, euler);
+    their error is bounded by the sum of the errors of the parts.
+*/
+
+#ifndef VSIP_OPT_SIMD_SIMD_MATH_HPP
+#define VSIP_OPT_SIMD_SIMD_MATH_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cmath>
+#include <limits>
+
+#include <vsip/opt/simd/simd.hpp>
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace simd
+{
+
+/// Elementary functions on SIMD vectors.
+///
+/// Specializations define is_supported and, if true, the functions
+/// exp, log, log10, sin, cos, sincos, sqrt, and atan2.  The
+/// traits SimdT must provide the math operations (sqrt, select, pow2,
+/// getexp, getmant), which is indicated by VSIP_IMPL_SIMD_HAVE_MATH.
+template <typename T,
+	  typename SimdT = Simd_traits<T> >
+struct Simd_math
+{
+  static bool const is_supported = false;
+};
+
+
+
+// 1.5 * 2^(digits-1): adding and subtracting it rounds to an integer.
+inline float  round_magic(float)  { return 12582912.f; }
+inline double round_magic(double) { return 6755399441055744.0; }
+
+
+
+/// Operations common to the float and double kernels.
+template <typename T,
+	  typename SimdT>
+struct Simd_math_base
+{
+  typedef SimdT                     simd;
+  typedef typename simd::simd_type  simd_type;
+
+  static simd_type cst(T value)
+  { return simd::load_scalar_all(value); }
+
+  /// Round to nearest integer; valid for |x| < 2^(digits-2).
+  static simd_type round(simd_type const& x)
+  {
+    simd_type magic = cst(round_magic(T()));
+    return simd::sub(simd::add(x, magic), magic);
+  }
+
+  static simd_type floor(simd_type const& x)
+  {
+    simd_type r = round(x);
+    return simd::sub(r, simd::select(simd::gt(r, x), cst(T(1)), simd::zero()));
+  }
+
+  /// Result has the magnitude of x and the sign of y.
+  static simd_type copysign(simd_type const& x, simd_type const& y)
+  { return simd::select(cst(-T(0)), y, x); }
+
+  static simd_type neg(simd_type const& x)
+  { return simd::sub(simd::zero(), x); }
+
+  /// x * 2^n for integral-valued n, with |n| up to twice the exponent
+  /// range (the scaling is split in two to reach denormal results).
+  static simd_type ldexp(simd_type const& x, simd_type const& n)
+  {
+    simd_type h = round(simd::mul(n, cst(T(0.5))));
+    return simd::mul(simd::mul(x, simd::pow2(h)), simd::pow2(simd::sub(n, h)));
+  }
+
+  /// Evaluate FCN element-wise on x with the C library.
+  static simd_type scalar(simd_type const& x, T (*fcn)(T))
+  {
+    union
+    {
+      simd_type vec;
+      T         val[simd::vec_size];
+    } u;
+    u.vec = x;
+    for (int i=0; i<simd::vec_size; ++i)
+      u.val[i] = fcn(u.val[i]);
+    return u.vec;
+  }
+
+  static T c_sin(T x) { return std::sin(x); }
+  static T c_cos(T x) { return std::cos(x); }
+
+  // atan2(y, x) given atan of min(|x|,|y|)/max(|x|,|y|).
+  static simd_type atan2_fixup(simd_type const& a,
+			       simd_type const& y, simd_type const& x,
+			       simd_type const& ay, simd_type const& ax,
+			       T pi, T pi_2)
+  {
+    simd_type r = simd::select(simd::gt(ay, ax), simd::sub(cst(pi_2), a), a);
+    simd_type xneg = simd::lt(copysign(cst(T(1)), x), simd::zero());
+    r = simd::select(xneg, simd::sub(cst(pi), r), r);
+    return copysign(r, y);
+  }
+
+  // Select the sine or cosine of the reduced argument for quadrant n.
+  static void quadrant(simd_type const& n,
+		       simd_type const& s, simd_type const& c,
+		       simd_type& sin_x, simd_type& cos_x)
+  {
+    // q = n mod 4
+    simd_type q    = simd::sub(n, simd::mul(cst(T(4)),
+					    floor(simd::mul(n, cst(T(0.25))))));
+    simd_type odd  = simd::sub(q, simd::mul(cst(T(2)),
+					    floor(simd::mul(q, cst(T(0.5))))));
+    simd_type swap = simd::gt(odd, cst(T(0.5)));
+
+    simd_type ss = simd::select(swap, c, s);
+    simd_type cc = simd::select(swap, s, c);
+
+    // sin is negated in quadrants 2 and 3, cos in quadrants 1 and 2.
+    simd_type neg_s = simd::gt(q, cst(T(1.5)));
+    simd_type neg_c = simd::select(simd::gt(q, cst(T(0.5))),
+				   simd::lt(q, cst(T(2.5))),
+				   simd::zero());
+
+    sin_x = simd::select(neg_s, neg(ss), ss);
+    cos_x = simd::select(neg_c, neg(cc), cc);
+  }
+};
+
+
+
+#if VSIP_IMPL_SIMD_HAVE_MATH
+
+template <typename SimdT>
+struct Simd_math<float, SimdT> : Simd_math_base<float, SimdT>
+{
+  typedef Simd_math_base<float, SimdT> base;
+  typedef SimdT                        simd;
+  typedef typename simd::simd_type     simd_type;
+
+  static bool const is_supported = true;
+
+  using base::cst;
+
+  static simd_type exp(simd_type const& x)
+  {
+    simd_type hi = cst(88.72283905206835f);
+    simd_type lo = cst(-103.97208f);
+    simd_type over  = simd::gt(x, hi);
+    simd_type under = simd::lt(x, lo);
+    simd_type xc = simd::select(over, hi, simd::select(under, lo, x));
+
+    // x = n ln2 + r, |r| <= ln2/2
+    simd_type n = base::round(simd::mul(xc, cst(1.44269504088896341f)));
+    simd_type r = simd::sub(xc, simd::mul(n, cst(0.693359375f)));
+    r = simd::sub(r, simd::mul(n, cst(-2.12194440e-4f)));
+
+    simd_type z = simd::mul(r, r);
+    simd_type p = cst(1.9875691500E-4f);
+    p = simd::fma(p, r, cst(1.3981999507E-3f));
+    p = simd::fma(p, r, cst(8.3334519073E-3f));
+    p = simd::fma(p, r, cst(4.1665795894E-2f));
+    p = simd::fma(p, r, cst(1.6666665459E-1f));
+    p = simd::fma(p, r, cst(5.0000001201E-1f));
+    p = simd::add(simd::fma(p, z, r), cst(1.f));
+
+    simd_type e = base::ldexp(p, n);
+    e = simd::select(over, cst(std::numeric_limits<float>::infinity()), e);
+    return simd::select(under, simd::zero(), e);
+  }
+
+  static simd_type log(simd_type const& x)
+  {
+    // Scale denormals into the normal range.
+    simd_type tiny = simd::lt(x, cst(std::numeric_limits<float>::min()));
+    simd_type xs   = simd::select(tiny, simd::mul(x, cst(33554432.f)), x);
+    simd_type e    = simd::sub(simd::getexp(xs),
+			       simd::select(tiny, cst(25.f), simd::zero()));
+    simd_type m    = simd::getmant(xs);
+
+    // m in [sqrt(1/2), sqrt(2))
+    simd_type big = simd::gt(m, cst(1.41421356237309504880f));
+    m = simd::select(big, simd::mul(m, cst(0.5f)), m);
+    e = simd::add(e, simd::select(big, cst(1.f), simd::zero()));
+    simd_type f = simd::sub(m, cst(1.f));
+
+    simd_type z = simd::mul(f, f);
+    simd_type y = cst(7.0376836292E-2f);
+    y = simd::fma(y, f, cst(-1.1514610310E-1f));
+    y = simd::fma(y, f, cst(1.1676998740E-1f));
+    y = simd::fma(y, f, cst(-1.2420140846E-1f));
+    y = simd::fma(y, f, cst(1.4249322787E-1f));
+    y = simd::fma(y, f, cst(-1.6668057665E-1f));
+    y = simd::fma(y, f, cst(2.0000714765E-1f));
+    y = simd::fma(y, f, cst(-2.4999993993E-1f));
+    y = simd::fma(y, f, cst(3.3333331174E-1f));
+    y = simd::mul(simd::mul(y, f), z);
+    y = simd::fma(e, cst(-2.12194440e-4f), y);
+    y = simd::fma(z, cst(-0.5f), y);
+    simd_type r = simd::fma(e, cst(0.693359375f), simd::add(f, y));
+
+    // log(NaN) = NaN, log(inf) = inf, log(0) = -inf, log(x<0) = NaN.
+    r = simd::add(r, simd::sub(x, x));
+    r = simd::select(simd::gt(x, cst(std::numeric_limits<float>::max())),
+		     x, r);
+    r = simd::select(simd::le(x, simd::zero()),
+		     cst(-std::numeric_limits<float>::infinity()), r);
+    return simd::select(simd::lt(x, simd::zero()),
+			cst(std::numeric_limits<float>::quiet_NaN()), r);
+  }
+
+  static simd_type log10(simd_type const& x)
+  { return simd::mul(log(x), cst(0.434294481903251827651f)); }
+
+  static void sincos(simd_type const& x, simd_type& s, simd_type& c)
+  {
+    if (simd::sign_mask(simd::le(simd::mag(x), cst(8192.f))) !=
+	(1 << simd::vec_size) - 1)
+    {
+      // Out of the reduction domain (or NaN): use the C library.
+      s = base::scalar(x, &base::c_sin);
+      c = base::scalar(x, &base::c_cos);
+      return;
+    }
+
+    // x = n pi/2 + r, |r| <= pi/4.  The first three parts of pi/2
+    // have at most 11 significant bits, so that n * part is exact.
+    simd_type n = base::round(simd::mul(x, cst(0.636619772367581343076f)));
+    simd_type r = simd::sub(x, simd::mul(n, cst(1.5703125f)));
+    r = simd::sub(r, simd::mul(n, cst(4.837512969970703125e-4f)));
+    r = simd::sub(r, simd::mul(n, cst(7.549533620476723e-8f)));
+    r = simd::sub(r, simd::mul(n, cst(2.5633440682570896e-12f)));
+
+    simd_type z  = simd::mul(r, r);
+    simd_type ps = cst(-1.9515295891E-4f);
+    ps = simd::fma(ps, z, cst(8.3321608736E-3f));
+    ps = simd::fma(ps, z, cst(-1.6666654611E-1f));
+    ps = simd::fma(simd::mul(ps, z), r, r);
+
+    simd_type pc = cst(2.443315711809948E-5f);
+    pc = simd::fma(pc, z, cst(-1.388731625493765E-3f));
+    pc = simd::fma(pc, z, cst(4.166664568298827E-2f));
+    pc = simd::mul(simd::mul(pc, z), z);
+    pc = simd::add(simd::fma(z, cst(-0.5f), pc), cst(1.f));
+
+    base::quadrant(n, ps, pc, s, c);
+  }
+
+  static simd_type sin(simd_type const& x)
+  { simd_type s, c; sincos(x, s, c); return s; }
+
+  static simd_type cos(simd_type const& x)
+  { simd_type s, c; sincos(x, s, c); return c; }
+
+  static simd_type sqrt(simd_type const& x)
+  { return simd::sqrt(x); }
+
+  static simd_type atan2(simd_type const& y, simd_type const& x)
+  {
+    simd_type ay = simd::mag(y);
+    simd_type ax = simd::mag(x);
+    simd_type mx = simd::max(ax, ay);
+    simd_type t  = simd::div(simd::min(ax, ay), mx);
+    t = simd::select(simd::le(mx, simd::zero()), simd::zero(), t);
+
+    // t in [0, 1]; reduce to |t| <= tan(pi/8).
+    simd_type big = simd::gt(t, cst(0.4142135623730950f));
+    simd_type y0  = simd::select(big, cst(0.785398163397448309616f),
+				 simd::zero());
+    t = simd::select(big, simd::div(simd::sub(t, cst(1.f)),
+				    simd::add(t, cst(1.f))), t);
+
+    simd_type z = simd::mul(t, t);
+    simd_type p = cst(8.05374449538e-2f);
+    p = simd::fma(p, z, cst(-1.38776856032E-1f));
+    p = simd::fma(p, z, cst(1.99777106478E-1f));
+    p = simd::fma(p, z, cst(-3.33329491539E-1f));
+    p = simd::add(simd::fma(simd::mul(p, z), t, t), y0);
+
+    return base::atan2_fixup(p, y, x, ay, ax,
+			     3.14159265358979323846f,
+			     1.57079632679489661923f);
+  }
+};
+
+
+
+template <typename SimdT>
+struct Simd_math<double, SimdT> : Simd_math_base<double, SimdT>
+{
+  typedef Simd_math_base<double, SimdT> base;
+  typedef SimdT                         simd;
+  typedef typename simd::simd_type      simd_type;
+
+  static bool const is_supported = true;
+
+  using base::cst;
+
+  static simd_type exp(simd_type const& x)
+  {
+    simd_type hi = cst(709.782712893383996843);
+    simd_type lo = cst(-745.13321910194110842);
+    simd_type over  = simd::gt(x, hi);
+    simd_type under = simd::lt(x, lo);
+    simd_type xc = simd::select(over, hi, simd::select(under, lo, x));
+
+    // x = n ln2 + r, |r| <= ln2/2
+    simd_type n = base::round(simd::mul(xc, cst(1.4426950408889634073599)));
+    simd_type r = simd::sub(xc, simd::mul(n, cst(6.93145751953125E-1)));
+    r = simd::sub(r, simd::mul(n, cst(1.42860682030941723212E-6)));
+
+    // exp(r) = 1 + 2 r P(r^2) / (Q(r^2) - r P(r^2))
+    simd_type z  = simd::mul(r, r);
+    simd_type px = cst(1.26177193074810590878E-4);
+    px = simd::fma(px, z, cst(3.02994407707441961300E-2));
+    px = simd::fma(px, z, cst(9.99999999999999999910E-1));
+    px = simd::mul(px, r);
+    simd_type qx = cst(3.00198505138664455042E-6);
+    qx = simd::fma(qx, z, cst(2.52448340349684104192E-3));
+    qx = simd::fma(qx, z, cst(2.27265548208155028766E-1));
+    qx = simd::fma(qx, z, cst(2.00000000000000000009E0));
+    simd_type p = simd::div(px, simd::sub(qx, px));
+    p = simd::fma(p, cst(2.0), cst(1.0));
+
+    simd_type e = base::ldexp(p, n);
+    e = simd::select(over, cst(std::numeric_limits<double>::infinity()), e);
+    return simd::select(under, simd::zero(), e);
+  }
+
+  static simd_type log(simd_type const& x)
+  {
+    // Scale denormals into the normal range.
+    simd_type tiny = simd::lt(x, cst(std::numeric_limits<double>::min()));
+    simd_type xs   = simd::select(tiny, simd::mul(x, cst(18014398509481984.)),
+				  x);
+    simd_type e    = simd::sub(simd::getexp(xs),
+			       simd::select(tiny, cst(54.), simd::zero()));
+    simd_type m    = simd::getmant(xs);
+
+    // m in [sqrt(1/2), sqrt(2))
+    simd_type big = simd::gt(m, cst(1.41421356237309504880));
+    m = simd::select(big, simd::mul(m, cst(0.5)), m);
+    e = simd::add(e, simd::select(big, cst(1.), simd::zero()));
+    simd_type f = simd::sub(m, cst(1.));
+
+    // log(1+f) = f - f^2/2 + f^3 P(f)/Q(f)
+    simd_type z = simd::mul(f, f);
+    simd_type p = cst(1.01875663804580931796E-4);
+    p = simd::fma(p, f, cst(4.97494994976747001425E-1));
+    p = simd::fma(p, f, cst(4.70579119878881725854E0));
+    p = simd::fma(p, f, cst(1.44989225341610930846E1));
+    p = simd::fma(p, f, cst(1.79368678507819816313E1));
+    p = simd::fma(p, f, cst(7.70838733755885391666E0));
+    simd_type q = simd::add(f, cst(1.12873587189167450590E1));
+    q = simd::fma(q, f, cst(4.52279145837532221105E1));
+    q = simd::fma(q, f, cst(8.29875266912776603211E1));
+    q = simd::fma(q, f, cst(7.11544750618563894466E1));
+    q = simd::fma(q, f, cst(2.31251620126765340583E1));
+    simd_type y = simd::mul(simd::mul(f, z), simd::div(p, q));
+    y = simd::fma(e, cst(-2.121944400546905827679e-4), y);
+    y = simd::fma(z, cst(-0.5), y);
+    simd_type r = simd::fma(e, cst(0.693359375), simd::add(f, y));
+
+    // log(NaN) = NaN, log(inf) = inf, log(0) = -inf, log(x<0) = NaN.
+    r = simd::add(r, simd::sub(x, x));
+    r = simd::select(simd::gt(x, cst(std::numeric_limits<double>::max())),
+		     x, r);
+    r = simd::select(simd::le(x, simd::zero()),
+		     cst(-std::numeric_limits<double>::infinity()), r);
+    return simd::select(simd::lt(x, simd::zero()),
+			cst(std::numeric_limits<double>::quiet_NaN()), r);
+  }
+
+  static simd_type log10(simd_type const& x)
+  { return simd::mul(log(x), cst(0.434294481903251827651)); }
+
+  static void sincos(simd_type const& x, simd_type& s, simd_type& c)
+  {
+    if (simd::sign_mask(simd::le(simd::mag(x), cst(16777216.))) !=
+	(1 << simd::vec_size) - 1)
+    {
+      // Out of the reduction domain (or NaN): use the C library.
+      s = base::scalar(x, &base::c_sin);
+      c = base::scalar(x, &base::c_cos);
+      return;
+    }
+
+    // x = n pi/2 + r, |r| <= pi/4
+    simd_type n = base::round(simd::mul(x, cst(0.63661977236758134307553)));
+    simd_type r = simd::sub(x, simd::mul(n, cst(1.57079625129699707031)));
+    r = simd::sub(r, simd::mul(n, cst(7.54978941586159635335E-8)));
+    r = simd::sub(r, simd::mul(n, cst(5.39030285815811905290E-15)));
+
+    simd_type z  = simd::mul(r, r);
+    simd_type ps = cst(1.58962301576546568060E-10);
+    ps = simd::fma(ps, z, cst(-2.50507477628578072866E-8));
+    ps = simd::fma(ps, z, cst(2.75573136213857245213E-6));
+    ps = simd::fma(ps, z, cst(-1.98412698295895385996E-4));
+    ps = simd::fma(ps, z, cst(8.33333333332211858878E-3));
+    ps = simd::fma(ps, z, cst(-1.66666666666666307295E-1));
+    ps = simd::fma(simd::mul(ps, z), r, r);
+
+    simd_type pc = cst(-1.13585365213876817300E-11);
+    pc = simd::fma(pc, z, cst(2.08757008419747316778E-9));
+    pc = simd::fma(pc, z, cst(-2.75573141792967388112E-7));
+    pc = simd::fma(pc, z, cst(2.48015872888517045348E-5));
+    pc = simd::fma(pc, z, cst(-1.38888888888730564116E-3));
+    pc = simd::fma(pc, z, cst(4.16666666666665929218E-2));
+    pc = simd::mul(simd::mul(pc, z), z);
+    pc = simd::add(simd::fma(z, cst(-0.5), pc), cst(1.));
+
+    base::quadrant(n, ps, pc, s, c);
+  }
+
+  static simd_type sin(simd_type const& x)
+  { simd_type s, c; sincos(x, s, c); return s; }
+
+  static simd_type cos(simd_type const& x)
+  { simd_type s, c; sincos(x, s, c); return c; }
+
+  static simd_type sqrt(simd_type const& x)
+  { return simd::sqrt(x); }
+
+  static simd_type atan2(simd_type const& y, simd_type const& x)
+  {
+    simd_type ay = simd::mag(y);
+    simd_type ax = simd::mag(x);
+    simd_type mx = simd::max(ax, ay);
+    simd_type t  = simd::div(simd::min(ax, ay), mx);
+    t = simd::select(simd::le(mx, simd::zero()), simd::zero(), t);
+
+    // t in [0, 1]; reduce to |t| <= 0.66.
+    simd_type big = simd::gt(t, cst(0.66));
+    simd_type y0  = simd::select(big, cst(0.785398163397448309616),
+				 simd::zero());
+    simd_type mb  = simd::select(big, cst(3.061616997868383017934e-17),
+				 simd::zero());
+    t = simd::select(big, simd::div(simd::sub(t, cst(1.)),
+				    simd::add(t, cst(1.))), t);
+
+    // atan(t) = t + t^3 P(t^2)/Q(t^2)
+    simd_type z = simd::mul(t, t);
+    simd_type p = cst(-8.750608600031904122785E-1);
+    p = simd::fma(p, z, cst(-1.615753718733365076637E1));
+    p = simd::fma(p, z, cst(-7.500855792314704667340E1));
+    p = simd::fma(p, z, cst(-1.228866684490136173410E2));
+    p = simd::fma(p, z, cst(-6.485021904942025371773E1));
+    simd_type q = simd::add(z, cst(2.485846490142306297962E1));
+    q = simd::fma(q, z, cst(1.650270098316988542046E2));
+    q = simd::fma(q, z, cst(4.328810604912902668951E2));
+    q = simd::fma(q, z, cst(4.853903996359136964868E2));
+    q = simd::fma(q, z, cst(1.945506571482613964425E2));
+    p = simd::mul(simd::mul(z, simd::div(p, q)), t);
+    p = simd::add(simd::add(simd::add(p, mb), t), y0);
+
+    return base::atan2_fixup(p, y, x, ay, ax,
+			     3.14159265358979323846,
+			     1.57079632679489661923);
+  }
+};
+
+#endif // VSIP_IMPL_SIMD_HAVE_MATH
+
+} // namespace vsip::impl::simd
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_SIMD_SIMD_MATH_HPP
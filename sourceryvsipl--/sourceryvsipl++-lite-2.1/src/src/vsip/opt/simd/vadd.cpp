@@ -16,6 +16,7 @@
 ***********************************************************************/
 
 #include <vsip/opt/simd/vadd.hpp>
+#include <vsip/opt/simd/wide.hpp>
 
 
 
@@ -40,6 +41,9 @@ vadd(
   T*  res,
   int size)
 {
+  if (wide_vadd(op1, op2, res, size))
+    return;
+
   static bool const Is_vectorized = Is_algorithm_supported<T, false, Alg_vadd>
                                       ::value;
   Simd_vadd<T, Is_vectorized>::exec(op1, op2, res, size);
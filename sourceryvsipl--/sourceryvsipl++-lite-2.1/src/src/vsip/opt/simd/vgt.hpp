@@ -44,12 +44,23 @@ namespace simd
 
 // Define value_types for which vgt is optimized.
 //  - float
+//
+// The kernel packs float comparison results through the short and
+// signed char traits, so it requires them to have the same width
+// (not the case for the AVX2 and AVX-512 float traits).
+
+#if !defined(VSIP_IMPL_SIMD_AVX2) && !defined(VSIP_IMPL_SIMD_AVX512)
+#  define VSIP_IMPL_SIMD_HAVE_VGT 1
+#else
+#  define VSIP_IMPL_SIMD_HAVE_VGT 0
+#endif
 
 template <typename T,
 	  bool     IsSplit>
 struct Is_algorithm_supported<T, IsSplit, Alg_vgt>
 {
   static bool const value =
+    VSIP_IMPL_SIMD_HAVE_VGT &&
     Simd_traits<T>::is_accel && Type_equal<T, float>::value;
 };
 
@@ -81,6 +92,7 @@ struct Simd_vgt<T, false>
 
 
 
+#if VSIP_IMPL_SIMD_HAVE_VGT
 // Vectorized implementation of vector element-wise gt.
 
 // Works under the following combinations:
@@ -178,6 +190,7 @@ struct Simd_vgt<float, true>
   }
   }
 };
+#endif // VSIP_IMPL_SIMD_HAVE_VGT
 
 
 
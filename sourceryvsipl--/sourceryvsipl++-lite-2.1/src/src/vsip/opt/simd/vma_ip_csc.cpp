@@ -12,6 +12,7 @@
 ***********************************************************************/
 
 #include <vsip/opt/simd/vma_ip_csc.hpp>
+#include <vsip/opt/simd/wide.hpp>
 
 
 
@@ -36,6 +37,9 @@ vma_ip_cSC(
   std::complex<T>*       R,
   int                    n)
 {
+  if (wide_vma_ip_cSC(a, B, R, n))
+    return;
+
   static bool const Is_vectorized =
     Is_algorithm_supported<std::complex<T>, false, Alg_vma_ip_cSC>::value;
   Simd_vma_ip_cSC<std::complex<T>, Is_vectorized>::exec(a, B, R, n);
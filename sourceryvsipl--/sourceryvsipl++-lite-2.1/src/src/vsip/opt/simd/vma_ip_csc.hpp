@@ -99,8 +99,17 @@ struct Simd_vma_ip_cSC<std::complex<T>, true>
 
     typedef typename simd::simd_type simd_type;
 
-    // handle mis-aligned vectors
-    if (simd::alignment_of((T*)R) != simd::alignment_of(B))
+    // clean up initial unaligned values
+    while (n && simd::alignment_of((T*)R) != 0)
+    {
+      *R += a * *B;
+      R++; B++;
+      n--;
+    }
+
+    // handle mis-aligned vectors.  B advances at half the rate of R
+    // (in bytes), so it is only known to be aligned once R is.
+    if (simd::alignment_of(B) != 0)
     {
       // PROFILE
       while (n)
@@ -111,14 +120,6 @@ struct Simd_vma_ip_cSC<std::complex<T>, true>
       }
       return;
     }
-
-    // clean up initial unaligned values
-    while (n && simd::alignment_of((T*)R) != 0)
-    {
-      *R += a * *B;
-      R++; B++;
-      n--;
-    }
   
     if (n == 0) return;
 
@@ -198,7 +199,7 @@ struct Simd_vma_ip_cSC<std::complex<T>, true>
 
       simd_type reg_B0 = simd::interleaved_lo_from_split(reg_B01, reg_B01);
       simd_type reg_B1 = simd::interleaved_hi_from_split(reg_B01, reg_B01);
-      simd_type reg_B2 = simd::interleaved_hi_from_split(reg_B23, reg_B23);
+      simd_type reg_B2 = simd::interleaved_lo_from_split(reg_B23, reg_B23);
       simd_type reg_B3 = simd::interleaved_hi_from_split(reg_B23, reg_B23);
 
       simd_type reg_AB0 = simd::mul(reg_A, reg_B0);
@@ -16,6 +16,7 @@
 ***********************************************************************/
 
 #include <vsip/opt/simd/vmul.hpp>
+#include <vsip/opt/simd/wide.hpp>
 
 
 
@@ -40,6 +41,9 @@ vmul(
   T*  res,
   int size)
 {
+  if (wide_vmul(op1, op2, res, size))
+    return;
+
   static bool const Is_vectorized = Is_algorithm_supported<T, false, Alg_vmul>
                                       ::value;
   Simd_vmul<T, Is_vectorized>::exec(op1, op2, res, size);
@@ -0,0 +1,583 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/simd/wide.cpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Runtime-dispatched AVX2/AVX-512 kernels.
+
+    The kernels in wide_impl.cpp are compiled once per instruction set,
+    each in its own namespace and target pragma region, so that no code
+    outside of those regions (in particular no inline function shared
+    with other translation units) uses the wider instructions.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+
+#include <vsip/core/config.hpp>
+#include <vsip/opt/simd/wide.hpp>
+#include <vsip/opt/simd/simd_avx.hpp>
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+#if VSIP_IMPL_SIMD_RUNTIME_ISA
+
+namespace vsip
+{
+namespace impl
+{
+namespace simd
+{
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+namespace avx2
+{
+#define VSIP_IMPL_WIDE_TRAITS Avx_traits
+#include "wide_impl.cpp"
+#undef VSIP_IMPL_WIDE_TRAITS
+
+
+
+// Bilinear and bicubic interpolation for the perspective warp.  These
+// kernels use AVX2 gathers and are also used on AVX-512 processors.
+// Groups of 8 pixels that need neighbours outside of the image are
+// interpolated one pixel at a time.
+
+// Interpolate one pixel (the edges of the image, and the tail).
+template <typename T>
+inline T
+pwarp_linear_pixel(T const* in, int stride, int rows, int cols,
+		   float u, float v)
+{
+  if (!(u >= 0 && u <= float(cols - 1) && v >= 0 && v <= float(rows - 1)))
+    return T();
+
+  int   u0     = static_cast<int>(u);
+  int   v0     = static_cast<int>(v);
+  float u_beta = u - u0;
+  float v_beta = v - v0;
+
+  int off_01 = u0 + 1 < cols ? 1      : 0;
+  int off_10 = v0 + 1 < rows ? stride : 0;
+
+  T const* p = in + v0 * stride + u0;
+  float z0 = (1 - u_beta) * p[0]      + u_beta * p[off_01];
+  float z1 = (1 - u_beta) * p[off_10] + u_beta * p[off_10 + off_01];
+  return static_cast<T>((1 - v_beta) * z0 + v_beta * z1);
+}
+
+template <typename T>
+struct Pwarp_gather;
+
+// Float images: the four neighbours are gathered separately.
+template <>
+struct Pwarp_gather<float>
+{
+  // Lanes whose neighbours are all inside of the image.
+  static __m256 interior(__m256 u, __m256 v, int rows, int cols)
+  {
+    return _mm256_and_ps(
+      _mm256_cmp_ps(u, _mm256_set1_ps(float(cols - 1)), _CMP_LT_OQ),
+      _mm256_cmp_ps(v, _mm256_set1_ps(float(rows - 1)), _CMP_LT_OQ));
+  }
+
+  static void load(float const* in, __m256i idx, __m256i stride,
+		   __m256& z00, __m256& z01, __m256& z10, __m256& z11)
+  {
+    __m256i idx1 = _mm256_add_epi32(idx, stride);
+    z00 = _mm256_i32gather_ps(in,     idx,  4);
+    z01 = _mm256_i32gather_ps(in + 1, idx,  4);
+    z10 = _mm256_i32gather_ps(in,     idx1, 4);
+    z11 = _mm256_i32gather_ps(in + 1, idx1, 4);
+  }
+
+  static void store(float* R, __m256 z) { _mm256_storeu_ps(R, z); }
+
+  // W[0] * P[0] + ... + W[3] * P[3] for the pixels P at IDX - 1 ... IDX + 2
+  static __m256 row(float const* in, __m256i idx, __m256 const* w)
+  {
+    __m256 z = _mm256_mul_ps(w[0], _mm256_i32gather_ps(in,     idx, 4));
+    z = _mm256_add_ps(z, _mm256_mul_ps(w[1], _mm256_i32gather_ps(in + 1, idx, 4)));
+    z = _mm256_add_ps(z, _mm256_mul_ps(w[2], _mm256_i32gather_ps(in + 2, idx, 4)));
+    return _mm256_add_ps(z, _mm256_mul_ps(w[3], _mm256_i32gather_ps(in + 3, idx, 4)));
+  }
+
+  static float round(float z) { return z; }
+  static void store_rounded(float* R, __m256 z) { _mm256_storeu_ps(R, z); }
+};
+
+// Byte images: a 32-bit gather loads a pixel and its right neighbour,
+// and the two bytes that follow them.
+template <>
+struct Pwarp_gather<unsigned char>
+{
+  // Lanes whose neighbours are inside of the image, and whose gathers
+  // do not read past its last pixel.
+  static __m256 interior(__m256 u, __m256 v, int rows, int cols)
+  {
+    __m256 tail = _mm256_or_ps(
+      _mm256_cmp_ps(u, _mm256_set1_ps(float(cols - 3)), _CMP_LT_OQ),
+      _mm256_cmp_ps(v, _mm256_set1_ps(float(rows - 2)), _CMP_LT_OQ));
+    return _mm256_and_ps(Pwarp_gather<float>::interior(u, v, rows, cols),
+			 tail);
+  }
+
+  static void load(unsigned char const* in, __m256i idx, __m256i stride,
+		   __m256& z00, __m256& z01, __m256& z10, __m256& z11)
+  {
+    __m256i const lo = _mm256_set1_epi32(0xff);
+    __m256i a = _mm256_i32gather_epi32((int const*)in, idx, 1);
+    __m256i b = _mm256_i32gather_epi32((int const*)in,
+				       _mm256_add_epi32(idx, stride), 1);
+    z00 = _mm256_cvtepi32_ps(_mm256_and_si256(a, lo));
+    z01 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(a, 8), lo));
+    z10 = _mm256_cvtepi32_ps(_mm256_and_si256(b, lo));
+    z11 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(b, 8), lo));
+  }
+
+  static void store(unsigned char* R, __m256 z)
+  {
+    __m256i i = _mm256_cvttps_epi32(z);
+    __m128i w = _mm_packus_epi32(_mm256_castsi256_si128(i),
+				 _mm256_extracti128_si256(i, 1));
+    _mm_storel_epi64((__m128i*)R, _mm_packus_epi16(w, w));
+  }
+
+  // A 32-bit gather loads the four pixels of a row.
+  static __m256 row(unsigned char const* in, __m256i idx, __m256 const* w)
+  {
+    __m256i const lo = _mm256_set1_epi32(0xff);
+    __m256i a = _mm256_i32gather_epi32((int const*)in, idx, 1);
+    __m256 z = _mm256_mul_ps(w[0], _mm256_cvtepi32_ps(_mm256_and_si256(a, lo)));
+    z = _mm256_add_ps(z, _mm256_mul_ps(w[1], _mm256_cvtepi32_ps(
+	  _mm256_and_si256(_mm256_srli_epi32(a, 8), lo))));
+    z = _mm256_add_ps(z, _mm256_mul_ps(w[2], _mm256_cvtepi32_ps(
+	  _mm256_and_si256(_mm256_srli_epi32(a, 16), lo))));
+    return _mm256_add_ps(z, _mm256_mul_ps(w[3], _mm256_cvtepi32_ps(
+	  _mm256_srli_epi32(a, 24))));
+  }
+
+  // Round to the nearest pixel value, saturating.
+  static unsigned char round(float z)
+  {
+    if (z <= 0.f)   return 0;
+    if (z >= 255.f) return 255;
+    return static_cast<unsigned char>(z + 0.5f);
+  }
+
+  static void store_rounded(unsigned char* R, __m256 z)
+  {
+    z = _mm256_min_ps(_mm256_max_ps(z, _mm256_setzero_ps()),
+		      _mm256_set1_ps(255.f));
+    store(R, _mm256_add_ps(z, _mm256_set1_ps(0.5f)));
+  }
+};
+
+template <typename T>
+void
+pwarp_linear(T const* in, int stride, int rows, int cols,
+	     float const* U, float const* V, T* R, int n)
+{
+  typedef Pwarp_gather<T> gather;
+
+  __m256  zero     = _mm256_setzero_ps();
+  __m256  one      = _mm256_set1_ps(1.f);
+  __m256  u_clip   = _mm256_set1_ps(float(cols - 1));
+  __m256  v_clip   = _mm256_set1_ps(float(rows - 1));
+  __m256i stride_v = _mm256_set1_epi32(stride);
+
+  while (n >= 8)
+  {
+    __m256 u = _mm256_loadu_ps(U);
+    __m256 v = _mm256_loadu_ps(V);
+
+    __m256 valid = _mm256_and_ps(
+      _mm256_and_ps(_mm256_cmp_ps(u, zero,   _CMP_GE_OQ),
+		    _mm256_cmp_ps(u, u_clip, _CMP_LE_OQ)),
+      _mm256_and_ps(_mm256_cmp_ps(v, zero,   _CMP_GE_OQ),
+		    _mm256_cmp_ps(v, v_clip, _CMP_LE_OQ)));
+    __m256 edge = _mm256_andnot_ps(gather::interior(u, v, rows, cols), valid);
+
+    if (_mm256_movemask_ps(edge))
+    {
+      for (int i = 0; i < 8; ++i)
+	R[i] = pwarp_linear_pixel(in, stride, rows, cols, U[i], V[i]);
+    }
+    else
+    {
+      // Lanes outside of the image gather pixel 0 and produce 0.
+      u = _mm256_and_ps(u, valid);
+      v = _mm256_and_ps(v, valid);
+
+      __m256i u0  = _mm256_cvttps_epi32(u);
+      __m256i v0  = _mm256_cvttps_epi32(v);
+      __m256  ub  = _mm256_sub_ps(u, _mm256_cvtepi32_ps(u0));
+      __m256  vb  = _mm256_sub_ps(v, _mm256_cvtepi32_ps(v0));
+      __m256i idx = _mm256_add_epi32(_mm256_mullo_epi32(v0, stride_v), u0);
+
+      __m256 z00, z01, z10, z11;
+      gather::load(in, idx, stride_v, z00, z01, z10, z11);
+
+      __m256 ua = _mm256_sub_ps(one, ub);
+      __m256 z0 = _mm256_add_ps(_mm256_mul_ps(ua, z00), _mm256_mul_ps(ub, z01));
+      __m256 z1 = _mm256_add_ps(_mm256_mul_ps(ua, z10), _mm256_mul_ps(ub, z11));
+      __m256 z  = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(one, vb), z0),
+				_mm256_mul_ps(vb, z1));
+      gather::store(R, _mm256_and_ps(z, valid));
+    }
+
+    U += 8; V += 8; R += 8;
+    n -= 8;
+  }
+
+  while (n)
+  {
+    *R = pwarp_linear_pixel(in, stride, rows, cols, *U, *V);
+    U++; V++; R++;
+    n--;
+  }
+}
+
+// Weights of the bicubic (Keys, a = -1/2) kernel for the pixels at
+// offsets -1, 0, 1 and 2, T from the pixel at offset 0.
+inline void
+pwarp_cubic_weights(float t, float* w)
+{
+  float const h = 0.5f;
+  w[0] = ((-h * t + 1) * t - h) * t;
+  w[1] = (3 * h * t - 5 * h) * t * t + 1;
+  w[2] = ((-3 * h * t + 2) * t + h) * t;
+  w[3] = (h * t - h) * t * t;
+}
+
+inline void
+pwarp_cubic_weights(__m256 t, __m256* w)
+{
+  __m256 const h   = _mm256_set1_ps(0.5f);
+  __m256 const one = _mm256_set1_ps(1.f);
+  w[0] = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_add_ps(
+	   _mm256_mul_ps(_mm256_set1_ps(-0.5f), t), one), t), h), t);
+  w[1] = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(
+	   _mm256_mul_ps(_mm256_set1_ps(1.5f), t), _mm256_set1_ps(2.5f)),
+	   t), t), one);
+  w[2] = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(
+	   _mm256_mul_ps(_mm256_set1_ps(-1.5f), t), _mm256_set1_ps(2.f)),
+	   t), h), t);
+  w[3] = _mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(
+	   _mm256_mul_ps(h, t), h), t), t);
+}
+
+template <typename T>
+inline T
+pwarp_cubic_pixel(T const* in, int stride, int rows, int cols,
+		  float u, float v)
+{
+  if (!(u >= 0 && u <= float(cols - 1) && v >= 0 && v <= float(rows - 1)))
+    return T();
+
+  int u0 = static_cast<int>(u);
+  int v0 = static_cast<int>(v);
+
+  float wu[4], wv[4];
+  pwarp_cubic_weights(u - u0, wu);
+  pwarp_cubic_weights(v - v0, wv);
+
+  int x[4];
+  float r[4];
+  for (int k = 0; k < 4; ++k)
+    x[k] = std::min(std::max(u0 + k - 1, 0), cols - 1);
+  for (int j = 0; j < 4; ++j)
+  {
+    T const* p = in + std::min(std::max(v0 + j - 1, 0), rows - 1) * stride;
+    r[j] = wu[0] * p[x[0]] + wu[1] * p[x[1]] +
+           wu[2] * p[x[2]] + wu[3] * p[x[3]];
+  }
+  return Pwarp_gather<T>::round(wv[0] * r[0] + wv[1] * r[1] +
+				wv[2] * r[2] + wv[3] * r[3]);
+}
+
+template <typename T>
+void
+pwarp_cubic(T const* in, int stride, int rows, int cols,
+	    float const* U, float const* V, T* R, int n)
+{
+  typedef Pwarp_gather<T> gather;
+
+  __m256  zero     = _mm256_setzero_ps();
+  __m256  one      = _mm256_set1_ps(1.f);
+  __m256  u_clip   = _mm256_set1_ps(float(cols - 1));
+  __m256  v_clip   = _mm256_set1_ps(float(rows - 1));
+  __m256  u_inner  = _mm256_set1_ps(float(cols - 2));
+  __m256  v_inner  = _mm256_set1_ps(float(rows - 2));
+  __m256i stride_v = _mm256_set1_epi32(stride);
+  __m256i one_i    = _mm256_set1_epi32(1);
+
+  while (n >= 8)
+  {
+    __m256 u = _mm256_loadu_ps(U);
+    __m256 v = _mm256_loadu_ps(V);
+
+    __m256 valid = _mm256_and_ps(
+      _mm256_and_ps(_mm256_cmp_ps(u, zero,   _CMP_GE_OQ),
+		    _mm256_cmp_ps(u, u_clip, _CMP_LE_OQ)),
+      _mm256_and_ps(_mm256_cmp_ps(v, zero,   _CMP_GE_OQ),
+		    _mm256_cmp_ps(v, v_clip, _CMP_LE_OQ)));
+    __m256 interior = _mm256_and_ps(
+      _mm256_and_ps(_mm256_cmp_ps(u, one,     _CMP_GE_OQ),
+		    _mm256_cmp_ps(u, u_inner, _CMP_LT_OQ)),
+      _mm256_and_ps(_mm256_cmp_ps(v, one,     _CMP_GE_OQ),
+		    _mm256_cmp_ps(v, v_inner, _CMP_LT_OQ)));
+
+    if (_mm256_movemask_ps(_mm256_andnot_ps(interior, valid)))
+    {
+      for (int i = 0; i < 8; ++i)
+	R[i] = pwarp_cubic_pixel(in, stride, rows, cols, U[i], V[i]);
+    }
+    else if (!_mm256_movemask_ps(valid))
+      gather::store(R, zero);
+    else
+    {
+      // Lanes outside of the image interpolate at (1, 1) and produce 0.
+      u = _mm256_blendv_ps(one, u, valid);
+      v = _mm256_blendv_ps(one, v, valid);
+
+      __m256i u0 = _mm256_cvttps_epi32(u);
+      __m256i v0 = _mm256_cvttps_epi32(v);
+
+      __m256 wu[4], wv[4];
+      pwarp_cubic_weights(_mm256_sub_ps(u, _mm256_cvtepi32_ps(u0)), wu);
+      pwarp_cubic_weights(_mm256_sub_ps(v, _mm256_cvtepi32_ps(v0)), wv);
+
+      __m256i idx = _mm256_add_epi32(
+	_mm256_mullo_epi32(_mm256_sub_epi32(v0, one_i), stride_v),
+	_mm256_sub_epi32(u0, one_i));
+
+      __m256 z = _mm256_mul_ps(wv[0], gather::row(in, idx, wu));
+      idx = _mm256_add_epi32(idx, stride_v);
+      z = _mm256_add_ps(z, _mm256_mul_ps(wv[1], gather::row(in, idx, wu)));
+      idx = _mm256_add_epi32(idx, stride_v);
+      z = _mm256_add_ps(z, _mm256_mul_ps(wv[2], gather::row(in, idx, wu)));
+      idx = _mm256_add_epi32(idx, stride_v);
+      z = _mm256_add_ps(z, _mm256_mul_ps(wv[3], gather::row(in, idx, wu)));
+
+      gather::store_rounded(R, _mm256_and_ps(z, valid));
+    }
+
+    U += 8; V += 8; R += 8;
+    n -= 8;
+  }
+
+  while (n)
+  {
+    *R = pwarp_cubic_pixel(in, stride, rows, cols, *U, *V);
+    U++; V++; R++;
+    n--;
+  }
+}
+} // namespace vsip::impl::simd::avx2
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+namespace avx512
+{
+#define VSIP_IMPL_WIDE_TRAITS Avx512_traits
+#include "wide_impl.cpp"
+#undef VSIP_IMPL_WIDE_TRAITS
+} // namespace vsip::impl::simd::avx512
+#pragma GCC pop_options
+
+
+
+#define VSIP_IMPL_WIDE_DISPATCH(CALL)					\
+  switch (isa())							\
+  {									\
+  case isa_avx512: avx512::CALL; return true;				\
+  case isa_avx2:   avx2::CALL;   return true;				\
+  default:         return false;					\
+  }
+
+template <>
+bool
+wide_vmul(float const* A, float const* B, float* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(vmul(A, B, R, n)) }
+
+template <>
+bool
+wide_vmul(double const* A, double const* B, double* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(vmul(A, B, R, n)) }
+
+template <>
+bool
+wide_vmul(std::complex<float> const* A, std::complex<float> const* B,
+	  std::complex<float>* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(cvmul(A, B, R, n)) }
+
+template <>
+bool
+wide_vmul(std::complex<double> const* A, std::complex<double> const* B,
+	  std::complex<double>* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(cvmul(A, B, R, n)) }
+
+
+
+template <>
+bool
+wide_vadd(float const* A, float const* B, float* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(vadd(A, B, R, n)) }
+
+template <>
+bool
+wide_vadd(double const* A, double const* B, double* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(vadd(A, B, R, n)) }
+
+template <>
+bool
+wide_vadd(std::complex<float> const* A, std::complex<float> const* B,
+	  std::complex<float>* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(vadd((float const*)A, (float const*)B,
+			       (float*)R, 2*n)) }
+
+template <>
+bool
+wide_vadd(std::complex<double> const* A, std::complex<double> const* B,
+	  std::complex<double>* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(vadd((double const*)A, (double const*)B,
+			       (double*)R, 2*n)) }
+
+
+
+template <>
+bool
+wide_rscvmul(float alpha, std::complex<float> const* B,
+	     std::complex<float>* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(svmul(alpha, (float const*)B, (float*)R, 2*n)) }
+
+template <>
+bool
+wide_rscvmul(double alpha, std::complex<double> const* B,
+	     std::complex<double>* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(svmul(alpha, (double const*)B, (double*)R, 2*n)) }
+
+
+
+template <>
+bool
+wide_vma_ip_cSC(std::complex<float> const& a, float const* B,
+		std::complex<float>* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(vma_ip_cSC(a, B, R, n)) }
+
+template <>
+bool
+wide_vma_ip_cSC(std::complex<double> const& a, double const* B,
+		std::complex<double>* R, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(vma_ip_cSC(a, B, R, n)) }
+
+
+
+template <>
+bool
+wide_gemm_shape<float>(int& mr, int& nr)
+{ VSIP_IMPL_WIDE_DISPATCH(gemm_shape<float>(mr, nr)) }
+
+template <>
+bool
+wide_gemm_shape<double>(int& mr, int& nr)
+{ VSIP_IMPL_WIDE_DISPATCH(gemm_shape<double>(mr, nr)) }
+
+template <>
+bool
+wide_gemm_kernel(int kc, float const* A, float const* B, float* AB)
+{ VSIP_IMPL_WIDE_DISPATCH(gemm_kernel(kc, A, B, AB)) }
+
+template <>
+bool
+wide_gemm_kernel(int kc, double const* A, double const* B, double* AB)
+{ VSIP_IMPL_WIDE_DISPATCH(gemm_kernel(kc, A, B, AB)) }
+
+template <>
+bool
+wide_cgemm_shape<float>(int& mr, int& nr)
+{ VSIP_IMPL_WIDE_DISPATCH(cgemm_shape<float>(mr, nr)) }
+
+template <>
+bool
+wide_cgemm_shape<double>(int& mr, int& nr)
+{ VSIP_IMPL_WIDE_DISPATCH(cgemm_shape<double>(mr, nr)) }
+
+template <>
+bool
+wide_cgemm_kernel(int kc, float const* A, float const* B, float* AB)
+{ VSIP_IMPL_WIDE_DISPATCH(cgemm_kernel(kc, A, B, AB)) }
+
+template <>
+bool
+wide_cgemm_kernel(int kc, double const* A, double const* B, double* AB)
+{ VSIP_IMPL_WIDE_DISPATCH(cgemm_kernel(kc, A, B, AB)) }
+
+
+
+template <>
+bool
+wide_pwarp_coords(float u0, float v0, float w0,
+		  float du, float dv, float dw,
+		  float c0, float* U, float* V, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(pwarp_coords(u0, v0, w0, du, dv, dw, c0, U, V, n)) }
+
+template <>
+bool
+wide_pwarp_coords(double u0, double v0, double w0,
+		  double du, double dv, double dw,
+		  double c0, double* U, double* V, int n)
+{ VSIP_IMPL_WIDE_DISPATCH(pwarp_coords(u0, v0, w0, du, dv, dw, c0, U, V, n)) }
+
+
+
+// The interpolation kernels are AVX2 only.
+#define VSIP_IMPL_GATHER_DISPATCH(CALL)					\
+  if (isa() == isa_native) return false;				\
+  avx2::CALL;								\
+  return true;
+
+template <>
+bool
+wide_pwarp_linear(float const* in, int stride, int rows, int cols,
+		  float const* U, float const* V, float* R, int n)
+{ VSIP_IMPL_GATHER_DISPATCH(pwarp_linear(in, stride, rows, cols, U, V, R, n)) }
+
+template <>
+bool
+wide_pwarp_linear(unsigned char const* in, int stride, int rows, int cols,
+		  float const* U, float const* V, unsigned char* R, int n)
+{ VSIP_IMPL_GATHER_DISPATCH(pwarp_linear(in, stride, rows, cols, U, V, R, n)) }
+
+template <>
+bool
+wide_pwarp_cubic(float const* in, int stride, int rows, int cols,
+		 float const* U, float const* V, float* R, int n)
+{ VSIP_IMPL_GATHER_DISPATCH(pwarp_cubic(in, stride, rows, cols, U, V, R, n)) }
+
+template <>
+bool
+wide_pwarp_cubic(unsigned char const* in, int stride, int rows, int cols,
+		 float const* U, float const* V, unsigned char* R, int n)
+{ VSIP_IMPL_GATHER_DISPATCH(pwarp_cubic(in, stride, rows, cols, U, V, R, n)) }
+
+#undef VSIP_IMPL_GATHER_DISPATCH
+#undef VSIP_IMPL_WIDE_DISPATCH
+
+} // namespace vsip::impl::simd
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_IMPL_SIMD_RUNTIME_ISA
@@ -0,0 +1,189 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/simd/wide.hpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Runtime-dispatched AVX2/AVX-512 kernels.
+
+    Each wide_* function evaluates its operation with the kernel for
+    the instruction set selected by isa() and returns true, or returns
+    false if no wide kernel applies (unsupported type, or isa() is
+    isa_native).  In that case the caller falls back to its
+    Simd_traits-based kernel.
+*/
+
+#ifndef VSIP_OPT_SIMD_WIDE_HPP
+#define VSIP_OPT_SIMD_WIDE_HPP
+
+#if VSIP_IMPL_REF_IMPL
+# error "vsip/opt files cannot be used as part of the reference impl."
+#endif
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <complex>
+
+#include <vsip/opt/simd/isa.hpp>
+
+
+
+/***********************************************************************
+  Declarations
+***********************************************************************/
+
+namespace vsip
+{
+namespace impl
+{
+namespace simd
+{
+
+/// R = A * B
+template <typename T>
+inline bool
+wide_vmul(T const*, T const*, T*, int)
+{ return false; }
+
+/// R = A + B
+template <typename T>
+inline bool
+wide_vadd(T const*, T const*, T*, int)
+{ return false; }
+
+/// R = alpha * B, alpha real and B complex.
+template <typename T>
+inline bool
+wide_rscvmul(T, std::complex<T> const*, std::complex<T>*, int)
+{ return false; }
+
+/// R += a * B, a complex and B real.
+template <typename T>
+inline bool
+wide_vma_ip_cSC(std::complex<T> const&, T const*, std::complex<T>*, int)
+{ return false; }
+
+/// Source coordinates of N consecutive pixels of a perspective warp:
+///
+///   U[i] = (U0 + c * DU) / (W0 + c * DW)
+///   V[i] = (V0 + c * DV) / (W0 + c * DW),  with c = C0 + i.
+///
+/// U and V must have the same alignment.
+template <typename T>
+inline bool
+wide_pwarp_coords(T, T, T, T, T, T, T, T*, T*, int)
+{ return false; }
+
+/// Bilinear interpolation of image IN (ROWS x COLS pixels, with row
+/// stride STRIDE) at the N positions (U[i], V[i]), as in a perspective
+/// warp.  Positions outside of the image produce 0.  The offsets of
+/// all pixels must fit in an int.
+template <typename CoeffT,
+	  typename T>
+inline bool
+wide_pwarp_linear(T const*, int, int, int, CoeffT const*, CoeffT const*,
+		  T*, int)
+{ return false; }
+
+/// Bicubic interpolation, otherwise as wide_pwarp_linear.  Integer
+/// pixels are rounded and saturated.
+template <typename CoeffT,
+	  typename T>
+inline bool
+wide_pwarp_cubic(T const*, int, int, int, CoeffT const*, CoeffT const*,
+		 T*, int)
+{ return false; }
+
+/// Shape MR x NR of the micro-kernel of the blocked matrix product
+/// (see gemm.hpp).
+template <typename T>
+inline bool
+wide_gemm_shape(int&, int&)
+{ return false; }
+
+/// Micro-kernel of the blocked matrix product, for the shape returned
+/// by wide_gemm_shape.  The panels and the result must be aligned to
+/// 64 bytes.
+template <typename T>
+inline bool
+wide_gemm_kernel(int, T const*, T const*, T*)
+{ return false; }
+
+/// As wide_gemm_shape, for complex<T> with split panels.
+template <typename T>
+inline bool
+wide_cgemm_shape(int&, int&)
+{ return false; }
+
+/// As wide_gemm_kernel, for complex<T> with split panels.
+template <typename T>
+inline bool
+wide_cgemm_kernel(int, T const*, T const*, T*)
+{ return false; }
+
+#if VSIP_IMPL_SIMD_RUNTIME_ISA
+
+template <> bool wide_vmul(float const*, float const*, float*, int);
+template <> bool wide_vmul(double const*, double const*, double*, int);
+template <> bool wide_vmul(std::complex<float> const*,
+			   std::complex<float> const*,
+			   std::complex<float>*, int);
+template <> bool wide_vmul(std::complex<double> const*,
+			   std::complex<double> const*,
+			   std::complex<double>*, int);
+
+template <> bool wide_vadd(float const*, float const*, float*, int);
+template <> bool wide_vadd(double const*, double const*, double*, int);
+template <> bool wide_vadd(std::complex<float> const*,
+			   std::complex<float> const*,
+			   std::complex<float>*, int);
+template <> bool wide_vadd(std::complex<double> const*,
+			   std::complex<double> const*,
+			   std::complex<double>*, int);
+
+template <> bool wide_rscvmul(float, std::complex<float> const*,
+			      std::complex<float>*, int);
+template <> bool wide_rscvmul(double, std::complex<double> const*,
+			      std::complex<double>*, int);
+
+template <> bool wide_vma_ip_cSC(std::complex<float> const&, float const*,
+				 std::complex<float>*, int);
+template <> bool wide_vma_ip_cSC(std::complex<double> const&, double const*,
+				 std::complex<double>*, int);
+
+template <> bool wide_pwarp_coords(float, float, float, float, float, float,
+				   float, float*, float*, int);
+template <> bool wide_pwarp_coords(double, double, double,
+				   double, double, double,
+				   double, double*, double*, int);
+
+template <> bool wide_pwarp_linear(float const*, int, int, int,
+				   float const*, float const*, float*, int);
+template <> bool wide_pwarp_linear(unsigned char const*, int, int, int,
+				   float const*, float const*,
+				   unsigned char*, int);
+template <> bool wide_pwarp_cubic(float const*, int, int, int,
+				  float const*, float const*, float*, int);
+template <> bool wide_pwarp_cubic(unsigned char const*, int, int, int,
+				  float const*, float const*,
+				  unsigned char*, int);
+
+template <> bool wide_gemm_shape<float>(int&, int&);
+template <> bool wide_gemm_shape<double>(int&, int&);
+template <> bool wide_gemm_kernel(int, float const*, float const*, float*);
+template <> bool wide_gemm_kernel(int, double const*, double const*,
+				  double*);
+template <> bool wide_cgemm_shape<float>(int&, int&);
+template <> bool wide_cgemm_shape<double>(int&, int&);
+template <> bool wide_cgemm_kernel(int, float const*, float const*, float*);
+template <> bool wide_cgemm_kernel(int, double const*, double const*,
+				   double*);
+
+#endif // VSIP_IMPL_SIMD_RUNTIME_ISA
+
+} // namespace vsip::impl::simd
+} // namespace vsip::impl
+} // namespace vsip
+
+#endif // VSIP_OPT_SIMD_WIDE_HPP
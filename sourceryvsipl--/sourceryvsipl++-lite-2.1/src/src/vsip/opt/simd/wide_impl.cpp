@@ -0,0 +1,396 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip/opt/simd/wide_impl.cpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Kernels for one wide SIMD instruction set.
+
+    This file is included by wide.cpp once per instruction set, inside
+    a namespace and a target pragma region.  VSIP_IMPL_WIDE_TRAITS names
+    the traits template (Avx_traits, Avx512_traits).
+
+    The result pointer is aligned by peeling scalar elements; the
+    operands are loaded unaligned, so that operands with different
+    relative alignment still use the vector loop.
+*/
+
+// R = A * B  (real)
+template <typename T>
+void
+vmul(T const* A, T const* B, T* R, int n)
+{
+  typedef VSIP_IMPL_WIDE_TRAITS<T> simd;
+  typedef typename simd::simd_type simd_type;
+
+  while (n && simd::alignment_of(R) != 0)
+  {
+    *R = *A * *B;
+    R++; A++; B++;
+    n--;
+  }
+
+  while (n >= 2*simd::vec_size)
+  {
+    simd_type a0 = simd::load_unaligned(A);
+    simd_type b0 = simd::load_unaligned(B);
+    simd_type a1 = simd::load_unaligned(A + simd::vec_size);
+    simd_type b1 = simd::load_unaligned(B + simd::vec_size);
+
+    simd::store(R,                  simd::mul(a0, b0));
+    simd::store(R + simd::vec_size, simd::mul(a1, b1));
+
+    A += 2*simd::vec_size; B += 2*simd::vec_size; R += 2*simd::vec_size;
+    n -= 2*simd::vec_size;
+  }
+
+  while (n)
+  {
+    *R = *A * *B;
+    R++; A++; B++;
+    n--;
+  }
+}
+
+
+
+// R = A + B  (real, or interleaved complex viewed as real)
+template <typename T>
+void
+vadd(T const* A, T const* B, T* R, int n)
+{
+  typedef VSIP_IMPL_WIDE_TRAITS<T> simd;
+  typedef typename simd::simd_type simd_type;
+
+  while (n && simd::alignment_of(R) != 0)
+  {
+    *R = *A + *B;
+    R++; A++; B++;
+    n--;
+  }
+
+  while (n >= 2*simd::vec_size)
+  {
+    simd_type a0 = simd::load_unaligned(A);
+    simd_type b0 = simd::load_unaligned(B);
+    simd_type a1 = simd::load_unaligned(A + simd::vec_size);
+    simd_type b1 = simd::load_unaligned(B + simd::vec_size);
+
+    simd::store(R,                  simd::add(a0, b0));
+    simd::store(R + simd::vec_size, simd::add(a1, b1));
+
+    A += 2*simd::vec_size; B += 2*simd::vec_size; R += 2*simd::vec_size;
+    n -= 2*simd::vec_size;
+  }
+
+  while (n)
+  {
+    *R = *A + *B;
+    R++; A++; B++;
+    n--;
+  }
+}
+
+
+
+// R = alpha * B  (real, or interleaved complex viewed as real)
+template <typename T>
+void
+svmul(T alpha, T const* B, T* R, int n)
+{
+  typedef VSIP_IMPL_WIDE_TRAITS<T> simd;
+  typedef typename simd::simd_type simd_type;
+
+  while (n && simd::alignment_of(R) != 0)
+  {
+    *R = alpha * *B;
+    R++; B++;
+    n--;
+  }
+
+  simd_type a = simd::load_scalar_all(alpha);
+
+  while (n >= 2*simd::vec_size)
+  {
+    simd_type b0 = simd::load_unaligned(B);
+    simd_type b1 = simd::load_unaligned(B + simd::vec_size);
+
+    simd::store(R,                  simd::mul(a, b0));
+    simd::store(R + simd::vec_size, simd::mul(a, b1));
+
+    B += 2*simd::vec_size; R += 2*simd::vec_size;
+    n -= 2*simd::vec_size;
+  }
+
+  while (n)
+  {
+    *R = alpha * *B;
+    R++; B++;
+    n--;
+  }
+}
+
+
+
+// R = A * B  (interleaved complex)
+template <typename T>
+void
+cvmul(std::complex<T> const* A, std::complex<T> const* B,
+      std::complex<T>* R, int n)
+{
+  typedef VSIP_IMPL_WIDE_TRAITS<T> simd;
+  typedef typename simd::simd_type simd_type;
+
+  while (n && simd::alignment_of((T*)R) != 0)
+  {
+    *R = *A * *B;
+    R++; A++; B++;
+    n--;
+  }
+
+  while (n >= simd::vec_size)
+  {
+    simd_type a1 = simd::load_unaligned((T const*)A);
+    simd_type a2 = simd::load_unaligned((T const*)A + simd::vec_size);
+    simd_type b1 = simd::load_unaligned((T const*)B);
+    simd_type b2 = simd::load_unaligned((T const*)B + simd::vec_size);
+
+    simd_type ar = simd::real_from_interleaved(a1, a2);
+    simd_type ai = simd::imag_from_interleaved(a1, a2);
+    simd_type br = simd::real_from_interleaved(b1, b2);
+    simd_type bi = simd::imag_from_interleaved(b1, b2);
+
+    simd_type rr = simd::sub(simd::mul(ar, br), simd::mul(ai, bi));
+    simd_type ri = simd::fma(ar, bi, simd::mul(ai, br));
+
+    simd::store((T*)R,                  simd::interleaved_lo_from_split(rr, ri));
+    simd::store((T*)R + simd::vec_size, simd::interleaved_hi_from_split(rr, ri));
+
+    A += simd::vec_size; B += simd::vec_size; R += simd::vec_size;
+    n -= simd::vec_size;
+  }
+
+  while (n)
+  {
+    *R = *A * *B;
+    R++; A++; B++;
+    n--;
+  }
+}
+
+
+
+// R += a * B  (a complex, B real, R interleaved complex)
+template <typename T>
+void
+vma_ip_cSC(std::complex<T> const& a, T const* B, std::complex<T>* R, int n)
+{
+  typedef VSIP_IMPL_WIDE_TRAITS<T> simd;
+  typedef typename simd::simd_type simd_type;
+
+  while (n && simd::alignment_of((T*)R) != 0)
+  {
+    *R += a * *B;
+    R++; B++;
+    n--;
+  }
+
+  // [ar ai ar ai ...] * [b0 b0 b1 b1 ...]
+  simd_type va = simd::interleaved_lo_from_split(simd::load_scalar_all(a.real()),
+						 simd::load_scalar_all(a.imag()));
+
+  while (n >= simd::vec_size)
+  {
+    simd_type b  = simd::load_unaligned(B);
+    simd_type r0 = simd::load((T*)R);
+    simd_type r1 = simd::load((T*)R + simd::vec_size);
+
+    r0 = simd::fma(va, simd::interleaved_lo_from_split(b, b), r0);
+    r1 = simd::fma(va, simd::interleaved_hi_from_split(b, b), r1);
+
+    simd::store((T*)R,                  r0);
+    simd::store((T*)R + simd::vec_size, r1);
+
+    B += simd::vec_size; R += simd::vec_size;
+    n -= simd::vec_size;
+  }
+
+  while (n)
+  {
+    *R += a * *B;
+    R++; B++;
+    n--;
+  }
+}
+
+
+
+// Micro-kernels of the blocked matrix product (see gemm.hpp): 6 rows
+// of 2 vectors (real) or 6 rows of 1 vector (split complex).
+template <typename T>
+void
+gemm_shape(int& mr, int& nr)
+{
+  mr = 6;
+  nr = 2 * VSIP_IMPL_WIDE_TRAITS<T>::vec_size;
+}
+
+template <typename T>
+void
+cgemm_shape(int& mr, int& nr)
+{
+  mr = 6;
+  nr = VSIP_IMPL_WIDE_TRAITS<T>::vec_size;
+}
+
+template <typename T>
+void
+gemm_kernel(int kc, T const* A, T const* B, T* AB)
+{
+  typedef VSIP_IMPL_WIDE_TRAITS<T> simd;
+  typedef typename simd::simd_type simd_type;
+
+  int const vs = simd::vec_size;
+  int const mr = 6;
+  int const nr = 2 * vs;
+
+  simd_type c00 = simd::zero(), c01 = simd::zero();
+  simd_type c10 = simd::zero(), c11 = simd::zero();
+  simd_type c20 = simd::zero(), c21 = simd::zero();
+  simd_type c30 = simd::zero(), c31 = simd::zero();
+  simd_type c40 = simd::zero(), c41 = simd::zero();
+  simd_type c50 = simd::zero(), c51 = simd::zero();
+
+  for (; kc; --kc, A += mr, B += nr)
+  {
+    simd_type b0 = simd::load(B);
+    simd_type b1 = simd::load(B + vs);
+    simd_type a;
+    a = simd::load_scalar_all(A[0]);
+    c00 = simd::fma(a, b0, c00); c01 = simd::fma(a, b1, c01);
+    a = simd::load_scalar_all(A[1]);
+    c10 = simd::fma(a, b0, c10); c11 = simd::fma(a, b1, c11);
+    a = simd::load_scalar_all(A[2]);
+    c20 = simd::fma(a, b0, c20); c21 = simd::fma(a, b1, c21);
+    a = simd::load_scalar_all(A[3]);
+    c30 = simd::fma(a, b0, c30); c31 = simd::fma(a, b1, c31);
+    a = simd::load_scalar_all(A[4]);
+    c40 = simd::fma(a, b0, c40); c41 = simd::fma(a, b1, c41);
+    a = simd::load_scalar_all(A[5]);
+    c50 = simd::fma(a, b0, c50); c51 = simd::fma(a, b1, c51);
+  }
+
+  simd::store(AB + 0 * nr, c00); simd::store(AB + 0 * nr + vs, c01);
+  simd::store(AB + 1 * nr, c10); simd::store(AB + 1 * nr + vs, c11);
+  simd::store(AB + 2 * nr, c20); simd::store(AB + 2 * nr + vs, c21);
+  simd::store(AB + 3 * nr, c30); simd::store(AB + 3 * nr + vs, c31);
+  simd::store(AB + 4 * nr, c40); simd::store(AB + 4 * nr + vs, c41);
+  simd::store(AB + 5 * nr, c50); simd::store(AB + 5 * nr + vs, c51);
+}
+
+template <typename T>
+void
+cgemm_kernel(int kc, T const* A, T const* B, T* AB)
+{
+  typedef VSIP_IMPL_WIDE_TRAITS<T> simd;
+  typedef typename simd::simd_type simd_type;
+
+  int const mr = 6;
+  int const nr = simd::vec_size;
+
+  simd_type r0 = simd::zero(), i0 = simd::zero();
+  simd_type r1 = simd::zero(), i1 = simd::zero();
+  simd_type r2 = simd::zero(), i2 = simd::zero();
+  simd_type r3 = simd::zero(), i3 = simd::zero();
+  simd_type r4 = simd::zero(), i4 = simd::zero();
+  simd_type r5 = simd::zero(), i5 = simd::zero();
+
+  for (; kc; --kc, A += 2 * mr, B += 2 * nr)
+  {
+    simd_type br  = simd::load(B);
+    simd_type bi  = simd::load(B + nr);
+    simd_type nbi = simd::sub(simd::zero(), bi);
+    simd_type ar, ai;
+#define VSIP_IMPL_CGEMM_ROW(I)						\
+    ar = simd::load_scalar_all(A[I]);					\
+    ai = simd::load_scalar_all(A[mr + I]);				\
+    r##I = simd::fma(ar, br, r##I); r##I = simd::fma(ai, nbi, r##I);	\
+    i##I = simd::fma(ar, bi, i##I); i##I = simd::fma(ai, br,  i##I);
+    VSIP_IMPL_CGEMM_ROW(0)
+    VSIP_IMPL_CGEMM_ROW(1)
+    VSIP_IMPL_CGEMM_ROW(2)
+    VSIP_IMPL_CGEMM_ROW(3)
+    VSIP_IMPL_CGEMM_ROW(4)
+    VSIP_IMPL_CGEMM_ROW(5)
+#undef VSIP_IMPL_CGEMM_ROW
+  }
+
+  T* ABi = AB + mr * nr;
+  simd::store(AB + 0 * nr, r0); simd::store(ABi + 0 * nr, i0);
+  simd::store(AB + 1 * nr, r1); simd::store(ABi + 1 * nr, i1);
+  simd::store(AB + 2 * nr, r2); simd::store(ABi + 2 * nr, i2);
+  simd::store(AB + 3 * nr, r3); simd::store(ABi + 3 * nr, i3);
+  simd::store(AB + 4 * nr, r4); simd::store(ABi + 4 * nr, i4);
+  simd::store(AB + 5 * nr, r5); simd::store(ABi + 5 * nr, i5);
+}
+
+
+
+// The perspective warp kernels (here and in wide.cpp) round like the
+// scalar code, without contracting products and sums into FMAs, so
+// that the warped image does not depend on the instruction set.
+#pragma GCC optimize ("fp-contract=off")
+
+// U = (u0 + c * du) / (w0 + c * dw), V = (v0 + c * dv) / (w0 + c * dw),
+// c = c0, c0 + 1, ...  (perspective warp source coordinates)
+template <typename T>
+void
+pwarp_coords(T u0, T v0, T w0, T du, T dv, T dw, T c0, T* U, T* V, int n)
+{
+  typedef VSIP_IMPL_WIDE_TRAITS<T> simd;
+  typedef typename simd::simd_type simd_type;
+
+  assert(simd::alignment_of(U) == simd::alignment_of(V));
+
+  T c = c0;
+  while (n && simd::alignment_of(U) != 0)
+  {
+    T w = w0 + c * dw;
+    *U = (u0 + c * du) / w;
+    *V = (v0 + c * dv) / w;
+    U++; V++; c += T(1);
+    n--;
+  }
+
+  T ramp[simd::vec_size];
+  for (int i = 0; i < simd::vec_size; ++i)
+    ramp[i] = c + T(i);
+
+  simd_type c_v    = simd::load_unaligned(ramp);
+  simd_type step_v = simd::load_scalar_all(T(simd::vec_size));
+  simd_type u0_v   = simd::load_scalar_all(u0);
+  simd_type v0_v   = simd::load_scalar_all(v0);
+  simd_type w0_v   = simd::load_scalar_all(w0);
+  simd_type du_v   = simd::load_scalar_all(du);
+  simd_type dv_v   = simd::load_scalar_all(dv);
+  simd_type dw_v   = simd::load_scalar_all(dw);
+
+  while (n >= simd::vec_size)
+  {
+    simd_type w = simd::add(w0_v, simd::mul(c_v, dw_v));
+    simd::store(U, simd::div(simd::add(u0_v, simd::mul(c_v, du_v)), w));
+    simd::store(V, simd::div(simd::add(v0_v, simd::mul(c_v, dv_v)), w));
+
+    c_v = simd::add(c_v, step_v);
+    U += simd::vec_size; V += simd::vec_size; c += T(simd::vec_size);
+    n -= simd::vec_size;
+  }
+
+  while (n)
+  {
+    T w = w0 + c * dw;
+    *U = (u0 + c * du) / w;
+    *V = (v0 + c * dv) / w;
+    U++; V++; c += T(1);
+    n--;
+  }
+}
@@ -0,0 +1,405 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip_csl/fir_bank.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Multi-channel FIR filter bank.
+
+*/
+
+#ifndef VSIP_CSL_FIR_BANK_HPP
+#define VSIP_CSL_FIR_BANK_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <vsip/support.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/core/signal/types.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/core/extdata.hpp>
+#include <vsip/core/profile.hpp>
+#include <vsip/core/ops_info.hpp>
+#include <vsip/core/signal/fir.hpp>
+#if !VSIP_IMPL_REF_IMPL
+# include <vsip/opt/signal/fir_opt.hpp>
+#endif
+
+namespace vsip_csl
+{
+namespace impl
+{
+
+/// Channel-interleaved storage and multiply-accumulate for Fir_bank.
+///
+/// A row of S lanes holds one value per channel.  Complex rows are
+/// stored split, the real parts in lanes 0 to S - 1 and the imaginary
+/// parts in lanes S to 2S - 1, so that all arithmetic is on the scalar
+/// type.
+template <typename T>
+struct Fir_bank_traits
+{
+  typedef T scalar_type;
+  static vsip::length_type const parts = 1;
+
+  static void put(scalar_type* row, vsip::length_type, vsip::index_type c,
+		  T value)
+  { row[c] = value;}
+
+  template <vsip::length_type L>
+  static void mac(scalar_type* acc, scalar_type const* h,
+		  scalar_type const* x, vsip::length_type)
+  {
+    for (vsip::index_type l = 0; l < L; ++l)
+      acc[l] += h[l] * x[l];
+  }
+
+  static T get(scalar_type const* acc, vsip::length_type, vsip::index_type l)
+  { return acc[l];}
+};
+
+template <typename T>
+struct Fir_bank_traits<vsip::complex<T> >
+{
+  typedef T scalar_type;
+  static vsip::length_type const parts = 2;
+
+  static void put(scalar_type* row, vsip::length_type s, vsip::index_type c,
+		  vsip::complex<T> value)
+  {
+    row[c]     = value.real();
+    row[s + c] = value.imag();
+  }
+
+  template <vsip::length_type L>
+  static void mac(scalar_type* acc, scalar_type const* h,
+		  scalar_type const* x, vsip::length_type s)
+  {
+    for (vsip::index_type l = 0; l < L; ++l)
+    {
+      acc[l]     += h[l] * x[l]     - h[s + l] * x[s + l];
+      acc[L + l] += h[l] * x[s + l] + h[s + l] * x[l];
+    }
+  }
+
+  static vsip::complex<T> get(scalar_type const* acc, vsip::length_type L,
+			      vsip::index_type l)
+  { return vsip::complex<T>(acc[l], acc[L + l]);}
+};
+
+} // namespace vsip_csl::impl
+
+
+
+/// Fir_bank filters the rows of a matrix, one channel per row, with
+/// either a kernel shared by all channels or one kernel per channel.
+///
+/// The semantics of each channel are those of a vsip::Fir<T, S, C>
+/// with the same kernel, input size and decimation: the kernel
+/// symmetry, the output phase of decimated filters and state
+/// preservation between frames all match.
+///
+/// The channels are processed together: the filter history is kept
+/// channel-interleaved, so that the innermost loops run across
+/// lanes adjacent channels with unit stride and a constant trip
+/// count, and are vectorized by the compiler.  Only the outputs kept
+/// by the decimation are computed.
+///
+/// Kernels long enough for Fir<> to filter with FFTs are instead
+/// applied with one Fir<> per channel.
+template <typename T = vsip::scalar_f,
+          vsip::symmetry_type S = vsip::nonsym,
+          vsip::obj_state C = vsip::state_save,
+          unsigned N = 0,
+          vsip::alg_hint_type H = vsip::alg_time>
+class Fir_bank
+  : vsip::impl::profile::Accumulator<vsip::impl::profile::signal>
+{
+  typedef vsip::impl::profile::Accumulator<vsip::impl::profile::signal>
+		accumulator_type;
+  typedef vsip::length_type length_type;
+  typedef vsip::index_type  index_type;
+  typedef vsip::stride_type stride_type;
+
+  typedef vsip::Fir<T, S, C, N, H>               fir_type;
+  typedef impl::Fir_bank_traits<T>              traits;
+  typedef typename traits::scalar_type          scalar_type;
+  typedef vsip::impl::aligned_array<scalar_type> array_type;
+
+  static length_type const lanes = 16;
+
+public:
+  static vsip::symmetry_type const symmetry = S;
+  static vsip::obj_state const continuous_filter = C;
+
+  static length_type order(length_type k)
+  { return k * (1 + (S != vsip::nonsym)) - (S == vsip::sym_even_len_odd);}
+
+  /// Return true if kernels of size K decimated by D are applied
+  /// directly, false if they are applied with one Fir<> per channel.
+  static bool is_direct(length_type k, length_type d)
+  {
+#if !VSIP_IMPL_REF_IMPL
+    return !(H == vsip::alg_time &&
+	     vsip::impl::Is_fft_avail<T>::value &&
+	     order(k) >= vsip::impl::fir_fft_crossover * d);
+#else
+    return true;
+#endif
+  }
+
+  /// Filter CHANNELS channels with the same KERNEL.
+  template <typename BlockT>
+  Fir_bank(vsip::const_Vector<T, BlockT> kernel,
+           length_type channels,
+           length_type input_size,
+           length_type decimation = 1)
+    VSIP_THROW((std::bad_alloc))
+    : accumulator_type(vsip::impl::signal_detail::Description<1, T>::tag(
+			 "Fir_bank", input_size),
+                       channels *
+                       vsip::impl::signal_detail::Op_count_fir<T>::value
+                       (order(kernel.size()), input_size, decimation)),
+      channels_   (channels),
+      stride_     ((channels + lanes - 1) / lanes * lanes),
+      input_size_ (input_size),
+      order_      (order(kernel.size()) - 1),
+      decimation_ (decimation),
+      skip_       (0),
+      direct_     (is_direct(kernel.size(), decimation)),
+      kernel_     (direct_ ? (order_ + 1) * row_size() : 0),
+      buf_        (direct_ ? (order_ + input_size_) * row_size() : 0)
+  {
+    assert(kernel.size() > (S == vsip::nonsym));
+    init();
+    for (index_type c = 0; c < channels_; ++c)
+      if (direct_)
+        for (index_type i = 0; i < kernel.size(); ++i)
+          set_tap(c, i, kernel.get(i));
+      else
+        firs_.push_back(fir_type(kernel, input_size_, decimation_));
+  }
+
+  /// Filter KERNELS.size(0) channels, channel i with row i of KERNELS.
+  template <typename BlockT>
+  Fir_bank(vsip::const_Matrix<T, BlockT> kernels,
+           length_type input_size,
+           length_type decimation = 1)
+    VSIP_THROW((std::bad_alloc))
+    : accumulator_type(vsip::impl::signal_detail::Description<1, T>::tag(
+			 "Fir_bank", input_size),
+                       kernels.size(0) *
+                       vsip::impl::signal_detail::Op_count_fir<T>::value
+                       (order(kernels.size(1)), input_size, decimation)),
+      channels_   (kernels.size(0)),
+      stride_     ((channels_ + lanes - 1) / lanes * lanes),
+      input_size_ (input_size),
+      order_      (order(kernels.size(1)) - 1),
+      decimation_ (decimation),
+      skip_       (0),
+      direct_     (is_direct(kernels.size(1), decimation)),
+      kernel_     (direct_ ? (order_ + 1) * row_size() : 0),
+      buf_        (direct_ ? (order_ + input_size_) * row_size() : 0)
+  {
+    assert(kernels.size(1) > (S == vsip::nonsym));
+    init();
+    for (index_type c = 0; c < channels_; ++c)
+      if (direct_)
+        for (index_type i = 0; i < kernels.size(1); ++i)
+          set_tap(c, i, kernels.get(c, i));
+      else
+        firs_.push_back(fir_type(kernels.row(c), input_size_, decimation_));
+  }
+
+  Fir_bank(Fir_bank const& fir)
+    : accumulator_type(fir),
+      channels_   (fir.channels_),
+      stride_     (fir.stride_),
+      input_size_ (fir.input_size_),
+      output_size_(fir.output_size_),
+      order_      (fir.order_),
+      decimation_ (fir.decimation_),
+      skip_       (fir.skip_),
+      direct_     (fir.direct_),
+      kernel_     (VSIP_IMPL_ALLOC_ALIGNMENT, fir.kernel_.size(),
+                   fir.kernel_.get()),
+      buf_        (VSIP_IMPL_ALLOC_ALIGNMENT, fir.buf_.size(), fir.buf_.get()),
+      firs_       (fir.firs_)
+  {}
+
+  Fir_bank& operator=(Fir_bank const& fir)
+  {
+    if (this != &fir)
+    {
+      accumulator_type::operator=(fir);
+      channels_    = fir.channels_;
+      stride_      = fir.stride_;
+      input_size_  = fir.input_size_;
+      output_size_ = fir.output_size_;
+      order_       = fir.order_;
+      decimation_  = fir.decimation_;
+      skip_        = fir.skip_;
+      direct_      = fir.direct_;
+      firs_        = fir.firs_;
+      array_type kernel(VSIP_IMPL_ALLOC_ALIGNMENT, fir.kernel_.size(),
+                        fir.kernel_.get());
+      array_type buf(VSIP_IMPL_ALLOC_ALIGNMENT, fir.buf_.size(),
+                     fir.buf_.get());
+      kernel_ = kernel;
+      buf_    = buf;
+    }
+    return *this;
+  }
+
+  length_type kernel_size() const VSIP_NOTHROW { return order_ + 1;}
+  length_type filter_order() const VSIP_NOTHROW { return order_ + 1;}
+  length_type input_size() const VSIP_NOTHROW { return input_size_;}
+  length_type output_size() const VSIP_NOTHROW { return output_size_;}
+  length_type decimation() const VSIP_NOTHROW { return decimation_;}
+  length_type channels() const VSIP_NOTHROW { return channels_;}
+  vsip::obj_state continuous_filtering() const VSIP_NOTHROW { return C;}
+
+  /// Filter row i of IN into row i of OUT, for each channel i.
+  ///
+  /// Returns the number of outputs written to each row.
+  template <typename Block0, typename Block1>
+  length_type
+  operator()(vsip::const_Matrix<T, Block0> in,
+             vsip::Matrix<T, Block1>       out)
+    VSIP_NOTHROW
+  {
+    using vsip::impl::Block_layout;
+    using vsip::impl::Adjust_layout_complex;
+    using vsip::impl::Cmplx_inter_fmt;
+
+    typename accumulator_type::Scope scope(*this);
+    assert(in.size(0) == channels_ && out.size(0) == channels_);
+    assert(in.size(1) == input_size_);
+    assert(out.size(1) == output_size_);
+
+    if (!direct_)
+    {
+      length_type count = 0;
+      for (index_type c = 0; c < channels_; ++c)
+        count = firs_[c](in.row(c), out.row(c));
+      return count;
+    }
+
+    typedef typename Block_layout<Block0>::layout_type LP0;
+    typedef typename Block_layout<Block1>::layout_type LP1;
+    typedef typename Adjust_layout_complex<Cmplx_inter_fmt, LP0>::type use_LP0;
+    typedef typename Adjust_layout_complex<Cmplx_inter_fmt, LP1>::type use_LP1;
+
+    vsip::impl::Ext_data<Block0, use_LP0> ext_in(in.block());
+    vsip::impl::Ext_data<Block1, use_LP1> ext_out(out.block());
+
+    T const*          ip  = ext_in.data();
+    stride_type const is0 = ext_in.stride(0);
+    stride_type const is1 = ext_in.stride(1);
+    T*                op  = ext_out.data();
+    stride_type const os0 = ext_out.stride(0);
+    stride_type const os1 = ext_out.stride(1);
+
+    length_type const m     = order_;
+    length_type const n     = input_size_;
+    length_type const dec   = decimation_;
+    length_type const row   = row_size();
+    length_type const count = (n - skip_ + dec - 1) / dec;
+
+    // Row m + t of buf_ holds input sample t of every channel; rows
+    // 0 to m - 1 hold the last m samples of the previous frame.
+    scalar_type* buf = buf_.get();
+    for (index_type c = 0; c < channels_; ++c)
+      for (index_type t = 0; t < n; ++t)
+        traits::put(buf + (m + t) * row, stride_, c, ip[c * is0 + t * is1]);
+
+    for (index_type c0 = 0; c0 < channels_; c0 += lanes)
+    {
+      length_type const size =
+        channels_ - c0 < lanes ? channels_ - c0 : lanes;
+      for (index_type j = 0; j < count; ++j)
+      {
+        // Output j is at position skip_ + j * dec, and needs rows
+        // skip_ + j * dec to skip_ + j * dec + m.
+        scalar_type const* x = buf + (skip_ + j * dec) * row + c0;
+        scalar_type const* h = kernel_.get() + c0;
+        scalar_type acc[traits::parts * lanes];
+        for (index_type l = 0; l < traits::parts * lanes; ++l)
+          acc[l] = scalar_type();
+        for (index_type i = 0; i <= m; ++i, x += row, h += row)
+          traits::template mac<lanes>(acc, h, x, stride_);
+        for (index_type l = 0; l < size; ++l)
+          op[(c0 + l) * os0 + j * os1] = traits::get(acc, lanes, l);
+      }
+    }
+
+    if (C == vsip::state_save)
+    {
+      skip_ = skip_ + count * dec - n;
+      std::copy(buf + n * row, buf + (n + m) * row, buf);
+    }
+    return count;
+  }
+
+  void reset() VSIP_NOTHROW
+  {
+    for (index_type c = 0; c < firs_.size(); ++c)
+      firs_[c].reset();
+    skip_ = 0;
+    std::fill(buf_.get(), buf_.get() + buf_.size(), scalar_type());
+  }
+
+  float impl_performance(char const *what) const VSIP_NOTHROW
+  {
+    if      (!strcmp(what, "mops"))  return this->mflops();
+    else if (!strcmp(what, "time"))  return this->total();
+    else if (!strcmp(what, "count")) return this->count();
+    else return 0.f;
+  }
+
+private:
+  length_type row_size() const { return traits::parts * stride_;}
+
+  void init()
+  {
+    assert(channels_ > 0);
+    assert(decimation_ > 0);
+    assert(order_ + 1 > decimation_); // M >= decimation
+    assert(input_size_ >= order_);    // input_size >= M
+    output_size_ = (input_size_ + decimation_ - 1) / decimation_;
+    std::fill(kernel_.get(), kernel_.get() + kernel_.size(), scalar_type());
+    std::fill(buf_.get(), buf_.get() + buf_.size(), scalar_type());
+  }
+
+  // Store coefficient I of channel C's kernel, and its mirror image
+  // for symmetric kernels.  kernel_ is kept mirrored, so that output
+  // n is the sum of kernel_[i] * x[n + i] over the extended input x.
+  void set_tap(index_type c, index_type i, T value)
+  {
+    traits::put(kernel_.get() + (order_ - i) * row_size(), stride_, c, value);
+    if (S != vsip::nonsym)
+      traits::put(kernel_.get() + i * row_size(), stride_, c, value);
+  }
+
+  length_type channels_;
+  length_type stride_;      // channels_ rounded up to lanes
+  length_type input_size_;
+  length_type output_size_;
+  length_type order_;       // M in the spec
+  length_type decimation_;
+  length_type skip_;        // how much of next input to skip
+  bool        direct_;      // see is_direct()
+  array_type  kernel_;      // mirrored kernels, channel-interleaved
+  array_type  buf_;         // extended input, channel-interleaved
+  std::vector<fir_type> firs_; // one filter per channel, unless direct_
+};
+
+} // namespace vsip_csl
+
+#endif // VSIP_CSL_FIR_BANK_HPP
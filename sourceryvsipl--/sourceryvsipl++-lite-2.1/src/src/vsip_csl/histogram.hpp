@@ -0,0 +1,166 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip_csl/histogram.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Weighted and joint histograms.
+
+*/
+
+#ifndef VSIP_CSL_HISTOGRAM_HPP
+#define VSIP_CSL_HISTOGRAM_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/support.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/core/extdata.hpp>
+#include <vsip/core/signal/histo.hpp>
+
+namespace vsip_csl
+{
+
+/// Weighted_histogram accumulates the weights of values falling in
+/// each bin, rather than their count.
+///
+/// The bins are those of vsip::Histogram<const_View, T> with the same
+/// range and number of bins: the first and last bins hold the values
+/// below MIN_VALUE and at or above MAX_VALUE.
+template <template <typename, typename> class const_View = vsip::const_Vector,
+          typename T = vsip::scalar_f,
+          typename W = T>
+class Weighted_histogram
+{
+  typedef vsip::Dense<1, W> hist_block_type;
+
+public:
+  Weighted_histogram(T min_value, T max_value, vsip::length_type num_bin)
+    VSIP_THROW((std::bad_alloc))
+    : bins_(min_value, max_value, num_bin),
+      hist_(num_bin, W(0))
+  {
+    assert(min_value < max_value);
+    assert(num_bin >= 3);
+  }
+
+  /// Add the WEIGHTS of the values of DATA to their bins.
+  template <typename Block0,
+            typename Block1>
+  vsip::const_Vector<W>
+  operator()(vsip::const_Vector<T, Block0> data,
+             vsip::const_Vector<W, Block1> weights,
+             bool accumulate = false)
+    VSIP_NOTHROW
+  {
+    assert(data.size() == weights.size());
+    if (accumulate == false)
+      hist_ = W(0);
+
+    vsip::impl::Ext_data<hist_block_type> ext(hist_.block());
+    vsip::impl::histo::accumulate(bins_, data, weights, ext.data());
+
+    return hist_;
+  }
+
+  template <typename Block0,
+            typename Block1>
+  vsip::const_Vector<W>
+  operator()(vsip::const_Matrix<T, Block0> data,
+             vsip::const_Matrix<W, Block1> weights,
+             bool accumulate = false)
+    VSIP_NOTHROW
+  {
+    assert(data.size(0) == weights.size(0) &&
+           data.size(1) == weights.size(1));
+    if (accumulate == false)
+      hist_ = W(0);
+
+    vsip::impl::Ext_data<hist_block_type> ext(hist_.block());
+    vsip::impl::histo::accumulate(bins_, data, weights, ext.data());
+
+    return hist_;
+  }
+
+private:
+  vsip::impl::histo::Bins<T>       bins_;
+  vsip::Vector<W, hist_block_type> hist_;
+};
+
+
+
+/// Joint_histogram counts pairs of values X and Y falling in each pair
+/// of bins.
+///
+/// Element (i, j) of the result counts the pairs whose X falls in bin
+/// i and whose Y falls in bin j, with the bins of vsip::Histogram for
+/// each range.  This gives the joint distribution of two images, such
+/// as a cell and the mean of its neighbors for CFAR threshold
+/// estimation.
+template <template <typename, typename> class const_View = vsip::const_Matrix,
+          typename T = vsip::scalar_f>
+class Joint_histogram
+{
+  typedef vsip::Dense<2, vsip::scalar_i> hist_block_type;
+
+public:
+  Joint_histogram(T x_min_value, T x_max_value, vsip::length_type x_num_bin,
+                  T y_min_value, T y_max_value, vsip::length_type y_num_bin)
+    VSIP_THROW((std::bad_alloc))
+    : xbins_(x_min_value, x_max_value, x_num_bin),
+      ybins_(y_min_value, y_max_value, y_num_bin),
+      hist_(x_num_bin, y_num_bin, 0)
+  {
+    assert(x_min_value < x_max_value && y_min_value < y_max_value);
+    assert(x_num_bin >= 3 && y_num_bin >= 3);
+  }
+
+  /// Count the pairs (X(i), Y(i)).
+  template <typename Block0,
+            typename Block1>
+  vsip::const_Matrix<vsip::scalar_i>
+  operator()(vsip::const_Vector<T, Block0> x,
+             vsip::const_Vector<T, Block1> y,
+             bool accumulate = false)
+    VSIP_NOTHROW
+  {
+    assert(x.size() == y.size());
+    if (accumulate == false)
+      hist_ = 0;
+
+    vsip::impl::Ext_data<hist_block_type> ext(hist_.block());
+    vsip::impl::histo::accumulate(xbins_, ybins_, x, y, ext.data());
+
+    return hist_;
+  }
+
+  /// Count the pairs (X(i, j), Y(i, j)).
+  template <typename Block0,
+            typename Block1>
+  vsip::const_Matrix<vsip::scalar_i>
+  operator()(vsip::const_Matrix<T, Block0> x,
+             vsip::const_Matrix<T, Block1> y,
+             bool accumulate = false)
+    VSIP_NOTHROW
+  {
+    assert(x.size(0) == y.size(0) && x.size(1) == y.size(1));
+    if (accumulate == false)
+      hist_ = 0;
+
+    vsip::impl::Ext_data<hist_block_type> ext(hist_.block());
+    vsip::impl::histo::accumulate(xbins_, ybins_, x, y, ext.data());
+
+    return hist_;
+  }
+
+private:
+  vsip::impl::histo::Bins<T>                    xbins_;
+  vsip::impl::histo::Bins<T>                    ybins_;
+  vsip::Matrix<vsip::scalar_i, hist_block_type> hist_;
+};
+
+} // namespace vsip_csl
+
+#endif // VSIP_CSL_HISTOGRAM_HPP
@@ -0,0 +1,264 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip_csl/iir_bank.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Multi-channel IIR filter bank.
+
+*/
+
+#ifndef VSIP_CSL_IIR_BANK_HPP
+#define VSIP_CSL_IIR_BANK_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include <vsip/support.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/core/signal/types.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/core/extdata.hpp>
+#include <vsip/core/profile.hpp>
+#include <vsip/core/ops_info.hpp>
+
+namespace vsip_csl
+{
+
+/// Iir_bank filters the rows of a matrix, one channel per row, with
+/// the same cascade of second-order sections.
+///
+/// Each channel behaves as a vsip::Iir<T, C> with the same B and A
+/// coefficients and input size.
+///
+/// The channels are processed lanes at a time: a block of channels is
+/// transposed into a channel-interleaved buffer, and each section
+/// then runs over the whole frame with its coefficients and the
+/// lanes' states held in local variables.  The innermost loops run
+/// across the lanes with unit stride and a constant trip count, and
+/// are vectorized by the compiler.
+template <typename      T = vsip::scalar_f,
+	  vsip::obj_state     C = vsip::state_save,
+	  unsigned            N = 0,
+	  vsip::alg_hint_type H = vsip::alg_time>
+class Iir_bank
+  : vsip::impl::profile::Accumulator<vsip::impl::profile::signal>
+{
+  typedef vsip::impl::profile::Accumulator<vsip::impl::profile::signal>
+		accumulator_type;
+  typedef vsip::length_type           length_type;
+  typedef vsip::index_type            index_type;
+  typedef vsip::stride_type           stride_type;
+  typedef vsip::impl::aligned_array<T> array_type;
+
+  static length_type const lanes = 16;
+
+public:
+  static vsip::obj_state const continuous_filtering = C;
+
+  /// Filter CHANNELS channels of INPUT_SIZE samples with the sections
+  /// in the rows of B (b0, b1, b2) and A (a1, a2).
+  template <typename Block0, typename Block1>
+  Iir_bank(vsip::const_Matrix<T, Block0> b,
+	   vsip::const_Matrix<T, Block1> a,
+	   length_type                   channels,
+	   length_type                   input_size)
+    VSIP_THROW((std::bad_alloc))
+  : accumulator_type(vsip::impl::signal_detail::Description<1, T>::tag(
+		       "Iir_bank", input_size),
+		     channels *
+		     vsip::impl::signal_detail::Op_count_iir<T>::value(
+		       input_size, a.size(0))),
+    sections_  (a.size(0)),
+    channels_  (channels),
+    stride_    ((channels + lanes - 1) / lanes * lanes),
+    input_size_(input_size),
+    coeff_     (5 * sections_),
+    state_     (2 * sections_ * stride_),
+    buf_       (input_size_ * lanes)
+  {
+    assert(b.size(0) == a.size(0));
+    assert(b.size(1) == 3);
+    assert(a.size(1) == 2);
+    assert(channels_ > 0);
+
+    for (index_type m = 0; m < sections_; ++m)
+    {
+      coeff_[5*m + 0] = b.get(m, 0);
+      coeff_[5*m + 1] = b.get(m, 1);
+      coeff_[5*m + 2] = b.get(m, 2);
+      coeff_[5*m + 3] = a.get(m, 0);
+      coeff_[5*m + 4] = a.get(m, 1);
+    }
+    reset();
+  }
+
+  Iir_bank(Iir_bank const& iir)
+    VSIP_THROW((std::bad_alloc))
+  : accumulator_type(iir),
+    sections_  (iir.sections_),
+    channels_  (iir.channels_),
+    stride_    (iir.stride_),
+    input_size_(iir.input_size_),
+    coeff_     (VSIP_IMPL_ALLOC_ALIGNMENT, iir.coeff_.size(), iir.coeff_.get()),
+    state_     (VSIP_IMPL_ALLOC_ALIGNMENT, iir.state_.size(), iir.state_.get()),
+    buf_       (iir.buf_.size())
+  {}
+
+  Iir_bank& operator=(Iir_bank const& iir)
+    VSIP_THROW((std::bad_alloc))
+  {
+    if (this != &iir)
+    {
+      accumulator_type::operator=(iir);
+      sections_   = iir.sections_;
+      channels_   = iir.channels_;
+      stride_     = iir.stride_;
+      input_size_ = iir.input_size_;
+      array_type coeff(VSIP_IMPL_ALLOC_ALIGNMENT, iir.coeff_.size(),
+		       iir.coeff_.get());
+      array_type state(VSIP_IMPL_ALLOC_ALIGNMENT, iir.state_.size(),
+		       iir.state_.get());
+      array_type buf(iir.buf_.size());
+      coeff_ = coeff;
+      state_ = state;
+      buf_   = buf;
+    }
+    return *this;
+  }
+
+  length_type kernel_size()  const VSIP_NOTHROW { return 2 * sections_;}
+  length_type filter_order() const VSIP_NOTHROW { return 2 * sections_;}
+  length_type input_size()   const VSIP_NOTHROW { return input_size_;}
+  length_type output_size()  const VSIP_NOTHROW { return input_size_;}
+  length_type channels()     const VSIP_NOTHROW { return channels_;}
+
+  /// Filter row i of DATA into row i of OUT, for each channel i.
+  /// DATA and OUT may be the same matrix.
+  template <typename Block0, typename Block1>
+  vsip::Matrix<T, Block1>
+  operator()(vsip::const_Matrix<T, Block0> data,
+	     vsip::Matrix<T, Block1>       out)
+    VSIP_NOTHROW
+  {
+    using vsip::impl::Block_layout;
+    using vsip::impl::Adjust_layout_complex;
+    using vsip::impl::Cmplx_inter_fmt;
+
+    typename accumulator_type::Scope scope(*this);
+    assert(data.size(0) == channels_ && out.size(0) == channels_);
+    assert(data.size(1) == input_size_);
+    assert(out.size(1)  == input_size_);
+
+    typedef typename Block_layout<Block0>::layout_type LP0;
+    typedef typename Block_layout<Block1>::layout_type LP1;
+    typedef typename Adjust_layout_complex<Cmplx_inter_fmt, LP0>::type use_LP0;
+    typedef typename Adjust_layout_complex<Cmplx_inter_fmt, LP1>::type use_LP1;
+
+    {
+      vsip::impl::Ext_data<Block0, use_LP0> ext_in(data.block());
+      vsip::impl::Ext_data<Block1, use_LP1> ext_out(out.block());
+
+      T const*          ip  = ext_in.data();
+      stride_type const is0 = ext_in.stride(0);
+      stride_type const is1 = ext_in.stride(1);
+      T*                op  = ext_out.data();
+      stride_type const os0 = ext_out.stride(0);
+      stride_type const os1 = ext_out.stride(1);
+
+      length_type const n   = input_size_;
+      T*                buf = buf_.get();
+
+      for (index_type c0 = 0; c0 < channels_; c0 += lanes)
+      {
+	length_type const size =
+	  channels_ - c0 < lanes ? channels_ - c0 : lanes;
+
+	// Sample t of channel c0 + l goes to buf[t * lanes + l].
+	if (size < lanes)
+	  std::fill(buf, buf + n * lanes, T());
+	for (index_type l = 0; l < size; ++l)
+	  for (index_type t = 0; t < n; ++t)
+	    buf[t * lanes + l] = ip[(c0 + l) * is0 + t * is1];
+
+	for (index_type m = 0; m < sections_; ++m)
+	  section(m, c0, buf, n);
+
+	for (index_type l = 0; l < size; ++l)
+	  for (index_type t = 0; t < n; ++t)
+	    op[(c0 + l) * os0 + t * os1] = buf[t * lanes + l];
+      }
+    }
+
+    if (C == vsip::state_no_save)
+      this->reset();
+
+    return out;
+  }
+
+  void reset() VSIP_NOTHROW
+  { std::fill(state_.get(), state_.get() + state_.size(), T());}
+
+  float impl_performance(char const *what) const VSIP_NOTHROW
+  {
+    if      (!strcmp(what, "mops"))  return this->mflops();
+    else if (!strcmp(what, "time"))  return this->total();
+    else if (!strcmp(what, "count")) return this->count();
+    else return 0.f;
+  }
+
+private:
+  // Run the N samples of lanes channels starting at C0, interleaved
+  // in BUF, through section M in place.
+  void section(index_type m, index_type c0, T* buf, length_type n)
+  {
+    T const b0 = coeff_[5*m + 0];
+    T const b1 = coeff_[5*m + 1];
+    T const b2 = coeff_[5*m + 2];
+    T const a1 = coeff_[5*m + 3];
+    T const a2 = coeff_[5*m + 4];
+
+    T* s1 = state_.get() + 2 * m * stride_ + c0;
+    T* s2 = s1 + stride_;
+
+    T w1[lanes], w2[lanes];
+    for (index_type l = 0; l < lanes; ++l)
+    {
+      w1[l] = s1[l];
+      w2[l] = s2[l];
+    }
+
+    for (index_type t = 0; t < n; ++t)
+    {
+      T* x = buf + t * lanes;
+      for (index_type l = 0; l < lanes; ++l)
+      {
+	T const w0 = x[l] - a1 * w1[l] - a2 * w2[l];
+	x[l]  = b0 * w0 + b1 * w1[l] + b2 * w2[l];
+	w2[l] = w1[l];
+	w1[l] = w0;
+      }
+    }
+
+    for (index_type l = 0; l < lanes; ++l)
+    {
+      s1[l] = w1[l];
+      s2[l] = w2[l];
+    }
+  }
+
+  length_type sections_;
+  length_type channels_;
+  length_type stride_;       // channels_ rounded up to lanes
+  length_type input_size_;
+  array_type  coeff_;        // b0, b1, b2, a1, a2 of each section
+  array_type  state_;        // w1 and w2 of each section and channel
+  array_type  buf_;          // one block of channels, interleaved
+};
+
+} // namespace vsip_csl
+
+#endif // VSIP_CSL_IIR_BANK_HPP
@@ -17,6 +17,10 @@
   Included Files
 ***********************************************************************/
 
+#include <algorithm>
+#include <complex>
+#include <limits>
+
 #include <vsip/support.hpp>
 #include <vsip/domain.hpp>
 #include <vsip/vector.hpp>
@@ -26,9 +30,24 @@
 #include <vsip/core/profile.hpp>
 #include <vsip/core/signal/conv_common.hpp>
 #include <vsip/core/extdata_dist.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/opt/simd/wide.hpp>
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
 
 #include <vsip_csl/img/impl/pwarp_common.hpp>
 
+/// Size of the output tiles in which the generic perspective warp
+/// traverses an image.  The source region of a tile stays in cache
+/// when the warp rotates the image.
+#ifndef VSIP_IMPL_PWARP_TILE_ROWS
+#  define VSIP_IMPL_PWARP_TILE_ROWS 32
+#endif
+#ifndef VSIP_IMPL_PWARP_TILE_COLS
+#  define VSIP_IMPL_PWARP_TILE_COLS 256
+#endif
+
 
 
 /***********************************************************************
@@ -53,23 +72,441 @@ struct Is_pwarp_impl_avail<vsip::impl::Generic_tag,
   static bool const value = true;
 };
 
+template <typename      CoeffT,
+	  typename      T,
+	  transform_dir T_dir>
+struct Is_pwarp_impl_avail<vsip::impl::Generic_tag,
+			   CoeffT, T, interp_cubic, T_dir>
+{
+  static bool const value = true;
+};
+
+
+
+namespace pwarp_detail
+{
+
+/// Interpolation of pixels of type T with weights of type CoeffT:
+/// the type in which values are accumulated, and the conversion of a
+/// result back to a pixel.  saturate() is used by interpolators that
+/// can overshoot their inputs (interp_cubic); it rounds and clamps
+/// integer pixels.
+
+template <typename CoeffT,
+	  typename T,
+	  bool     IsInteger = std::numeric_limits<T>::is_integer>
+struct Pixel_traits
+{
+  typedef CoeffT accum_type;
+
+  static T convert(accum_type z)  { return static_cast<T>(z); }
+  static T saturate(accum_type z) { return static_cast<T>(z); }
+};
+
+template <typename CoeffT,
+	  typename T>
+struct Pixel_traits<CoeffT, T, true>
+{
+  typedef CoeffT accum_type;
+
+  static T convert(accum_type z)  { return static_cast<T>(z); }
+  static T saturate(accum_type z)
+  {
+    accum_type const lo = std::numeric_limits<T>::min();
+    accum_type const hi = std::numeric_limits<T>::max();
+    if (z <= lo) return std::numeric_limits<T>::min();
+    if (z >= hi) return std::numeric_limits<T>::max();
+    z += accum_type(0.5);
+    T t = static_cast<T>(z);
+    return accum_type(t) > z ? T(t - 1) : t;
+  }
+};
+
+template <typename CoeffT,
+	  typename T>
+struct Pixel_traits<CoeffT, std::complex<T>, false>
+{
+  typedef std::complex<CoeffT> accum_type;
+
+  static std::complex<T> convert(accum_type z)
+  { return std::complex<T>(z); }
+  static std::complex<T> saturate(accum_type z)
+  { return std::complex<T>(z); }
+};
+
+
+
+/// Interpolation of the source image IN (ROWS x COLS pixels, with
+/// row stride STRIDE) at (U, V), with 0 <= U <= COLS - 1 and
+/// 0 <= V <= ROWS - 1.
+
+template <typename         CoeffT,
+	  typename         T,
+	  interpolate_type InterpT>
+struct Interp;
+
+/// Bilinear interpolation of the 2x2 neighbourhood of (U, V).
+
+template <typename CoeffT,
+	  typename T>
+struct Interp<CoeffT, T, interp_linear>
+{
+  typedef Pixel_traits<CoeffT, T>     traits;
+  typedef typename traits::accum_type accum_type;
+
+  static T exec(
+    T const*          in,
+    vsip::stride_type stride,
+    vsip::length_type rows,
+    vsip::length_type cols,
+    CoeffT            u,
+    CoeffT            v)
+  {
+    using vsip::stride_type;
+
+    stride_type u0 = static_cast<stride_type>(u);
+    stride_type v0 = static_cast<stride_type>(v);
+
+    CoeffT u_beta = u - u0;
+    CoeffT v_beta = v - v0;
+
+    // Neighbours past the last column or row have zero weight.
+    stride_type off_01 = u0 + 1 < stride_type(cols) ? 1      : 0;
+    stride_type off_10 = v0 + 1 < stride_type(rows) ? stride : 0;
+
+    T const* p = in + v0 * stride + u0;
+
+    accum_type z00 = accum_type(p[0]);
+    accum_type z01 = accum_type(p[off_01]);
+    accum_type z10 = accum_type(p[off_10]);
+    accum_type z11 = accum_type(p[off_10 + off_01]);
+
+    accum_type z0 = (1 - u_beta) * z00 + u_beta * z01;
+    accum_type z1 = (1 - u_beta) * z10 + u_beta * z11;
+
+    return traits::convert((1 - v_beta) * z0 + v_beta * z1);
+  }
+};
+
+/// Bicubic interpolation of the 4x4 neighbourhood of (U, V) with the
+/// Keys kernel (a = -1/2).  Neighbours outside of the image are
+/// replaced by the nearest edge pixel.
+
+template <typename CoeffT,
+	  typename T>
+struct Interp<CoeffT, T, interp_cubic>
+{
+  typedef Pixel_traits<CoeffT, T>     traits;
+  typedef typename traits::accum_type accum_type;
+
+  // Weights of the pixels at offsets -1, 0, 1 and 2 from the
+  // interpolated position, T from the pixel at offset 0.
+  static void weights(CoeffT t, CoeffT* w)
+  {
+    CoeffT const h = CoeffT(0.5);
+    w[0] = ((-h * t + 1) * t - h) * t;
+    w[1] = (3 * h * t - 5 * h) * t * t + 1;
+    w[2] = ((-3 * h * t + 2) * t + h) * t;
+    w[3] = (h * t - h) * t * t;
+  }
+
+  static T exec(
+    T const*          in,
+    vsip::stride_type stride,
+    vsip::length_type rows,
+    vsip::length_type cols,
+    CoeffT            u,
+    CoeffT            v)
+  {
+    using vsip::stride_type;
+
+    stride_type u0 = static_cast<stride_type>(u);
+    stride_type v0 = static_cast<stride_type>(v);
+
+    CoeffT wu[4], wv[4];
+    weights(u - u0, wu);
+    weights(v - v0, wv);
+
+    stride_type x[4], y[4];
+    if (u0 >= 1 && u0 + 2 < stride_type(cols) &&
+	v0 >= 1 && v0 + 2 < stride_type(rows))
+    {
+      for (int k = 0; k < 4; ++k)
+      {
+	x[k] = u0 + k - 1;
+	y[k] = (v0 + k - 1) * stride;
+      }
+    }
+    else
+    {
+      for (int k = 0; k < 4; ++k)
+      {
+	x[k] = std::min<stride_type>(std::max<stride_type>(u0 + k - 1, 0),
+				     cols - 1);
+	y[k] = std::min<stride_type>(std::max<stride_type>(v0 + k - 1, 0),
+				     rows - 1) * stride;
+      }
+    }
+
+    return traits::saturate(wv[0] * row(in + y[0], x, wu) +
+			    wv[1] * row(in + y[1], x, wu) +
+			    wv[2] * row(in + y[2], x, wu) +
+			    wv[3] * row(in + y[3], x, wu));
+  }
+
+private:
+  static accum_type row(T const* p, vsip::stride_type const* x,
+			CoeffT const* w)
+  {
+    return w[0] * accum_type(p[x[0]]) + w[1] * accum_type(p[x[1]]) +
+           w[2] * accum_type(p[x[2]]) + w[3] * accum_type(p[x[3]]);
+  }
+};
+
+
+
+/// Interpolation of N pixels with the runtime-dispatched SIMD kernels,
+/// if there is one for the pixel and coefficient types.
+
+template <interpolate_type InterpT>
+struct Wide_interp
+{
+  template <typename CoeffT, typename T>
+  static bool exec(T const*, int, int, int, CoeffT const*, CoeffT const*,
+		   T*, int)
+  { return false; }
+};
+
+template <>
+struct Wide_interp<interp_linear>
+{
+  template <typename CoeffT, typename T>
+  static bool exec(T const* in, int stride, int rows, int cols,
+		   CoeffT const* u, CoeffT const* v, T* out, int n)
+  {
+    return vsip::impl::simd::wide_pwarp_linear(in, stride, rows, cols,
+					       u, v, out, n);
+  }
+};
+
+template <>
+struct Wide_interp<interp_cubic>
+{
+  template <typename CoeffT, typename T>
+  static bool exec(T const* in, int stride, int rows, int cols,
+		   CoeffT const* u, CoeffT const* v, T* out, int n)
+  {
+    return vsip::impl::simd::wide_pwarp_cubic(in, stride, rows, cols,
+					      u, v, out, n);
+  }
+};
+
+
+
+/// Source coordinates (U[i], V[i]) of the N output pixels C0, C0 + 1,
+/// ... of a row whose projection at column 0 is (U_BASE, V_BASE,
+/// W_BASE).
+
+template <typename T>
+inline void
+coords(
+  T  u_base, T v_base, T w_base,
+  T  u_delta, T v_delta, T w_delta,
+  T  c0,
+  T* u,
+  T* v,
+  vsip::length_type n)
+{
+  if (vsip::impl::simd::wide_pwarp_coords(u_base, v_base, w_base,
+					  u_delta, v_delta, w_delta,
+					  c0, u, v, n))
+    return;
+
+  for (vsip::index_type i = 0; i < n; ++i)
+  {
+    T c = c0 + T(i);
+    T w = w_base + c * w_delta;
+    u[i] = (u_base + c * u_delta) / w;
+    v[i] = (v_base + c * v_delta) / w;
+  }
+}
+
+
+
+/// Perspective warp of an image with unit-stride rows.
+///
+/// The output is traversed in tiles of VSIP_IMPL_PWARP_TILE_ROWS x
+/// VSIP_IMPL_PWARP_TILE_COLS pixels.  For each row of a tile, the
+/// source coordinates are computed into a buffer, then interpolated,
+/// with the runtime-dispatched SIMD kernels when they apply.
+/// Bands of tiles are distributed across the thread pool.
+
+template <typename         CoeffT,
+	  typename         T,
+	  interpolate_type InterpT>
+class Tiled_warp
+{
+  static vsip::length_type const tile_rows = VSIP_IMPL_PWARP_TILE_ROWS;
+  static vsip::length_type const tile_cols = VSIP_IMPL_PWARP_TILE_COLS;
+
+public:
+  Tiled_warp(
+    vsip::const_Matrix<CoeffT> P,
+    T const*          in,
+    vsip::stride_type in_stride,
+    vsip::length_type in_rows,
+    vsip::length_type in_cols,
+    T*                out,
+    vsip::stride_type out_stride,
+    vsip::length_type rows,
+    vsip::length_type cols)
+  : in_        (in),
+    in_stride_ (in_stride),
+    in_rows_   (in_rows),
+    in_cols_   (in_cols),
+    out_       (out),
+    out_stride_(out_stride),
+    rows_      (rows),
+    cols_      (cols),
+    u_clip_    (in_cols - 1),
+    v_clip_    (in_rows - 1),
+    int_offsets_(in_rows * in_stride <
+		 vsip::length_type(std::numeric_limits<int>::max()))
+  {
+    // Keep a plain copy of P, since the tasks must not copy the view
+    // (and so update its block's reference count) concurrently.
+    for (vsip::index_type i = 0; i < 3; ++i)
+      for (vsip::index_type j = 0; j < 3; ++j)
+	P_[i][j] = P.get(i, j);
+
+    CoeffT u_0, v_0, w_0;
+    CoeffT u_1, v_1, w_1;
+    vsip::length_type n = std::max<vsip::length_type>(cols - 1, 1);
+    proj_w(CoeffT(0), CoeffT(0), u_0, v_0, w_0);
+    proj_w(CoeffT(n), CoeffT(0), u_1, v_1, w_1);
+    u_delta_ = (u_1 - u_0) / n;
+    v_delta_ = (v_1 - v_0) / n;
+    w_delta_ = (w_1 - w_0) / n;
+  }
+
+  void operator()()
+  {
+    vsip::length_type num_bands = (rows_ + tile_rows - 1) / tile_rows;
+#if VSIP_IMPL_HAVE_THREAD_POOL
+    vsip::impl::threads::Thread_pool* pool =
+      vsip::impl::threads::Thread_pool::instance();
+    if (pool && pool->num_workers() > 1 && num_bands > 1 &&
+	rows_ * cols_ >= pool->threshold())
+    {
+      pool->parallel_for(task, this, num_bands);
+      return;
+    }
+#endif
+    apply(0, num_bands);
+  }
+
+private:
+  // Partially transform (U, V) with P_, as apply_proj_w does.
+  void proj_w(CoeffT u, CoeffT v, CoeffT& x, CoeffT& y, CoeffT& w) const
+  {
+    x = u * P_[0][0] + v * P_[0][1] + P_[0][2];
+    y = u * P_[1][0] + v * P_[1][1] + P_[1][2];
+    w = u * P_[2][0] + v * P_[2][1] + P_[2][2];
+  }
+
+  static void task(void* arg, vsip::index_type b)
+  {
+    static_cast<Tiled_warp*>(arg)->apply(b, b + 1);
+  }
+
+  // Warp the bands of tiles [FIRST, LAST).
+  void apply(vsip::index_type first, vsip::index_type last)
+  {
+    vsip::length_type const tr = tile_rows;
+    vsip::length_type const tc = tile_cols;
+
+    vsip::impl::aligned_array<CoeffT> buf(2 * tc);
+    CoeffT* u = buf.get();
+    CoeffT* v = buf.get() + tc;
+
+    for (vsip::index_type b = first; b < last; ++b)
+    {
+      vsip::index_type  r0 = b * tr;
+      vsip::length_type nr = std::min(tr, rows_ - r0);
+      for (vsip::index_type c0 = 0; c0 < cols_; c0 += tc)
+      {
+	vsip::length_type nc = std::min(tc, cols_ - c0);
+	for (vsip::index_type r = r0; r < r0 + nr; ++r)
+	  row(r, c0, nc, u, v);
+      }
+    }
+  }
+
+  // Warp the N pixels of output row R starting at column C0.
+  void row(vsip::index_type  r,
+	   vsip::index_type  c0,
+	   vsip::length_type n,
+	   CoeffT*           u,
+	   CoeffT*           v)
+  {
+    CoeffT u_base, v_base, w_base;
+    proj_w(CoeffT(0), CoeffT(r), u_base, v_base, w_base);
+    coords(u_base, v_base, w_base, u_delta_, v_delta_, w_delta_,
+	   CoeffT(c0), u, v, n);
+
+    T* p_out = out_ + r * out_stride_ + c0;
+    if (int_offsets_ &&
+	Wide_interp<InterpT>::exec(in_, in_stride_, in_rows_, in_cols_,
+				   u, v, p_out, n))
+      return;
+
+    for (vsip::index_type i = 0; i < n; ++i)
+    {
+      if (u[i] >= 0 && u[i] <= u_clip_ && v[i] >= 0 && v[i] <= v_clip_)
+	p_out[i] = Interp<CoeffT, T, InterpT>::exec(
+	  in_, in_stride_, in_rows_, in_cols_, u[i], v[i]);
+      else
+	p_out[i] = T();
+    }
+  }
+
+  CoeffT            P_[3][3];
+  T const*          in_;
+  vsip::stride_type in_stride_;
+  vsip::length_type in_rows_;
+  vsip::length_type in_cols_;
+  T*                out_;
+  vsip::stride_type out_stride_;
+  vsip::length_type rows_;
+  vsip::length_type cols_;
+  CoeffT            u_clip_;
+  CoeffT            v_clip_;
+  CoeffT            u_delta_;
+  CoeffT            v_delta_;
+  CoeffT            w_delta_;
+  bool              int_offsets_;
+};
+
+} // namespace vsip_csl::img::impl::pwarp_detail
+
 
 
 /// Generic implementation of Pwarp_impl.
 
 template <typename            CoeffT,
 	  typename            T,
+	  interpolate_type    InterpT,
 	  transform_dir       DirT,
 	  unsigned            n_times,
           vsip::alg_hint_type a_hint>
-class Pwarp_impl<CoeffT, T, interp_linear, DirT, n_times, a_hint,
+class Pwarp_impl<CoeffT, T, InterpT, DirT, n_times, a_hint,
 		 vsip::impl::Generic_tag>
 {
   static vsip::dimension_type const dim = 2;
 
   // Compile-time constants.
 public:
-  static interpolate_type const interp_tv    = interp_linear;
+  static interpolate_type const interp_tv    = InterpT;
   static transform_dir    const transform_tv = DirT;
 
   // Constructors, copies, assignments, and destructors.
@@ -132,18 +569,22 @@ private:
 
 template <typename            CoeffT,
 	  typename            T,
+	  interpolate_type    InterpT,
 	  transform_dir       DirT,
 	  unsigned            n_times,
           vsip::alg_hint_type a_hint>
 template <typename Block1>
-Pwarp_impl<CoeffT, T, interp_linear, DirT, n_times, a_hint, vsip::impl::Generic_tag>::
+Pwarp_impl<CoeffT, T, InterpT, DirT, n_times, a_hint,
+	   vsip::impl::Generic_tag>::
 Pwarp_impl(
   vsip::const_Matrix<CoeffT, Block1> coeff,
   vsip::Domain<dim> const&           size)
 VSIP_THROW((std::bad_alloc))
   : P_    (3, 3),
     size_ (size),
-    pm_non_opt_calls_ (0)
+    pm_non_opt_calls_ (0),
+    pm_in_ext_cost_   (0),
+    pm_out_ext_cost_  (0)
 {
   P_ = coeff;
 }
@@ -154,10 +595,12 @@ VSIP_THROW((std::bad_alloc))
 
 template <typename            CoeffT,
 	  typename            T,
+	  interpolate_type    InterpT,
 	  transform_dir       DirT,
 	  unsigned            n_times,
           vsip::alg_hint_type a_hint>
-Pwarp_impl<CoeffT, T, interp_linear, DirT, n_times, a_hint, vsip::impl::Generic_tag>::
+Pwarp_impl<CoeffT, T, InterpT, DirT, n_times, a_hint,
+	   vsip::impl::Generic_tag>::
 ~Pwarp_impl()
   VSIP_NOTHROW
 {
@@ -165,98 +608,44 @@ Pwarp_impl<CoeffT, T, interp_linear, DirT, n_times, a_hint, vsip::impl::Generic_
 
 
 
-// Perform 2-D separable filter.
+// Perform perspective warp.
 
 template <typename            CoeffT,
 	  typename            T,
+	  interpolate_type    InterpT,
 	  transform_dir       DirT,
 	  unsigned            n_times,
           vsip::alg_hint_type a_hint>
 template <typename Block1,
 	  typename Block2>
 void
-Pwarp_impl<CoeffT, T, interp_linear, DirT, n_times, a_hint, vsip::impl::Generic_tag>::
+Pwarp_impl<CoeffT, T, InterpT, DirT, n_times, a_hint,
+	   vsip::impl::Generic_tag>::
 filter(
   vsip::const_Matrix<T, Block1> in,
   vsip::Matrix<T,       Block2> out)
 VSIP_NOTHROW
 {
-  using vsip::index_type;
-  using vsip::length_type;
-  using vsip::stride_type;
-
-  typedef CoeffT AccumT;
-
-  CoeffT      v_clip  = in.size(0) - 1;
-  CoeffT      u_clip  = in.size(1) - 1;
-  length_type rows    = out.size(0);
-  length_type cols    = out.size(1);
-
-  CoeffT u_0, v_0, w_0;
-  CoeffT u_1, v_1, w_1;
-  apply_proj_w<CoeffT>(P_, 0.,     0., u_0, v_0, w_0);
-  apply_proj_w<CoeffT>(P_, cols-1, 0., u_1, v_1, w_1);
-  CoeffT u_delta = (u_1 - u_0) / (cols-1);
-  CoeffT v_delta = (v_1 - v_0) / (cols-1);
-  CoeffT w_delta = (w_1 - w_0) / (cols-1);
-
-  vsip::impl::Ext_data<Block1> in_ext(in.block());
-  vsip::impl::Ext_data<Block2> out_ext(out.block());
-
-  T* p_in  = in_ext.data();
-  T* p_out = out_ext.data();
-  stride_type in_stride_0            = in_ext.stride(0);
-  stride_type out_stride_0_remainder = out_ext.stride(0) - cols;
-
-  stride_type max_offset = (rows-1)*in_stride_0 + (cols-1);
-  for (index_type r=0; r<rows; ++r)
-  {
-    CoeffT y = static_cast<CoeffT>(r);
-    
-    CoeffT u_base, v_base, w_base;
-    apply_proj_w<CoeffT>(P_, 0., y, u_base, v_base, w_base);
-    
-    for (index_type c=0; c<cols; ++c)
-    {
-      CoeffT w =  w_base + c*w_delta;
-      CoeffT u = (u_base + c*u_delta) / w;
-      CoeffT v = (v_base + c*v_delta) / w;
-      
-      if (u >= 0 && u <= u_clip && v >= 0 && v <= v_clip)
-      {
-	index_type u0 = static_cast<index_type>(u);
-	index_type v0 = static_cast<index_type>(v);
-	
-	CoeffT u_beta = u - u0;
-	CoeffT v_beta = v - v0;
-	
-	T* p = p_in + v0*in_stride_0 + u0;
-
-	stride_type limit = max_offset - v0*in_stride_0 - u0;
-
-	stride_type off_10 = std::min<stride_type>(in_stride_0,     limit);
-	stride_type off_01 = std::min<stride_type>(              1, limit);
-	stride_type off_11 = std::min<stride_type>(in_stride_0 + 1, limit);
-
-	T z00 = *p;            // in.get(v0,   u0);
-	T z10 = *(p + off_10); // in.get(v0+1, u0+0);
-	T z01 = *(p + off_01); // in.get(v0+0, u0+1);
-	T z11 = *(p + off_11); // in.get(v0+1, u0+1);
-	
-	AccumT z0 = (AccumT)((1 - u_beta) * z00 + u_beta * z01);
-	AccumT z1 = (AccumT)((1 - u_beta) * z10 + u_beta * z11);
-	
-	AccumT z  = (AccumT)((1 - v_beta) * z0  + v_beta * z1);
-	
-	*p_out++ =  static_cast<T>(z);
-      }
-      else
-      {
-	*p_out++ = 0;
-      }
-    }
-    p_out += out_stride_0_remainder;
-  }
+  using vsip::impl::Ext_data;
+  using vsip::impl::Layout;
+  using vsip::impl::Stride_unit;
+  using vsip::impl::Cmplx_inter_fmt;
+  using vsip::impl::SYNC_IN;
+  using vsip::impl::SYNC_OUT;
+
+  typedef Layout<2, vsip::row2_type, Stride_unit, Cmplx_inter_fmt> LP;
+
+  Ext_data<Block1, LP> in_ext (in.block(),  SYNC_IN);
+  Ext_data<Block2, LP> out_ext(out.block(), SYNC_OUT);
+
+  VSIP_IMPL_PROFILE(pm_in_ext_cost_  += in_ext.cost());
+  VSIP_IMPL_PROFILE(pm_out_ext_cost_ += out_ext.cost());
+
+  pwarp_detail::Tiled_warp<CoeffT, T, InterpT> warp(
+    P_,
+    in_ext.data(),  in_ext.stride(0),  in.size(0),  in.size(1),
+    out_ext.data(), out_ext.stride(0), out.size(0), out.size(1));
+  warp();
 }
 
 } // namespace vsip_csl::img::impl
@@ -19,6 +19,7 @@
 
 #include <vsip/core/memory_pool.hpp>
 #include <vsip/core/huge_page_pool.hpp>
+#include <vsip/core/arena_pool.hpp>
 
 
 
@@ -31,6 +32,8 @@ namespace vsip_csl
 
 using vsip::impl::Memory_pool;
 using vsip::impl::Huge_page_pool;
+using vsip::impl::Arena_pool;
+using vsip::impl::Scratch_scope;
 
 void
 set_pool(vsip::Local_map& map, Memory_pool* pool)
@@ -0,0 +1,1751 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    vsip_csl/solver_bank.hpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Batched linear system solvers.
+
+*/
+
+#ifndef VSIP_CSL_SOLVER_BANK_HPP
+#define VSIP_CSL_SOLVER_BANK_HPP
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <vsip/support.hpp>
+#include <vsip/tensor.hpp>
+#include <vsip/core/aligned_allocator.hpp>
+#include <vsip/core/extdata.hpp>
+#include <vsip/core/fns_scalar.hpp>
+#include <vsip/core/solver/common.hpp>
+#include <vsip/core/static_assert.hpp>
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
+
+namespace vsip_csl
+{
+namespace impl
+{
+
+/// Lane arithmetic for the solver banks.
+///
+/// A cell holds one matrix element of each of L problems.  Complex
+/// cells are stored split, the real parts in lanes 0 to L - 1 and the
+/// imaginary parts in lanes L to 2L - 1.  The loops over lanes have a
+/// constant trip count and only write to local arrays, so that they
+/// are vectorized by the compiler without alias checks.
+template <typename T>
+struct Solver_bank_traits
+{
+  typedef T scalar_type;
+  static vsip::length_type const parts = 1;
+
+  static void put(scalar_type* c, vsip::length_type, vsip::index_type l,
+		  T value)
+  { c[l] = value;}
+
+  static T get(scalar_type const* c, vsip::length_type, vsip::index_type l)
+  { return c[l];}
+
+  static scalar_type abs1(scalar_type const* c, vsip::length_type,
+			  vsip::index_type l)
+  { return std::abs(c[l]);}
+
+  static void swap(scalar_type* a, scalar_type* b, vsip::length_type,
+		   vsip::index_type l)
+  { std::swap(a[l], b[l]);}
+
+  /// D += op(A) * B, where op(A) is conj(A) if Conj.
+  template <vsip::length_type L, bool Conj>
+  static void mac(scalar_type* d, scalar_type const* a, scalar_type const* b)
+  {
+    scalar_type t[L];
+    for (vsip::index_type l = 0; l < L; ++l)
+      t[l] = d[l] + a[l] * b[l];
+    for (vsip::index_type l = 0; l < L; ++l)
+      d[l] = t[l];
+  }
+
+  /// D -= op(A) * B.
+  template <vsip::length_type L, bool Conj>
+  static void msc(scalar_type* d, scalar_type const* a, scalar_type const* b)
+  {
+    scalar_type t[L];
+    for (vsip::index_type l = 0; l < L; ++l)
+      t[l] = d[l] - a[l] * b[l];
+    for (vsip::index_type l = 0; l < L; ++l)
+      d[l] = t[l];
+  }
+
+  /// D *= op(A).
+  template <vsip::length_type L, bool Conj>
+  static void mul(scalar_type* d, scalar_type const* a)
+  {
+    scalar_type t[L];
+    for (vsip::index_type l = 0; l < L; ++l)
+      t[l] = d[l] * a[l];
+    for (vsip::index_type l = 0; l < L; ++l)
+      d[l] = t[l];
+  }
+
+  /// D *= R, where R holds one real value per lane.
+  template <vsip::length_type L>
+  static void scale(scalar_type* d, scalar_type const* r)
+  { mul<L, false>(d, r);}
+
+  /// D = 1 / op(A).
+  template <vsip::length_type L, bool Conj>
+  static void recip(scalar_type* d, scalar_type const* a)
+  {
+    for (vsip::index_type l = 0; l < L; ++l)
+      d[l] = scalar_type(1) / a[l];
+  }
+
+  /// R += |A|^2, where R holds one real value per lane.
+  template <vsip::length_type L>
+  static void norm2(scalar_type* r, scalar_type const* a)
+  {
+    for (vsip::index_type l = 0; l < L; ++l)
+      r[l] += a[l] * a[l];
+  }
+
+  /// D += A * B, for a value A shared by all lanes.
+  template <vsip::length_type L>
+  static void smac(scalar_type* d, T a, scalar_type const* b)
+  {
+    scalar_type t[L];
+    for (vsip::index_type l = 0; l < L; ++l)
+      t[l] = d[l] + a * b[l];
+    for (vsip::index_type l = 0; l < L; ++l)
+      d[l] = t[l];
+  }
+};
+
+template <typename T>
+struct Solver_bank_traits<vsip::complex<T> >
+{
+  typedef T scalar_type;
+  static vsip::length_type const parts = 2;
+
+  static void put(scalar_type* c, vsip::length_type L, vsip::index_type l,
+		  vsip::complex<T> value)
+  {
+    c[l]     = value.real();
+    c[L + l] = value.imag();
+  }
+
+  static vsip::complex<T> get(scalar_type const* c, vsip::length_type L,
+			      vsip::index_type l)
+  { return vsip::complex<T>(c[l], c[L + l]);}
+
+  static scalar_type abs1(scalar_type const* c, vsip::length_type L,
+			  vsip::index_type l)
+  { return std::abs(c[l]) + std::abs(c[L + l]);}
+
+  static void swap(scalar_type* a, scalar_type* b, vsip::length_type L,
+		   vsip::index_type l)
+  {
+    std::swap(a[l],     b[l]);
+    std::swap(a[L + l], b[L + l]);
+  }
+
+  template <vsip::length_type L, bool Conj>
+  static void mac(scalar_type* d, scalar_type const* a, scalar_type const* b)
+  {
+    scalar_type t[2 * L];
+    for (vsip::index_type l = 0; l < L; ++l)
+    {
+      scalar_type ai = Conj ? -a[L + l] : a[L + l];
+      t[l]     = d[l]     + a[l] * b[l]     - ai * b[L + l];
+      t[L + l] = d[L + l] + a[l] * b[L + l] + ai * b[l];
+    }
+    for (vsip::index_type l = 0; l < 2 * L; ++l)
+      d[l] = t[l];
+  }
+
+  template <vsip::length_type L, bool Conj>
+  static void msc(scalar_type* d, scalar_type const* a, scalar_type const* b)
+  {
+    scalar_type t[2 * L];
+    for (vsip::index_type l = 0; l < L; ++l)
+    {
+      scalar_type ai = Conj ? -a[L + l] : a[L + l];
+      t[l]     = d[l]     - a[l] * b[l]     + ai * b[L + l];
+      t[L + l] = d[L + l] - a[l] * b[L + l] - ai * b[l];
+    }
+    for (vsip::index_type l = 0; l < 2 * L; ++l)
+      d[l] = t[l];
+  }
+
+  template <vsip::length_type L, bool Conj>
+  static void mul(scalar_type* d, scalar_type const* a)
+  {
+    scalar_type t[2 * L];
+    for (vsip::index_type l = 0; l < L; ++l)
+    {
+      scalar_type ai = Conj ? -a[L + l] : a[L + l];
+      t[l]     = d[l] * a[l]     - d[L + l] * ai;
+      t[L + l] = d[l] * ai       + d[L + l] * a[l];
+    }
+    for (vsip::index_type l = 0; l < 2 * L; ++l)
+      d[l] = t[l];
+  }
+
+  template <vsip::length_type L>
+  static void scale(scalar_type* d, scalar_type const* r)
+  {
+    scalar_type t[2 * L];
+    for (vsip::index_type l = 0; l < L; ++l)
+    {
+      t[l]     = d[l]     * r[l];
+      t[L + l] = d[L + l] * r[l];
+    }
+    for (vsip::index_type l = 0; l < 2 * L; ++l)
+      d[l] = t[l];
+  }
+
+  template <vsip::length_type L, bool Conj>
+  static void recip(scalar_type* d, scalar_type const* a)
+  {
+    for (vsip::index_type l = 0; l < L; ++l)
+    {
+      scalar_type s = scalar_type(1) / (a[l] * a[l] + a[L + l] * a[L + l]);
+      d[l]     = a[l] * s;
+      d[L + l] = Conj ? a[L + l] * s : -a[L + l] * s;
+    }
+  }
+
+  template <vsip::length_type L>
+  static void norm2(scalar_type* r, scalar_type const* a)
+  {
+    for (vsip::index_type l = 0; l < L; ++l)
+      r[l] += a[l] * a[l] + a[L + l] * a[L + l];
+  }
+
+  template <vsip::length_type L>
+  static void smac(scalar_type* d, vsip::complex<T> a, scalar_type const* b)
+  {
+    scalar_type const ar = a.real();
+    scalar_type const ai = a.imag();
+    scalar_type t[2 * L];
+    for (vsip::index_type l = 0; l < L; ++l)
+    {
+      t[l]     = d[l]     + ar * b[l]     - ai * b[L + l];
+      t[L + l] = d[L + l] + ar * b[L + l] + ai * b[l];
+    }
+    for (vsip::index_type l = 0; l < 2 * L; ++l)
+      d[l] = t[l];
+  }
+};
+
+
+
+/// Storage and scheduling shared by the solver banks.
+///
+/// The problems are processed in groups of LANES.  Group g holds
+/// problems g * LANES to g * LANES + LANES - 1 as a ROWS x COLS
+/// row-major array of cells; the lanes past the end of the batch
+/// hold identity matrices.  Groups are independent, and are factored
+/// and solved in parallel on the thread pool.
+template <typename T>
+class Solver_bank_base
+{
+protected:
+  typedef vsip::length_type length_type;
+  typedef vsip::index_type  index_type;
+  typedef vsip::stride_type stride_type;
+
+  typedef Solver_bank_traits<T>        traits;
+  typedef typename traits::scalar_type scalar_type;
+  typedef std::vector<scalar_type, vsip::impl::Aligned_allocator<scalar_type> >
+		array_type;
+
+  static length_type const lanes = 16;
+  static length_type const cell  = traits::parts * lanes;
+
+  /// Direct access to a tensor of problems, with complex data
+  /// interleaved.
+  template <typename Block>
+  struct Ext
+  {
+    typedef typename vsip::impl::Block_layout<Block>::layout_type LP;
+    typedef typename vsip::impl::Adjust_layout_complex<
+      vsip::impl::Cmplx_inter_fmt, LP>::type use_LP;
+    typedef vsip::impl::Ext_data<Block, use_LP> type;
+  };
+
+  /// A tensor of problems: element (i, j) of problem p is at
+  /// data[p * stride[0] + i * stride[1] + j * stride[2]].
+  struct Operand
+  {
+    T*          data;
+    stride_type stride[3];
+    length_type rows;
+    length_type cols;
+  };
+
+  template <typename ExtT>
+  static Operand operand(ExtT& ext)
+  {
+    Operand op;
+    op.data = ext.data();
+    for (vsip::dimension_type d = 0; d < 3; ++d)
+      op.stride[d] = ext.stride(d);
+    op.rows = ext.size(1);
+    op.cols = ext.size(2);
+    return op;
+  }
+
+  /// A matrix of problems, one vector per row, as a tensor of
+  /// problems of one row.
+  template <typename ExtT>
+  static Operand row_operand(ExtT& ext)
+  {
+    Operand op;
+    op.data      = ext.data();
+    op.stride[0] = ext.stride(0);
+    op.stride[1] = 0;
+    op.stride[2] = ext.stride(1);
+    op.rows      = 1;
+    op.cols      = ext.size(1);
+    return op;
+  }
+
+  typedef bool (*group_func)(void* arg, index_type g);
+
+  Solver_bank_base(length_type batch, length_type rows, length_type cols)
+    VSIP_THROW((std::bad_alloc))
+    : batch_ (batch),
+      groups_((batch + lanes - 1) / lanes),
+      rows_  (rows),
+      cols_  (cols),
+      data_  (groups_ * rows * cols * cell)
+  {
+    assert(batch_ > 0 && rows_ > 0 && cols_ > 0);
+  }
+
+public:
+  length_type batch() const VSIP_NOTHROW { return batch_;}
+
+protected:
+  scalar_type* group(index_type g)
+  { return &data_[0] + g * rows_ * cols_ * cell;}
+
+  scalar_type const* group(index_type g) const
+  { return &data_[0] + g * rows_ * cols_ * cell;}
+
+  length_type group_size(index_type g) const
+  { return std::min(lanes, batch_ - g * lanes);}
+
+  /// Copy the problems of group G of OP into BUF, or their conjugate
+  /// transposes if HERM.
+  void load(Operand const& op, index_type g, scalar_type* buf, bool herm)
+    const
+  {
+    using vsip::impl::fn::impl_conj;
+    length_type const rows = herm ? op.cols : op.rows;
+    length_type const cols = herm ? op.rows : op.cols;
+    length_type const size = group_size(g);
+
+    for (index_type l = 0; l < lanes; ++l)
+    {
+      T const* p = op.data + (g * lanes + l) * op.stride[0];
+      for (index_type i = 0; i < rows; ++i)
+	for (index_type j = 0; j < cols; ++j)
+	{
+	  T value = l >= size ? T(i == j) :
+	            herm      ? impl_conj(p[j * op.stride[1] + i * op.stride[2]])
+	                      : p[i * op.stride[1] + j * op.stride[2]];
+	  traits::put(buf + (i * cols + j) * cell, lanes, l, value);
+	}
+    }
+  }
+
+  /// Copy the first OP.rows rows of BUF, a row-major array of cells
+  /// with OP.cols columns, into the problems of group G of OP.
+  void store(scalar_type const* buf, index_type g, Operand const& op) const
+  {
+    length_type const size = group_size(g);
+    for (index_type l = 0; l < size; ++l)
+    {
+      T* p = op.data + (g * lanes + l) * op.stride[0];
+      for (index_type i = 0; i < op.rows; ++i)
+	for (index_type j = 0; j < op.cols; ++j)
+	  p[i * op.stride[1] + j * op.stride[2]] =
+	    traits::get(buf + (i * op.cols + j) * cell, lanes, l);
+    }
+  }
+
+  /// Call FUNC(ARG, g) for each group g, and return true if all calls
+  /// return true.
+  bool for_each_group(group_func func, void* arg) const
+  {
+    std::vector<char> ok(groups_, 1);
+    Group_task task = { func, arg, &ok[0] };
+#if VSIP_IMPL_HAVE_THREAD_POOL
+    vsip::impl::threads::Thread_pool* pool =
+      vsip::impl::threads::Thread_pool::instance();
+    if (pool && pool->num_workers() > 1 && groups_ > 1 &&
+	batch_ * rows_ * cols_ >= pool->threshold())
+      pool->parallel_for(run_group, &task, groups_);
+    else
+#endif
+    for (index_type g = 0; g < groups_; ++g)
+      run_group(&task, g);
+    return std::find(ok.begin(), ok.end(), 0) == ok.end();
+  }
+
+  length_type batch_;
+  length_type groups_;      // batch_ rounded up to lanes, over lanes
+  length_type rows_;
+  length_type cols_;
+  array_type  data_;        // factored problems, lane-interleaved
+
+private:
+  struct Group_task
+  {
+    group_func func;
+    void*      arg;
+    char*      ok;
+  };
+
+  static void run_group(void* arg, index_type g)
+  {
+    Group_task* task = static_cast<Group_task*>(arg);
+    task->ok[g] = task->func(task->arg, g);
+  }
+};
+
+template <typename T>
+vsip::length_type const Solver_bank_base<T>::lanes;
+
+template <typename T>
+vsip::length_type const Solver_bank_base<T>::cell;
+
+} // namespace vsip_csl::impl
+
+
+
+/// Lud_bank factors a batch of square matrices, A(p, :, :) for each
+/// problem p of a tensor A, and solves linear systems with them.
+///
+/// Each problem is factored and solved as by a vsip::lud<T>, with
+/// partial pivoting.  The problems are processed in groups, with the
+/// matrix elements of the problems of a group interleaved, so that the
+/// factorization and substitutions run across problems with vector
+/// instructions; groups are processed in parallel.
+template <typename T = vsip::scalar_f>
+class Lud_bank : public impl::Solver_bank_base<T>
+{
+  typedef impl::Solver_bank_base<T>      base_type;
+  typedef typename base_type::traits      traits;
+  typedef typename base_type::scalar_type scalar_type;
+  typedef typename base_type::Operand     Operand;
+  typedef vsip::length_type length_type;
+  typedef vsip::index_type  index_type;
+
+  static length_type const lanes = base_type::lanes;
+  static length_type const cell  = base_type::cell;
+
+public:
+  /// Factor BATCH matrices of LENGTH x LENGTH.
+  Lud_bank(length_type batch, length_type length)
+    VSIP_THROW((std::bad_alloc))
+    : base_type(batch, length, length),
+      piv_(this->groups_ * length * lanes)
+  {}
+
+  length_type length() const VSIP_NOTHROW { return this->rows_;}
+
+  /// Factor A(p, :, :) for each problem p.  Returns false if any of
+  /// the matrices is singular.
+  template <typename Block>
+  bool decompose(vsip::Tensor<T, Block> a) VSIP_NOTHROW
+  {
+    assert(a.size(0) == this->batch_);
+    assert(a.size(1) == length() && a.size(2) == length());
+    typename base_type::template Ext<Block>::type ext(a.block(),
+						      vsip::impl::SYNC_IN);
+    Args args = { this, base_type::operand(ext), Operand() };
+    return this->for_each_group(decompose_group, &args);
+  }
+
+  /// Solve op(A(p, :, :)) X(p, :, :) = B(p, :, :) for each problem p.
+  template <vsip::mat_op_type tr,
+	    typename          Block0,
+	    typename          Block1>
+  bool solve(vsip::const_Tensor<T, Block0> b, vsip::Tensor<T, Block1> x)
+    VSIP_NOTHROW
+  {
+    assert(b.size(0) == this->batch_ && b.size(1) == length());
+    assert(x.size(0) == b.size(0) && x.size(1) == b.size(1) &&
+	   x.size(2) == b.size(2));
+    typename base_type::template Ext<Block0>::type ext_b(b.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block1>::type ext_x(x.block(),
+							 vsip::impl::SYNC_OUT);
+    Args args = { this, base_type::operand(ext_b), base_type::operand(ext_x) };
+    return this->for_each_group(solve_group<tr>, &args);
+  }
+
+private:
+  struct Args
+  {
+    Lud_bank* self;
+    Operand   in;
+    Operand   out;
+  };
+
+  static bool decompose_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Lud_bank* self = args->self;
+    length_type const n = self->length();
+    scalar_type* a = self->group(g);
+    index_type* piv = &self->piv_[g * n * lanes];
+    bool ok = true;
+
+    self->load(args->in, g, a, false);
+    for (index_type k = 0; k < n; ++k)
+    {
+      // Pivot each problem on the largest element of column k.
+      for (index_type l = 0; l < lanes; ++l)
+      {
+	index_type  p   = k;
+	scalar_type mag = traits::abs1(a + (k * n + k) * cell, lanes, l);
+	for (index_type i = k + 1; i < n; ++i)
+	{
+	  scalar_type m = traits::abs1(a + (i * n + k) * cell, lanes, l);
+	  if (m > mag) { p = i; mag = m;}
+	}
+	piv[k * lanes + l] = p;
+	if (mag == scalar_type()) ok = false;
+	if (p != k)
+	  for (index_type j = 0; j < n; ++j)
+	    traits::swap(a + (k * n + j) * cell, a + (p * n + j) * cell,
+			 lanes, l);
+      }
+
+      scalar_type r[cell];
+      traits::template recip<lanes, false>(r, a + (k * n + k) * cell);
+      for (index_type i = k + 1; i < n; ++i)
+      {
+	scalar_type* aik = a + (i * n + k) * cell;
+	traits::template mul<lanes, false>(aik, r);
+	for (index_type j = k + 1; j < n; ++j)
+	  traits::template msc<lanes, false>(a + (i * n + j) * cell, aik,
+					     a + (k * n + j) * cell);
+      }
+    }
+    return ok;
+  }
+
+  template <vsip::mat_op_type tr>
+  static bool solve_group(void* arg, index_type g)
+  {
+    bool const conj = tr == vsip::mat_herm;
+    Args* args = static_cast<Args*>(arg);
+    Lud_bank* self = args->self;
+    length_type const n = self->length();
+    length_type const m = args->in.cols;
+    scalar_type const* a = self->group(g);
+    index_type const* piv = &self->piv_[g * n * lanes];
+
+    typename base_type::array_type buf(n * m * cell);
+    scalar_type* w = &buf[0];
+    scalar_type r[cell];
+    self->load(args->in, g, w, false);
+
+    if (tr == vsip::mat_ntrans)
+    {
+      // A = P^T L U: apply P, then solve L and U.
+      for (index_type k = 0; k < n; ++k)
+	permute(w, k, piv, m);
+      for (index_type k = 0; k < n; ++k)
+	for (index_type i = k + 1; i < n; ++i)
+	  for (index_type j = 0; j < m; ++j)
+	    traits::template msc<lanes, false>(w + (i * m + j) * cell,
+					       a + (i * n + k) * cell,
+					       w + (k * m + j) * cell);
+      for (index_type k = n; k-- > 0; )
+      {
+	traits::template recip<lanes, false>(r, a + (k * n + k) * cell);
+	for (index_type j = 0; j < m; ++j)
+	  traits::template mul<lanes, false>(w + (k * m + j) * cell, r);
+	for (index_type i = 0; i < k; ++i)
+	  for (index_type j = 0; j < m; ++j)
+	    traits::template msc<lanes, false>(w + (i * m + j) * cell,
+					       a + (i * n + k) * cell,
+					       w + (k * m + j) * cell);
+      }
+    }
+    else
+    {
+      // op(A) = op(U) op(L) P: solve op(U) and op(L), then apply P^T.
+      for (index_type k = 0; k < n; ++k)
+      {
+	traits::template recip<lanes, conj>(r, a + (k * n + k) * cell);
+	for (index_type j = 0; j < m; ++j)
+	  traits::template mul<lanes, false>(w + (k * m + j) * cell, r);
+	for (index_type i = k + 1; i < n; ++i)
+	  for (index_type j = 0; j < m; ++j)
+	    traits::template msc<lanes, conj>(w + (i * m + j) * cell,
+					      a + (k * n + i) * cell,
+					      w + (k * m + j) * cell);
+      }
+      for (index_type k = n; k-- > 0; )
+	for (index_type i = 0; i < k; ++i)
+	  for (index_type j = 0; j < m; ++j)
+	    traits::template msc<lanes, conj>(w + (i * m + j) * cell,
+					      a + (k * n + i) * cell,
+					      w + (k * m + j) * cell);
+      for (index_type k = n; k-- > 0; )
+	permute(w, k, piv, m);
+    }
+
+    self->store(w, g, args->out);
+    return true;
+  }
+
+  // Swap row K of W, of M cells, with the pivot row of each problem.
+  static void permute(scalar_type* w, index_type k, index_type const* piv,
+		      length_type m)
+  {
+    for (index_type l = 0; l < lanes; ++l)
+      if (piv[k * lanes + l] != k)
+	for (index_type j = 0; j < m; ++j)
+	  traits::swap(w + (k * m + j) * cell,
+		       w + (piv[k * lanes + l] * m + j) * cell, lanes, l);
+  }
+
+  std::vector<index_type> piv_;  // pivot rows, lane-interleaved
+};
+
+
+
+/// Chold_bank factors a batch of Hermitian positive definite matrices,
+/// A(p, :, :) for each problem p of a tensor A, and solves linear
+/// systems with them.
+///
+/// Each problem is factored and solved as by a vsip::chold<T>; only
+/// the triangle of A selected by UPLO is read.  Problems are processed
+/// as by Lud_bank.
+template <typename T = vsip::scalar_f>
+class Chold_bank : public impl::Solver_bank_base<T>
+{
+  typedef impl::Solver_bank_base<T>      base_type;
+  typedef typename base_type::traits      traits;
+  typedef typename base_type::scalar_type scalar_type;
+  typedef typename base_type::Operand     Operand;
+  typedef vsip::length_type length_type;
+  typedef vsip::index_type  index_type;
+
+  static length_type const lanes = base_type::lanes;
+  static length_type const cell  = base_type::cell;
+
+public:
+  /// Factor BATCH matrices of LENGTH x LENGTH.
+  Chold_bank(vsip::mat_uplo uplo, length_type batch, length_type length)
+    VSIP_THROW((std::bad_alloc))
+    : base_type(batch, length, length),
+      uplo_(uplo)
+  {}
+
+  length_type length() const VSIP_NOTHROW { return this->rows_;}
+  vsip::mat_uplo uplo() const VSIP_NOTHROW { return uplo_;}
+
+  /// Factor A(p, :, :) for each problem p.  Returns false if any of
+  /// the matrices is not positive definite.
+  template <typename Block>
+  bool decompose(vsip::Tensor<T, Block> a) VSIP_NOTHROW
+  {
+    assert(a.size(0) == this->batch_);
+    assert(a.size(1) == length() && a.size(2) == length());
+    typename base_type::template Ext<Block>::type ext(a.block(),
+						      vsip::impl::SYNC_IN);
+    Args args = { this, base_type::operand(ext), Operand() };
+    return this->for_each_group(decompose_group, &args);
+  }
+
+  /// Solve A(p, :, :) X(p, :, :) = B(p, :, :) for each problem p.
+  template <typename Block0,
+	    typename Block1>
+  bool solve(vsip::const_Tensor<T, Block0> b, vsip::Tensor<T, Block1> x)
+    VSIP_NOTHROW
+  {
+    assert(b.size(0) == this->batch_ && b.size(1) == length());
+    assert(x.size(0) == b.size(0) && x.size(1) == b.size(1) &&
+	   x.size(2) == b.size(2));
+    typename base_type::template Ext<Block0>::type ext_b(b.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block1>::type ext_x(x.block(),
+							 vsip::impl::SYNC_OUT);
+    Args args = { this, base_type::operand(ext_b), base_type::operand(ext_x) };
+    return this->for_each_group(solve_group, &args);
+  }
+
+private:
+  struct Args
+  {
+    Chold_bank* self;
+    Operand     in;
+    Operand     out;
+  };
+
+  // Factor A = L L^H, with L in the lower triangle.  An upper
+  // triangle is read transposed, since A = U^H U with U = L^H.
+  static bool decompose_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Chold_bank* self = args->self;
+    length_type const n = self->length();
+    scalar_type* a = self->group(g);
+    bool ok = true;
+
+    self->load(args->in, g, a, self->uplo_ == vsip::upper);
+    for (index_type k = 0; k < n; ++k)
+    {
+      scalar_type* akk = a + (k * n + k) * cell;
+      scalar_type r[lanes];
+      for (index_type l = 0; l < lanes; ++l)
+      {
+	scalar_type d = vsip::impl::fn::impl_real(traits::get(akk, lanes, l));
+	if (!(d > scalar_type())) ok = false;
+	d = std::sqrt(d);
+	traits::put(akk, lanes, l, T(d));
+	r[l] = scalar_type(1) / d;
+      }
+      for (index_type i = k + 1; i < n; ++i)
+	traits::template scale<lanes>(a + (i * n + k) * cell, r);
+      for (index_type j = k + 1; j < n; ++j)
+	for (index_type i = j; i < n; ++i)
+	  traits::template msc<lanes, true>(a + (i * n + j) * cell,
+					    a + (j * n + k) * cell,
+					    a + (i * n + k) * cell);
+    }
+    return ok;
+  }
+
+  static bool solve_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Chold_bank* self = args->self;
+    length_type const n = self->length();
+    length_type const m = args->in.cols;
+    scalar_type const* a = self->group(g);
+
+    typename base_type::array_type buf(n * m * cell);
+    scalar_type* w = &buf[0];
+    scalar_type r[lanes];
+    self->load(args->in, g, w, false);
+
+    // Solve L Y = B, then L^H X = Y.
+    for (index_type k = 0; k < n; ++k)
+    {
+      for (index_type l = 0; l < lanes; ++l)
+	r[l] = scalar_type(1) / a[(k * n + k) * cell + l];
+      for (index_type j = 0; j < m; ++j)
+	traits::template scale<lanes>(w + (k * m + j) * cell, r);
+      for (index_type i = k + 1; i < n; ++i)
+	for (index_type j = 0; j < m; ++j)
+	  traits::template msc<lanes, false>(w + (i * m + j) * cell,
+					     a + (i * n + k) * cell,
+					     w + (k * m + j) * cell);
+    }
+    for (index_type k = n; k-- > 0; )
+    {
+      for (index_type l = 0; l < lanes; ++l)
+	r[l] = scalar_type(1) / a[(k * n + k) * cell + l];
+      for (index_type j = 0; j < m; ++j)
+	traits::template scale<lanes>(w + (k * m + j) * cell, r);
+      for (index_type i = 0; i < k; ++i)
+	for (index_type j = 0; j < m; ++j)
+	  traits::template msc<lanes, true>(w + (i * m + j) * cell,
+					    a + (k * n + i) * cell,
+					    w + (k * m + j) * cell);
+    }
+
+    self->store(w, g, args->out);
+    return true;
+  }
+
+  vsip::mat_uplo uplo_;
+};
+
+
+
+/// Qrd_bank computes the QR decompositions of a batch of matrices,
+/// A(p, :, :) for each problem p of a tensor A of ROWS x COLS
+/// matrices, with ROWS >= COLS, and solves systems with them.
+///
+/// Each problem is factored with Householder reflections, which are
+/// kept, so that products with either Q or its first COLS columns can
+/// be formed, as by a vsip::qrd<T> with qrd_saveq1 or qrd_saveq.
+/// Problems are processed as by Lud_bank.
+template <typename T = vsip::scalar_f>
+class Qrd_bank : public impl::Solver_bank_base<T>
+{
+  typedef impl::Solver_bank_base<T>      base_type;
+  typedef typename base_type::traits      traits;
+  typedef typename base_type::scalar_type scalar_type;
+  typedef typename base_type::Operand     Operand;
+  typedef vsip::length_type length_type;
+  typedef vsip::index_type  index_type;
+
+  static length_type const lanes = base_type::lanes;
+  static length_type const cell  = base_type::cell;
+
+public:
+  /// Factor BATCH matrices of ROWS x COLS.
+  Qrd_bank(length_type batch, length_type rows, length_type cols)
+    VSIP_THROW((std::bad_alloc))
+    : base_type(batch, rows, cols),
+      tau_(this->groups_ * cols * cell)
+  {
+    assert(rows >= cols);
+  }
+
+  length_type rows() const VSIP_NOTHROW { return this->rows_;}
+  length_type columns() const VSIP_NOTHROW { return this->cols_;}
+
+  /// Factor A(p, :, :) for each problem p.
+  template <typename Block>
+  bool decompose(vsip::Tensor<T, Block> a) VSIP_NOTHROW
+  {
+    assert(a.size(0) == this->batch_);
+    assert(a.size(1) == rows() && a.size(2) == columns());
+    typename base_type::template Ext<Block>::type ext(a.block(),
+						      vsip::impl::SYNC_IN);
+    Args args = { this, base_type::operand(ext), Operand(), T() };
+    return this->for_each_group(decompose_group, &args);
+  }
+
+  /// X(p, :, :) = op(Q) B(p, :, :) for each problem p.
+  ///
+  /// For mat_ntrans, B has COLS or ROWS rows; for mat_trans and
+  /// mat_herm, B has ROWS rows, and X receives the first COLS or ROWS
+  /// rows of the product.
+  template <vsip::mat_op_type tr,
+	    typename          Block0,
+	    typename          Block1>
+  bool prodq(vsip::const_Tensor<T, Block0> b, vsip::Tensor<T, Block1> x)
+    VSIP_NOTHROW
+  {
+    assert(tr != vsip::mat_trans || !vsip::impl::Is_complex<T>::value);
+    assert(b.size(0) == this->batch_ && x.size(0) == b.size(0));
+    assert(b.size(2) == x.size(2));
+    assert(tr == vsip::mat_ntrans ? x.size(1) == rows()
+                                  : b.size(1) == rows());
+    typename base_type::template Ext<Block0>::type ext_b(b.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block1>::type ext_x(x.block(),
+							 vsip::impl::SYNC_OUT);
+    Args args = { this, base_type::operand(ext_b), base_type::operand(ext_x),
+		  T() };
+    return this->for_each_group(prodq_group<tr>, &args);
+  }
+
+  /// Solve op(R) X(p, :, :) = ALPHA B(p, :, :) for each problem p.
+  template <vsip::mat_op_type tr,
+	    typename          Block0,
+	    typename          Block1>
+  bool rsol(vsip::const_Tensor<T, Block0> b, T const alpha,
+	    vsip::Tensor<T, Block1> x)
+    VSIP_NOTHROW
+  {
+    assert(tr != vsip::mat_trans || !vsip::impl::Is_complex<T>::value);
+    assert(b.size(0) == this->batch_ && b.size(1) == columns());
+    assert(x.size(0) == b.size(0) && x.size(1) == b.size(1) &&
+	   x.size(2) == b.size(2));
+    typename base_type::template Ext<Block0>::type ext_b(b.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block1>::type ext_x(x.block(),
+							 vsip::impl::SYNC_OUT);
+    Args args = { this, base_type::operand(ext_b), base_type::operand(ext_x),
+		  alpha };
+    return this->for_each_group(rsol_group<tr>, &args);
+  }
+
+  /// Solve A^H A X(p, :, :) = B(p, :, :) for each problem p.
+  template <typename Block0,
+	    typename Block1>
+  bool covsol(vsip::const_Tensor<T, Block0> b, vsip::Tensor<T, Block1> x)
+    VSIP_NOTHROW
+  {
+    assert(b.size(0) == this->batch_ && b.size(1) == columns());
+    assert(x.size(0) == b.size(0) && x.size(1) == b.size(1) &&
+	   x.size(2) == b.size(2));
+    typename base_type::template Ext<Block0>::type ext_b(b.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block1>::type ext_x(x.block(),
+							 vsip::impl::SYNC_OUT);
+    Args args = { this, base_type::operand(ext_b), base_type::operand(ext_x),
+		  T() };
+    return this->for_each_group(covsol_group, &args);
+  }
+
+  /// Find X(p, :, :) minimizing || A X(p, :, :) - B(p, :, :) || for
+  /// each problem p.
+  template <typename Block0,
+	    typename Block1>
+  bool lsqsol(vsip::const_Tensor<T, Block0> b, vsip::Tensor<T, Block1> x)
+    VSIP_NOTHROW
+  {
+    assert(b.size(0) == this->batch_ && b.size(1) == rows());
+    assert(x.size(0) == b.size(0) && x.size(1) == columns() &&
+	   x.size(2) == b.size(2));
+    typename base_type::template Ext<Block0>::type ext_b(b.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block1>::type ext_x(x.block(),
+							 vsip::impl::SYNC_OUT);
+    Args args = { this, base_type::operand(ext_b), base_type::operand(ext_x),
+		  T() };
+    return this->for_each_group(lsqsol_group, &args);
+  }
+
+private:
+  struct Args
+  {
+    Qrd_bank* self;
+    Operand   in;
+    Operand   out;
+    T         alpha;
+  };
+
+  // Factor A = H_0 H_1 ... H_{n-1} R, with H_k = I - tau_k v_k v_k^H.
+  // v_k(k) = 1 is implicit, v_k(k + 1:m) is kept below the diagonal of
+  // column k, as by LAPACK's geqrf.
+  static bool decompose_group(void* arg, index_type g)
+  {
+    using vsip::impl::fn::impl_real;
+    using vsip::impl::fn::impl_imag;
+    using vsip::impl::fn::magsq;
+
+    Args* args = static_cast<Args*>(arg);
+    Qrd_bank* self = args->self;
+    length_type const m = self->rows();
+    length_type const n = self->columns();
+    scalar_type* a = self->group(g);
+    scalar_type* tau = &self->tau_[g * n * cell];
+
+    self->load(args->in, g, a, false);
+    for (index_type k = 0; k < n; ++k)
+    {
+      scalar_type* akk = a + (k * n + k) * cell;
+      scalar_type* tk  = tau + k * cell;
+      scalar_type norm[lanes];
+      scalar_type s[cell];
+      for (index_type l = 0; l < lanes; ++l)
+	norm[l] = scalar_type();
+      for (index_type i = k + 1; i < m; ++i)
+	traits::template norm2<lanes>(norm, a + (i * n + k) * cell);
+
+      // Per problem, choose beta and tau such that H_k^H x = beta e_0
+      // for column x of A, and the scaling s of v_k.
+      for (index_type l = 0; l < lanes; ++l)
+      {
+	T alpha = traits::get(akk, lanes, l);
+	if (norm[l] == scalar_type() && impl_imag(alpha) == scalar_type())
+	{
+	  traits::put(tk, lanes, l, T());
+	  traits::put(s, lanes, l, T());
+	  continue;
+	}
+	scalar_type beta = std::sqrt(magsq(alpha) + norm[l]);
+	if (impl_real(alpha) >= scalar_type())
+	  beta = -beta;
+	traits::put(tk,  lanes, l, (T(beta) - alpha) / T(beta));
+	traits::put(s,   lanes, l, T(1) / (alpha - T(beta)));
+	traits::put(akk, lanes, l, T(beta));
+      }
+      for (index_type i = k + 1; i < m; ++i)
+	traits::template mul<lanes, false>(a + (i * n + k) * cell, s);
+
+      // Apply H_k^H to the remaining columns.
+      for (index_type j = k + 1; j < n; ++j)
+      {
+	scalar_type w[cell];
+	std::copy(a + (k * n + j) * cell, a + (k * n + j + 1) * cell, w);
+	for (index_type i = k + 1; i < m; ++i)
+	  traits::template mac<lanes, true>(w, a + (i * n + k) * cell,
+					    a + (i * n + j) * cell);
+	traits::template mul<lanes, true>(w, tk);
+	apply(a + j * cell, n, a + k * cell, n, k, m, w);
+      }
+    }
+    return true;
+  }
+
+  // Subtract v_k W from column J of B, for the reflector v_k kept in
+  // column K of A: BJ points to B(0, J) and AK to A(0, K), with rows of
+  // NB and NA cells.
+  static void apply(scalar_type* bj, length_type nb,
+		    scalar_type const* ak, length_type na,
+		    index_type k, length_type m, scalar_type const* w)
+  {
+    scalar_type* bkj = bj + k * nb * cell;
+    for (index_type l = 0; l < cell; ++l)
+      bkj[l] -= w[l];
+    for (index_type i = k + 1; i < m; ++i)
+      traits::template msc<lanes, false>(bj + i * nb * cell,
+					 ak + i * na * cell, w);
+  }
+
+  // B = H_k^H B if Conj, H_k B otherwise, for B of M rows and P
+  // columns of cells.
+  template <bool Conj>
+  void reflect(scalar_type* b, length_type p, index_type k, index_type g)
+    const
+  {
+    length_type const m = rows();
+    length_type const n = columns();
+    scalar_type const* a = this->group(g);
+    scalar_type const* tk = &tau_[(g * n + k) * cell];
+
+    for (index_type j = 0; j < p; ++j)
+    {
+      scalar_type w[cell];
+      std::copy(b + (k * p + j) * cell, b + (k * p + j + 1) * cell, w);
+      for (index_type i = k + 1; i < m; ++i)
+	traits::template mac<lanes, true>(w, a + (i * n + k) * cell,
+					  b + (i * p + j) * cell);
+      traits::template mul<lanes, Conj>(w, tk);
+      apply(b + j * cell, p, a + k * cell, n, k, m, w);
+    }
+  }
+
+  // Solve op(R) X = W in place, for W of N rows and P columns of cells.
+  template <bool Herm>
+  void rsolve(scalar_type* w, length_type p, index_type g) const
+  {
+    length_type const n = columns();
+    scalar_type const* a = this->group(g);
+    scalar_type r[cell];
+
+    if (!Herm)
+    {
+      for (index_type k = n; k-- > 0; )
+      {
+	traits::template recip<lanes, false>(r, a + (k * n + k) * cell);
+	for (index_type j = 0; j < p; ++j)
+	  traits::template mul<lanes, false>(w + (k * p + j) * cell, r);
+	for (index_type i = 0; i < k; ++i)
+	  for (index_type j = 0; j < p; ++j)
+	    traits::template msc<lanes, false>(w + (i * p + j) * cell,
+					       a + (i * n + k) * cell,
+					       w + (k * p + j) * cell);
+      }
+    }
+    else
+    {
+      for (index_type k = 0; k < n; ++k)
+      {
+	traits::template recip<lanes, true>(r, a + (k * n + k) * cell);
+	for (index_type j = 0; j < p; ++j)
+	  traits::template mul<lanes, false>(w + (k * p + j) * cell, r);
+	for (index_type i = k + 1; i < n; ++i)
+	  for (index_type j = 0; j < p; ++j)
+	    traits::template msc<lanes, true>(w + (i * p + j) * cell,
+					      a + (k * n + i) * cell,
+					      w + (k * p + j) * cell);
+      }
+    }
+  }
+
+  template <vsip::mat_op_type tr>
+  static bool prodq_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Qrd_bank* self = args->self;
+    length_type const m = self->rows();
+    length_type const n = self->columns();
+    length_type const p = args->in.cols;
+
+    // Q = H_0 H_1 ... H_{n-1}.  Rows of B past its end are zero.
+    typename base_type::array_type buf(m * p * cell);
+    scalar_type* w = &buf[0];
+    self->load(args->in, g, w, false);
+    if (tr == vsip::mat_ntrans)
+      for (index_type k = n; k-- > 0; )
+	self->template reflect<false>(w, p, k, g);
+    else
+      for (index_type k = 0; k < n; ++k)
+	self->template reflect<true>(w, p, k, g);
+
+    self->store(w, g, args->out);
+    return true;
+  }
+
+  template <vsip::mat_op_type tr>
+  static bool rsol_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Qrd_bank* self = args->self;
+    length_type const n = self->columns();
+    length_type const p = args->in.cols;
+
+    typename base_type::array_type buf(n * p * cell);
+    scalar_type* w = &buf[0];
+    scalar_type alpha[cell];
+    self->load(args->in, g, w, false);
+    for (index_type l = 0; l < lanes; ++l)
+      traits::put(alpha, lanes, l, args->alpha);
+    for (index_type i = 0; i < n * p; ++i)
+      traits::template mul<lanes, false>(w + i * cell, alpha);
+    self->template rsolve<tr != vsip::mat_ntrans>(w, p, g);
+
+    self->store(w, g, args->out);
+    return true;
+  }
+
+  static bool covsol_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Qrd_bank* self = args->self;
+    length_type const n = self->columns();
+    length_type const p = args->in.cols;
+
+    // A^H A = R^H R.
+    typename base_type::array_type buf(n * p * cell);
+    scalar_type* w = &buf[0];
+    self->load(args->in, g, w, false);
+    self->template rsolve<true>(w, p, g);
+    self->template rsolve<false>(w, p, g);
+
+    self->store(w, g, args->out);
+    return true;
+  }
+
+  static bool lsqsol_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Qrd_bank* self = args->self;
+    length_type const m = self->rows();
+    length_type const n = self->columns();
+    length_type const p = args->in.cols;
+
+    // X = R^-1 (Q^H B)(0:n-1, :).
+    typename base_type::array_type buf(m * p * cell);
+    scalar_type* w = &buf[0];
+    self->load(args->in, g, w, false);
+    for (index_type k = 0; k < n; ++k)
+      self->template reflect<true>(w, p, k, g);
+    self->template rsolve<false>(w, p, g);
+
+    self->store(w, g, args->out);
+    return true;
+  }
+
+  typename base_type::array_type tau_;  // reflector scales, lane-interleaved
+};
+
+
+
+namespace impl
+{
+
+/// Levinson recursions for a batch of Toeplitz problems, one per row
+/// of a matrix.  The workspace of each group of problems holds ROWS
+/// vectors of N cells.
+template <typename T>
+class Toeplitz_bank : public Solver_bank_base<T>
+{
+  typedef Solver_bank_base<T>            base_type;
+  typedef typename base_type::traits      traits;
+  typedef typename base_type::scalar_type scalar_type;
+  typedef typename base_type::Operand     Operand;
+  typedef vsip::length_type length_type;
+  typedef vsip::index_type  index_type;
+  typedef vsip::stride_type stride_type;
+
+  static length_type const lanes = base_type::lanes;
+  static length_type const cell  = base_type::cell;
+
+public:
+  Toeplitz_bank(length_type batch, length_type rows, length_type n)
+    VSIP_THROW((std::bad_alloc))
+    : base_type(batch, rows, n)
+  {}
+
+  /// Solve toeplitz(T(p, :)) X(p, :) = B(p, :) for each row p.
+  template <typename Block0,
+	    typename Block1,
+	    typename Block2>
+  bool solve(vsip::const_Matrix<T, Block0> t,
+	     vsip::const_Matrix<T, Block1> b,
+	     vsip::Matrix<T, Block2>       x)
+  {
+    typename base_type::template Ext<Block0>::type ext_t(t.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block1>::type ext_b(b.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block2>::type ext_x(x.block(),
+							 vsip::impl::SYNC_OUT);
+    Args args = { this,
+		  base_type::row_operand(ext_t),
+		  base_type::row_operand(ext_b),
+		  base_type::row_operand(ext_x),
+		  0, 0, 0 };
+    return this->for_each_group(solve_group, &args);
+  }
+
+  /// Solve toeplitz(T) X(p, :) = B(p, :) for each row p.
+  template <typename Block0,
+	    typename Block1,
+	    typename Block2>
+  bool solve(vsip::const_Vector<T, Block0> t,
+	     vsip::const_Matrix<T, Block1> b,
+	     vsip::Matrix<T, Block2>       x)
+  {
+    Shared shared;
+    if (!shared.init(t))
+      return false;
+
+    typename base_type::template Ext<Block1>::type ext_b(b.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block2>::type ext_x(x.block(),
+							 vsip::impl::SYNC_OUT);
+    Args args = { this,
+		  Operand(),
+		  base_type::row_operand(ext_b),
+		  base_type::row_operand(ext_x),
+		  0, 0, &shared };
+    return this->for_each_group(shared_group, &args);
+  }
+
+  /// Find the predictors A(p, :) and errors E(p) of each row p of
+  /// autocorrelations R, with the Levinson-Durbin recursion.
+  template <typename Block0,
+	    typename Block1,
+	    typename Block2>
+  bool levinson(vsip::const_Matrix<T, Block0>     r,
+		vsip::Matrix<T, Block1>           a,
+		vsip::Vector<scalar_type, Block2> e)
+  { return predict(r, a, e, levinson_group);}
+
+  /// Likewise, with the split Levinson recursion, for real T.
+  template <typename Block0,
+	    typename Block1,
+	    typename Block2>
+  bool split_levinson(vsip::const_Matrix<T, Block0>     r,
+		      vsip::Matrix<T, Block1>           a,
+		      vsip::Vector<scalar_type, Block2> e)
+  { return predict(r, a, e, split_group);}
+
+private:
+  template <typename Block0,
+	    typename Block1,
+	    typename Block2>
+  bool predict(vsip::const_Matrix<T, Block0>     r,
+	       vsip::Matrix<T, Block1>           a,
+	       vsip::Vector<scalar_type, Block2> e,
+	       typename base_type::group_func    func)
+  {
+    typename base_type::template Ext<Block0>::type ext_r(r.block(),
+							 vsip::impl::SYNC_IN);
+    typename base_type::template Ext<Block1>::type ext_a(a.block(),
+							 vsip::impl::SYNC_OUT);
+    vsip::impl::Ext_data<Block2> ext_e(e.block(), vsip::impl::SYNC_OUT);
+    Args args = { this,
+		  base_type::row_operand(ext_r),
+		  Operand(),
+		  base_type::row_operand(ext_a),
+		  ext_e.data(), ext_e.stride(0), 0 };
+    return this->for_each_group(func, &args);
+  }
+
+  // The Levinson recursion of a system shared by all problems.  Step k
+  // of the solution needs the conjugate of the k values of y after
+  // step k - 1, which are kept in y[k (k - 1) / 2 ...].
+  struct Shared
+  {
+    template <typename Block>
+    bool init(vsip::const_Vector<T, Block> t)
+    {
+      using vsip::impl::fn::impl_conj;
+      using vsip::impl::fn::impl_real;
+      using vsip::impl::fn::magsq;
+
+      length_type const n = t.size();
+      scalar_type const scale = impl_real(t.get(0));
+      std::vector<T> v(n);
+
+      rc.resize(n);
+      rs.resize(n);
+      y.resize(n * (n - 1) / 2);
+      for (index_type j = 0; j + 1 < n; ++j)
+	rc[j] = -impl_conj(t.get(j + 1));
+      rs[0] = scalar_type(1) / scale;
+      if (n == 1)
+	return scale > scalar_type();
+
+      scalar_type beta  = 1;
+      T           alpha = rc[0] / scale;
+      v[0] = alpha;
+      for (index_type k = 1; k < n; ++k)
+      {
+	beta *= scalar_type(1) - magsq(alpha);
+	if (!(beta > scalar_type()))
+	  return false;
+	rs[k] = scalar_type(1) / (scale * beta);
+	for (index_type j = 0; j < k; ++j)
+	  y[k * (k - 1) / 2 + j] = impl_conj(v[j]);
+
+	if (k < n - 1)
+	{
+	  T acc = -rc[k];
+	  for (index_type j = 0; j < k; ++j)
+	    acc -= rc[j] * v[k - 1 - j];
+	  alpha = -acc * rs[k];
+	  for (index_type i = 0; 2 * i < k; ++i)
+	  {
+	    index_type j = k - 1 - i;
+	    T vi = v[i];
+	    T vj = v[j];
+	    v[i] += alpha * impl_conj(vj);
+	    if (i != j)
+	      v[j] += alpha * impl_conj(vi);
+	  }
+	  v[k] = alpha;
+	}
+      }
+      return true;
+    }
+
+    std::vector<T>           rc;    // -conj(t(j + 1))
+    std::vector<scalar_type> rs;    // 1 / (t(0) beta) after step k
+    std::vector<T>           y;
+  };
+
+  struct Args
+  {
+    Toeplitz_bank* self;
+    Operand        in0;
+    Operand        in1;
+    Operand        out;
+    scalar_type*   err;
+    stride_type    err_stride;
+    Shared const*  shared;
+  };
+
+  // Rows: 0 for T, 1 for X and 2 for Y.  This is the recursion of
+  // vsip::toepsol, with the problems of a group in lanes.
+  static bool solve_group(void* arg, index_type g)
+  {
+    using vsip::impl::fn::impl_conj;
+
+    Args* args = static_cast<Args*>(arg);
+    Toeplitz_bank* self = args->self;
+    length_type const n = self->cols_;
+    scalar_type* t = self->group(g);
+    scalar_type* x = t + n * cell;
+    scalar_type* y = x + n * cell;
+    scalar_type const* r = t + cell;
+    bool ok = true;
+
+    self->load(args->in0, g, t, false);
+    self->load(args->in1, g, x, false);
+
+    scalar_type beta[lanes];
+    scalar_type rs[lanes];
+    scalar_type alpha[cell];
+    for (index_type l = 0; l < lanes; ++l)
+    {
+      if (!(t[l] > scalar_type())) ok = false;
+      beta[l] = scalar_type(1);
+      rs[l]   = scalar_type(1) / t[l];
+      if (n > 1)
+	traits::put(alpha, lanes, l,
+		    -impl_conj(traits::get(r, lanes, l)) * rs[l]);
+    }
+    traits::template scale<lanes>(x, rs);
+    if (n > 1)
+      std::copy(alpha, alpha + cell, y);
+
+    for (index_type k = 1; k < n; ++k)
+    {
+      scalar_type m2[lanes];
+      for (index_type l = 0; l < lanes; ++l)
+	m2[l] = scalar_type();
+      traits::template norm2<lanes>(m2, alpha);
+      for (index_type l = 0; l < lanes; ++l)
+      {
+	beta[l] *= scalar_type(1) - m2[l];
+	if (!(beta[l] > scalar_type())) ok = false;
+	rs[l] = scalar_type(1) / (t[l] * beta[l]);
+      }
+
+      // mu = (b(k) - sum conj(r(j)) x(k - 1 - j)) / (t(0) beta)
+      scalar_type mu[cell];
+      std::copy(x + k * cell, x + (k + 1) * cell, mu);
+      for (index_type j = 0; j < k; ++j)
+	traits::template msc<lanes, true>(mu, r + j * cell,
+					  x + (k - 1 - j) * cell);
+      traits::template scale<lanes>(mu, rs);
+      for (index_type j = 0; j < k; ++j)
+	traits::template mac<lanes, true>(x + j * cell,
+					  y + (k - 1 - j) * cell, mu);
+      std::copy(mu, mu + cell, x + k * cell);
+
+      if (k < n - 1)
+      {
+	scalar_type acc[cell];
+	for (index_type l = 0; l < cell; ++l)
+	  acc[l] = scalar_type();
+	for (index_type j = 0; j < k; ++j)
+	  traits::template mac<lanes, true>(acc, r + j * cell,
+					    y + (k - 1 - j) * cell);
+	for (index_type l = 0; l < lanes; ++l)
+	  traits::put(alpha, lanes, l,
+		      -(traits::get(acc, lanes, l) +
+			impl_conj(traits::get(r + k * cell, lanes, l))) * rs[l]);
+
+	// y(j) += alpha conj(y(k - 1 - j)), for each pair of ends.
+	for (index_type i = 0; 2 * i < k; ++i)
+	{
+	  index_type j = k - 1 - i;
+	  scalar_type yi[cell];
+	  scalar_type yj[cell];
+	  std::copy(y + i * cell, y + (i + 1) * cell, yi);
+	  std::copy(y + j * cell, y + (j + 1) * cell, yj);
+	  traits::template mac<lanes, true>(y + i * cell, yj, alpha);
+	  if (i != j)
+	    traits::template mac<lanes, true>(y + j * cell, yi, alpha);
+	}
+	std::copy(alpha, alpha + cell, y + k * cell);
+      }
+    }
+
+    self->store(x, g, args->out);
+    return ok;
+  }
+
+  // Rows: 0 for X.  The recursion for y is shared.
+  static bool shared_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Toeplitz_bank* self = args->self;
+    Shared const& sh = *args->shared;
+    length_type const n = self->cols_;
+    scalar_type* x = self->group(g);
+
+    self->load(args->in1, g, x, false);
+
+    scalar_type rs[lanes];
+    std::fill(rs, rs + lanes, sh.rs[0]);
+    traits::template scale<lanes>(x, rs);
+    for (index_type k = 1; k < n; ++k)
+    {
+      T const* y = &sh.y[k * (k - 1) / 2];
+      scalar_type mu[cell];
+      std::copy(x + k * cell, x + (k + 1) * cell, mu);
+      for (index_type j = 0; j < k; ++j)
+	traits::template smac<lanes>(mu, sh.rc[j], x + (k - 1 - j) * cell);
+      std::fill(rs, rs + lanes, sh.rs[k]);
+      traits::template scale<lanes>(mu, rs);
+      for (index_type j = 0; j < k; ++j)
+	traits::template smac<lanes>(x + j * cell, y[k - 1 - j], mu);
+      std::copy(mu, mu + cell, x + k * cell);
+    }
+
+    self->store(x, g, args->out);
+    return true;
+  }
+
+  // Store the prediction errors E of group G.
+  static void store_err(Args const* args, index_type g, scalar_type const* e)
+  {
+    length_type const size = args->self->group_size(g);
+    for (index_type l = 0; l < size; ++l)
+      args->err[(g * lanes + l) * args->err_stride] = e[l];
+  }
+
+  // Rows: 0 for R and 1 for A.  Step k extends the predictor of order
+  // k - 1 with the reflection coefficient kappa.
+  static bool levinson_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Toeplitz_bank* self = args->self;
+    length_type const n = self->cols_;
+    scalar_type* r = self->group(g);
+    scalar_type* a = r + n * cell;
+    bool ok = true;
+
+    self->load(args->in0, g, r, false);
+    std::fill(a, a + n * cell, scalar_type());
+    std::fill(a, a + lanes, scalar_type(1));
+
+    scalar_type e[lanes];
+    scalar_type ie[lanes];
+    for (index_type l = 0; l < lanes; ++l)
+    {
+      e[l] = r[l];
+      if (!(e[l] > scalar_type())) ok = false;
+    }
+    for (index_type k = 1; k < n; ++k)
+    {
+      // kappa = -(r(k) + sum a(j) r(k - j)) / e
+      scalar_type kappa[cell];
+      std::copy(r + k * cell, r + (k + 1) * cell, kappa);
+      for (index_type j = 1; j < k; ++j)
+	traits::template mac<lanes, false>(kappa, a + j * cell,
+					   r + (k - j) * cell);
+      for (index_type l = 0; l < lanes; ++l)
+	ie[l] = scalar_type(-1) / e[l];
+      traits::template scale<lanes>(kappa, ie);
+
+      // a(j) += kappa conj(a(k - j)), for each pair of ends.
+      for (index_type i = 1; 2 * i <= k; ++i)
+      {
+	index_type j = k - i;
+	scalar_type ai[cell];
+	scalar_type aj[cell];
+	std::copy(a + i * cell, a + (i + 1) * cell, ai);
+	std::copy(a + j * cell, a + (j + 1) * cell, aj);
+	traits::template mac<lanes, true>(a + i * cell, aj, kappa);
+	if (i != j)
+	  traits::template mac<lanes, true>(a + j * cell, ai, kappa);
+      }
+      std::copy(kappa, kappa + cell, a + k * cell);
+
+      scalar_type m2[lanes];
+      for (index_type l = 0; l < lanes; ++l)
+	m2[l] = scalar_type();
+      traits::template norm2<lanes>(m2, kappa);
+      for (index_type l = 0; l < lanes; ++l)
+      {
+	e[l] *= scalar_type(1) - m2[l];
+	if (!(e[l] > scalar_type())) ok = false;
+      }
+    }
+
+    self->store(a, g, args->out);
+    store_err(args, g, e);
+    return ok;
+  }
+
+  // Rows: 0 for R, 1 to 3 for s(k - 1), s(k) and s(k + 1), and 4 for
+  // A, of N + 1 cells each for an order N - 1 predictor.
+  //
+  // The split Levinson recursion (Delsarte and Genin) for real
+  // symmetric matrices computes the symmetric vectors
+  //
+  //   s(k + 1) = [s(k); 0] + [0; s(k)] - alpha(k) [0; s(k - 1); 0],
+  //
+  // with s(0) = [2], s(1) = [1; 1], alpha(k) = tau(k) / tau(k - 1),
+  // tau(0) = r(0) and tau(k) = r(0:k)' s(k), which need about half
+  // the multiplications of the Levinson-Durbin recursion.  With
+  // lambda(k) = 1 + kappa(k) = 2 - alpha(k) / lambda(k - 1), the
+  // predictor is
+  //
+  //   A(z) = (S(k + 1)(z) - lambda(k) z^-1 S(k)(z)) / (1 - z^-1)
+  //
+  // and the prediction error is tau(k) lambda(k).
+  static bool split_group(void* arg, index_type g)
+  {
+    Args* args = static_cast<Args*>(arg);
+    Toeplitz_bank* self = args->self;
+    length_type const m = self->cols_;
+    length_type const p = m - 2;
+    scalar_type* r    = self->group(g);
+    scalar_type* prev = r + m * cell;
+    scalar_type* cur  = prev + m * cell;
+    scalar_type* next = cur + m * cell;
+    scalar_type* a    = next + m * cell;
+    bool ok = true;
+
+    self->load(args->in0, g, r, false);
+    std::fill(prev, prev + lanes, scalar_type(2));
+    std::fill(cur, cur + 2 * lanes, scalar_type(1));
+
+    scalar_type tau_prev[lanes];
+    scalar_type lambda[lanes];
+    for (index_type l = 0; l < lanes; ++l)
+    {
+      tau_prev[l] = r[l];
+      lambda[l]   = scalar_type(1);
+      if (!(r[l] > scalar_type())) ok = false;
+    }
+
+    for (index_type k = 1; k <= p; ++k)
+    {
+      scalar_type tau[lanes];
+      scalar_type alpha[lanes];
+      for (index_type l = 0; l < lanes; ++l)
+	tau[l] = scalar_type();
+      for (index_type i = 0; 2 * i < k; ++i)
+      {
+	scalar_type const* ri = r + i * cell;
+	scalar_type const* rk = r + (k - i) * cell;
+	scalar_type const* si = cur + i * cell;
+	for (index_type l = 0; l < lanes; ++l)
+	  tau[l] += (ri[l] + rk[l]) * si[l];
+      }
+      if (k % 2 == 0)
+	for (index_type l = 0; l < lanes; ++l)
+	  tau[l] += r[k / 2 * cell + l] * cur[k / 2 * cell + l];
+
+      for (index_type l = 0; l < lanes; ++l)
+      {
+	alpha[l]    = tau[l] / tau_prev[l];
+	lambda[l]   = scalar_type(2) - alpha[l] / lambda[l];
+	tau_prev[l] = tau[l];
+	if (!(lambda[l] > scalar_type() && lambda[l] < scalar_type(2)))
+	  ok = false;
+      }
+
+      // s(k + 1)(i) = s(k)(i) + s(k)(i - 1) - alpha s(k - 1)(i - 1),
+      // for the first half, mirrored to the second.
+      for (index_type i = 0; 2 * i <= k + 1; ++i)
+      {
+	scalar_type s[lanes];
+	scalar_type const* ci = cur + i * cell;
+	for (index_type l = 0; l < lanes; ++l)
+	  s[l] = ci[l];
+	if (i > 0)
+	{
+	  scalar_type const* cj = cur  + (i - 1) * cell;
+	  scalar_type const* pj = prev + (i - 1) * cell;
+	  for (index_type l = 0; l < lanes; ++l)
+	    s[l] += cj[l] - alpha[l] * pj[l];
+	}
+	std::copy(s, s + lanes, next + i * cell);
+	std::copy(s, s + lanes, next + (k + 1 - i) * cell);
+      }
+      std::swap(prev, cur);
+      std::swap(cur, next);
+    }
+
+    // a(i) = a(i - 1) + s(p + 1)(i) - lambda s(p)(i - 1)
+    std::copy(cur, cur + lanes, a);
+    for (index_type i = 1; i <= p; ++i)
+    {
+      scalar_type s[lanes];
+      for (index_type l = 0; l < lanes; ++l)
+	s[l] = a[(i - 1) * cell + l] + cur[i * cell + l]
+	     - lambda[l] * prev[(i - 1) * cell + l];
+      std::copy(s, s + lanes, a + i * cell);
+    }
+
+    scalar_type e[lanes];
+    for (index_type l = 0; l < lanes; ++l)
+      e[l] = tau_prev[l] * lambda[l];
+
+    self->store(a, g, args->out);
+    store_err(args, g, e);
+    return ok;
+  }
+};
+
+} // namespace vsip_csl::impl
+
+
+
+/// Solve the Toeplitz systems toeplitz(T(p, :)) X(p, :) = B(p, :) for
+/// each row p, where row p of T is the first row of a real symmetric
+/// or complex Hermitian positive definite Toeplitz matrix, as for
+/// vsip::toepsol.
+///
+/// The rows are solved together, as by Lud_bank.  Returns false if
+/// any of the matrices is not positive definite.
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename Block2>
+bool
+toepsol(vsip::const_Matrix<T, Block0> t,
+	vsip::const_Matrix<T, Block1> b,
+	vsip::Matrix<T, Block2>       x)
+  VSIP_THROW((std::bad_alloc))
+{
+  assert(b.size(0) == t.size(0) && b.size(1) == t.size(1));
+  assert(x.size(0) == t.size(0) && x.size(1) == t.size(1));
+  impl::Toeplitz_bank<T> bank(t.size(0), 3, t.size(1));
+  return bank.solve(t, b, x);
+}
+
+
+
+/// Solve toeplitz(T) X(p, :) = B(p, :) for each row p of B, where T
+/// is the first row of a real symmetric or complex Hermitian positive
+/// definite Toeplitz matrix.
+///
+/// The recursion that depends only on T is run once.  Returns false,
+/// without solving, if the matrix is not positive definite.
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename Block2>
+bool
+toepsol(vsip::const_Vector<T, Block0> t,
+	vsip::const_Matrix<T, Block1> b,
+	vsip::Matrix<T, Block2>       x)
+  VSIP_THROW((std::bad_alloc))
+{
+  assert(b.size(1) == t.size());
+  assert(x.size(0) == b.size(0) && x.size(1) == b.size(1));
+  impl::Toeplitz_bank<T> bank(b.size(0), 1, b.size(1));
+  return bank.solve(t, b, x);
+}
+
+
+
+/// Find the linear predictors of order N - 1 of each row of R, a
+/// matrix of N autocorrelation lags r(0), ..., r(N - 1) per row, with
+/// the Levinson-Durbin recursion.
+///
+/// Row p of A receives a(0) = 1, a(1), ..., a(N - 1) such that
+///
+///   toeplitz(R(p, :))' A(p, :)' = [E(p), 0, ..., 0]'
+///
+/// that is, sum over j of r(i - j) a(j) = 0 for i = 1, ..., N - 1, with
+/// r(-m) = conj(r(m)), and E(p) receives the prediction error.
+/// Returns false if any of the autocorrelation matrices is not
+/// positive definite.
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename Block2>
+bool
+levinson(vsip::const_Matrix<T, Block0> r,
+	 vsip::Matrix<T, Block1>       a,
+	 vsip::Vector<typename vsip::impl::Scalar_of<T>::type, Block2> e)
+  VSIP_THROW((std::bad_alloc))
+{
+  assert(a.size(0) == r.size(0) && a.size(1) == r.size(1));
+  assert(e.size() == r.size(0));
+  impl::Toeplitz_bank<T> bank(r.size(0), 2, r.size(1));
+  return bank.levinson(r, a, e);
+}
+
+
+
+/// Find the linear predictors of the rows of R, as by levinson(), for
+/// real T, with the split Levinson recursion.
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename Block2>
+bool
+split_levinson(vsip::const_Matrix<T, Block0> r,
+	       vsip::Matrix<T, Block1>       a,
+	       vsip::Vector<T, Block2>       e)
+  VSIP_THROW((std::bad_alloc))
+{
+  VSIP_IMPL_STATIC_ASSERT(!vsip::impl::Is_complex<T>::value);
+  assert(a.size(0) == r.size(0) && a.size(1) == r.size(1));
+  assert(e.size() == r.size(0));
+  impl::Toeplitz_bank<T> bank(r.size(0), 5, r.size(1) + 1);
+  return bank.split_levinson(r, a, e);
+}
+
+} // namespace vsip_csl
+
+#endif // VSIP_CSL_SOLVER_BANK_HPP
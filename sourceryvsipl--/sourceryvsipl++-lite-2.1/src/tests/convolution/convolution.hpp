@@ -511,6 +511,12 @@ cases(bool rand)
 
     cases_conv<T, sym_even_len_odd>(size,   4,  1, rand);
     cases_conv<T, sym_even_len_odd>(size+3, 3,  2, rand);
+
+    // Kernels large enough to be applied with FFTs.
+    cases_conv<T, nonsym>(size+5,    31, 1, rand);
+    cases_conv<T, nonsym>(2*size,    64, 3, rand);
+    cases_conv<T, sym_even_len_even>(2*size, 20, 1, rand);
+    cases_conv<T, sym_even_len_odd>(2*size,  25, 2, rand);
   }
 }
 
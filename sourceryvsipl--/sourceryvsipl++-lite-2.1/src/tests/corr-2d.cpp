@@ -41,7 +41,7 @@ using namespace vsip_csl;
   Definitions
 ***********************************************************************/
 
-/// Test general 1-D correlation.
+/// Test general 2-D correlation.
 
 template <typename            T,
 	  support_region_type support>
@@ -50,7 +50,8 @@ test_corr(
   bias_type                bias,
   Domain<2> const&         M,		// reference size
   Domain<2> const&         N,		// input size
-  length_type const        n_loop = 3)
+  double                   thresh = -100,
+  length_type const        n_loop = 4)
 {
   typedef typename vsip::impl::Scalar_of<T>::type scalar_type;
   typedef Correlation<const_Matrix, support, T> corr_type;
@@ -97,11 +98,16 @@ test_corr(
       for (index_type r=0; r<Nr; ++r)
 	in.row(r) = ramp(T(0), T(1), Nc);
     }
-    else
+    else if (loop == 2)
     {
       ref = rand.randu(Mr, Mc);
       in  = rand.randu(Nr, Nc);
     }
+    else
+    {
+      // Keep the reference of the previous call.
+      in  = rand.randu(Nr, Nc);
+    }
 
     corr(bias, ref, in, out);
 
@@ -110,7 +116,7 @@ test_corr(
     double error = error_db(out, chk);
 
 #if VERBOSE
-    if (error > -100)
+    if (error > thresh)
     {
       cout << "error = " << error
 	   << "  (" << Pr << ", " << Pc << ")" << endl;
@@ -125,7 +131,7 @@ test_corr(
     }
 #endif
 
-    test_assert(error < -100);
+    test_assert(error < thresh);
   }
 }
 
@@ -133,16 +139,16 @@ test_corr(
 
 template <typename T>
 void
-corr_cases(Domain<2> const& M, Domain<2> const& N)
+corr_cases(Domain<2> const& M, Domain<2> const& N, double thresh = -100)
 {
-  test_corr<T, support_min>(biased,   M, N);
-  test_corr<T, support_min>(unbiased, M, N);
+  test_corr<T, support_min>(biased,   M, N, thresh);
+  test_corr<T, support_min>(unbiased, M, N, thresh);
 
-  test_corr<T, support_same>(biased,   M, N);
-  test_corr<T, support_same>(unbiased, M, N);
+  test_corr<T, support_same>(biased,   M, N, thresh);
+  test_corr<T, support_same>(unbiased, M, N, thresh);
 
-  test_corr<T, support_full>(biased,   M, N);
-  test_corr<T, support_full>(unbiased, M, N);
+  test_corr<T, support_full>(biased,   M, N, thresh);
+  test_corr<T, support_full>(unbiased, M, N, thresh);
 }
 
 
@@ -166,6 +172,12 @@ corr_cover()
   corr_cases<T>(Domain<2>(2, 4), Domain<2>(13, 16));
   corr_cases<T>(Domain<2>(2, 3), Domain<2>(13, 16));
   corr_cases<T>(Domain<2>(3, 2), Domain<2>(13, 16));
+
+  // Sizes large enough for the FFT algorithm, which has more
+  // round-off than the direct sum.
+  corr_cases<T>(Domain<2>(9, 12),  Domain<2>(64, 59),   -90);
+  corr_cases<T>(Domain<2>(17, 10), Domain<2>(100, 64),  -90);
+  corr_cases<T>(Domain<2>(16, 16), Domain<2>(128, 128), -90);
 }
 
 
@@ -385,6 +385,54 @@ void test_shift_m(Domain<1> const &dom, length_type shift, T scale)
 }
 
 
+// Fused fftm, vmmul/mmmul, inv_fftm on a non-square matrix, with enough
+// rows to be split into several batches (plus a partial one).
+//
+// Also check the in-place form, where the output aliases the input.
+
+template <typename O, typename T>
+void test_shift_batch(length_type rows, length_type cols, length_type shift,
+                      T scale)
+{
+  typedef Fftm<T, T, row, fft_fwd, by_value> for_fftm_type;
+  typedef Fftm<T, T, row, fft_inv, by_value> inv_fftm_type;
+
+  test_assert(cols > shift);
+  for_fftm_type for_fftm(Domain<2>(rows, cols), 1.);
+  inv_fftm_type inv_fftm(Domain<2>(rows, cols), 1./cols);
+
+  Vector<T> vw(cols, T(0.));
+  vw.put(shift, scale);
+  vw = t2f(vw);
+  Matrix<T> mw(rows, cols, T(0.));
+  float ds = 1 / float(rows);
+  for (index_type i = 0; i < rows; ++i)
+    mw.put(i, shift, scale * T(1 + i * ds));
+  mw = t2f(mw);
+
+  Matrix<T, Dense<2, T, O> > input(rows, cols);
+  for (index_type r = 0; r < rows; ++r)
+    input.row(r) = ramp(T(r), T(1.), cols);
+  Matrix<T, Dense<2, T, O> > output(rows, cols);
+  Matrix<T> reference(rows, cols);
+  for (index_type r = 0; r < rows; ++r)
+    reference.row(r) = scale * T(1 + r * ds) * input.row(r);
+
+  Domain<2> src(rows, Domain<1>(0, 1, cols - shift));
+  Domain<2> dst(rows, Domain<1>(shift, 1, cols - shift));
+
+  output = inv_fftm(vmmul<0>(vw, for_fftm(input)));
+  test_assert(error_db(scale * input(src), output(dst)) < -100);
+
+  output = inv_fftm(mw * for_fftm(input));
+  test_assert(error_db(reference(src), output(dst)) < -100);
+
+  output = input;
+  output = inv_fftm(for_fftm(output) * mw);
+  test_assert(error_db(reference(src), output(dst)) < -100);
+}
+
+
 int main(int argc, char **argv)
 {
   vsipl init(argc, argv);
@@ -407,6 +455,12 @@ int main(int argc, char **argv)
   //    - multiple rows at a time, fft() * coeffs order
   test_shift_m<row2_type, fused_m_multi<1> >(64, 2, std::complex<float>(2.));
 
+  // ... with several batches of rows.
+  test_shift_batch<row2_type>(100, 1024, 3, std::complex<float>(2.));
+  test_shift_batch<row2_type>(7, 64, 1, std::complex<float>(2.));
+  test_shift_batch<col2_type>(40, 256, 3, std::complex<float>(2.));
+  test_shift_batch<row2_type>(20, 256, 3, std::complex<double>(2.));
+
 #if VSIP_IMPL_CBE_SDK
   test_shift<row2_type, direct_vmmul<false> >(64, 2, std::complex<float>(0.5));
   test_shift<row2_type, direct_vmmul<true> >(64, 2, std::complex<float>(0.5));
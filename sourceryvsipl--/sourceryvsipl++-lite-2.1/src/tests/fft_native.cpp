@@ -0,0 +1,361 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/fft_native.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test the native FFT backend.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/signal.hpp>
+#include <vsip/core/fft/native.hpp>
+
+#include <vsip_csl/test.hpp>
+#include <vsip_csl/error_db.hpp>
+#include <vsip_csl/ref_dft.hpp>
+
+using namespace vsip;
+using vsip_csl::error_db;
+
+namespace fft = vsip::impl::fft;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+template <typename T>
+complex<T>
+value(index_type i)
+{
+  return complex<T>(T((3 * i) % 11) - T(5), T((7 * i) % 13) / T(3));
+}
+
+// Check that BACK, scaled by 1/SCALE, matches REAL.
+template <typename T>
+void
+check_real(std::vector<T> const& back, std::vector<T> const& real,
+	   length_type scale)
+{
+  Vector<T> out(real.size()), ref(real.size());
+  for (index_type i = 0; i < real.size(); ++i)
+  {
+    out.put(i, back[i] / T(scale));
+    ref.put(i, real[i]);
+  }
+  test_assert(error_db(out, ref) < -100);
+}
+
+// Check the complex plan of SIZE points against a reference DFT.
+template <typename T>
+void
+test_plan(length_type size)
+{
+  typedef complex<T> C;
+
+  fft::Native_plan<T> plan(size);
+  test_assert(plan.size() == size);
+  std::pair<T*, T*> in = plan.input();
+  Vector<C> ref_in(size), ref(size), out(size);
+  for (index_type i = 0; i < size; ++i)
+  {
+    C v = value<T>(i);
+    in.first[i] = v.real();
+    in.second[i] = v.imag();
+    ref_in.put(i, v);
+  }
+  std::pair<T*, T*> res = plan.execute();
+  for (index_type i = 0; i < size; ++i)
+    out.put(i, C(res.first[i], res.second[i]));
+  vsip_csl::ref::dft(ref_in, ref, -1);
+  test_assert(error_db(out, ref) < -100);
+}
+
+// Check 1-D complex and real transforms of SIZE points, with strided
+// interleaved and split data.
+template <typename T>
+void
+test_1d(length_type size)
+{
+  typedef complex<T> C;
+  stride_type const s = 2;
+  length_type const h = size / 2 + 1;
+  Domain<1> dom(size);
+
+  Vector<C> ref_in(size), ref(size), out(size);
+  Vector<T> ref_real(size);
+  Vector<C> ref_half(h), half(h);
+  std::vector<C> inter(s * size), inter_out(s * size);
+  std::vector<T> re(s * size), im(s * size), real(s * size);
+  for (index_type i = 0; i < size; ++i)
+  {
+    C v = value<T>(i);
+    ref_in.put(i, v);
+    ref_real.put(i, v.real());
+    inter[s * i] = v;
+    re[s * i] = v.real();
+    im[s * i] = v.imag();
+    real[s * i] = v.real();
+  }
+
+  // Forward, interleaved and by reference.
+  fft::native<1, C, C, 0, -1> fwd(dom);
+  fwd.by_reference(&inter[0], s, &inter_out[0], s, size);
+  for (index_type i = 0; i < size; ++i) out.put(i, inter_out[s * i]);
+  vsip_csl::ref::dft(ref_in, ref, -1);
+  test_assert(error_db(out, ref) < -100);
+
+  // Inverse, split and in place.
+  fft::native<1, C, C, 0, 1> inv(dom);
+  inv.in_place(std::make_pair(&re[0], &im[0]), s, size);
+  for (index_type i = 0; i < size; ++i) out.put(i, C(re[s * i], im[s * i]));
+  vsip_csl::ref::dft(ref_in, ref, 1);
+  test_assert(error_db(out, ref) < -100);
+
+  // Real forward.
+  fft::native<1, T, C, 0, -1> r2c(dom);
+  r2c.by_reference(&real[0], s, &inter_out[0], 1, size);
+  for (index_type i = 0; i < h; ++i) half.put(i, inter_out[i]);
+  vsip_csl::ref::dft(ref_real, ref_half, -1);
+  test_assert(error_db(half, ref_half) < -100);
+
+  // Real inverse of the same spectrum, split.
+  std::vector<T> hre(h), him(h);
+  for (index_type i = 0; i < h; ++i)
+  {
+    hre[i] = ref_half.get(i).real();
+    him[i] = ref_half.get(i).imag();
+  }
+  fft::native<1, C, T, 0, 1> c2r(dom);
+  c2r.by_reference(std::make_pair(&hre[0], &him[0]), 1, &real[0], s, size);
+  Vector<T> back(size);
+  for (index_type i = 0; i < size; ++i) back.put(i, real[s * i] / T(size));
+  test_assert(error_db(back, ref_real) < -100);
+}
+
+// Check 2-D complex and real transforms of ROWS x COLS points in a
+// row-major array.
+template <typename T>
+void
+test_2d(length_type rows, length_type cols)
+{
+  typedef complex<T> C;
+  Domain<2> dom(rows, cols);
+
+  Matrix<C> in(rows, cols), tmp(rows, cols), ref(rows, cols), out(rows, cols);
+  std::vector<C> data(rows * cols), res(rows * cols);
+  std::vector<T> real(rows * cols);
+  for (index_type r = 0; r < rows; ++r)
+    for (index_type c = 0; c < cols; ++c)
+    {
+      C v = value<T>(r * cols + c);
+      in.put(r, c, v);
+      data[r * cols + c] = v;
+    }
+
+  // Complex forward.
+  fft::native<2, C, C, 0, -1> fwd(dom);
+  fwd.by_reference(&data[0], cols, 1, &res[0], cols, 1, rows, cols);
+  for (index_type r = 0; r < rows; ++r)
+    for (index_type c = 0; c < cols; ++c)
+      out.put(r, c, res[r * cols + c]);
+  vsip_csl::ref::dft_x(in, tmp, -1);
+  vsip_csl::ref::dft_y(tmp, ref, -1);
+  test_assert(error_db(out, ref) < -100);
+
+  // Real forward along rows, then inverse.
+  in.imag() = T();
+  for (index_type i = 0; i < rows * cols; ++i)
+    real[i] = in.get(i / cols, i % cols).real();
+  vsip_csl::ref::dft_x(in, tmp, -1);
+  vsip_csl::ref::dft_y(tmp, ref, -1);
+
+  length_type const h = cols / 2 + 1;
+  fft::native<2, T, C, 1, -1> r2c(dom);
+  r2c.by_reference(&real[0], cols, 1, &res[0], h, 1, rows, cols);
+  Matrix<C> half(rows, h);
+  for (index_type r = 0; r < rows; ++r)
+    for (index_type c = 0; c < h; ++c)
+      half.put(r, c, res[r * h + c]);
+  test_assert(error_db(half, ref(Domain<2>(rows, h))) < -100);
+
+  std::vector<T> back(rows * cols);
+  fft::native<2, C, T, 1, 1> c2r(dom);
+  c2r.by_reference(&res[0], h, 1, &back[0], cols, 1, rows, cols);
+  check_real(back, real, rows * cols);
+
+  // Real forward along columns, with column-major output.
+  length_type const v = rows / 2 + 1;
+  fft::native<2, T, C, 0, -1> r2c0(dom);
+  r2c0.by_reference(&real[0], cols, 1, &res[0], 1, v, rows, cols);
+  Matrix<C> vhalf(v, cols);
+  for (index_type r = 0; r < v; ++r)
+    for (index_type c = 0; c < cols; ++c)
+      vhalf.put(r, c, res[c * v + r]);
+  test_assert(error_db(vhalf, ref(Domain<2>(v, cols))) < -100);
+
+  fft::native<2, C, T, 0, 1> c2r0(dom);
+  c2r0.by_reference(&res[0], 1, v, &back[0], cols, 1, rows, cols);
+  check_real(back, real, rows * cols);
+}
+
+// Check a 3-D complex transform against separate 1-D transforms, and
+// real transforms along each axis by their inverses.
+template <typename T>
+void
+test_3d(length_type n0, length_type n1, length_type n2)
+{
+  typedef complex<T> C;
+  length_type const size = n0 * n1 * n2;
+  Domain<3> dom(n0, n1, n2);
+
+  std::vector<C> data(size), res(size), ref(data);
+  std::vector<T> real(size), back(size);
+  for (index_type i = 0; i < size; ++i)
+  {
+    data[i] = ref[i] = value<T>(i);
+    real[i] = data[i].real();
+  }
+
+  fft::native<3, C, C, 0, 1> inv(dom);
+  inv.by_reference(&data[0], n1 * n2, n2, 1, &res[0], n1 * n2, n2, 1,
+		   n0, n1, n2);
+
+  stride_type const s[3] = { stride_type(n1 * n2), stride_type(n2), 1 };
+  length_type const n[3] = { n0, n1, n2 };
+  for (dimension_type d = 0; d < 3; ++d)
+  {
+    dimension_type o1 = d == 0 ? 1 : 0;
+    dimension_type o2 = d == 2 ? 1 : 2;
+    Vector<C> line(n[d]), line_out(n[d]);
+    for (index_type i = 0; i < n[o1]; ++i)
+      for (index_type j = 0; j < n[o2]; ++j)
+      {
+	C* p = &ref[i * s[o1] + j * s[o2]];
+	for (index_type k = 0; k < n[d]; ++k) line.put(k, p[k * s[d]]);
+	vsip_csl::ref::dft(line, line_out, 1);
+	for (index_type k = 0; k < n[d]; ++k) p[k * s[d]] = line_out.get(k);
+      }
+  }
+  Vector<C> out(size), expect(size);
+  for (index_type i = 0; i < size; ++i)
+  {
+    out.put(i, res[i]);
+    expect.put(i, ref[i]);
+  }
+  test_assert(error_db(out, expect) < -100);
+
+  // Real forward and inverse along axis 1.
+  length_type const h = n1 / 2 + 1;
+  fft::native<3, T, C, 1, -1> r2c(dom);
+  fft::native<3, C, T, 1, 1> c2r(dom);
+  r2c.by_reference(&real[0], n1 * n2, n2, 1,
+		   &res[0], h * n2, n2, 1, n0, n1, n2);
+  c2r.by_reference(&res[0], h * n2, n2, 1,
+		   &back[0], n1 * n2, n2, 1, n0, n1, n2);
+  check_real(back, real, size);
+}
+
+// Check multiple complex and real transforms along rows and columns.
+template <typename T>
+void
+test_fftm(length_type rows, length_type cols)
+{
+  typedef complex<T> C;
+  Domain<2> dom(rows, cols);
+
+  Matrix<C> in(rows, cols), ref(rows, cols), out(rows, cols);
+  std::vector<C> data(rows * cols), res(rows * cols);
+  for (index_type r = 0; r < rows; ++r)
+    for (index_type c = 0; c < cols; ++c)
+    {
+      C v = value<T>(r * cols + c);
+      in.put(r, c, v);
+      data[r * cols + c] = v;
+    }
+
+  fft::nativem<C, C, 1, -1> row_fftm(dom);
+  row_fftm.by_reference(&data[0], cols, 1, &res[0], cols, 1, rows, cols);
+  for (index_type i = 0; i < rows * cols; ++i)
+    out.put(i / cols, i % cols, res[i]);
+  vsip_csl::ref::dft_x(in, ref, -1);
+  test_assert(error_db(out, ref) < -100);
+
+  fft::nativem<C, C, 0, 1> col_fftm(dom);
+  col_fftm.in_place(&data[0], cols, 1, rows, cols);
+  for (index_type i = 0; i < rows * cols; ++i)
+    out.put(i / cols, i % cols, data[i]);
+  vsip_csl::ref::dft_y(in, ref, 1);
+  test_assert(error_db(out, ref) < -100);
+
+  // Real transforms along columns.
+  std::vector<T> real(rows * cols), back(rows * cols);
+  for (index_type i = 0; i < rows * cols; ++i)
+    real[i] = value<T>(i).real();
+  fft::nativem<T, C, 0, -1> r2c(dom);
+  fft::nativem<C, T, 0, 1> c2r(dom);
+  r2c.by_reference(&real[0], cols, 1, &res[0], cols, 1, rows, cols);
+  c2r.by_reference(&res[0], cols, 1, &back[0], cols, 1, rows, cols);
+  check_real(back, real, rows);
+}
+
+// Check that Fft objects use the native backend when it is configured.
+template <typename T>
+void
+test_frontend(length_type size)
+{
+  typedef complex<T> C;
+  typedef Fft<const_Vector, C, C, fft_fwd, by_reference> fft_type;
+
+  fft_type f(Domain<1>(size), 1.f);
+  Vector<C> in(size), out(size), ref(size);
+  for (index_type i = 0; i < size; ++i) in.put(i, value<T>(i));
+  f(in, out);
+  vsip_csl::ref::dft(in, ref, -1);
+  test_assert(error_db(out, ref) < -100);
+}
+
+template <typename T>
+void
+test_type()
+{
+  length_type const sizes[] =
+    { 1, 2, 3, 4, 5, 7, 8, 12, 16, 30, 49, 64, 97, 120, 128, 243,
+      256, 1009, 1155, 2048, 10000 };
+  for (unsigned i = 0; i < sizeof(sizes) / sizeof(*sizes); ++i)
+  {
+    test_plan<T>(sizes[i]);
+    test_1d<T>(sizes[i]);
+  }
+  test_2d<T>(8, 16);
+  test_2d<T>(6, 5);
+  test_2d<T>(37, 12);
+  test_3d<T>(4, 6, 8);
+  test_3d<T>(3, 5, 7);
+  test_3d<T>(1, 9, 1);
+  test_fftm<T>(16, 10);
+  test_fftm<T>(9, 97);
+#if VSIP_IMPL_NATIVE_FFT
+  test_frontend<T>(1000);
+  test_frontend<T>(1009);
+#endif
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+  test_type<float>();
+  test_type<double>();
+}
@@ -0,0 +1,183 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/fft_threads.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test FFTs and FFTMs using several threads.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/signal.hpp>
+#include <vsip/matrix.hpp>
+#if !VSIP_IMPL_REF_IMPL
+#  include <vsip/opt/fft/threads.hpp>
+#endif
+
+#include <vsip_csl/test.hpp>
+#include <vsip_csl/error_db.hpp>
+#include <vsip_csl/ref_dft.hpp>
+
+using namespace vsip;
+using vsip_csl::error_db;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+#if !VSIP_IMPL_REF_IMPL
+namespace fft = vsip::impl::fft;
+
+void
+test_num_threads()
+{
+  fft::set_threads(4, 1000);
+  test_assert(fft::num_threads(999) == 1);
+  test_assert(fft::num_threads(1000) == 4);
+  {
+    fft::Threads_hint hint(3);
+    test_assert(fft::num_threads(1) == 3);
+    {
+      fft::Threads_hint inner(2);
+      test_assert(fft::num_threads(1) == 2);
+    }
+    test_assert(fft::num_threads(1) == 3);
+  }
+  test_assert(fft::num_threads(999) == 1);
+  {
+    fft::Threads_hint hint(0);
+    test_assert(fft::num_threads(1) >= 1);
+  }
+
+  char  name[] = "fft_threads";
+  char  opt1[] = "--svpp-fft-threads";
+  char  val1[] = "2";
+  char  opt2[] = "--svpp-fft-threads-min";
+  char  val2[] = "100";
+  char  other[] = "--other";
+  char* args[] = { name, opt1, val1, other, opt2, val2, 0 };
+  int    argc = 6;
+  char** argv = args;
+  fft::initialize_threads(argc, argv);
+  test_assert(argc == 2 && argv[1] == other);
+  test_assert(fft::num_threads(99) == 1);
+  test_assert(fft::num_threads(100) == 2);
+
+  fft::set_threads(1, 32768);
+}
+
+
+
+template <typename T>
+void
+fill(Matrix<complex<T> > m)
+{
+  for (index_type r=0; r<m.size(0); ++r)
+    for (index_type c=0; c<m.size(1); ++c)
+      m.put(r, c, complex<T>(T((r + 3*c) % 7), T((2*r + c) % 5) - T(2)));
+}
+
+// Check complex FFTMs of ROWS x COLS points created while NTHREADS
+// threads are hinted.
+template <typename T>
+void
+test_fftm(length_type rows, length_type cols, length_type nthreads)
+{
+  typedef complex<T> C;
+  typedef Fftm<C, C, row, fft_fwd, by_reference, 1, alg_time> row_type;
+  typedef Fftm<C, C, col, fft_fwd, by_reference, 1, alg_time> col_type;
+  typedef Fftm<C, C, row, fft_inv, by_reference, 1, alg_time> inv_type;
+  typedef Fftm<T, C, row, fft_fwd, by_reference, 1, alg_time> r2c_type;
+  typedef Fftm<C, T, row, fft_inv, by_reference, 1, alg_time> c2r_type;
+
+  fft::Threads_hint hint(nthreads);
+  Domain<2> dom(rows, cols);
+  row_type row_fftm(dom, 1.f);
+  col_type col_fftm(dom, 1.f);
+  inv_type inv_fftm(dom, 1.f / cols);
+
+  Matrix<C> in(rows, cols), out(rows, cols), ref(rows, cols);
+  fill(in);
+
+  row_fftm(in, out);
+  vsip_csl::ref::dft_x(in, ref, -1);
+  test_assert(error_db(out, ref) < -100);
+
+  col_fftm(in, out);
+  vsip_csl::ref::dft_y(in, ref, -1);
+  test_assert(error_db(out, ref) < -100);
+
+  // In-place inverse.
+  row_fftm(in, out);
+  inv_fftm(out);
+  test_assert(error_db(out, in) < -100);
+
+  // Real forward and inverse.
+  Matrix<T> real(rows, cols), back(rows, cols);
+  Matrix<C> spectrum(rows, cols/2 + 1);
+  real = vsip::real(in);
+  r2c_type r2c_fftm(dom, 1.f);
+  c2r_type c2r_fftm(dom, 1.f / cols);
+  r2c_fftm(real, spectrum);
+  c2r_fftm(spectrum, back);
+  test_assert(error_db(back, real) < -100);
+}
+
+// Check a complex 2-D FFT of ROWS x COLS points created while NTHREADS
+// threads are hinted.
+template <typename T>
+void
+test_fft2d(length_type rows, length_type cols, length_type nthreads)
+{
+  typedef complex<T> C;
+  typedef Fft<const_Matrix, C, C, fft_fwd, by_reference, 1, alg_time>
+    fft_type;
+
+  fft::Threads_hint hint(nthreads);
+  fft_type fft(Domain<2>(rows, cols), 1.f);
+
+  Matrix<C> in(rows, cols), out(rows, cols), tmp(rows, cols), ref(rows, cols);
+  fill(in);
+  fft(in, out);
+  vsip_csl::ref::dft_x(in, tmp, -1);
+  vsip_csl::ref::dft_y(tmp, ref, -1);
+  test_assert(error_db(out, ref) < -100);
+}
+
+template <typename T>
+void
+test_type()
+{
+  test_fftm<T>(16, 64, 1);
+  test_fftm<T>(16, 64, 4);
+  test_fftm<T>(3, 32, 4);
+  test_fftm<T>(37, 24, 3);
+  test_fft2d<T>(32, 64, 1);
+  test_fft2d<T>(32, 64, 4);
+}
+#endif
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+#if !VSIP_IMPL_REF_IMPL
+  test_num_threads();
+
+#if VSIP_IMPL_PROVIDE_FFT_FLOAT
+  test_type<float>();
+#endif
+#if VSIP_IMPL_PROVIDE_FFT_DOUBLE
+  test_type<double>();
+#endif
+#endif
+}
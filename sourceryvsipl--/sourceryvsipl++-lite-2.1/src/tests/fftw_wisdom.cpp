@@ -0,0 +1,144 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/fftw_wisdom.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test the FFTW3 wisdom store and planning
+             effort options.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/signal.hpp>
+#include <vsip/vector.hpp>
+#if defined(VSIP_IMPL_FFTW3) && !VSIP_IMPL_REF_IMPL
+#  include <vsip/opt/fftw3/wisdom.hpp>
+#endif
+
+#include <vsip_csl/test.hpp>
+#include <vsip_csl/error_db.hpp>
+#include <vsip_csl/ref_dft.hpp>
+
+using namespace vsip;
+using vsip_csl::error_db;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+#if defined(VSIP_IMPL_FFTW3) && !VSIP_IMPL_REF_IMPL
+namespace fftw3 = vsip::impl::fftw3;
+
+// Check a forward FFT of SIZE points planned for NO_TIMES uses.
+template <typename T,
+	  unsigned no_times>
+void
+test_fft(length_type size)
+{
+  typedef complex<T> C;
+  typedef Fft<const_Vector, C, C, fft_fwd, by_reference, no_times, alg_time>
+    fft_type;
+
+  fft_type fft(Domain<1>(size), 1.f);
+  Vector<C> in(size), out(size), ref(size);
+  for (index_type i=0; i<size; ++i)
+    in.put(i, C(T(i % 5), T(i % 3) - T(1)));
+  fft(in, out);
+  vsip_csl::ref::dft(in, ref, -1);
+  test_assert(error_db(out, ref) < -100);
+}
+
+// Return the first bytes of FILE, or "" if it cannot be read.
+std::string
+head(std::string const& file)
+{
+  char buffer[16] = "";
+  FILE* fp = fopen(file.c_str(), "r");
+  if (fp)
+  {
+    size_t n = fread(buffer, 1, sizeof(buffer) - 1, fp);
+    buffer[n] = 0;
+    fclose(fp);
+  }
+  return buffer;
+}
+
+// Process the options OPT1 VAL1 OPT2 VAL2, then perform FFTs planned
+// for NO_TIMES uses.  The wisdom store is saved by finalize(), as at
+// library finalization.
+template <unsigned no_times>
+void
+run(char const* opt1, char const* val1, char const* opt2, char const* val2,
+    length_type size)
+{
+  char  name[] = "fftw_wisdom";
+  char* args[6] = { name,
+		    const_cast<char*>(opt1), const_cast<char*>(val1),
+		    const_cast<char*>(opt2), const_cast<char*>(val2), 0 };
+  int    argc = 5;
+  char** argv = args;
+
+  fftw3::initialize(argc, argv);
+  test_assert(argc == 1);
+
+#if VSIP_IMPL_PROVIDE_FFT_FLOAT
+  test_fft<float, no_times>(size);
+#endif
+#if VSIP_IMPL_PROVIDE_FFT_DOUBLE
+  test_fft<double, no_times>(size);
+#endif
+
+  fftw3::finalize();
+}
+#endif
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+#if defined(VSIP_IMPL_FFTW3) && !VSIP_IMPL_REF_IMPL
+  char file[64];
+  std::sprintf(file, "/tmp/vsip-wisdom-%d", int(getpid()));
+  std::string store = file;
+# if VSIP_IMPL_PROVIDE_FFT_FLOAT
+  store += ".fftwf";
+# else
+  store += ".fftw";
+# endif
+
+  // Plans measured with an explicit effort are saved at finalization.
+  run<1>("--svpp-fftw-wisdom", file, "--svpp-fftw-effort", "measure", 256);
+  test_assert(head(store).compare(0, 6, "(fftw-") == 0);
+  test_assert(fftw3::get_planning_effort() == fftw3::effort_hint);
+
+  // They are loaded again at initialization.  Wisdom-only planning
+  // uses them, and falls back to ESTIMATE for sizes without wisdom.
+  fftw3::forget_wisdom();
+  run<15>("--svpp-fftw-wisdom", file, "--svpp-fftw-effort", "wisdom", 256);
+  run<15>("--svpp-fftw-wisdom", file, "--svpp-fftw-effort", "wisdom", 96);
+
+  // Explicit import and export.
+  fftw3::forget_wisdom();
+  test_assert(fftw3::import_wisdom(file));
+  test_assert(fftw3::export_wisdom(file));
+  test_assert(!fftw3::import_wisdom("/nonexistent/vsip-wisdom"));
+
+  std::remove((std::string(file) + ".fftwf").c_str());
+  std::remove((std::string(file) + ".fftw").c_str());
+  std::remove((std::string(file) + ".fftwl").c_str());
+#endif
+}
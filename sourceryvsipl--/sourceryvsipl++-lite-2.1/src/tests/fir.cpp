@@ -258,5 +258,25 @@ main(int argc, char** argv)
   test_fir<float,vsip::sym_even_len_odd>(3,23,55);
   test_fir<float,vsip::sym_even_len_odd>(3,32,1024);
 
+  // Larger decimations for the polyphase implementation.
+  test_fir<float,vsip::nonsym>(7,20,100);
+  test_fir<float,vsip::nonsym>(8,64,250);
+  test_fir<float,vsip::nonsym>(16,100,1000);
+  test_fir<float,vsip::sym_even_len_odd>(6,13,61);
+  test_fir<std::complex<float>,vsip::nonsym>(5,37,123);
+
+  // Kernels long enough for the FFT-based implementation.
+  test_fir<float,vsip::nonsym>(1,128,1024);
+  test_fir<float,vsip::nonsym>(3,100,1000);
+  test_fir<float,vsip::nonsym>(5,300,333);
+  test_fir<float,vsip::sym_even_len_even>(2,64,700);
+  test_fir<float,vsip::sym_even_len_odd>(4,50,257);
+  test_fir<std::complex<float>,vsip::nonsym>(1,200,1024);
+  test_fir<std::complex<float>,vsip::nonsym>(3,128,500);
+#if VSIP_IMPL_TEST_DOUBLE
+  test_fir<double,vsip::nonsym>(2,128,1024);
+  test_fir<std::complex<double>,vsip::nonsym>(3,100,999);
+#endif
+
   return 0;
 }
@@ -0,0 +1,145 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/fir_bank.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test multi-channel FIR filter banks.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/signal.hpp>
+#include <vsip/matrix.hpp>
+
+#include <vsip_csl/test.hpp>
+#include <vsip_csl/error_db.hpp>
+#include <vsip_csl/fir_bank.hpp>
+
+using namespace vsip;
+using vsip_csl::error_db;
+using vsip_csl::Fir_bank;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+template <typename T>
+T
+value(index_type c, index_type i)
+{
+  return T(int((7 * c + 3 * i) % 11) - 5);
+}
+
+// Filter CHANNELS channels of FRAMES frames of SIZE samples with a bank
+// of kernels of K coefficients, decimated by D, and compare each
+// channel with a Fir<> object.  If SHARED, all channels use the same
+// kernel.  OrderT is the dimension order of the data matrices.
+template <typename T, symmetry_type S, obj_state C, typename OrderT>
+void
+test_bank(length_type channels, length_type k, length_type size,
+	  length_type d, length_type frames, bool shared)
+{
+  typedef Fir<T, S, C> fir_type;
+  typedef Fir_bank<T, S, C> bank_type;
+  typedef Dense<2, T, OrderT> block_type;
+
+  Matrix<T> kernels(channels, k);
+  for (index_type c = 0; c < channels; ++c)
+    for (index_type i = 0; i < k; ++i)
+      kernels.put(c, i, value<T>(shared ? 0 : c, i + 1));
+
+  std::auto_ptr<bank_type> bank(shared
+    ? new bank_type(kernels.row(0), channels, size, d)
+    : new bank_type(kernels, size, d));
+  test_assert(bank->channels() == channels);
+  test_assert(bank->input_size() == size);
+  test_assert(bank->decimation() == d);
+  test_assert(bank->output_size() == (size + d - 1) / d);
+  test_assert(bank->continuous_filtering() == C);
+
+  std::vector<fir_type*> firs(channels);
+  for (index_type c = 0; c < channels; ++c)
+  {
+    firs[c] = new fir_type(kernels.row(c), size, d);
+    test_assert(bank->kernel_size() == firs[c]->kernel_size());
+  }
+
+  Matrix<T, block_type> in(channels, size);
+  Matrix<T, block_type> out(channels, bank->output_size(), T());
+  Vector<T> ref(bank->output_size());
+
+  for (index_type f = 0; f < frames; ++f)
+  {
+    for (index_type c = 0; c < channels; ++c)
+      for (index_type i = 0; i < size; ++i)
+	in.put(c, i, value<T>(c + f, i));
+
+    // Continue with a copy halfway, to check that the state is copied.
+    if (f == frames / 2)
+      bank.reset(new bank_type(*bank));
+
+    length_type got = (*bank)(in, out);
+    for (index_type c = 0; c < channels; ++c)
+    {
+      length_type ref_got = (*firs[c])(in.row(c), ref);
+      test_assert(got == ref_got);
+      test_assert(error_db(out.row(c)(Domain<1>(got)),
+			   ref(Domain<1>(got))) < -100);
+    }
+  }
+
+  bank->reset();
+  for (index_type c = 0; c < channels; ++c)
+    firs[c]->reset();
+  length_type got = (*bank)(in, out);
+  for (index_type c = 0; c < channels; ++c)
+  {
+    test_assert(got == (*firs[c])(in.row(c), ref));
+    test_assert(error_db(out.row(c)(Domain<1>(got)),
+			 ref(Domain<1>(got))) < -100);
+    delete firs[c];
+  }
+}
+
+template <typename T>
+void
+test_type()
+{
+  test_bank<T, nonsym, state_save, row2_type>(1, 4, 32, 1, 3, true);
+  test_bank<T, nonsym, state_save, row2_type>(16, 8, 64, 1, 4, true);
+  test_bank<T, nonsym, state_save, row2_type>(37, 21, 100, 1, 4, false);
+  test_bank<T, nonsym, state_save, col2_type>(20, 13, 50, 1, 3, false);
+  test_bank<T, nonsym, state_save, row2_type>(33, 16, 128, 4, 4, true);
+  test_bank<T, nonsym, state_save, row2_type>(5, 20, 101, 3, 5, false);
+  test_bank<T, nonsym, state_save, col2_type>(17, 9, 35, 7, 5, true);
+  test_bank<T, nonsym, state_no_save, row2_type>(9, 11, 40, 2, 3, false);
+  test_bank<T, sym_even_len_even, state_save, row2_type>(18, 5, 60, 2, 4,
+							 false);
+  test_bank<T, sym_even_len_odd, state_save, row2_type>(7, 6, 45, 3, 4,
+							true);
+  // Kernels long enough to be applied with FFTs.
+  test_bank<T, nonsym, state_save, row2_type>(6, 40, 200, 1, 4, false);
+  test_bank<T, nonsym, state_save, col2_type>(5, 70, 150, 3, 3, true);
+}
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+  test_type<float>();
+  test_type<complex<float> >();
+#if VSIP_IMPL_TEST_DOUBLE
+  test_type<double>();
+  test_type<complex<double> >();
+#endif
+}
@@ -20,6 +20,7 @@
 #include <vsip/random.hpp>
 #include <vsip_csl/test.hpp>
 #include <vsip_csl/output.hpp>
+#include <vsip_csl/error_db.hpp>
 
 using namespace vsip;
 using namespace vsip_csl;
@@ -142,6 +143,112 @@ test_diff_type_matrix_freqswap( length_type m, length_type n )
 
 
 
+// Test freqswap of matrices with ORDER, in place and into a strided
+// subview.
+
+template <typename T,
+	  typename OrderT>
+void
+test_order_matrix_freqswap( length_type m, length_type n )
+{
+  typedef Dense<2, T, OrderT> block_type;
+  Matrix<T, block_type> a(m, n);
+
+  Rand<T> rgen(1);
+  a = rgen.randu(m, n);
+
+  Matrix<T, block_type> b(m, n);
+  Matrix<T, block_type> c(m, n);
+  Matrix<T, block_type> d(2 * m, 2 * n, T());
+  b = vsip::freqswap(a);
+  c = a; c = vsip::freqswap(c);
+  Domain<2> dom(Domain<1>(0, 2, m), Domain<1>(1, 2, n));
+  d(dom) = vsip::freqswap(a);
+
+  for ( index_type i = 0; i < m; i++ )
+    for ( index_type j = 0; j < n; j++ )
+    {
+      T ref = a.get(((m+1)/2 + i) % m, ((n+1)/2 + j) % n );
+      test_assert(b.get(i, j) == ref);
+      test_assert(c.get(i, j) == ref);
+      test_assert(d(dom).get(i, j) == ref);
+    }
+}
+
+
+
+#if defined(VSIP_IMPL_FFT_USE_FLOAT)
+// Test freqswap of the result of Fftm, compared with freqswap of a
+// copy of the result.
+
+template <int A>
+void
+test_fftm_freqswap( length_type m, length_type n )
+{
+  typedef std::complex<float> T;
+  typedef Fftm<T, T, A, fft_fwd, by_value, 1, alg_time> fftm_type;
+
+  fftm_type fftm(Domain<2>(m, n), 1.f);
+
+  Matrix<T> a(m, n);
+  Rand<T> rgen(2);
+  a = rgen.randu(m, n);
+
+  Matrix<T> tmp(m, n);
+  Matrix<T> ref(m, n);
+  tmp = fftm(a);
+  ref = vsip::freqswap(tmp);
+
+  Matrix<T> b(m, n);
+  Matrix<T, Dense<2, T, col2_type> > c(m, n);
+  Matrix<T> d(m, n);
+  b = vsip::freqswap(fftm(a));
+  c = vsip::freqswap(fftm(a));
+  d = T(2) * vsip::freqswap(fftm(a));
+  test_assert(error_db(b, ref) < -100);
+  test_assert(error_db(c, ref) < -100);
+  test_assert(error_db(d, T(2) * ref) < -100);
+
+  a = vsip::freqswap(fftm(a));
+  test_assert(error_db(a, ref) < -100);
+}
+
+
+
+// Test freqswap of the result of Fft.
+
+void
+test_fft_freqswap( length_type m, length_type n )
+{
+  typedef std::complex<float> T;
+  typedef Fft<const_Vector, T, T, fft_fwd, by_value, 1, alg_time> fft_type;
+  typedef Fft<const_Matrix, T, T, fft_fwd, by_value, 1, alg_time> fft2_type;
+
+  fft_type  fft(Domain<1>(n), 1.f);
+  fft2_type fft2(Domain<2>(m, n), 1.f);
+
+  Vector<T> v(n);
+  Matrix<T> a(m, n);
+  Rand<T> rgen(3);
+  v = rgen.randu(n);
+  a = rgen.randu(m, n);
+
+  Vector<T> vtmp(n), vref(n), w(n);
+  vtmp = fft(v);
+  vref = vsip::freqswap(vtmp);
+  w = vsip::freqswap(fft(v));
+  test_assert(error_db(w, vref) < -100);
+
+  Matrix<T> tmp(m, n), ref(m, n), b(m, n);
+  tmp = fft2(a);
+  ref = vsip::freqswap(tmp);
+  b = vsip::freqswap(fft2(a));
+  test_assert(error_db(b, ref) < -100);
+}
+#endif
+
+
+
 template <typename T>
 void
 cases_by_type()
@@ -158,6 +265,12 @@ cases_by_type()
   test_matrix_freqswap<T>( 4, 5 );
   test_matrix_freqswap<T>( 5, 4 );
   test_matrix_freqswap<T>( 5, 5 );
+
+  test_order_matrix_freqswap<T, row2_type>( 64, 48 );
+  test_order_matrix_freqswap<T, row2_type>( 33, 17 );
+  test_order_matrix_freqswap<T, col2_type>( 64, 48 );
+  test_order_matrix_freqswap<T, col2_type>( 33, 17 );
+  test_order_matrix_freqswap<complex<T>, row2_type>( 31, 64 );
 }
   
 
@@ -179,5 +292,13 @@ main(int argc, char** argv)
   cases_by_type<long double>();
 #endif // VSIP_IMPL_TEST_LONG_DOUBLE
 
+#if defined(VSIP_IMPL_FFT_USE_FLOAT)
+  test_fftm_freqswap<row>( 33, 64 );
+  test_fftm_freqswap<row>( 1024, 256 );
+  test_fftm_freqswap<col>( 64, 33 );
+  test_fftm_freqswap<col>( 256, 1024 );
+  test_fft_freqswap( 32, 64 );
+#endif
+
   return EXIT_SUCCESS;
 }
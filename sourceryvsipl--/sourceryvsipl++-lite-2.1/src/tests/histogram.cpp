@@ -14,6 +14,8 @@
   Included Files
 ***********************************************************************/
 
+#include <limits>
+
 #include <vsip/initfin.hpp>
 #include <vsip/support.hpp>
 #include <vsip/signal.hpp>
@@ -150,12 +152,143 @@ test_matrix_histogram( length_type rows, length_type cols )
 
 
 
+// Compare the histogram of a large vector, and of a strided view of
+// it, to the bins of individual values.
+
+template <typename T>
+void
+test_large_vector_histogram( length_type size )
+{
+  Rand<float> rgen(1);
+  Vector<float> tmp(size);
+  tmp = rgen.randu(size) * 18 - 1;
+
+  Vector<T> v(size);
+  for ( index_type i = 0; i < size; ++i )
+    v.put(i, static_cast<T>(tmp.get(i)) );
+  // Values on the edges of the range.
+  v.put(0, T(0));
+  v.put(1, T(16));
+  v.put(2, T(8));
+
+  Histogram<const_Vector, T> h(0, 16, 18);
+
+  Vector<scalar_i> q(18);
+  q = h(v);
+
+  Vector<scalar_i> ref(18, 0);
+  for ( index_type i = 0; i < size; ++i )
+    ref(h.impl_bin(v(i)))++;
+  for ( index_type b = 0; b < 18; ++b )
+    test_assert( q(b) == ref(b) );
+
+  Domain<1> dom(1, 3, size / 3);
+  q = h(v(dom), true);
+
+  for ( index_type i = 0; i < dom.size(); ++i )
+    ref(h.impl_bin(v(dom.impl_nth(i))))++;
+  for ( index_type b = 0; b < 18; ++b )
+    test_assert( q(b) == ref(b) );
+}
+
+
+
+// Compare the histogram of a large matrix, in either dimension order,
+// and of a submatrix of it, to the bins of individual values.
+
+template <typename T,
+          typename OrderT>
+void
+test_large_matrix_histogram( length_type rows, length_type cols )
+{
+  Rand<float> rgen(2);
+  Matrix<float> tmp(rows, cols);
+  tmp = rgen.randu(rows, cols) * 36 - 2;
+
+  Matrix<T, Dense<2, T, OrderT> > m(rows, cols);
+  for ( index_type i = 0; i < rows; ++i )
+    for ( index_type j = 0; j < cols; ++j )
+      m.put(i, j, static_cast<T>(tmp.get(i, j)));
+
+  Histogram<const_Matrix, T> h(0, 32, 34);
+
+  Vector<scalar_i> q(34);
+  q = h(m);
+
+  Vector<scalar_i> ref(34, 0);
+  for ( index_type i = 0; i < rows; ++i )
+    for ( index_type j = 0; j < cols; ++j )
+      ref(h.impl_bin(m(i, j)))++;
+  for ( index_type b = 0; b < 34; ++b )
+    test_assert( q(b) == ref(b) );
+
+  Domain<2> dom(Domain<1>(1, 1, rows - 2), Domain<1>(2, 2, cols / 2 - 1));
+  q = h(m(dom));
+
+  ref = 0;
+  for ( index_type i = 0; i < dom[0].size(); ++i )
+    for ( index_type j = 0; j < dom[1].size(); ++j )
+      ref(h.impl_bin(m(dom[0].impl_nth(i), dom[1].impl_nth(j))))++;
+  for ( index_type b = 0; b < 34; ++b )
+    test_assert( q(b) == ref(b) );
+}
+
+
+
+// Compare the histogram of values just below and on the bin edges, in
+// a unit-stride view and in a strided view, with the expected bins.
+// The bins have unit width, so that a value just below edge K is
+// scaled to just below K, which adding 1 before truncating would round
+// up into the next bin.
+
+template <typename T>
+void
+test_bin_edges()
+{
+  length_type const num_edges = 15;
+  length_type const reps      = 8;
+  length_type const size      = 2 * num_edges * reps;
+
+  Vector<T> v(size);
+  Vector<T> s(2 * size, T(-1));
+  for ( index_type r = 0; r < reps; ++r )
+    for ( index_type k = 1; k <= num_edges; ++k )
+    {
+      index_type i = 2 * (r * num_edges + k - 1);
+      v.put(i,     T(k) * (T(1) - std::numeric_limits<T>::epsilon() / 2));
+      v.put(i + 1, T(k));
+    }
+  s(Domain<1>(0, 2, size)) = v;
+
+  Histogram<const_Vector, T> h(0, 16, 18);
+
+  Vector<scalar_i> q(18);
+  q = h(v);
+  Vector<scalar_i> qs(18);
+  qs = h(s(Domain<1>(0, 2, size)));
+
+  for ( index_type i = 0; i < size; ++i )
+    test_assert( h.impl_bin(v(i)) == (i % 2 ? 2 : 1) + (i / 2) % num_edges );
+  for ( index_type b = 0; b < 18; ++b )
+  {
+    scalar_i count = b == 0 || b == 17 ? 0 :
+                     b == 1 || b == 16 ? reps : 2 * reps;
+    test_assert( q(b) == count );
+    test_assert( qs(b) == count );
+  }
+}
+
+
+
 template <typename T>
 void
 cases_by_type()
 {
   test_vector_histogram<T>( 1024 );
   test_matrix_histogram<T>( 32, 32 );
+  test_large_vector_histogram<T>( 100003 );
+  test_large_matrix_histogram<T, row2_type>( 301, 400 );
+  test_large_matrix_histogram<T, col2_type>( 301, 400 );
 }
   
 
@@ -170,8 +303,11 @@ main(int argc, char** argv)
   cases_by_type<int>();
   cases_by_type<long>();
 
+  test_bin_edges<float>();
+
 #if VSIP_IMPL_TEST_DOUBLE
   cases_by_type<double>();
+  test_bin_edges<double>();
 #endif
 #if VSIP_IMPL_TEST_LONG_DOUBLE
   cases_by_type<long double>();
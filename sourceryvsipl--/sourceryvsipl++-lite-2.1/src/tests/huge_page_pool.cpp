@@ -0,0 +1,246 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/huge_page_pool.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test the huge page memory pool.
+
+    The pool is backed by an ordinary temporary file, which is enough
+    to exercise the allocator without a hugetlbfs mount.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstdio>
+#include <vector>
+#include <unistd.h>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/core/huge_page_pool.hpp>
+
+#include <vsip_csl/test.hpp>
+
+using namespace vsip;
+using vsip::impl::Huge_page_pool;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+#if VSIP_IMPL_ENABLE_HUGE_PAGE_POOL
+
+struct Chunk
+{
+  unsigned char* ptr;
+  size_t         size;
+  unsigned char  tag;
+};
+
+// Simple linear congruential generator, independent per thread.
+inline unsigned
+next(unsigned& state)
+{
+  state = state * 1103515245u + 12345u;
+  return state >> 8;
+}
+
+void
+fill(Chunk const& c)
+{
+  for (size_t i=0; i<c.size; ++i)
+    c.ptr[i] = c.tag;
+}
+
+bool
+check(Chunk const& c)
+{
+  for (size_t i=0; i<c.size; ++i)
+    if (c.ptr[i] != c.tag)
+      return false;
+  return true;
+}
+
+// Allocate and free random sizes, checking that live blocks do not
+// overlap.  Returns the number of errors.
+
+int
+churn(Huge_page_pool& pool, unsigned seed, int iterations)
+{
+  unsigned state = seed;
+  std::vector<Chunk> live;
+  int errors = 0;
+
+  for (int i=0; i<iterations; ++i)
+  {
+    if (live.size() < 64 && (live.empty() || next(state) % 3 != 0))
+    {
+      Chunk c;
+      switch (next(state) % 4)
+      {
+      case 0:  c.size = next(state) % 129;     break;
+      case 1:  c.size = next(state) % 4096;    break;
+      case 2:  c.size = next(state) % 65536;   break;
+      default: c.size = next(state) % 400000;  break;
+      }
+      c.ptr = static_cast<unsigned char*>(pool.impl_allocate(c.size));
+      c.tag = static_cast<unsigned char>(next(state));
+      if (reinterpret_cast<size_t>(c.ptr) % Huge_page_pool::align != 0)
+	++errors;
+      fill(c);
+      live.push_back(c);
+    }
+    else
+    {
+      size_t k = next(state) % live.size();
+      if (!check(live[k]))
+	++errors;
+      pool.impl_deallocate(live[k].ptr, live[k].size);
+      live[k] = live.back();
+      live.pop_back();
+    }
+  }
+
+  for (size_t k=0; k<live.size(); ++k)
+  {
+    if (!check(live[k]))
+      ++errors;
+    pool.impl_deallocate(live[k].ptr, live[k].size);
+  }
+  return errors;
+}
+
+
+
+struct Thread_arg
+{
+  Huge_page_pool* pool;
+  unsigned        seed;
+  int             errors;
+};
+
+extern "C" void*
+churn_thread(void* arg)
+{
+  Thread_arg* a = static_cast<Thread_arg*>(arg);
+  a->errors = churn(*a->pool, a->seed, 20000);
+  return 0;
+}
+
+
+
+// Check that all memory has returned to the free lists.
+void
+check_empty(Huge_page_pool& pool)
+{
+  pool.flush_thread_cache();
+  Huge_page_pool::Stats s = pool.stats();
+  test_assert(s.free == s.total);
+  test_assert(s.thread_cached == 0);
+  test_assert(pool.total_avail() == s.total);
+}
+
+
+
+void
+test_single(char const* file)
+{
+  // Three 16 MB pages: one 32 MB block and one 16 MB block.
+  Huge_page_pool pool(file, 3);
+  Huge_page_pool::Stats s = pool.stats();
+  test_assert(s.total == 3 * 0x1000000);
+  test_assert(s.free == s.total);
+  test_assert(s.largest_free == 2 * 0x1000000);
+  test_assert(s.free_blocks == 2);
+
+  // A large request is trimmed to a multiple of 128 bytes.
+  void* p = pool.impl_allocate(3 * 0x100000 + 1);
+  test_assert(pool.total_avail() == s.total - (3 * 0x100000 + 128));
+  pool.impl_deallocate(p, 3 * 0x100000 + 1);
+  test_assert(pool.total_avail() == s.total);
+  test_assert(pool.stats().free_blocks == 2);
+
+  // Requests larger than any block fail.
+#if VSIP_HAS_EXCEPTIONS
+  bool thrown = false;
+  try { pool.impl_allocate(40 * 0x100000); }
+  catch (std::bad_alloc const&) { thrown = true; }
+  test_assert(thrown);
+#endif
+
+  // Freeing every other block fragments free memory; freeing the
+  // rest merges the blocks again.
+  std::vector<void*> blocks;
+  for (int i=0; i<64; ++i)
+    blocks.push_back(pool.impl_allocate(200000));
+  float frag = pool.stats().fragmentation();
+  for (int i=0; i<64; i+=2)
+    pool.impl_deallocate(blocks[i], 200000);
+  test_assert(pool.stats().fragmentation() > frag);
+  for (int i=1; i<64; i+=2)
+    pool.impl_deallocate(blocks[i], 200000);
+  test_assert(pool.stats().fragmentation() == s.fragmentation());
+  test_assert(pool.stats().free_blocks == 2);
+
+  test_assert(churn(pool, 1, 20000) == 0);
+  check_empty(pool);
+
+  // Views allocated from the pool.
+  {
+    Local_map map;
+    map.impl_set_pool(&pool);
+    Vector<float, Dense<1, float, row1_type, Local_map> > v(1000, 1.f, map);
+    Vector<float, Dense<1, float, row1_type, Local_map> > w(100000, 2.f, map);
+    w(Domain<1>(1000)) += v;
+    test_assert(w.get(999) == 3.f && w.get(1000) == 2.f);
+  }
+  check_empty(pool);
+}
+
+
+
+void
+test_threads(char const* file)
+{
+  Huge_page_pool pool(file, 4);
+
+  int const n = 4;
+  pthread_t  thread[n];
+  Thread_arg arg[n];
+  for (int i=0; i<n; ++i)
+  {
+    arg[i].pool = &pool;
+    arg[i].seed = i + 1;
+    pthread_create(&thread[i], 0, churn_thread, &arg[i]);
+  }
+  for (int i=0; i<n; ++i)
+  {
+    pthread_join(thread[i], 0);
+    test_assert(arg[i].errors == 0);
+  }
+
+  // The caches of the exited threads have been returned.
+  check_empty(pool);
+}
+
+#endif // VSIP_IMPL_ENABLE_HUGE_PAGE_POOL
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+#if VSIP_IMPL_ENABLE_HUGE_PAGE_POOL
+  char file[64];
+  std::sprintf(file, "/tmp/vsip-huge-page-pool-%d", int(getpid()));
+  test_single(file);
+  test_threads(file);
+#endif
+}
@@ -0,0 +1,137 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/iir_bank.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test multi-channel IIR filter banks.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vector>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/signal.hpp>
+#include <vsip/matrix.hpp>
+
+#include <vsip_csl/test.hpp>
+#include <vsip_csl/error_db.hpp>
+#include <vsip_csl/iir_bank.hpp>
+
+using namespace vsip;
+using vsip_csl::error_db;
+using vsip_csl::Iir_bank;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+template <typename T>
+T
+value(index_type c, index_type i)
+{
+  return T(int((7 * c + 3 * i) % 11) - 5);
+}
+
+// Filter CHANNELS channels of FRAMES frames of SIZE samples with a bank
+// of SECTIONS second-order sections, and compare each channel with an
+// Iir<> object.  OrderT is the dimension order of the data matrices.
+// If IN_PLACE, the output overwrites the input.
+template <typename T, obj_state C, typename OrderT>
+void
+test_bank(length_type channels, length_type sections, length_type size,
+	  length_type frames, bool in_place)
+{
+  typedef Iir<T, C> iir_type;
+  typedef Iir_bank<T, C> bank_type;
+  typedef Dense<2, T, OrderT> block_type;
+
+  // Stable sections: poles of radius 0.5 to 0.9.
+  Matrix<T> b(sections, 3);
+  Matrix<T> a(sections, 2);
+  for (index_type m = 0; m < sections; ++m)
+  {
+    double r = 0.5 + 0.4 * m / sections;
+    b.put(m, 0, T(1));
+    b.put(m, 1, T(-1) + T(0.25) * T(m));
+    b.put(m, 2, T(0.5));
+    a.put(m, 0, T(-r));
+    a.put(m, 1, T(r * r / 2));
+  }
+
+  bank_type bank(b, a, channels, size);
+  test_assert(bank.channels() == channels);
+  test_assert(bank.kernel_size() == 2 * sections);
+  test_assert(bank.filter_order() == 2 * sections);
+  test_assert(bank.input_size() == size);
+  test_assert(bank.output_size() == size);
+  test_assert(bank.continuous_filtering == C);
+
+  std::vector<iir_type> iirs(channels, iir_type(b, a, size));
+
+  Matrix<T, block_type> in(channels, size);
+  Matrix<T, block_type> out(channels, size, T());
+  Vector<T> ref(size);
+
+  for (index_type f = 0; f < frames; ++f)
+  {
+    for (index_type c = 0; c < channels; ++c)
+      for (index_type i = 0; i < size; ++i)
+	in.put(c, i, value<T>(c + f, i));
+
+    Matrix<T> data(channels, size);
+    data = in;
+
+    if (f == frames / 2)
+    {
+      // Continue with a copy, to check that the state is copied.
+      bank_type copy(bank);
+      bank = copy;
+    }
+
+    if (in_place)
+    {
+      bank(in, in);
+      out = in;
+    }
+    else
+      bank(in, out);
+
+    for (index_type c = 0; c < channels; ++c)
+    {
+      iirs[c](data.row(c), ref);
+      test_assert(error_db(out.row(c), ref) < -100);
+    }
+  }
+}
+
+template <typename T>
+void
+test_type()
+{
+  test_bank<T, state_save, row2_type>(1, 1, 32, 3, false);
+  test_bank<T, state_save, row2_type>(16, 1, 64, 4, false);
+  test_bank<T, state_save, row2_type>(37, 2, 100, 4, false);
+  test_bank<T, state_save, col2_type>(20, 3, 50, 3, false);
+  test_bank<T, state_save, row2_type>(33, 2, 17, 5, true);
+  test_bank<T, state_no_save, row2_type>(9, 2, 40, 3, false);
+  test_bank<T, state_no_save, col2_type>(18, 1, 25, 3, true);
+}
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+  test_type<float>();
+  test_type<complex<float> >();
+#if VSIP_IMPL_TEST_DOUBLE
+  test_type<double>();
+  test_type<complex<double> >();
+#endif
+}
@@ -164,4 +164,15 @@ main(int argc, char** argv)
   // ATLAS blocking code.  If order < NB, only the cleanup code
   // gets exercised.
   test_prod_rand<float, float, row2_type, row2_type, row2_type>(256, 256, 256);
+
+  // Test products spanning several blocks of the builtin blocked
+  // product, with partial register tiles.
+  test_prod_rand<float, float, col2_type, row2_type, col2_type>(197, 32, 263);
+  test_prod_rand<complex<float>, complex<float>, row2_type, col2_type,
+		 row2_type>(101, 24, 37);
+#if VSIP_IMPL_TEST_DOUBLE
+  test_prod_rand<double, double, row2_type, row2_type, col2_type>(113, 32, 261);
+  test_prod_rand<complex<double>, complex<double>, col2_type, col2_type,
+		 col2_type>(37, 24, 270);
+#endif
 }
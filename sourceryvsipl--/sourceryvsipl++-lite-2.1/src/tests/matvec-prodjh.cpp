@@ -128,6 +128,9 @@ prod_cases_complex_only()
   test_prodj_rand<T0, T1>(5, 7, 9);
   test_prodj_rand<T0, T1>(9, 5, 7);
   test_prodj_rand<T0, T1>(9, 7, 5);
+
+  test_prodh_rand<T0, T1>(101, 24, 37);
+  test_prodj_rand<T0, T1>(37, 24, 101);
 }
 
 
@@ -334,6 +334,7 @@ Test_gem_types( T alpha, T beta )
   Test_gemp<T>( alpha, beta, 7, 9, 5 );
   Test_gemp<T>( alpha, beta, 5, 9, 7 );
   Test_gemp<T>( alpha, beta, 5, 3, 7 );
+  Test_gemp<T>( alpha, beta, 100, 270, 33 );
 
   // generalized matrix sum
   Test_gems<T>( alpha, beta, 7, 3, 5 );
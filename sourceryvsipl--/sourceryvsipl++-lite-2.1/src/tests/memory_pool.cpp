@@ -0,0 +1,269 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/memory_pool.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test default pool selection, the arena
+             pool and scratch scopes.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstring>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/math.hpp>
+#include <vsip/signal.hpp>
+#include <vsip/core/arena_pool.hpp>
+#include <vsip/core/extdata.hpp>
+
+#include <vsip_csl/test.hpp>
+
+using namespace vsip;
+using vsip::impl::Arena_pool;
+using vsip::impl::Scratch_scope;
+using vsip::impl::temporary_pool;
+using vsip_csl::equal;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+void
+test_arena()
+{
+  Arena_pool pool(4096);
+  test_assert(pool.chunks() == 0);
+
+  // Blocks are aligned and carved from one chunk.
+  char* a = static_cast<char*>(pool.impl_allocate(100));
+  char* b = static_cast<char*>(pool.impl_allocate(1));
+  test_assert(reinterpret_cast<size_t>(a) % Arena_pool::align == 0);
+  test_assert(reinterpret_cast<size_t>(b) % Arena_pool::align == 0);
+  test_assert(b > a);
+  test_assert(pool.chunks() == 1);
+
+  // Freeing the last block makes its memory available again.
+  pool.impl_deallocate(b, 1);
+  test_assert(pool.impl_allocate(1) == b);
+
+  // Large blocks get a chunk of their own.
+  void* c = pool.impl_allocate(10000);
+  test_assert(pool.chunks() == 2);
+  test_assert(pool.live() == 3);
+
+  // Rewinding reclaims the blocks allocated since the mark, and the
+  // same requests are then served from the same chunks.
+  Arena_pool::Mark mark = pool.mark();
+  void* d = pool.impl_allocate(2000);
+  void* e = pool.impl_allocate(3000);
+  test_assert(pool.chunks() == 4);
+  pool.impl_deallocate(d, 2000);
+  pool.impl_deallocate(e, 3000);
+  pool.rewind(mark);
+  test_assert(pool.live() == 3);
+  test_assert(pool.impl_allocate(2000) == d);
+  e = pool.impl_allocate(3000);
+  test_assert(pool.chunks() == 4);
+  pool.impl_deallocate(e, 3000);
+  pool.impl_deallocate(d, 2000);
+  pool.rewind(mark);
+  d = pool.impl_allocate(2000);
+
+  // Releasing every block resets the arena to its first chunk.
+  pool.impl_deallocate(a, 100);
+  pool.impl_deallocate(b, 1);
+  pool.impl_deallocate(c, 10000);
+  pool.impl_deallocate(d, 2000);
+  test_assert(pool.live() == 0);
+  test_assert(pool.impl_allocate(64) == a);
+  test_assert(pool.chunks() == 4);
+}
+
+
+
+// Blocks released out of order are reused while a long-lived block
+// keeps the arena from resetting.
+void
+test_arena_free_list()
+{
+  Arena_pool pool(4096);
+  void* keep = pool.impl_allocate(256);
+
+  void* first[3];
+  for (int iter=0; iter<100; ++iter)
+  {
+    void* a = pool.impl_allocate(512);
+    void* b = pool.impl_allocate(1000);
+    void* c = pool.impl_allocate(100);
+    pool.impl_deallocate(a, 512);
+    pool.impl_deallocate(b, 1000);
+    pool.impl_deallocate(c, 100);
+    if (iter == 0)
+    {
+      first[0] = a; first[1] = b; first[2] = c;
+    }
+    else
+      test_assert(a == first[0] && b == first[1] && c == first[2]);
+  }
+  test_assert(pool.chunks() == 1);
+  test_assert(pool.live() == 1);
+
+  // Released blocks past a mark are forgotten by rewinding to it, and
+  // their memory is handed out once.
+  Arena_pool::Mark mark = pool.mark();
+  void* x = pool.impl_allocate(64);
+  void* y = pool.impl_allocate(64);
+  pool.impl_deallocate(x, 64);
+  pool.impl_deallocate(y, 64);
+  pool.rewind(mark);
+  test_assert(pool.impl_allocate(64) == x);
+  test_assert(pool.impl_allocate(64) == y);
+  test_assert(pool.live() == 3);
+
+  pool.impl_deallocate(x, 64);
+  pool.impl_deallocate(y, 64);
+  pool.impl_deallocate(keep, 256);
+}
+
+
+
+// A block from before a mark that is released before rewinding to it
+// no longer counts, so the arena still resets when it becomes empty.
+void
+test_arena_rewind()
+{
+  Arena_pool pool(4096);
+  void* a = pool.impl_allocate(256);
+
+  Arena_pool::Mark mark = pool.mark();
+  void* b = pool.impl_allocate(1024);
+  pool.impl_deallocate(a, 256);
+  pool.impl_deallocate(b, 1024);
+  pool.rewind(mark);
+  test_assert(pool.live() == 0);
+
+  for (int iter=0; iter<10; ++iter)
+  {
+    void* p = pool.impl_allocate(2048);
+    test_assert(p == a);
+    mark = pool.mark();
+    void* q = pool.impl_allocate(1024);
+    pool.impl_deallocate(p, 2048);
+    pool.impl_deallocate(q, 1024);
+    pool.rewind(mark);
+    test_assert(pool.live() == 0);
+  }
+  test_assert(pool.chunks() == 1);
+}
+
+
+
+// Repeated processing inside a scratch scope reuses the same memory.
+void
+test_scratch()
+{
+  length_type const rows = 16, cols = 256;
+  typedef complex<float> C;
+  typedef Fftm<C, C, row, fft_fwd, by_value> fftm_type;
+
+  fftm_type fftm(Domain<2>(rows, cols), 1.f);
+  Matrix<C> in(rows, cols), out(rows, cols), ref(rows, cols);
+  Vector<float> v(1000, 2.f), w(1000);
+
+  for (index_type r=0; r<rows; ++r)
+    for (index_type c=0; c<cols; ++c)
+      in.put(r, c, C(float(r), float(c % 7)));
+  ref = fftm(in);
+
+  test_assert(temporary_pool() == impl::default_pool);
+
+  length_type chunks = 0;
+  for (int iter=0; iter<4; ++iter)
+  {
+    Scratch_scope scope;
+    test_assert(temporary_pool() == Scratch_scope::arena());
+
+    // The return block of the FFT is a temporary.
+    out = C(2.f) * fftm(in);
+
+    // So is the copy made by Ext_data for a strided view.
+    {
+      typedef Vector<float>::subview_type view_type;
+      typedef impl::Layout<1, row1_type, impl::Stride_unit_dense,
+	                   impl::Cmplx_inter_fmt> layout_type;
+      view_type sub = v(Domain<1>(0, 2, 500));
+      impl::Ext_data<view_type::block_type, layout_type>
+	ext(sub.block(), impl::SYNC_IN);
+      test_assert(ext.data()[499] == 2.f);
+    }
+
+    w = v * 3.f;
+
+    if (iter == 0)
+    {
+      chunks = Scratch_scope::arena()->chunks();
+      test_assert(chunks > 0);
+    }
+    else
+      test_assert(Scratch_scope::arena()->chunks() == chunks);
+
+    for (index_type r=0; r<rows; ++r)
+      for (index_type c=0; c<cols; ++c)
+	test_assert(equal(out.get(r, c), C(2.f) * ref.get(r, c)));
+    test_assert(w.get(999) == 6.f);
+  }
+  test_assert(Scratch_scope::arena()->live() == 0);
+  test_assert(temporary_pool() == impl::default_pool);
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+  // Select the arena pool for the default pool.  It is only accepted
+  // when a single thread allocates from it.
+  char  opt_pool[] = "--svpp-pool";
+  char  opt_kind[] = "arena";
+  char  opt_one[]  = "1";
+#if VSIP_IMPL_HAVE_THREAD_POOL
+  char  opt_workers[] = "--svpp-num-workers";
+#endif
+#if VSIP_IMPL_PAR_SERVICE == 3
+  char  opt_threads[] = "--svpp-num-threads";
+#endif
+  char* args[64];
+  int   nargs = 0;
+  for (int i=0; i<argc && i<56; ++i)
+    args[nargs++] = argv[i];
+  args[nargs++] = opt_pool;
+  args[nargs++] = opt_kind;
+#if VSIP_IMPL_HAVE_THREAD_POOL
+  args[nargs++] = opt_workers;
+  args[nargs++] = opt_one;
+#endif
+#if VSIP_IMPL_PAR_SERVICE == 3
+  args[nargs++] = opt_threads;
+  args[nargs++] = opt_one;
+#endif
+  args[nargs] = 0;
+  char** use_argv = args;
+
+  vsipl init(nargs, use_argv);
+
+  test_assert(!strcmp(impl::default_pool->name(), "Arena_pool"));
+  test_assert(nargs == argc);
+
+  test_arena();
+  test_arena_free_list();
+  test_arena_rewind();
+  test_scratch();
+}
@@ -36,7 +36,8 @@ using namespace vsip_csl;
   Definitions
 ***********************************************************************/
 
-template <typename T>
+template <typename T,
+	  typename DstOrderT>
 void
 corner_turn(
   length_type rows,
@@ -44,6 +45,7 @@ corner_turn(
 {
   typedef Map<Block_dist, Block_dist>      map_type;
   typedef Dense<2, T, row2_type, map_type> block_type;
+  typedef Dense<2, T, DstOrderT, map_type> dst_block_type;
 
   processor_type np   = num_processors();
 
@@ -51,10 +53,10 @@ corner_turn(
   map_type row_map (np, 1);
   map_type col_map (1, np);
 
-  Matrix<T, block_type> src(rows, cols, root_map);
-  Matrix<T, block_type> A  (rows, cols, row_map);
-  Matrix<T, block_type> B  (rows, cols, col_map);
-  Matrix<T, block_type> dst(rows, cols, root_map);
+  Matrix<T, block_type>     src(rows, cols, root_map);
+  Matrix<T, block_type>     A  (rows, cols, row_map);
+  Matrix<T, dst_block_type> B  (rows, cols, col_map);
+  Matrix<T, block_type>     dst(rows, cols, root_map);
 
   if (root_map.subblock() != no_subblock)
   {
@@ -80,6 +82,124 @@ corner_turn(
 
 
 
+template <typename T>
+void
+corner_turn(
+  length_type rows,
+  length_type cols)
+{
+  corner_turn<T, row2_type>(rows, cols);
+}
+
+
+
+// Corner turn a tensor from distribution over dimension 0 to
+// distribution over dimension D.
+
+template <typename T>
+void
+corner_turn_tensor(
+  length_type    n0,
+  length_type    n1,
+  length_type    n2,
+  dimension_type d)
+{
+  typedef Map<Block_dist, Block_dist, Block_dist> map_type;
+  typedef Dense<3, T, row3_type, map_type>        block_type;
+
+  processor_type np   = num_processors();
+
+  map_type root_map(1, 1, 1);
+  map_type src_map (np, 1, 1);
+  map_type dst_map (1, d == 1 ? np : 1, d == 2 ? np : 1);
+
+  Tensor<T, block_type> src(n0, n1, n2, root_map);
+  Tensor<T, block_type> A  (n0, n1, n2, src_map);
+  Tensor<T, block_type> B  (n0, n1, n2, dst_map);
+  Tensor<T, block_type> dst(n0, n1, n2, root_map);
+
+  if (root_map.subblock() != no_subblock)
+  {
+    for (index_type i=0; i<n0; ++i)
+      for (index_type j=0; j<n1; ++j)
+	for (index_type k=0; k<n2; ++k)
+	  src.local().put(i, j, k, T((i*n1+j)*n2+k));
+  }
+
+  A   = src; // scatter
+  B   = A;   // corner-turn
+  dst = B;   // gather
+
+  if (root_map.subblock() != no_subblock)
+  {
+    for (index_type i=0; i<n0; ++i)
+      for (index_type j=0; j<n1; ++j)
+	for (index_type k=0; k<n2; ++k)
+	  test_assert(equal(src.local().get(i, j, k),
+			    dst.local().get(i, j, k)));
+  }
+}
+
+
+
+#if VSIP_IMPL_PAR_SERVICE == 1
+// Corner turn a matrix with Alltoall_assign, exchanging the data in
+// CHUNKS steps.
+
+template <typename T>
+void
+corner_turn_chunks(
+  length_type rows,
+  length_type cols,
+  length_type chunks)
+{
+  typedef Map<Block_dist, Block_dist>      map_type;
+  typedef Dense<2, T, row2_type, map_type> block_type;
+  typedef Dense<2, T, col2_type, map_type> dst_block_type;
+
+  processor_type np   = num_processors();
+
+  map_type root_map(1, 1);
+  map_type row_map (np, 1);
+  map_type col_map (1, np);
+
+  Matrix<T, block_type>     src(rows, cols, root_map);
+  Matrix<T, block_type>     A  (rows, cols, row_map);
+  Matrix<T, dst_block_type> B  (rows, cols, col_map);
+  Matrix<T, block_type>     dst(rows, cols, root_map);
+
+  if (root_map.subblock() != no_subblock)
+  {
+    for (index_type r=0; r<rows; ++r)
+      for (index_type c=0; c<cols; ++c)
+	src.local().put(r, c, T(r*cols+c));
+  }
+
+  A = src;
+
+  impl::Par_assign<2, T, T, dst_block_type, block_type, impl::Alltoall_assign>
+    corner_turn(B, A, chunks);
+
+  // Repeat the assignment, to check that the object can be reused.
+  for (index_type i=0; i<2; ++i)
+  {
+    B = T();
+    corner_turn();
+    dst = B;
+
+    if (root_map.subblock() != no_subblock)
+    {
+      for (index_type r=0; r<rows; ++r)
+	for (index_type c=0; c<cols; ++c)
+	  test_assert(equal(src.local().get(r, c),
+			    dst.local().get(r, c)));
+    }
+  }
+}
+#endif
+
+
+
 int
 main(int argc, char** argv)
 {
@@ -114,5 +234,18 @@ main(int argc, char** argv)
   corner_turn<complex<float> >(11, 6);
   corner_turn<complex<float> >(11, 7);
 
+  corner_turn<float, col2_type>(32, 64);
+  corner_turn<complex<float>, col2_type>(31, 15);
+
+  corner_turn_tensor<float>(8, 12, 10, 1);
+  corner_turn_tensor<complex<float> >(7, 5, 9, 2);
+
+#if VSIP_IMPL_PAR_SERVICE == 1
+  corner_turn_chunks<float>(32, 64, 1);
+  corner_turn_chunks<float>(32, 64, 3);
+  corner_turn_chunks<complex<float> >(31, 15, 4);
+  corner_turn_chunks<complex<float> >(5, 7, 16);
+#endif
+
   return 0;
 }
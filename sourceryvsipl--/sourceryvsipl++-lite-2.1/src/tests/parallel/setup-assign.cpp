@@ -0,0 +1,299 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    tests/parallel/setup-assign.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test asynchronous execution of Setup_assign
+                              and split parallel assignments.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <iostream>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/map.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/parallel.hpp>
+#include <vsip/core/parallel/services.hpp>
+
+#include <vsip_csl/test.hpp>
+#include "util.hpp"
+
+using namespace std;
+using namespace vsip;
+using namespace vsip_csl;
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+// Scatter the values of frame K into A from SRC, held on the root
+// processor.
+
+template <typename T,
+	  typename Block1,
+	  typename Block2>
+void
+scatter_frame(
+  Matrix<T, Block1> src,
+  Matrix<T, Block2> A,
+  index_type        k)
+{
+  length_type rows = src.size(0);
+  length_type cols = src.size(1);
+
+  if (src.block().map().subblock() != no_subblock)
+  {
+    for (index_type r=0; r<rows; ++r)
+      for (index_type c=0; c<cols; ++c)
+	src.local().put(r, c, T((k*rows + r)*cols + c));
+  }
+  A = src;
+}
+
+
+
+// Gather B into DST, held on the root processor, and check that it
+// holds frame K.
+
+template <typename T,
+	  typename Block1,
+	  typename Block2>
+void
+check_frame(
+  Matrix<T, Block1> B,
+  Matrix<T, Block2> dst,
+  index_type        k)
+{
+  length_type rows = dst.size(0);
+  length_type cols = dst.size(1);
+
+  dst = B;
+  if (dst.block().map().subblock() != no_subblock)
+  {
+    for (index_type r=0; r<rows; ++r)
+      for (index_type c=0; c<cols; ++c)
+	test_assert(equal(dst.local().get(r, c),
+			  T((k*rows + r)*cols + c)));
+  }
+}
+
+
+
+// Assign A to B with Setup_assign::exec_async(), completing the
+// assignment either by polling test() or with wait().
+
+template <typename T,
+	  typename SrcMapT,
+	  typename DstMapT>
+void
+test_async(
+  length_type    rows,
+  length_type    cols,
+  SrcMapT const& src_map,
+  DstMapT const& dst_map,
+  bool           poll)
+{
+  typedef Map<Block_dist, Block_dist>      root_map_type;
+  typedef Dense<2, T, row2_type, root_map_type> root_block_type;
+  typedef Dense<2, T, row2_type, SrcMapT>  src_block_type;
+  typedef Dense<2, T, row2_type, DstMapT>  dst_block_type;
+
+  root_map_type root_map(1, 1);
+
+  Matrix<T, root_block_type> src(rows, cols, root_map);
+  Matrix<T, root_block_type> dst(rows, cols, root_map);
+  Matrix<T, src_block_type>  A  (rows, cols, src_map);
+  Matrix<T, dst_block_type>  B  (rows, cols, T(-1), dst_map);
+
+  Setup_assign assign(B, A);
+
+  for (index_type k=0; k<3; ++k)
+  {
+    scatter_frame(src, A, k);
+
+    Setup_assign::Async_handle handle = assign.exec_async();
+    if (poll)
+      while (!handle.test())
+	;
+    else
+      handle.wait();
+
+    check_frame(B, dst, k);
+  }
+}
+
+
+
+// Double-buffered corner turn: frame K+1 is redistributed while
+// frame K is checked.
+
+template <typename T>
+void
+test_pipeline(
+  length_type rows,
+  length_type cols,
+  length_type frames)
+{
+  typedef Map<Block_dist, Block_dist>      map_type;
+  typedef Dense<2, T, row2_type, map_type> block_type;
+
+  processor_type np = num_processors();
+
+  map_type root_map(1, 1);
+  map_type row_map (np, 1);
+  map_type col_map (1, np);
+
+  Matrix<T, block_type> src(rows, cols, root_map);
+  Matrix<T, block_type> dst(rows, cols, root_map);
+  Matrix<T, block_type> A0 (rows, cols, row_map);
+  Matrix<T, block_type> A1 (rows, cols, row_map);
+  Matrix<T, block_type> B0 (rows, cols, col_map);
+  Matrix<T, block_type> B1 (rows, cols, col_map);
+
+  Setup_assign assign0(B0, A0);
+  Setup_assign assign1(B1, A1);
+
+  scatter_frame(src, A0, 0);
+  Setup_assign::Async_handle cur = assign0.exec_async();
+
+  for (index_type k=0; k<frames; ++k)
+  {
+    Setup_assign::Async_handle next = cur;
+    if (k+1 < frames)
+    {
+      if (k % 2 == 0)
+      {
+	scatter_frame(src, A1, k+1);
+	next = assign1.exec_async();
+      }
+      else
+      {
+	scatter_frame(src, A0, k+1);
+	next = assign0.exec_async();
+      }
+    }
+
+    cur.wait();
+    if (k % 2 == 0)
+      check_frame(B0, dst, k);
+    else
+      check_frame(B1, dst, k);
+    cur = next;
+  }
+}
+
+
+
+// Split execution of a Par_assign implementation: begin(), then
+// test() or wait().
+
+template <typename T,
+	  typename ParAssignImpl>
+void
+test_split(
+  length_type rows,
+  length_type cols)
+{
+  typedef Map<Block_dist, Block_dist>      map_type;
+  typedef Dense<2, T, row2_type, map_type> block_type;
+
+  processor_type np = num_processors();
+
+  map_type root_map(1, 1);
+  map_type row_map (np, 1);
+  map_type col_map (1, np);
+
+  Matrix<T, block_type> src(rows, cols, root_map);
+  Matrix<T, block_type> dst(rows, cols, root_map);
+  Matrix<T, block_type> A  (rows, cols, row_map);
+  Matrix<T, block_type> B  (rows, cols, col_map);
+
+  impl::Par_assign<2, T, T, block_type, block_type, ParAssignImpl>
+    corner_turn(B, A);
+
+  for (index_type k=0; k<4; ++k)
+  {
+    scatter_frame(src, A, k);
+    corner_turn.begin();
+    if (k % 2)
+      while (!corner_turn.test())
+	;
+    else
+      corner_turn.wait();
+    // Completing an assignment again has no effect.
+    test_assert(corner_turn.test());
+    corner_turn.wait();
+    check_frame(B, dst, k);
+  }
+}
+
+
+
+template <typename T>
+void
+test_maps(length_type rows, length_type cols, bool poll)
+{
+  typedef Map<Block_dist,  Block_dist>  block_map_type;
+  typedef Map<Cyclic_dist, Block_dist>  cyclic_map_type;
+
+  processor_type np = num_processors();
+
+  block_map_type  row_map (np, 1);
+  block_map_type  col_map (1, np);
+  cyclic_map_type cyc_map (Cyclic_dist(np, 2), Block_dist(1));
+
+  test_async<T>(rows, cols, row_map, col_map, poll);	// corner turn
+  test_async<T>(rows, cols, col_map, row_map, poll);	// corner turn
+  test_async<T>(rows, cols, row_map, row_map, poll);	// same map
+  test_async<T>(rows, cols, row_map, cyc_map, poll);	// redistribution
+  test_async<T>(rows, cols, Global_map<2>(), row_map, poll);
+}
+
+
+
+// With the threads service, the tests run on a team of threads.
+
+struct Test_spmd
+{
+  void operator()()
+  {
+    test_maps<float>(16, 24, false);
+    test_maps<float>(16, 24, true);
+    test_maps<complex<float> >(9, 7, false);
+    test_maps<complex<float> >(9, 7, true);
+
+    test_pipeline<float>(32, 16, 5);
+    test_pipeline<complex<float> >(8, 12, 4);
+
+    test_split<float, impl::Chained_assign>(16, 24);
+    test_split<complex<float>, impl::Chained_assign>(9, 7);
+#if VSIP_IMPL_PAR_SERVICE == 1
+    test_split<float, impl::Alltoall_assign>(16, 24);
+    test_split<complex<float>, impl::Alltoall_assign>(9, 7);
+#endif
+
+    impl::default_communicator().barrier();
+  }
+};
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl vpp(argc, argv);
+
+  impl::par_spmd(Test_spmd());
+
+  return 0;
+}
@@ -0,0 +1,84 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/parallel/spmd.cpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Test SPMD regions (par_spmd).
+
+    Exercises reductions, redistribution, and broadcast inside a
+    par_spmd region.  With MPI the region is the whole program; with
+    the threads service it runs on a team of threads.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/map.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/math.hpp>
+#include <vsip/selgen.hpp>
+#include <vsip/parallel.hpp>
+#include <vsip/core/parallel/services.hpp>
+
+#include <vsip_csl/test.hpp>
+
+using namespace vsip;
+using vsip_csl::equal;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+struct Test_spmd
+{
+  Test_spmd(length_type size) : size_(size) {}
+
+  void operator()()
+  {
+    typedef Map<Block_dist>                      map_type;
+    typedef Dense<1, float, row1_type, map_type> block_type;
+
+    length_type np = num_processors();
+
+    map_type dist_map = map_type(Block_dist(np));
+    map_type root_map = map_type(Block_dist(1));
+
+    // Reduction over a distributed vector.
+    Vector<float, block_type> a(size_, dist_map);
+    a = ramp(0.f, 1.f, size_);
+    test_assert(equal(sumval(a), float(size_ * (size_ - 1) / 2)));
+
+    // Redistribute onto the root processor.
+    Vector<float, block_type> b(size_, root_map);
+    b = a;
+
+    // Broadcast: every processor can read every element.
+    for (index_type i=0; i<size_; ++i)
+    {
+      test_assert(equal(a.get(i), float(i)));
+      test_assert(equal(b.get(i), float(i)));
+    }
+
+    impl::default_communicator().barrier();
+  }
+
+  length_type size_;
+};
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+  impl::par_spmd(Test_spmd(16));
+  impl::par_spmd(Test_spmd(97));
+
+  return 0;
+}
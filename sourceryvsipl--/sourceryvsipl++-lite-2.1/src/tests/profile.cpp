@@ -0,0 +1,267 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/profile.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test the profiler's event recording.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#if !VSIP_IMPL_REF_IMPL
+#  include <vsip/opt/profile.hpp>
+#endif
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
+
+#include <vsip_csl/test.hpp>
+
+using namespace vsip;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+#if !VSIP_IMPL_REF_IMPL
+using vsip::impl::profile::Profiler;
+using vsip::impl::profile::event_id_type;
+
+// Count the lines of FILE that start with PREFIX.
+int
+count_lines(char const* file, char const* prefix)
+{
+  std::ifstream is(file);
+  std::string line;
+  int count = 0;
+  while (std::getline(is, line))
+    if (!line.compare(0, strlen(prefix), prefix))
+      ++count;
+  return count;
+}
+
+// Record N nested pairs of events.
+void
+record(Profiler& p, int n)
+{
+  event_id_type outer = p.intern("outer");
+  for (int i=0; i<n; ++i)
+  {
+    int id = p.event(outer, 10, 0);
+    int inner_id = p.event(p.intern(std::string("inner")), 1, 0);
+    p.event(p.intern("inner"), 0, inner_id);
+    p.event(outer, 0, id);
+  }
+}
+
+void
+test_intern()
+{
+  Profiler p;
+  event_id_type a = p.intern("a");
+  event_id_type b = p.intern("b");
+  test_assert(a > 0 && b > 0 && a != b);
+  test_assert(p.intern(std::string("a")) == a);
+  test_assert(!strcmp(p.name(b), "b"));
+
+  // A reused buffer is looked up by contents.
+  char buffer[8];
+  strcpy(buffer, "a");
+  test_assert(p.intern(buffer) == a);
+  strcpy(buffer, "c");
+  test_assert(p.intern(buffer) != a);
+  test_assert(!strcmp(p.name(p.intern(buffer)), "c"));
+
+  // No events are recorded without a mode.
+  test_assert(p.event(a, 0, 0) == 0);
+}
+
+void
+test_trace(char const* file)
+{
+  Profiler p;
+  p.set_mode(impl::profile::pm_trace);
+  record(p, 5);
+  p.dump(file);
+  test_assert(count_lines(file, "# mode: pm_trace") == 1);
+  test_assert(count_lines(file, "# dropped") == 0);
+  // Four records per iteration.
+  test_assert(count_lines(file, "") == 5 + 4 * 5);
+
+  // Older records are overwritten when the buffer is full.
+  Profiler q;
+  q.set_mode(impl::profile::pm_trace);
+  q.set_buffer_size(10);
+  record(q, 10);
+  q.dump(file);
+  test_assert(count_lines(file, "# dropped: 24") == 1);
+  test_assert(count_lines(file, "") == 6 + 16);
+}
+
+void
+test_binary(char const* file)
+{
+  Profiler p;
+  p.set_mode(impl::profile::pm_trace);
+  p.set_format(impl::profile::pf_binary);
+  record(p, 3);
+  p.dump(file);
+
+  std::ifstream is(file, std::ios::binary);
+  char magic[8];
+  unsigned int order, num_names, length, num_threads, tid, pad;
+  unsigned long long clocks, num_records, dropped;
+  is.read(magic, 8);
+  is.read(reinterpret_cast<char*>(&order), 4);
+  is.read(reinterpret_cast<char*>(&clocks), 8);
+  is.read(reinterpret_cast<char*>(&num_names), 4);
+  test_assert(!strncmp(magic, "SVPPTRC1", 8));
+  test_assert(order == 0x01020304);
+  test_assert(num_names == 3);
+  for (unsigned int i=0; i<num_names; ++i)
+  {
+    char name[64];
+    is.read(reinterpret_cast<char*>(&length), 4);
+    test_assert(length < sizeof(name));
+    is.read(name, length);
+  }
+  is.read(reinterpret_cast<char*>(&num_threads), 4);
+  is.read(reinterpret_cast<char*>(&tid), 4);
+  is.read(reinterpret_cast<char*>(&pad), 4);
+  is.read(reinterpret_cast<char*>(&num_records), 8);
+  is.read(reinterpret_cast<char*>(&dropped), 8);
+  test_assert(num_threads == 1);
+  test_assert(num_records == 12 && dropped == 0);
+
+  unsigned long long ticks;
+  unsigned int event;
+  int idx, end, value;
+  for (unsigned long long i=0; i<num_records; ++i)
+  {
+    is.read(reinterpret_cast<char*>(&ticks), 8);
+    is.read(reinterpret_cast<char*>(&event), 4);
+    is.read(reinterpret_cast<char*>(&idx), 4);
+    is.read(reinterpret_cast<char*>(&end), 4);
+    is.read(reinterpret_cast<char*>(&value), 4);
+    test_assert(idx == int(i) + 1);
+    test_assert(event >= 1 && event <= num_names);
+  }
+  test_assert(is.good());
+  test_assert(is.peek() == EOF);
+}
+
+
+
+struct Named
+{
+  static char const* name() { return "named"; }
+};
+
+// Events of call sites and types are interned on first use, and not
+// at all while the profiler is off.
+void
+test_event()
+{
+  using impl::profile::prof;
+  static impl::profile::Event event = { "site", 0 };
+  typedef impl::profile::Type_event<Named> type_event;
+
+  impl::profile::profiler_mode mode = prof->mode();
+  prof->set_mode(impl::profile::pm_none);
+  test_assert(event.get() == 0 && event.id == 0);
+  test_assert(type_event::get() == 0 && type_event::id == 0);
+
+  prof->set_mode(impl::profile::pm_accum);
+  event_id_type id = event.get();
+  test_assert(id == prof->intern("site"));
+  test_assert(event.id == id && event.get() == id);
+  id = type_event::get();
+  test_assert(id == prof->intern("named"));
+  test_assert(type_event::id == id && type_event::get() == id);
+  {
+    impl::profile::Scope_base<true> scope(event, 1);
+  }
+  prof->set_mode(mode);
+}
+
+
+
+#if VSIP_IMPL_HAVE_THREAD_POOL
+void
+record_task(void* arg, index_type)
+{
+  record(*static_cast<Profiler*>(arg), 100);
+}
+#endif
+
+void
+test_accum(char const* file)
+{
+  Profiler p;
+  p.set_mode(impl::profile::pm_accum);
+  record(p, 100);
+  length_type tasks = 0;
+#if VSIP_IMPL_HAVE_THREAD_POOL
+  // The events of all threads are combined.
+  tasks = 8;
+  impl::threads::Thread_pool::instance()->parallel_for(record_task, &p, tasks);
+#endif
+  p.dump(file);
+
+  // Only the counts are checked; the times depend on the timer.
+  std::ifstream is(file);
+  std::string line;
+  int found = 0;
+  while (std::getline(is, line))
+  {
+    char name[32];
+    unsigned long long ticks;
+    unsigned long calls;
+    int ops;
+    if (sscanf(line.c_str(), "%31s : %llu : %lu : %d", name, &ticks, &calls,
+	       &ops) == 4)
+    {
+#if VSIP_IMPL_PROFILE_NESTING
+      if (!strcmp(name, "outer\\,inner"))
+	strcpy(name, "inner");
+#endif
+      test_assert(calls == 100 * (tasks + 1));
+      test_assert(ops == (strcmp(name, "outer") ? 1 : 10));
+      ++found;
+    }
+  }
+  test_assert(found == 2);
+}
+#endif // !VSIP_IMPL_REF_IMPL
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+#if !VSIP_IMPL_REF_IMPL
+  char file[64];
+  std::sprintf(file, "/tmp/vsip-profile-%d", int(getpid()));
+
+  test_intern();
+  test_event();
+  test_trace(file);
+  test_binary(file);
+  test_accum(file);
+  std::remove(file);
+#endif
+}
@@ -0,0 +1,85 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+
+/** @file    tests/regressions/vma_ip_csc.cpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Regression test for the unrolled loop of the
+             SIMD complex += complex-scalar * real kernel.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/complex.hpp>
+#include <vsip/core/allocation.hpp>
+#include <vsip/opt/simd/vma_ip_csc.hpp>
+
+#include <vsip_csl/test.hpp>
+
+using namespace vsip;
+using vsip_csl::equal;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+// R += a * B with the vectorized kernel of the build, when there is
+// one.  Its unrolled loop once used the upper half of the second
+// vector of B in place of the lower half.
+
+template <typename T>
+void
+test_vma_ip_cSC(length_type n, length_type offset)
+{
+  typedef complex<T> C;
+  typedef impl::simd::Simd_vma_ip_cSC<C,
+    impl::simd::Is_algorithm_supported<C, false,
+      impl::simd::Alg_vma_ip_cSC>::value> kernel_type;
+
+  length_type const size = n + offset;
+  T* B = impl::alloc_align<T>(VSIP_IMPL_ALLOC_ALIGNMENT, size);
+  C* R = impl::alloc_align<C>(VSIP_IMPL_ALLOC_ALIGNMENT, size);
+  C* Z = impl::alloc_align<C>(VSIP_IMPL_ALLOC_ALIGNMENT, size);
+
+  for (index_type i=0; i<size; ++i)
+  {
+    B[i] = T(i % 13) + T(1);
+    R[i] = Z[i] = C(T(i % 7), T(3) - T(i % 5));
+  }
+
+  C a(T(2), T(-1));
+  kernel_type::exec(a, B + offset, R + offset, n);
+
+  for (index_type i=0; i<n; ++i)
+    test_assert(equal(R[offset + i], Z[offset + i] + a * B[offset + i]));
+
+  impl::free_align(Z);
+  impl::free_align(R);
+  impl::free_align(B);
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+  length_type const sizes[] = { 4, 8, 16, 17, 64, 131 };
+  for (index_type s=0; s<sizeof(sizes)/sizeof(length_type); ++s)
+    for (index_type offset=0; offset<2; ++offset)
+    {
+      test_vma_ip_cSC<float>(sizes[s], offset);
+      test_vma_ip_cSC<double>(sizes[s], offset);
+    }
+}
@@ -0,0 +1,283 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/simd_math.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Test SIMD elementary functions.
+
+    Elementwise functions of views are checked against the scalar C
+    library.  When SIMD loop fusion is enabled, the expressions are
+    also checked to be evaluated by it.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cmath>
+#include <limits>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/math.hpp>
+#include <vsip/random.hpp>
+#include <vsip/selgen.hpp>
+#if !VSIP_IMPL_REF_IMPL
+#  include <vsip/opt/simd/simd_math.hpp>
+#  include <vsip/opt/simd/expr_evaluator.hpp>
+#endif
+
+#include <vsip_csl/test.hpp>
+
+using namespace vsip;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+// Check that got is within ulps units in the last place of ref.
+template <typename T>
+bool
+near(T got, T ref, T ulps)
+{
+  if (ref != ref)
+    return got != got;
+  if (std::fabs(ref) > std::numeric_limits<T>::max())
+    return got == ref;
+  T ulp = std::max(std::fabs(ref), std::numeric_limits<T>::min()) *
+          std::numeric_limits<T>::epsilon();
+  return std::fabs(got - ref) <= ulps * ulp;
+}
+
+template <typename T>
+bool
+near(complex<T> got, complex<T> ref, T ulps)
+{
+  T scale = std::max(std::fabs(ref.real()), std::fabs(ref.imag()));
+  T ulp   = std::max(scale, std::numeric_limits<T>::min()) *
+            std::numeric_limits<T>::epsilon();
+  return std::fabs(got.real() - ref.real()) <= ulps * ulp &&
+         std::fabs(got.imag() - ref.imag()) <= ulps * ulp;
+}
+
+
+
+#if VSIP_IMPL_HAVE_SIMD_LOOP_FUSION && VSIP_IMPL_SIMD_HAVE_MATH
+// Check that an assignment is evaluated by SIMD loop fusion.
+template <typename LB, typename RB>
+bool
+is_fused(LB&, RB&)
+{
+  return impl::Serial_expr_evaluator<1, LB, RB,
+				     impl::Simd_loop_fusion_tag>::ct_valid;
+}
+#  define CHECK_FUSED(Z, EXPR) test_assert(is_fused(Z.block(), (EXPR).block()))
+#else
+#  define CHECK_FUSED(Z, EXPR)
+#endif
+
+
+
+// Test elementwise functions of one real view against the C library.
+template <typename T>
+void
+test_real(length_type size)
+{
+  T const tol = 4;
+
+  Vector<T> A(size), B(size), Z(size);
+  Rand<T> gen(0, 0);
+  A = T(200) * gen.randu(size) - T(100);
+  B = T(4) * gen.randu(size) - T(2);
+
+  Z = exp(B * A / T(20));
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), T(std::exp(B.get(i) * A.get(i) / T(20))), tol));
+
+  Z = log(mag(A));
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), T(std::log(std::fabs(A.get(i)))), tol));
+
+  Z = log10(mag(B));
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), T(std::log10(std::fabs(B.get(i)))), tol));
+
+  Z = sqrt(mag(A));
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), T(std::sqrt(std::fabs(A.get(i)))), tol));
+
+  // sin and cos are checked against an absolute error, since near
+  // multiples of pi the relative error of the reduction is large.
+  Z = sin(A) + cos(B * A);
+  for (index_type i=0; i<size; ++i)
+    test_assert(std::fabs(Z.get(i) - (std::sin(A.get(i)) +
+				      std::cos(B.get(i) * A.get(i))))
+		<= 2 * tol * std::numeric_limits<T>::epsilon());
+
+  Z = atan2(A, B);
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), T(std::atan2(A.get(i), B.get(i))), tol));
+
+  // mag(exp(A*B)) stays in one fused loop.
+  CHECK_FUSED(Z, mag(exp(A * B / T(50))));
+  CHECK_FUSED(Z, atan2(A, B));
+  CHECK_FUSED(Z, sin(A) + cos(B * A));
+  Z = mag(exp(A * B / T(50)));
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i),
+		     T(std::fabs(std::exp(A.get(i) * B.get(i) / T(50)))), tol));
+}
+
+
+
+// Test elementwise functions of complex views.
+template <typename T>
+void
+test_complex(length_type size)
+{
+  typedef complex<T> C;
+  T const tol = 8;
+
+  Vector<T> A(size), R(size);
+  Vector<C> X(size), Y(size), Z(size);
+  Rand<T> gen(1, 0);
+  A = T(20) * gen.randu(size) - T(10);
+  X.real() = T(4) * gen.randu(size) - T(2);
+  X.imag() = T(20) * gen.randu(size) - T(10);
+  Y.real() = gen.randu(size);
+  Y.imag() = gen.randu(size);
+
+  CHECK_FUSED(Z, X * euler(A));
+  CHECK_FUSED(Z, exp(X));
+  CHECK_FUSED(R, mag(exp(X * Y)));
+  CHECK_FUSED(R, arg(X));
+
+  // Phase rotation.
+  Z = X * euler(A);
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), X.get(i) * std::polar(T(1), A.get(i)), tol));
+
+  Z = exp(X);
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), std::exp(X.get(i)), tol));
+
+  R = mag(exp(X * Y));
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(R.get(i), std::abs(std::exp(X.get(i) * Y.get(i))), tol));
+
+  R = arg(X);
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(R.get(i), std::arg(X.get(i)), tol));
+}
+
+
+
+// Test subviews whose offsets differ between the result and the
+// operands, including operators that change the size of the values.
+template <typename T>
+void
+test_offset(length_type size)
+{
+  typedef complex<T> C;
+  T const tol = 8;
+
+  Vector<T> A(size + 4), B(size + 4), R(size + 4);
+  Vector<C> X(size + 4), Z(size + 4);
+  Rand<T> gen(2, 0);
+  A = T(20) * gen.randu(size + 4) - T(10);
+  B = T(4) * gen.randu(size + 4) - T(2);
+  X.real() = T(4) * gen.randu(size + 4) - T(2);
+  X.imag() = T(4) * gen.randu(size + 4) - T(2);
+
+  for (index_type zo=0; zo<4; ++zo)
+    for (index_type ao=0; ao<4; ++ao)
+    {
+      Domain<1> zd(zo, 1, size);
+      Domain<1> ad(ao, 1, size);
+
+      R(zd) = mag(X(ad));
+      for (index_type i=0; i<size; ++i)
+	test_assert(near(R.get(zo + i), std::abs(X.get(ao + i)), tol));
+
+      R(zd) = arg(X(ad));
+      for (index_type i=0; i<size; ++i)
+	test_assert(near(R.get(zo + i), std::arg(X.get(ao + i)), tol));
+
+      Z(zd) = euler(A(ad));
+      for (index_type i=0; i<size; ++i)
+	test_assert(near(Z.get(zo + i), std::polar(T(1), A.get(ao + i)),
+			 tol));
+
+      Z(zd) = X(zd) * euler(A(ad));
+      for (index_type i=0; i<size; ++i)
+	test_assert(near(Z.get(zo + i),
+			 X.get(zo + i) * std::polar(T(1), A.get(ao + i)),
+			 tol));
+
+      R(zd) = exp(B(ad) * A(zd) / T(20));
+      for (index_type i=0; i<size; ++i)
+	test_assert(near(R.get(zo + i),
+			 T(std::exp(B.get(ao + i) * A.get(zo + i) / T(20))),
+			 tol));
+    }
+}
+
+
+
+// Special values, on vectors long enough to use the SIMD loop.
+template <typename T>
+void
+test_special()
+{
+  T const inf = std::numeric_limits<T>::infinity();
+  T const nan = std::numeric_limits<T>::quiet_NaN();
+  T const values[] = { T(0), -T(0), T(-1), inf, -inf, nan, T(1), T(2) };
+  length_type const n = sizeof(values) / sizeof(T);
+  length_type const size = 4 * n;
+
+  Vector<T> A(size), Z(size);
+  for (index_type i=0; i<size; ++i)
+    A.put(i, values[i % n]);
+
+  Z = exp(A);
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), T(std::exp(A.get(i))), T(2)));
+
+  Z = log(A);
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), T(std::log(A.get(i))), T(2)));
+
+  Z = sin(A);
+  for (index_type i=0; i<size; ++i)
+    test_assert(near(Z.get(i), T(std::sin(A.get(i))), T(2)));
+
+  // Large arguments fall back to the C library.
+  A = ramp(T(1e5), T(12345.678), size);
+  Z = cos(A);
+  for (index_type i=0; i<size; ++i)
+    test_assert(std::fabs(Z.get(i) - T(std::cos(A.get(i))))
+		<= 2 * std::numeric_limits<T>::epsilon());
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+  test_real<float>(1021);
+  test_real<double>(1021);
+
+  test_complex<float>(513);
+  test_complex<double>(513);
+
+  test_offset<float>(512);
+  test_offset<double>(509);
+
+  test_special<float>();
+  test_special<double>();
+}
@@ -0,0 +1,146 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/simd_wide.cpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Unit tests for runtime-dispatched SIMD kernels.
+
+    Each kernel is run for every instruction set supported by the
+    processor, on sizes and operand offsets that exercise the aligned
+    body, the peeled head, and the tail.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vector>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/complex.hpp>
+#include <vsip/opt/simd/vmul.hpp>
+#include <vsip/opt/simd/vadd.hpp>
+#include <vsip/opt/simd/rscvmul.hpp>
+#include <vsip/opt/simd/vma_ip_csc.hpp>
+#include <vsip/opt/simd/isa.hpp>
+
+#include <vsip_csl/test.hpp>
+
+using namespace vsip;
+using vsip_csl::equal;
+namespace simd = vsip::impl::simd;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+template <typename T>
+T
+value(int i)
+{
+  return T(i % 17) - T(8);
+}
+
+template <>
+complex<float>
+value(int i)
+{
+  return complex<float>(value<float>(i), value<float>(3*i+1));
+}
+
+template <>
+complex<double>
+value(int i)
+{
+  return complex<double>(value<double>(i), value<double>(3*i+1));
+}
+
+
+
+template <typename T>
+void
+test_vmul_vadd(int n, int offA, int offB, int offR)
+{
+  std::vector<T> A(n + 16), B(n + 16), R(n + 16);
+  for (int i=0; i<n+16; ++i)
+  {
+    A[i] = value<T>(i);
+    B[i] = value<T>(2*i + 5);
+  }
+
+  simd::vmul(&A[offA], &B[offB], &R[offR], n);
+  for (int i=0; i<n; ++i)
+    test_assert(equal(R[offR+i], A[offA+i] * B[offB+i]));
+
+  simd::vadd(&A[offA], &B[offB], &R[offR], n);
+  for (int i=0; i<n; ++i)
+    test_assert(equal(R[offR+i], A[offA+i] + B[offB+i]));
+}
+
+
+
+template <typename T>
+void
+test_rscvmul_vma(int n, int offB, int offR)
+{
+  typedef complex<T> C;
+  std::vector<T> S(n + 16);
+  std::vector<C> B(n + 16), R(n + 16), Z(n + 16);
+  for (int i=0; i<n+16; ++i)
+  {
+    S[i] = value<T>(i);
+    B[i] = value<C>(i + 3);
+  }
+
+  simd::rscvmul(T(3), &B[offB], &R[offR], n);
+  for (int i=0; i<n; ++i)
+    test_assert(equal(R[offR+i], T(3) * B[offB+i]));
+
+  C a(T(2), T(-1));
+  Z = R;
+  simd::vma_ip_cSC(a, &S[offB], &R[offR], n);
+  for (int i=0; i<n; ++i)
+    test_assert(equal(R[offR+i], Z[offR+i] + a * S[offB+i]));
+}
+
+
+
+void
+test_all()
+{
+  int const sizes[] = { 0, 1, 7, 16, 33, 64, 257, 1000 };
+  for (unsigned s=0; s<sizeof(sizes)/sizeof(int); ++s)
+  {
+    int n = sizes[s];
+    for (int off=0; off<3; ++off)
+    {
+      test_vmul_vadd<float>(n, off, 0, off);
+      test_vmul_vadd<float>(n, 0, off, 1);
+      test_vmul_vadd<double>(n, off, 1, 0);
+      test_vmul_vadd<complex<float> >(n, off, 0, 1);
+      test_vmul_vadd<complex<double> >(n, 0, off, off);
+      test_rscvmul_vma<float>(n, off, 1);
+      test_rscvmul_vma<double>(n, 0, off);
+    }
+  }
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+  simd::Isa detected = simd::detect_isa();
+
+  for (int i=simd::isa_native; i<=detected; ++i)
+  {
+    simd::set_isa(simd::Isa(i));
+    test_assert(simd::isa() == simd::Isa(i));
+    test_all();
+  }
+}
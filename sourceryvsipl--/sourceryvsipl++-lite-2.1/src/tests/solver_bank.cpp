@@ -0,0 +1,540 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved.
+
+   This file is available for license from CodeSourcery, Inc. under the terms
+   of a commercial license and under the GPL.  It is not part of the VSIPL++
+   reference implementation and is not available under the BSD license.
+*/
+/** @file    tests/solver_bank.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Unit tests for batched solvers.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cassert>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/tensor.hpp>
+#include <vsip/solvers.hpp>
+
+#include <vsip_csl/test.hpp>
+#include <vsip_csl/test-precision.hpp>
+#include <vsip_csl/solver_bank.hpp>
+#include "test-random.hpp"
+#include "solver-common.hpp"
+
+using namespace std;
+using namespace vsip;
+using namespace vsip_csl;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+// Copy problem P of tensor T into a matrix.
+
+template <typename T,
+	  typename Block>
+Matrix<T>
+problem(const_Tensor<T, Block> t, index_type p)
+{
+  Matrix<T> m(t.size(1), t.size(2));
+  for (index_type i=0; i<m.size(0); ++i)
+    for (index_type j=0; j<m.size(1); ++j)
+      m.put(i, j, t.get(p, i, j));
+  return m;
+}
+
+// Copy matrix M into problem P of tensor T.
+
+template <typename T,
+	  typename Block0,
+	  typename Block1>
+void
+set_problem(Tensor<T, Block0> t, index_type p, const_Matrix<T, Block1> m)
+{
+  for (index_type i=0; i<m.size(0); ++i)
+    for (index_type j=0; j<m.size(1); ++j)
+      t.put(p, i, j, m.get(i, j));
+}
+
+// Fill tensor T with random problems.
+
+template <typename T,
+	  typename Block>
+void
+randt(Tensor<T, Block> t)
+{
+  Matrix<T> m(t.size(1), t.size(2));
+  for (index_type p=0; p<t.size(0); ++p)
+  {
+    randm(m);
+    set_problem(t, p, m);
+  }
+}
+
+// Check that X solves A X = B, as by the solver tests.
+
+template <typename T,
+	  typename Block0,
+	  typename Block1,
+	  typename Block2>
+void
+check_solution(
+  const_Matrix<T, Block0> a,
+  const_Matrix<T, Block1> x,
+  const_Matrix<T, Block2> b)
+{
+  Matrix<T> chk(b.size(0), b.size(1));
+  prod(a, x, chk);
+  float err = prod_check(a, x, Matrix<T>(b));
+  if (err > 10.0)
+  {
+    for (index_type r=0; r<b.size(0); ++r)
+      for (index_type c=0; c<b.size(1); ++c)
+	test_assert(equal(b.get(r, c), chk.get(r, c)));
+  }
+}
+
+
+
+// Factor BATCH N x N matrices with Lud_bank and solve systems with
+// P right-hand sides.  The matrices are diagonally dominant with
+// rows rotated, so that pivoting is needed.
+
+template <typename T>
+void
+test_lud_bank(length_type batch, length_type n, length_type p)
+{
+  Tensor<T> a(batch, n, n);
+  Tensor<T> b(batch, n, p);
+  Tensor<T> x(batch, n, p);
+
+  Matrix<T> m(n, n);
+  for (index_type q=0; q<batch; ++q)
+  {
+    randm(m);
+    m.diag() += T(n);
+    for (index_type i=0; i<n; ++i)
+      for (index_type j=0; j<n; ++j)
+	a.put(q, (i + q) % n, j, m.get(i, j));
+  }
+  randt(b);
+
+  Lud_bank<T> lu(batch, n);
+  test_assert(lu.batch() == batch);
+  test_assert(lu.length() == n);
+  test_assert(lu.decompose(a));
+
+  mat_op_type const tr = Test_traits<T>::trans;
+
+  lu.template solve<mat_ntrans>(b, x);
+  for (index_type q=0; q<batch; ++q)
+    check_solution(problem(a, q), problem(x, q), problem(b, q));
+
+  lu.template solve<tr>(b, x);
+  for (index_type q=0; q<batch; ++q)
+  {
+    Matrix<T> aq = problem(a, q);
+    Matrix<T> at(n, n);
+    for (index_type i=0; i<n; ++i)
+      for (index_type j=0; j<n; ++j)
+	at.put(i, j, tconj(aq.get(j, i)));
+    check_solution(at, problem(x, q), problem(b, q));
+  }
+
+  // A single singular problem is reported.
+  for (index_type i=0; i<n; ++i)
+    for (index_type j=0; j<n; ++j)
+      a.put(batch / 2, i, j, T());
+  test_assert(!lu.decompose(a));
+}
+
+
+
+// Factor BATCH N x N positive definite matrices with Chold_bank,
+// reading only the UPLO triangle, and solve systems with P
+// right-hand sides.
+
+template <typename T>
+void
+test_chold_bank(mat_uplo uplo, length_type batch, length_type n,
+		length_type p)
+{
+  Tensor<T> a(batch, n, n);
+  Tensor<T> b(batch, n, p);
+  Tensor<T> x(batch, n, p);
+  std::vector<Matrix<T> > ref;
+
+  Matrix<T> m(n, n);
+  Matrix<T> c(n, n);
+  for (index_type q=0; q<batch; ++q)
+  {
+    randm(m);
+    prodh(m, m, c);
+    c.diag() += T(1);
+    ref.push_back(Matrix<T>(n, n));
+    ref.back() = c;
+
+    // Poison the triangle that is not read.
+    for (index_type i=0; i<n; ++i)
+      for (index_type j=0; j<n; ++j)
+	if (uplo == lower ? j > i : j < i)
+	  c.put(i, j, T(99));
+    set_problem(a, q, c);
+  }
+  randt(b);
+
+  Chold_bank<T> chol(uplo, batch, n);
+  test_assert(chol.uplo() == uplo);
+  test_assert(chol.length() == n);
+  test_assert(chol.decompose(a));
+
+  chol.solve(b, x);
+  for (index_type q=0; q<batch; ++q)
+    check_solution(ref[q], problem(x, q), problem(b, q));
+
+  // A single matrix that is not positive definite is reported.
+  for (index_type i=0; i<n; ++i)
+    a.put(batch - 1, i, i, T(-1));
+  test_assert(!chol.decompose(a));
+}
+
+
+
+// Factor BATCH M x N matrices with Qrd_bank, and check prodq, rsol,
+// covsol and lsqsol with P right-hand sides.
+
+template <typename T>
+void
+test_qrd_bank(length_type batch, length_type m, length_type n,
+	      length_type p)
+{
+  typedef typename vsip::impl::Scalar_of<T>::type scalar_type;
+  mat_op_type const tr = Test_traits<T>::trans;
+
+  Tensor<T> a(batch, m, n);
+  Tensor<T> b(batch, m, p);
+  Tensor<T> bn(batch, n, p);
+  randt(a);
+  randt(b);
+  randt(bn);
+
+  Qrd_bank<T> qr(batch, m, n);
+  test_assert(qr.rows() == m);
+  test_assert(qr.columns() == n);
+  test_assert(qr.decompose(a));
+
+  // R = Q^H A is upper triangular.
+  Tensor<T> r(batch, m, n);
+  qr.template prodq<tr>(a, r);
+  for (index_type q=0; q<batch; ++q)
+  {
+    scalar_type norm = scalar_type();
+    for (index_type i=0; i<m; ++i)
+      for (index_type j=0; j<n; ++j)
+	norm = std::max(norm, mag(a.get(q, i, j)));
+    for (index_type i=0; i<m; ++i)
+      for (index_type j=0; j<n && j<i; ++j)
+	test_assert(mag(r.get(q, i, j)) <=
+		    10 * m * norm * Precision_traits<scalar_type>::eps);
+  }
+
+  // Q Q^H B = B.
+  Tensor<T> y(batch, m, p);
+  Tensor<T> z(batch, m, p);
+  qr.template prodq<tr>(b, y);
+  qr.template prodq<mat_ntrans>(y, z);
+  for (index_type q=0; q<batch; ++q)
+    for (index_type i=0; i<m; ++i)
+      for (index_type j=0; j<p; ++j)
+	test_assert(equal(z.get(q, i, j), b.get(q, i, j)));
+
+  // Q1 B = Q [B; 0].
+  Tensor<T> b0(batch, m, p, T());
+  for (index_type q=0; q<batch; ++q)
+    for (index_type i=0; i<n; ++i)
+      for (index_type j=0; j<p; ++j)
+	b0.put(q, i, j, bn.get(q, i, j));
+  qr.template prodq<mat_ntrans>(bn, y);
+  qr.template prodq<mat_ntrans>(b0, z);
+  for (index_type q=0; q<batch; ++q)
+    for (index_type i=0; i<m; ++i)
+      for (index_type j=0; j<p; ++j)
+	test_assert(equal(y.get(q, i, j), z.get(q, i, j)));
+
+  // rsol: R X = alpha B and R^H X = alpha B.
+  T const alpha = Test_traits<T>::value2();
+  Tensor<T> x(batch, n, p);
+  Tensor<T> ab(batch, n, p);
+  for (index_type q=0; q<batch; ++q)
+    for (index_type i=0; i<n; ++i)
+      for (index_type j=0; j<p; ++j)
+	ab.put(q, i, j, alpha * bn.get(q, i, j));
+
+  qr.template rsol<mat_ntrans>(bn, alpha, x);
+  for (index_type q=0; q<batch; ++q)
+  {
+    Matrix<T> rq(n, n, T());
+    for (index_type i=0; i<n; ++i)
+      for (index_type j=i; j<n; ++j)
+	rq.put(i, j, r.get(q, i, j));
+    check_solution(rq, problem(x, q), problem(ab, q));
+  }
+
+  qr.template rsol<tr>(bn, alpha, x);
+  for (index_type q=0; q<batch; ++q)
+  {
+    Matrix<T> rh(n, n, T());
+    for (index_type i=0; i<n; ++i)
+      for (index_type j=i; j<n; ++j)
+	rh.put(j, i, tconj(r.get(q, i, j)));
+    check_solution(rh, problem(x, q), problem(ab, q));
+  }
+
+  // covsol: A^H A X = B.
+  qr.covsol(bn, x);
+  for (index_type q=0; q<batch; ++q)
+  {
+    Matrix<T> aq = problem(a, q);
+    Matrix<T> c(n, n);
+    prodh(aq, aq, c);
+    check_solution(c, problem(x, q), problem(bn, q));
+  }
+
+  // lsqsol: A^H A X = A^H B.
+  qr.lsqsol(b, x);
+  for (index_type q=0; q<batch; ++q)
+  {
+    Matrix<T> aq = problem(a, q);
+    Matrix<T> c(n, n);
+    Matrix<T> d(n, p);
+    prodh(aq, aq, c);
+    prodh(aq, problem(b, q), d);
+    check_solution(c, problem(x, q), d);
+  }
+}
+
+
+
+// Fill row P of R with the biased autocorrelation lags of a random
+// sequence, r(m) = sum x(t + m) conj(x(t)), so that toeplitz(R(p, :))
+// is positive definite.
+
+template <typename T,
+	  typename Block>
+void
+set_autocorr(Matrix<T, Block> r, index_type p)
+{
+  length_type n = r.size(1);
+  Vector<T> x(4 * n);
+  randv(x);
+  for (index_type m=0; m<n; ++m)
+  {
+    T acc = T();
+    for (index_type t=0; t+m<x.size(); ++t)
+      acc += x.get(t + m) * tconj(x.get(t));
+    r.put(p, m, acc / T(x.size()));
+  }
+}
+
+// Return the Hermitian Toeplitz matrix with first column C.
+
+template <typename T,
+	  typename Block>
+Matrix<T>
+toeplitz_col(const_Vector<T, Block> c)
+{
+  length_type n = c.size();
+  Matrix<T> m(n, n);
+  for (index_type i=0; i<n; ++i)
+    for (index_type j=0; j<n; ++j)
+      m.put(i, j, i >= j ? c.get(i - j) : tconj(c.get(j - i)));
+  return m;
+}
+
+template <typename T,
+	  typename Block>
+Matrix<T>
+column(const_Vector<T, Block> v)
+{
+  Matrix<T> m(v.size(), 1);
+  m.col(0) = v;
+  return m;
+}
+
+
+
+// Solve BATCH Toeplitz systems of size N, one per row, and systems
+// with a shared matrix and BATCH right-hand sides.
+
+template <typename T>
+void
+test_toepsol_bank(length_type batch, length_type n)
+{
+  Matrix<T> t(batch, n);
+  Matrix<T> b(batch, n);
+  Matrix<T> x(batch, n);
+  for (index_type p=0; p<batch; ++p)
+    set_autocorr(t, p);
+  randm(b);
+
+  // toeplitz(t) has first row t, that is first column conj(t).
+  test_assert(vsip_csl::toepsol(t, b, x));
+  for (index_type p=0; p<batch; ++p)
+  {
+    Vector<T> c(n);
+    for (index_type i=0; i<n; ++i)
+      c.put(i, tconj(t.get(p, i)));
+    check_solution(toeplitz_col(c), column(x.row(p)), column(b.row(p)));
+  }
+
+  Vector<T> t0(n);
+  t0 = t.row(0);
+  Vector<T> c(n);
+  for (index_type i=0; i<n; ++i)
+    c.put(i, tconj(t0.get(i)));
+  x = T();
+  test_assert(vsip_csl::toepsol(t0, b, x));
+  for (index_type p=0; p<batch; ++p)
+    check_solution(toeplitz_col(c), column(x.row(p)), column(b.row(p)));
+
+  // A single matrix that is not positive definite is reported.
+  t.put(batch - 1, 0, T(-1));
+  test_assert(!vsip_csl::toepsol(t, b, x));
+}
+
+
+
+// Find the predictors of order N - 1 of BATCH autocorrelation
+// sequences.
+
+template <typename T>
+void
+test_levinson(length_type batch, length_type n)
+{
+  typedef typename vsip::impl::Scalar_of<T>::type scalar_type;
+
+  Matrix<T> r(batch, n);
+  Matrix<T> a(batch, n);
+  Vector<scalar_type> e(batch);
+  for (index_type p=0; p<batch; ++p)
+    set_autocorr(r, p);
+
+  test_assert(levinson(r, a, e));
+  for (index_type p=0; p<batch; ++p)
+  {
+    test_assert(a.get(p, 0) == T(1));
+    Matrix<T> rhs(n, 1, T());
+    rhs.put(0, 0, T(e.get(p)));
+    check_solution(toeplitz_col(r.row(p)), column(a.row(p)), rhs);
+  }
+
+  r.put(batch / 2, 0, T());
+  test_assert(!levinson(r, a, e));
+}
+
+template <typename T>
+void
+test_split_levinson(length_type batch, length_type n)
+{
+  Matrix<T> r(batch, n);
+  Matrix<T> a(batch, n);
+  Matrix<T> a_ref(batch, n);
+  Vector<T> e(batch);
+  Vector<T> e_ref(batch);
+  for (index_type p=0; p<batch; ++p)
+    set_autocorr(r, p);
+
+  test_assert(levinson(r, a_ref, e_ref));
+  test_assert(split_levinson(r, a, e));
+  for (index_type p=0; p<batch; ++p)
+  {
+    test_assert(equal(e.get(p), e_ref.get(p)));
+    for (index_type i=0; i<n; ++i)
+      test_assert(equal(a.get(p, i), a_ref.get(p, i)));
+  }
+
+  if (n > 1)
+    r.put(batch / 2, 1, 2 * r.get(batch / 2, 0));
+  else
+    r.put(batch / 2, 0, T(-1));
+  test_assert(!split_levinson(r, a, e));
+}
+
+
+
+template <typename T>
+void
+bank_cases()
+{
+  test_lud_bank<T>(37,  1, 2);
+  test_lud_bank<T>(37,  5, 3);
+  test_lud_bank<T>(16, 17, 2);
+  test_lud_bank<T>(3,   8, 1);
+
+  test_chold_bank<T>(lower, 37,  1, 2);
+  test_chold_bank<T>(lower, 37,  5, 3);
+  test_chold_bank<T>(upper, 37,  5, 3);
+  test_chold_bank<T>(upper, 20, 17, 2);
+
+  test_qrd_bank<T>(37,  1,  1, 2);
+  test_qrd_bank<T>(37,  5,  5, 3);
+  test_qrd_bank<T>(37,  5,  3, 3);
+  test_qrd_bank<T>(20, 17, 11, 2);
+
+  test_toepsol_bank<T>(37,  1);
+  test_toepsol_bank<T>(37,  2);
+  test_toepsol_bank<T>(37,  5);
+  test_toepsol_bank<T>(20, 16);
+
+  test_levinson<T>(37,  1);
+  test_levinson<T>(37,  2);
+  test_levinson<T>(37,  6);
+  test_levinson<T>(20, 17);
+}
+
+template <typename T>
+void
+split_cases()
+{
+  test_split_levinson<T>(37,  1);
+  test_split_levinson<T>(37,  2);
+  test_split_levinson<T>(37,  3);
+  test_split_levinson<T>(37,  6);
+  test_split_levinson<T>(20, 17);
+}
+
+
+
+/***********************************************************************
+  Main
+***********************************************************************/
+
+template <> float  Precision_traits<float>::eps = 0.0;
+template <> double Precision_traits<double>::eps = 0.0;
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+  Precision_traits<float>::compute_eps();
+  Precision_traits<double>::compute_eps();
+
+  bank_cases<float>();
+  bank_cases<double>();
+  bank_cases<complex<float> >();
+  bank_cases<complex<double> >();
+
+  split_cases<float>();
+  split_cases<double>();
+}
@@ -0,0 +1,200 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/threaded_expr.cpp
+    @author  agent
+    @date    2026-10-16
+    @brief   VSIPL++ Library: Test large elementwise expressions.
+
+    Sizes are chosen above the default thread-pool threshold so that
+    the threaded loop-fusion evaluator is exercised when enabled,
+    including unaligned heads and partial tails.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <cstring>
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/vector.hpp>
+#include <vsip/matrix.hpp>
+#include <vsip/math.hpp>
+#include <vsip/random.hpp>
+#include <vsip/selgen.hpp>
+#if defined(VSIP_IMPL_HAVE_SIMD_LOOP_FUSION) && \
+    defined(VSIP_IMPL_HAVE_THREAD_POOL)
+#  define TEST_THREADED_SELECTION 1
+#  include <vsip/opt/diag/eval.hpp>
+#endif
+
+#include <vsip_csl/test.hpp>
+
+using namespace vsip;
+using vsip_csl::equal;
+
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+#if TEST_THREADED_SELECTION
+// Return the name of the evaluator that Serial_dispatch selects from
+// TagList for LB = RB, or 0 if there is none.
+
+template <typename LB,
+	  typename RB,
+	  typename TagList = impl::LibraryTagList>
+struct Selected_evaluator
+{
+  typedef impl::Serial_expr_evaluator<1, LB, RB, typename TagList::first>
+		see_type;
+  typedef impl::diag_detail::Check_rt_valid<see_type, LB, RB> check_type;
+
+  static char const* name(LB& lhs, RB const& rhs)
+  {
+    if (check_type::rt_valid(lhs, rhs))
+      return check_type::name();
+    return Selected_evaluator<LB, RB, typename TagList::rest>::name(lhs, rhs);
+  }
+};
+
+template <typename LB,
+	  typename RB>
+struct Selected_evaluator<LB, RB, impl::None_type>
+{
+  static char const* name(LB&, RB const&) { return 0; }
+};
+
+
+
+// Check that Z = EXPR is evaluated by the threaded loop-fusion
+// evaluator.
+
+template <typename T,
+	  typename BlockT>
+void
+check_threaded(Vector<T> Z, const_Vector<T, BlockT> expr)
+{
+  char const* name =
+    Selected_evaluator<typename Vector<T>::block_type, BlockT>
+      ::name(Z.block(), expr.block());
+  test_assert(name && !strcmp(name, "Expr_SIMD_Thread_Loop"));
+}
+
+
+
+template <typename T>
+void
+test_selected(length_type size)
+{
+  Vector<T> A(size, T(1));
+  Vector<T> B(size, T(2));
+  Vector<T> Z(size);
+
+  check_threaded(Z, A * B + A);
+  check_threaded(Z, T(2) * A - B);
+}
+#endif
+
+
+template <typename T>
+void
+test_vma(length_type size, index_type offset)
+{
+  Vector<T> A(size + offset);
+  Vector<T> B(size + offset);
+  Vector<T> C(size + offset);
+  Vector<T> Z(size + offset, T(-1));
+
+  Rand<T> gen(0, 0);
+  A = gen.randu(size + offset);
+  B = gen.randu(size + offset);
+  C = gen.randu(size + offset);
+
+  Domain<1> dom(offset, 1, size);
+  Z(dom) = A(dom) * B(dom) + C(dom);
+
+  for (index_type i=0; i<offset; ++i)
+    test_assert(equal(Z.get(i), T(-1)));
+  for (index_type i=offset; i<size+offset; ++i)
+    test_assert(equal(Z.get(i), A.get(i) * B.get(i) + C.get(i)));
+}
+
+
+
+template <typename T>
+void
+test_vmul_scalar(length_type size)
+{
+  Vector<T> A(size);
+  Vector<T> Z(size);
+
+  A = ramp(T(0), T(1), size);
+  Z = T(2) * A - A;
+
+  for (index_type i=0; i<size; ++i)
+    test_assert(equal(Z.get(i), A.get(i)));
+}
+
+
+
+template <typename T>
+void
+test_matrix(length_type rows, length_type cols)
+{
+  Matrix<T> A(rows, cols);
+  Matrix<T> B(rows, cols);
+  Matrix<T> Z(rows, cols);
+
+  Rand<T> gen(1, 0);
+  A = gen.randu(rows, cols);
+  B = gen.randu(rows, cols);
+
+  Z = A * B + A;
+
+  for (index_type r=0; r<rows; ++r)
+    for (index_type c=0; c<cols; ++c)
+      test_assert(equal(Z.get(r, c), A.get(r, c) * B.get(r, c) + A.get(r, c)));
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+  // Use several workers, so that the threaded evaluator is selected
+  // however many processors there are.
+  char  opt_workers[] = "--svpp-num-workers";
+  char  num_workers[] = "4";
+  char* args[64];
+  int   nargs = 0;
+  for (int i=0; i<argc && i<60; ++i)
+    args[nargs++] = argv[i];
+  args[nargs++] = opt_workers;
+  args[nargs++] = num_workers;
+  args[nargs] = 0;
+  char** use_argv = args;
+
+  vsipl init(nargs, use_argv);
+
+#if TEST_THREADED_SELECTION
+  test_selected<float>(262144);
+  test_selected<complex<float> >(131072);
+#endif
+
+  test_vma<float>(1024, 0);
+  test_vma<float>(65536, 0);
+  test_vma<float>(262144 + 7, 1);
+  test_vma<float>(262144 + 5, 3);
+  test_vma<double>(262144 + 3, 1);
+  test_vma<complex<float> >(131072 + 1, 1);
+
+  test_vmul_scalar<float>(200003);
+  test_vmul_scalar<double>(200003);
+
+  test_matrix<float>(300, 301);
+  test_matrix<complex<float> >(257, 256);
+}
@@ -0,0 +1,163 @@
+/* Copyright (c) 2026 by CodeSourcery, Inc.  All rights reserved. */
+
+/** @file    tests/vsip_csl/histogram.cpp
+    @author  agent
+    @date    2026-10-17
+    @brief   VSIPL++ Library: Unit tests for weighted and joint histograms.
+*/
+
+/***********************************************************************
+  Included Files
+***********************************************************************/
+
+#include <vsip/initfin.hpp>
+#include <vsip/support.hpp>
+#include <vsip/signal.hpp>
+#include <vsip/random.hpp>
+#include <vsip_csl/histogram.hpp>
+#include <vsip_csl/test.hpp>
+
+using namespace vsip;
+using namespace vsip_csl;
+
+
+/***********************************************************************
+  Definitions
+***********************************************************************/
+
+// Compare a weighted histogram of a vector, and of a strided view of
+// it, with weights summed in the bins of Histogram.
+
+template <typename T,
+          typename W>
+void
+test_weighted_vector( length_type size )
+{
+  Rand<T> rgen(0);
+  Vector<T> v(size);
+  Vector<W> w(size);
+  v = rgen.randu(size) * 10 - 1;
+  w = rgen.randu(size);
+
+  Histogram<const_Vector, T>          h(0, 8, 10);
+  Weighted_histogram<const_Vector, T, W> wh(0, 8, 10);
+
+  Vector<W> q(10);
+  q = wh(v, w);
+
+  Vector<W> ref(10, W(0));
+  for ( index_type i = 0; i < size; ++i )
+    ref(h.impl_bin(v(i))) += w(i);
+  for ( index_type b = 0; b < 10; ++b )
+    test_assert( equal(q(b), ref(b)) );
+
+  Domain<1> dom(0, 2, size / 2);
+  q = wh(v(dom), w(dom), true);
+
+  for ( index_type i = 0; i < dom.size(); ++i )
+    ref(h.impl_bin(v(2 * i))) += w(2 * i);
+  for ( index_type b = 0; b < 10; ++b )
+    test_assert( equal(q(b), ref(b)) );
+}
+
+
+
+// Compare a weighted histogram of a matrix with weights summed in the
+// bins of Histogram.
+
+template <typename T,
+          typename W>
+void
+test_weighted_matrix( length_type rows, length_type cols )
+{
+  Rand<T> rgen(1);
+  Matrix<T> m(rows, cols);
+  Matrix<W, Dense<2, W, col2_type> > w(rows, cols);
+  m = rgen.randu(rows, cols) * 10 - 1;
+  w = rgen.randu(rows, cols);
+
+  Histogram<const_Matrix, T>          h(0, 8, 6);
+  Weighted_histogram<const_Matrix, T, W> wh(0, 8, 6);
+
+  Vector<W> q(6);
+  q = wh(m, w);
+
+  Vector<W> ref(6, W(0));
+  for ( index_type i = 0; i < rows; ++i )
+    for ( index_type j = 0; j < cols; ++j )
+      ref(h.impl_bin(m(i, j))) += w(i, j);
+  for ( index_type b = 0; b < 6; ++b )
+    test_assert( equal(q(b), ref(b)) );
+}
+
+
+
+// Compare a joint histogram of two images, and of subimages, with
+// counts of the pairs of bins of Histogram.
+
+template <typename T>
+void
+test_joint( length_type rows, length_type cols )
+{
+  Rand<T> rgen(2);
+  Matrix<T> x(rows, cols);
+  Matrix<T> y(rows, cols);
+  x = rgen.randu(rows, cols) * 10 - 1;
+  y = rgen.randn(rows, cols);
+
+  Histogram<const_Matrix, T> hx(0, 8, 10);
+  Histogram<const_Matrix, T> hy(-2, 2, 7);
+  Joint_histogram<const_Matrix, T> jh(0, 8, 10, -2, 2, 7);
+
+  Matrix<scalar_i> q(10, 7);
+  q = jh(x, y);
+
+  Matrix<scalar_i> ref(10, 7, 0);
+  for ( index_type i = 0; i < rows; ++i )
+    for ( index_type j = 0; j < cols; ++j )
+      ref(hx.impl_bin(x(i, j)), hy.impl_bin(y(i, j)))++;
+  for ( index_type a = 0; a < 10; ++a )
+    for ( index_type b = 0; b < 7; ++b )
+      test_assert( q(a, b) == ref(a, b) );
+
+  Domain<2> dom(Domain<1>(1, 1, rows - 1), Domain<1>(0, 1, cols - 1));
+  q = jh(x(dom), y(dom), true);
+
+  for ( index_type i = 1; i < rows; ++i )
+    for ( index_type j = 0; j + 1 < cols; ++j )
+      ref(hx.impl_bin(x(i, j)), hy.impl_bin(y(i, j)))++;
+  for ( index_type a = 0; a < 10; ++a )
+    for ( index_type b = 0; b < 7; ++b )
+      test_assert( q(a, b) == ref(a, b) );
+
+  Joint_histogram<const_Vector, T> jv(0, 8, 10, -2, 2, 7);
+  q = jv(x.row(3), y.row(3));
+
+  ref = 0;
+  for ( index_type j = 0; j < cols; ++j )
+    ref(hx.impl_bin(x(3, j)), hy.impl_bin(y(3, j)))++;
+  for ( index_type a = 0; a < 10; ++a )
+    for ( index_type b = 0; b < 7; ++b )
+      test_assert( q(a, b) == ref(a, b) );
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+  vsipl init(argc, argv);
+
+  test_weighted_vector<float, float>( 1024 );
+  test_weighted_vector<float, float>( 100001 );
+  test_weighted_matrix<float, float>( 300, 200 );
+  test_joint<float>( 500, 400 );
+
+#if VSIP_IMPL_TEST_DOUBLE
+  test_weighted_vector<double, double>( 100001 );
+  test_weighted_matrix<double, double>( 300, 200 );
+  test_joint<double>( 500, 400 );
+#endif
+
+  return EXIT_SUCCESS;
+}
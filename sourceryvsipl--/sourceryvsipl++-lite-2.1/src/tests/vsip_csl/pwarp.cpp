@@ -22,6 +22,9 @@
 #endif
 #include <string>
 #include <sstream>
+#include <limits>
+#include <cmath>
+#include <algorithm>
 
 #include <vsip/initfin.hpp>
 #include <vsip/support.hpp>
@@ -531,6 +534,241 @@ test_perspective_obj(
 }
 
 
+// Reference bicubic perspective warp of a real image, with the same
+// incremental projection as ref::pwarp_incremental.
+
+template <typename CoeffT>
+void
+keys_weights(CoeffT t, CoeffT* w)
+{
+  // Keys cubic convolution kernel, a = -1/2, at distances 1 + t, t,
+  // 1 - t and 2 - t.
+  CoeffT const a = CoeffT(-0.5);
+  CoeffT d[4] = { 1 + t, t, 1 - t, 2 - t };
+  for (int k = 0; k < 4; ++k)
+  {
+    CoeffT x = d[k];
+    w[k] = x <= 1 ? ((a + 2) * x - (a + 3)) * x * x + 1
+                  : ((a * x - 5 * a) * x + 8 * a) * x - 4 * a;
+  }
+}
+
+template <typename CoeffT,
+	  typename T>
+void
+ref_pwarp_cubic(
+  Matrix<CoeffT> P,
+  Matrix<T>      in,
+  Matrix<T>      out)
+{
+  using vsip_csl::img::impl::apply_proj_w;
+
+  index_type rows = out.size(0);
+  index_type cols = out.size(1);
+  stride_type in_rows = in.size(0);
+  stride_type in_cols = in.size(1);
+
+  CoeffT u_0, v_0, w_0, u_1, v_1, w_1;
+  apply_proj_w<CoeffT>(P, 0.,     0., u_0, v_0, w_0);
+  apply_proj_w<CoeffT>(P, cols-1, 0., u_1, v_1, w_1);
+  CoeffT u_delta = (u_1 - u_0) / (cols-1);
+  CoeffT v_delta = (v_1 - v_0) / (cols-1);
+  CoeffT w_delta = (w_1 - w_0) / (cols-1);
+
+  for (index_type r=0; r<rows; ++r)
+  {
+    CoeffT u_base, v_base, w_base;
+    apply_proj_w<CoeffT>(P, 0., static_cast<CoeffT>(r),
+			 u_base, v_base, w_base);
+
+    for (index_type c=0; c<cols; ++c)
+    {
+      CoeffT w =  w_base + c*w_delta;
+      CoeffT u = (u_base + c*u_delta) / w;
+      CoeffT v = (v_base + c*v_delta) / w;
+
+      if (!(u >= 0 && u <= in_cols-1 && v >= 0 && v <= in_rows-1))
+      {
+	out.put(r, c, T());
+	continue;
+      }
+
+      stride_type u0 = static_cast<stride_type>(u);
+      stride_type v0 = static_cast<stride_type>(v);
+      CoeffT wu[4], wv[4];
+      keys_weights<CoeffT>(u - u0, wu);
+      keys_weights<CoeffT>(v - v0, wv);
+
+      CoeffT z = CoeffT();
+      for (stride_type j=0; j<4; ++j)
+	for (stride_type i=0; i<4; ++i)
+	{
+	  stride_type y = std::min(std::max(v0 + j - 1, stride_type(0)),
+				   in_rows - 1);
+	  stride_type x = std::min(std::max(u0 + i - 1, stride_type(0)),
+				   in_cols - 1);
+	  z += wv[j] * wu[i] * in.get(y, x);
+	}
+
+      if (std::numeric_limits<T>::is_integer)
+      {
+	CoeffT lo = std::numeric_limits<T>::min();
+	CoeffT hi = std::numeric_limits<T>::max();
+	CoeffT zr = std::floor(z + CoeffT(0.5));
+	out.put(r, c, T(zr < lo ? lo : zr > hi ? hi : zr));
+      }
+      else
+	out.put(r, c, T(z));
+    }
+  }
+}
+
+
+
+// Compare bicubic warps with the reference.
+
+template <typename CoeffT,
+	  typename T>
+void
+test_pwarp_cubic(
+  length_type rows,
+  length_type cols,
+  int         tc)
+{
+  using vsip::impl::view_cast;
+  using vsip_csl::img::Perspective_warp;
+  using vsip_csl::img::interp_cubic;
+  using vsip_csl::img::forward;
+
+  Matrix<T>      src(rows, cols);
+  Matrix<T>      dst(rows, cols);
+  Matrix<T>      chk(rows, cols);
+  Matrix<CoeffT> P(3, 3);
+
+  setup_pattern(4, src, 32, 16, T(200));
+  setup_p(P, tc);
+
+  Perspective_warp<CoeffT, T, interp_cubic, forward>
+    warp(P, Domain<2>(rows, cols));
+
+  warp(src, dst);
+  ref_pwarp_cubic(P, src, chk);
+
+  // The bicubic kernel interpolates: the identity and integer shifts
+  // reproduce the source.
+  if (tc == 0)
+    test_assert(view_equal(dst, src));
+  else if (tc == 3)
+  {
+    Domain<2> dom(rows, Domain<1>(0, 1, cols - 8));
+    Domain<2> src_dom(rows, Domain<1>(8, 1, cols - 8));
+    test_assert(view_equal(dst(dom), src(src_dom)));
+  }
+
+  // Integer pixels may be rounded differently.
+  if (std::numeric_limits<T>::is_integer)
+  {
+    Index<2> idx;
+    test_assert(maxval(mag(view_cast<int>(dst) - view_cast<int>(chk)), idx)
+		<= 1);
+  }
+  else
+  {
+    float error = error_db(dst, chk);
+#if VERBOSE > 0
+    std::cout << "cubic " << rows << " x " << cols << " tc: " << tc
+	      << "  error: " << error << std::endl;
+#endif
+    test_assert(error <= -100);
+  }
+}
+
+
+
+// Check a warp of complex pixels against the warps of their real and
+// imaginary parts.
+
+template <typename CoeffT,
+	  typename T,
+	  vsip_csl::img::interpolate_type InterpT>
+void
+test_pwarp_complex(
+  length_type rows,
+  length_type cols,
+  int         tc)
+{
+  using vsip_csl::img::Perspective_warp;
+  using vsip_csl::img::forward;
+
+  Matrix<complex<T> > src(rows, cols);
+  Matrix<complex<T> > dst(rows, cols);
+  Matrix<T>           re(rows, cols);
+  Matrix<T>           im(rows, cols);
+  Matrix<T>           dst_re(rows, cols);
+  Matrix<T>           dst_im(rows, cols);
+  Matrix<CoeffT>      P(3, 3);
+
+  setup_pattern(4, re, 32, 16, T(255));
+  setup_pattern(1, im, 8, 8, T(-10));
+  src = cmplx(re, im);
+  setup_p(P, tc);
+
+  Perspective_warp<CoeffT, complex<T>, InterpT, forward>
+    cwarp(P, Domain<2>(rows, cols));
+  Perspective_warp<CoeffT, T, InterpT, forward>
+    warp(P, Domain<2>(rows, cols));
+
+  cwarp(src, dst);
+  warp(re, dst_re);
+  warp(im, dst_im);
+
+  test_assert(view_equal(dst.real(), dst_re));
+  test_assert(view_equal(dst.imag(), dst_im));
+}
+
+
+
+// Check a bilinear warp against ref::pwarp_incremental, for a dense
+// source image and for a source image with non-unit strides.
+
+template <typename CoeffT,
+	  typename T>
+void
+test_pwarp_linear(
+  length_type rows,
+  length_type cols,
+  int         tc)
+{
+  using vsip_csl::img::Perspective_warp;
+  using vsip_csl::img::interp_linear;
+  using vsip_csl::img::forward;
+
+  Matrix<T>      src(rows, cols);
+  Matrix<T>      big(rows, 2 * cols, T());
+  Matrix<T>      dst(rows, cols);
+  Matrix<T>      dst2(rows, cols);
+  Matrix<T>      chk(rows, cols);
+  Matrix<CoeffT> P(3, 3);
+
+  setup_pattern(4, src, 32, 16, T(255));
+  setup_p(P, tc);
+
+  Domain<2> strided(rows, Domain<1>(0, 2, cols));
+  big(strided) = src;
+
+  Perspective_warp<CoeffT, T, interp_linear, forward>
+    warp(P, Domain<2>(rows, cols));
+
+  warp(src, dst);
+  warp(big(strided), dst2);
+  vsip_csl::ref::pwarp_incremental(P, src, chk);
+
+  test_assert(view_equal(dst, chk));
+  test_assert(view_equal(dst2, chk));
+}
+
+
+
 #if TEST_TYPES
 void
 test_types(
@@ -561,6 +799,34 @@ test_types(
 #endif
 
 
+
+void
+test_interp(
+  length_type rows,
+  length_type cols)
+{
+  typedef unsigned char byte_t;
+
+  for (index_type i=0; i<NUM_TCS; ++i)
+  {
+    test_pwarp_linear<float,  float>         (rows, cols, i);
+    test_pwarp_linear<float,  byte_t>        (rows, cols, i);
+    test_pwarp_linear<float,  unsigned short>(rows, cols, i);
+    test_pwarp_linear<double, double>        (rows, cols, i);
+
+    test_pwarp_cubic<float,  float>         (rows, cols, i);
+    test_pwarp_cubic<float,  byte_t>        (rows, cols, i);
+    test_pwarp_cubic<double, unsigned short>(rows, cols, i);
+    test_pwarp_cubic<double, double>        (rows, cols, i);
+
+    test_pwarp_complex<float,  float,  vsip_csl::img::interp_linear>
+      (rows, cols, i);
+    test_pwarp_complex<double, double, vsip_csl::img::interp_cubic>
+      (rows, cols, i);
+  }
+}
+
+
 int
 main(int argc, char** argv)
 {
@@ -574,6 +840,9 @@ main(int argc, char** argv)
   test_types(512,   512, 32, 16);
 #endif
 
+  test_interp(480, 640);
+  test_interp(97,  131);
+
   // Standalone examples for debugging.
   // test_perspective_obj<float, byte_t>("obj-uchar", 1080, 1920, 32, 16);
   // test_pwarp_obj<float, byte_t>("obj-uchar", 480, 640, 32, 16, 5);
@@ -19,6 +19,10 @@
 #include <vsip/signal.hpp>
 #include <vsip/vector.hpp>
 #include <vsip_csl/test.hpp>
+#include <vector>
+#if VSIP_IMPL_HAVE_THREAD_POOL
+#  include <vsip/core/threads/pool.hpp>
+#endif
 
 #if VSIP_IMPL_SAL_FFT
 #  define TEST_NON_POWER_OF_2  0
@@ -98,6 +102,150 @@ const scalar_f testvec_kaiser[] =
 };
 
 
+
+// Compare a window with reference weights computed in double precision.
+
+template <typename Func>
+void
+test_window( const_Vector<scalar_f> v, Func ref )
+{
+  for ( index_type n = 0; n < v.size(); ++n )
+    test_assert( std::abs(v.get(n) - ref(n, v.size())) < 1e-5 );
+}
+
+struct Blackman_ref
+{
+  double operator()(index_type n, length_type len) const
+  {
+    double t = 2 * VSIP_IMPL_PI * n / (len - 1);
+    return 0.42 - 0.5 * cos(t) + 0.08 * cos(2 * t);
+  }
+};
+
+struct Hanning_ref
+{
+  double operator()(index_type n, length_type len) const
+  {
+    return 0.5 * (1 - cos(2 * VSIP_IMPL_PI * (n + 1) / (len + 1)));
+  }
+};
+
+struct Kaiser_ref
+{
+  Kaiser_ref(double beta) : beta_(beta) {}
+
+  double operator()(index_type n, length_type len) const
+  {
+    double c3 = 2.0 * n / (len - 1) - 1;
+    return impl::bessel_I_0(beta_ * sqrt(1 - c3 * c3)) /
+      impl::bessel_I_0(beta_);
+  }
+
+  double beta_;
+};
+
+
+
+// Compare a Chebyshev window with the weights computed from a direct
+// DFT of its frequency response.
+
+void
+test_cheby( length_type len, scalar_f ripple )
+{
+  double dp = pow( 10.0, -ripple / 20.0 );
+  double df = acos( 1.0 / cosh( acosh( (1.0 + dp) / dp) / (len - 1.0) ) )
+    / VSIP_IMPL_PI;
+  double x0 = (3.0 - cos( 2 * VSIP_IMPL_PI * df )) /
+    (1.0 + cos( 2 * VSIP_IMPL_PI * df ));
+  double alpha = (x0 + 1.0) / 2.0;
+  double beta  = (x0 - 1.0) / 2.0;
+  double order = (len - 1.0) / 2.0;
+
+  std::vector<std::complex<double> > wf(len);
+  for ( index_type k = 0; k < len; ++k )
+  {
+    double x = alpha * cos( 2 * VSIP_IMPL_PI * k / len ) + beta;
+    double w = x > 1.0 ? cosh( order * acosh(x) )
+                       : cos( order * acos( std::max(x, -1.0) ) );
+    wf[k] = w;
+    if ( len % 2 == 0 )
+    {
+      wf[k] *= std::polar(1.0, -VSIP_IMPL_PI * k / len);
+      if ( k >= len / 2 )
+        wf[k] = -wf[k];
+    }
+  }
+
+  Vector<scalar_f> wt(len);
+  for ( index_type n = 0; n < len; ++n )
+  {
+    std::complex<double> sum = 0;
+    for ( index_type k = 0; k < len; ++k )
+      sum += wf[k] * std::polar(1.0, -2 * VSIP_IMPL_PI * k * n / len);
+    wt.put( n, sum.real() );
+  }
+  wt /= wt.get(0);
+
+  Vector<scalar_f> ref(len);
+  ref = freqswap(wt);
+
+  const_Vector<scalar_f> v = cheby(len, ripple);
+  for ( index_type n = 0; n < len; ++n )
+    test_assert( std::abs(v.get(n) - ref.get(n)) < 1e-5 );
+}
+
+
+
+// Check that each request for a cached window gets its own block, and
+// that windows remain correct when the cache releases them.
+
+void
+test_cache()
+{
+  const_Vector<scalar_f> v1 = hanning(1000);
+  const_Vector<scalar_f> v2 = hanning(1000);
+  test_assert( &v1.block() != &v2.block() );
+  test_window( v2, Hanning_ref() );
+
+  const_Vector<scalar_f> v3 = kaiser(1000, 3.5);
+  const_Vector<scalar_f> v4 = kaiser(1000, 4.5);
+  test_assert( &v3.block() != &v4.block() );
+  test_window( v3, Kaiser_ref(3.5) );
+  test_window( v4, Kaiser_ref(4.5) );
+
+  for ( length_type len = 2; len < 4000; len += 97 )
+    test_window( blackman(len * 13), Blackman_ref() );
+
+  test_window( v1, Hanning_ref() );
+  test_window( hanning(1000), Hanning_ref() );
+}
+
+
+
+#if VSIP_IMPL_HAVE_THREAD_POOL
+// Request windows from the tasks of the worker pool.
+
+void
+window_task(void*, index_type i)
+{
+  length_type len = 500 + 7 * (i % 5);
+  if (i % 2)
+    test_window( hanning(len), Hanning_ref() );
+  else
+    test_window( kaiser(len, 3.5), Kaiser_ref(3.5) );
+}
+
+void
+test_cache_threads()
+{
+  impl::threads::Thread_pool* pool = impl::threads::Thread_pool::instance();
+  for ( int iter = 0; iter < 4; ++iter )
+    pool->parallel_for(window_task, 0, 64);
+}
+#endif
+
+
+
 int
 main(int argc, char** argv)
 {
@@ -157,5 +305,26 @@ main(int argc, char** argv)
       test_assert( equal( v.get(n), testvec_kaiser[n] ) );
   }
 
+  // Large windows
+  test_window( blackman(10001), Blackman_ref() );
+  test_window( hanning(10001), Hanning_ref() );
+  test_window( kaiser(10001, 6.0), Kaiser_ref(6.0) );
+  test_window( kaiser(4096, 2.0), Kaiser_ref(2.0) );
+
+#if defined(VSIP_IMPL_FFT_USE_FLOAT)
+#  if TEST_NON_POWER_OF_2
+  test_cheby(2, 60.0);
+  test_cheby(7, 40.0);
+  test_cheby(100, 80.0);
+  test_cheby(257, 60.0);
+#  endif
+  test_cheby(256, 100.0);
+#endif
+
+  test_cache();
+#if VSIP_IMPL_HAVE_THREAD_POOL
+  test_cache_threads();
+#endif
+
   return EXIT_SUCCESS;
 }